@@ -28,11 +28,12 @@ int main(int argc, char **argv) {
   int c = 0;
   int nodeNum = 0;
   std::string configFileName;
+  std::string storageEngine = "mvcc";
   std::random_device rd;
   std::mt19937 gen(rd());
   std::uniform_int_distribution<> dis(10000, 29999);
   unsigned short startPort = dis(gen);
-  while ((c = getopt(argc, argv, "n:f:")) != -1) {
+  while ((c = getopt(argc, argv, "n:f:e:")) != -1) {
     switch (c) {
       case 'n':
         nodeNum = atoi(optarg);
@@ -40,6 +41,9 @@ int main(int argc, char **argv) {
       case 'f':
         configFileName = optarg;
         break;
+      case 'e':
+        storageEngine = optarg;
+        break;
       default:
         ShowArgsHelp();
         exit(EXIT_FAILURE);
@@ -63,7 +67,7 @@ int main(int argc, char **argv) {
       // 如果是子进程
       // 子进程的代码
 
-      auto kvServer = new KvServer(i, 500, configFileName, port);
+      auto kvServer = new KvServer(i, 500, configFileName, port, storageEngine);
       pause();  // 子进程进入等待状态，不会执行 return 语句
     } else if (pid > 0) {
       // 如果是父进程
@@ -79,4 +83,4 @@ int main(int argc, char **argv) {
   return 0;
 }
 
-void ShowArgsHelp() { std::cout << "format: command -n <nodeNum> -f <configFileName>" << std::endl; }
+void ShowArgsHelp() { std::cout << "format: command -n <nodeNum> -f <configFileName> [-e mvcc|skiplist|art|hash|btree|lsm|vlog[:<index>]|sharded[:<shard>]]" << std::endl; }
@@ -34,6 +34,104 @@ public:
         const raftKVRpcProctoc::PutAppendArgs& args,
         raftKVRpcProctoc::PutAppendReply* reply
     ) = 0;
+    
+    /**
+     * @brief 发送范围扫描请求（一页）
+     * @return true表示RPC成功，false表示RPC失败
+     */
+    virtual bool Scan(
+        const raftKVRpcProctoc::ScanArgs& args,
+        raftKVRpcProctoc::ScanReply* reply
+    ) = 0;
+    
+    /**
+     * @brief 发送前缀扫描请求（一页）
+     * @return true表示RPC成功，false表示RPC失败
+     */
+    virtual bool PrefixScan(
+        const raftKVRpcProctoc::PrefixScanArgs& args,
+        raftKVRpcProctoc::ScanReply* reply
+    ) = 0;
+    
+    /**
+     * @brief 发送批量读请求
+     * @return true表示RPC成功，false表示RPC失败
+     */
+    virtual bool MultiGet(
+        const raftKVRpcProctoc::MultiGetArgs& args,
+        raftKVRpcProctoc::MultiGetReply* reply
+    ) = 0;
+    
+    /**
+     * @brief 发送批量写请求
+     * @return true表示RPC成功，false表示RPC失败
+     */
+    virtual bool BatchWrite(
+        const raftKVRpcProctoc::BatchWriteArgs& args,
+        raftKVRpcProctoc::BatchWriteReply* reply
+    ) = 0;
+    
+    /**
+     * @brief 发送条件事务请求
+     * @return true表示RPC成功，false表示RPC失败
+     */
+    virtual bool Txn(
+        const raftKVRpcProctoc::TxnArgs& args,
+        raftKVRpcProctoc::TxnReply* reply
+    ) = 0;
+    
+    /**
+     * @brief 发送Delete请求
+     * @return true表示RPC成功，false表示RPC失败
+     */
+    virtual bool Delete(
+        const raftKVRpcProctoc::DeleteArgs& args,
+        raftKVRpcProctoc::DeleteReply* reply
+    ) = 0;
+    
+    /**
+     * @brief 发送DeleteRange请求
+     * @return true表示RPC成功，false表示RPC失败
+     */
+    virtual bool DeleteRange(
+        const raftKVRpcProctoc::DeleteRangeArgs& args,
+        raftKVRpcProctoc::DeleteReply* reply
+    ) = 0;
+    
+    /**
+     * @brief 发送Watch长轮询请求
+     * @return true表示RPC成功，false表示RPC失败
+     */
+    virtual bool Watch(
+        const raftKVRpcProctoc::WatchArgs& args,
+        raftKVRpcProctoc::WatchReply* reply
+    ) = 0;
+    
+    virtual bool CancelWatch(
+        const raftKVRpcProctoc::CancelWatchArgs& args,
+        raftKVRpcProctoc::CancelWatchReply* reply
+    ) = 0;
+    
+    /**
+     * @brief 注册客户端会话，需要发给leader
+     */
+    virtual bool RegisterSession(
+        const raftKVRpcProctoc::RegisterSessionArgs& args,
+        raftKVRpcProctoc::RegisterSessionReply* reply
+    ) = 0;
+    
+    /**
+     * @brief 导出已提交的日志（CDC），任意节点都可以处理
+     */
+    virtual bool ExportLog(
+        const raftKVRpcProctoc::ExportLogArgs& args,
+        raftKVRpcProctoc::ExportLogReply* reply
+    ) = 0;
+    
+    virtual bool CommitCdcCheckpoint(
+        const raftKVRpcProctoc::CommitCdcCheckpointArgs& args,
+        raftKVRpcProctoc::CommitCdcCheckpointReply* reply
+    ) = 0;
 };
 
 #endif  // IKV_RPC_CLIENT_H
@@ -1,7 +1,49 @@
 #ifndef ISTORAGE_ENGINE_H
 #define ISTORAGE_ENGINE_H
 
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <ostream>
 #include <string>
+#include <vector>
+
+/**
+ * @brief 固定在某一时刻的只读视图，多次读取（例如范围扫描的各个分页）看到同一份数据
+ */
+class IReadView {
+public:
+    virtual ~IReadView() = default;
+    
+    /**
+     * @brief 视图对应的已应用日志索引
+     */
+    virtual int64_t Index() const = 0;
+    
+    virtual bool Get(const std::string& key, std::string* value) const = 0;
+    
+    /**
+     * @brief key在视图中最近一次写入的版本号，不存在时为0
+     */
+    virtual int64_t Version(const std::string& key) const = 0;
+    
+    /**
+     * @brief 从第一个不小于start的键开始按键升序访问，visitor返回false时提前结束
+     */
+    virtual void Scan(const std::string& start,
+                      const std::function<bool(const std::string&, const std::string&)>& visitor) const = 0;
+    
+    /**
+     * @brief 导出视图中的全部数据，格式与引擎的Serialize()相同；快照据此在apply线程之外生成
+     */
+    virtual void SerializeTo(std::ostream& os) const = 0;
+    
+    /**
+     * @brief 按SerializeTo输出中键的顺序给出各键的版本号
+     * @return false表示引擎不记录版本
+     */
+    virtual bool CollectVersions(std::vector<int64_t>* out) const = 0;
+};
 
 /**
  * @brief 存储引擎接口 - 抽象KV存储操作
@@ -44,6 +86,25 @@ public:
      */
     virtual void Delete(const std::string& key) = 0;
     
+    /**
+     * @brief 查询键最近一次写入的版本号（多版本引擎中是写入时的日志索引）
+     * @param version 输出参数，键不存在时为0
+     * @return false表示引擎不记录版本
+     */
+    virtual bool GetVersion(const std::string& key, int64_t* version) {
+        return false;
+    }
+    
+    /**
+     * @brief 有序遍历：从第一个不小于start的键开始按键升序访问
+     * 遍历期间看到的是一致的数据（持锁或固定在某个版本上），visitor返回false时提前结束。
+     * 不保证有序的引擎（hash）需要先排序，代价与数据量成正比
+     * @param start 起始键（包含），空串表示从头开始
+     * @param visitor 参数为键和值，返回是否继续
+     */
+    virtual void Scan(const std::string& start,
+                      const std::function<bool(const std::string&, const std::string&)>& visitor) = 0;
+    
     /**
      * @brief 序列化存储引擎的所有数据
      * @return 序列化后的字符串
@@ -51,7 +112,14 @@ public:
     virtual std::string Serialize() = 0;
     
     /**
-     * @brief 反序列化并恢复数据
+     * @brief 将所有数据流式写出，内容与Serialize()相同
+     * 默认实现先生成完整字符串；能边遍历边输出的引擎可以覆盖，省掉一次整库拷贝
+     * @param os 输出流
+     */
+    virtual void SerializeTo(std::ostream& os) { os << Serialize(); }
+    
+    /**
+     * @brief 反序列化并恢复数据，替换引擎中原有的全部数据
      * @param data 序列化的数据
      */
     virtual void Deserialize(const std::string& data) = 0;
@@ -66,6 +134,51 @@ public:
      * @brief 清空所有数据
      */
     virtual void Clear() = 0;
+    
+    // ==================== 按日志应用（可选能力，默认实现适用于单版本引擎） ====================
+    
+    /**
+     * @brief 开始应用索引为index的日志，到FinishApply为止的写入都属于这条日志
+     * 多版本引擎以index作为这些写入的版本号，FinishApply之后才对读者可见；单版本引擎写入立即可见，不需要处理
+     * @return false表示index不在引擎已应用的索引之后（重复交付或早于已安装的快照），引擎不变，调用方跳过这条日志
+     */
+    virtual bool BeginApply(int64_t index) { return true; }
+    virtual void FinishApply(int64_t index) {}
+    
+    /**
+     * @brief 在BeginApply/FinishApply之间进入并发写入区间：到EndParallelWrites为止，
+     * 写入可能来自多个线程，但同一个key只由一个线程写。每次操作都自己加锁的引擎不需要处理
+     */
+    virtual void BeginParallelWrites(int64_t index) {}
+    virtual void EndParallelWrites() {}
+    
+    /**
+     * @brief 在最新的已应用数据上打开读视图，读视图不阻塞写入
+     * @return 引擎不支持读视图时返回nullptr，调用方直接读引擎
+     */
+    virtual std::shared_ptr<IReadView> OpenView() { return nullptr; }
+    
+    /**
+     * @brief 在指定索引上重新打开读视图
+     * @return 该索引的数据已经回收或者引擎不支持时返回nullptr
+     */
+    virtual std::shared_ptr<IReadView> OpenView(int64_t index) { return nullptr; }
+    
+    /**
+     * @brief 按Serialize()输出中键的顺序给出各键的版本号，随快照保存后传给Install
+     * @return false表示引擎不记录版本
+     */
+    virtual bool CollectVersions(std::vector<int64_t>* out) { return false; }
+    
+    /**
+     * @brief 安装索引为index的快照，替换引擎中的全部数据
+     * @param versions CollectVersions的输出，没有时为nullptr
+     * @return false表示快照早于引擎已应用的索引，没有安装
+     */
+    virtual bool Install(const std::string& data, int64_t index, const std::vector<int64_t>* versions) {
+        Deserialize(data);
+        return true;
+    }
 };
 
 #endif  // ISTORAGE_ENGINE_H
@@ -0,0 +1,268 @@
+#ifndef MPSC_RING_H
+#define MPSC_RING_H
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <atomic>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief 有界无锁多生产者单消费者环形队列，用于 raft 向 KvServer 交付 ApplyMsg
+ *
+ * 和 LockQueue 相比：
+ * 1. Push 不拿锁：生产者用 CAS 抢一个位置，写完后发布该槽位的序号（Vyukov 有界队列），消费者按序号判断槽位是否可读
+ * 2. 只移动不拷贝：Push 接收右值，Pop/PopBatch 把元素移出槽位，ApplyMsg 里的命令和快照不再整段复制
+ * 3. PushBatch/PopBatch 成批交付：applierTicker 一次推一批，apply 线程一次取走所有已就绪的元素，
+ *    整批只做一次唤醒检查
+ * 4. 等待用 futex：消费者在队列空、生产者在队列满时睡在各自的事件计数上；消费者睡着后只有第一个入队的生产者
+ *    做 FUTEX_WAKE，生产者睡着时消费者腾出位置才唤醒，不等待时的 Push/Pop 完全没有系统调用
+ *
+ * 容量向上取整到 2 的幂（至少为 2）。只允许一个线程调用 Pop/TryPop/PopBatch，Push/TryPush/PushBatch 可以多线程并发调用。
+ */
+template <typename T>
+class MpscRing {
+ public:
+  explicit MpscRing(size_t capacity) : m_capacity(roundUpPow2(capacity)), m_mask(m_capacity - 1) {
+    if (capacity == 0) {
+      throw std::invalid_argument("MpscRing capacity must be positive");
+    }
+    m_slots.reset(new Slot[m_capacity]);
+    for (size_t i = 0; i < m_capacity; ++i) {
+      m_slots[i].seq.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  ~MpscRing() {
+    T item;
+    while (TryPop(&item)) {
+    }
+  }
+
+  MpscRing(const MpscRing &) = delete;
+  MpscRing &operator=(const MpscRing &) = delete;
+
+  /**
+   * @brief 入队，队列满时阻塞到消费者腾出位置
+   */
+  void Push(T &&item) {
+    while (!TryPush(std::move(item))) {
+      waitNotFull();
+    }
+  }
+
+  /**
+   * @brief 不阻塞地入队，队列满时返回 false，item 保持原样
+   */
+  bool TryPush(T &&item) {
+    if (!publish(std::move(item))) {
+      return false;
+    }
+    notifyConsumer();
+    return true;
+  }
+
+  /**
+   * @brief 按顺序入队一批元素，队列满时阻塞；整批只做一次唤醒检查（中途满了先唤醒消费者再等），
+   * 单个生产者连续交付时不必每条都付一次内存屏障和可能的 FUTEX_WAKE
+   */
+  void PushBatch(std::vector<T> &&items) {
+    for (auto &item : items) {
+      while (!publish(std::move(item))) {
+        notifyConsumer();
+        waitNotFull();
+      }
+    }
+    notifyConsumer();
+    items.clear();
+  }
+
+  /**
+   * @brief 出队，队列空时阻塞
+   */
+  T Pop() {
+    T item;
+    while (!TryPop(&item)) {
+      waitNotEmpty();
+    }
+    return item;
+  }
+
+  /**
+   * @brief 不阻塞地出队，队列空时返回 false
+   */
+  bool TryPop(T *item) {
+    size_t pos = m_head.load(std::memory_order_relaxed);
+    Slot &slot = m_slots[pos & m_mask];
+    if (slot.seq.load(std::memory_order_acquire) != pos + 1) {
+      return false;
+    }
+    T *stored = std::launder(reinterpret_cast<T *>(slot.storage));
+    *item = std::move(*stored);
+    stored->~T();
+    slot.seq.store(pos + m_capacity, std::memory_order_release);
+    m_head.store(pos + 1, std::memory_order_relaxed);
+    wakeProducers();
+    return true;
+  }
+
+  /**
+   * @brief 取走最多 max 个已就绪的元素追加到 *out，队列空时阻塞到至少有一个
+   * @return 取到的个数
+   */
+  size_t PopBatch(std::vector<T> *out, size_t max) {
+    while (true) {
+      size_t pos = m_head.load(std::memory_order_relaxed);
+      size_t taken = 0;
+      while (taken < max) {
+        Slot &slot = m_slots[(pos + taken) & m_mask];
+        if (slot.seq.load(std::memory_order_acquire) != pos + taken + 1) {
+          break;
+        }
+        T *stored = std::launder(reinterpret_cast<T *>(slot.storage));
+        out->push_back(std::move(*stored));
+        stored->~T();
+        slot.seq.store(pos + taken + m_capacity, std::memory_order_release);
+        ++taken;
+      }
+      if (taken > 0) {
+        m_head.store(pos + taken, std::memory_order_relaxed);
+        wakeProducers();
+        return taken;
+      }
+      waitNotEmpty();
+    }
+  }
+
+  // 队列中的元素个数（近似值：包含生产者已经占位、还没写完的元素）
+  size_t Size() const {
+    size_t head = m_head.load(std::memory_order_relaxed);
+    size_t tail = m_tail.load(std::memory_order_relaxed);
+    return tail > head ? tail - head : 0;
+  }
+
+  size_t Capacity() const { return m_capacity; }
+
+ private:
+  struct Slot {
+    std::atomic<size_t> seq;  // == 位置：可写；== 位置 + 1：可读；其余：还是上一轮/下一轮的
+    alignas(T) unsigned char storage[sizeof(T)];
+  };
+
+  // 至少 2 个槽位：只有 1 个槽位时"已发布待读"的序号（位置 + 1）和下一轮"可写"的序号相同，会覆盖未读的元素
+  static size_t roundUpPow2(size_t n) {
+    size_t capacity = 2;
+    while (capacity < n) {
+      capacity <<= 1;
+    }
+    return capacity;
+  }
+
+  static void futexWait(std::atomic<uint32_t> *word, uint32_t expected) {
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "futex word must be 32 bits");
+    // 计数已经变了（对方在我们取 key 之后唤醒过）时立即返回 EAGAIN，不会丢唤醒；被信号打断同样返回，由调用方重新检查
+    syscall(SYS_futex, reinterpret_cast<uint32_t *>(word), FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+  }
+
+  static void futexWake(std::atomic<uint32_t> *word, int count) {
+    syscall(SYS_futex, reinterpret_cast<uint32_t *>(word), FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+  }
+
+  // 抢一个位置、放入元素并发布，不唤醒消费者；队列满时返回 false
+  bool publish(T &&item) {
+    size_t pos = m_tail.load(std::memory_order_relaxed);
+    Slot *slot;
+    while (true) {
+      slot = &m_slots[pos & m_mask];
+      size_t seq = slot->seq.load(std::memory_order_acquire);
+      intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+      if (diff == 0) {
+        if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;  // 这个槽位上一轮的元素还没被取走：队列满
+      } else {
+        pos = m_tail.load(std::memory_order_relaxed);
+      }
+    }
+    new (slot->storage) T(std::move(item));
+    slot->seq.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  // 消费者睡着时唤醒它。exchange 保证一次睡眠只有一个生产者做 FUTEX_WAKE（队列由空变非空的那一次），
+  // 其余生产者看到标志已被清掉就直接返回
+  void notifyConsumer() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_consumerWaiting.load(std::memory_order_relaxed) &&
+        m_consumerWaiting.exchange(false, std::memory_order_relaxed)) {
+      m_notEmptyEpoch.fetch_add(1, std::memory_order_release);
+      futexWake(&m_notEmptyEpoch, 1);
+    }
+  }
+
+  void waitNotFull() {
+    uint32_t key = m_notFullEpoch.load(std::memory_order_acquire);
+    m_producersWaiting.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    // 登记等待之后再看一次：消费者在我们登记之前腾出的位置不会再来唤醒
+    if (full()) {
+      futexWait(&m_notFullEpoch, key);
+    }
+    m_producersWaiting.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  // 和 publish 判断满的条件一致；槽位已被别的生产者占用（tail 读旧了）不算满，回去重试
+  bool full() const {
+    size_t pos = m_tail.load(std::memory_order_relaxed);
+    size_t seq = m_slots[pos & m_mask].seq.load(std::memory_order_acquire);
+    return static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos) < 0;
+  }
+
+  bool empty() const {
+    size_t pos = m_head.load(std::memory_order_relaxed);
+    return m_slots[pos & m_mask].seq.load(std::memory_order_acquire) != pos + 1;
+  }
+
+  void waitNotEmpty() {
+    uint32_t key = m_notEmptyEpoch.load(std::memory_order_acquire);
+    m_consumerWaiting.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (empty()) {
+      futexWait(&m_notEmptyEpoch, key);
+    }
+    // 被唤醒时生产者已经清掉了标志；没睡（看到了新元素）或者被信号打断时自己清掉
+    m_consumerWaiting.store(false, std::memory_order_relaxed);
+  }
+
+  void wakeProducers() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_producersWaiting.load(std::memory_order_relaxed) > 0) {
+      m_notFullEpoch.fetch_add(1, std::memory_order_release);
+      futexWake(&m_notFullEpoch, INT_MAX);
+    }
+  }
+
+  const size_t m_capacity;
+  const size_t m_mask;
+  std::unique_ptr<Slot[]> m_slots;
+
+  // 生产者和消费者各自频繁写的变量分开放在不同缓存行
+  alignas(64) std::atomic<size_t> m_tail{0};
+  alignas(64) std::atomic<size_t> m_head{0};
+  alignas(64) std::atomic<uint32_t> m_notEmptyEpoch{0};
+  std::atomic<bool> m_consumerWaiting{false};
+  alignas(64) std::atomic<uint32_t> m_notFullEpoch{0};
+  std::atomic<uint32_t> m_producersWaiting{0};
+};
+
+#endif  // MPSC_RING_H
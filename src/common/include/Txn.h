@@ -0,0 +1,94 @@
+#ifndef TXN_H
+#define TXN_H
+
+#include <boost/serialization/access.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief 条件事务（compare + then/else）的日志表示，随 Op 一起进入 raft 日志
+ *
+ * 枚举取值与 kvServerRPC.proto 中的 TxnCompare / TxnOp 保持一致，RPC 层直接转换。
+ */
+struct TxnCompare {
+  enum Target { kValue = 0, kExists = 1, kVersion = 2 };
+  enum Result { kEqual = 0, kNotEqual = 1, kGreater = 2, kLess = 3 };
+
+  std::string Key;
+  int Target = kValue;
+  int Result = kEqual;
+  std::string Value;    // kValue：与当前值按字节比较；key 不存在时比较不成立
+  bool Exists = false;  // kExists：与 key 是否存在比较，只支持 kEqual / kNotEqual
+  int64_t Version = 0;  // kVersion：与 key 最近一次写入的 raft 索引比较，不存在的 key 版本为 0
+
+  template <class Archive>
+  void serialize(Archive &ar, const unsigned int version) {
+    ar &Key;
+    ar &Target;
+    ar &Result;
+    ar &Value;
+    ar &Exists;
+    ar &Version;
+  }
+};
+
+struct TxnOp {
+  enum Type { kGet = 0, kPut = 1, kAppend = 2, kDelete = 3, kIncrement = 4, kAppendIfAbsent = 5 };
+
+  int Op = kGet;
+  std::string Key;
+  std::string Value;  // kPut / kAppend / kAppendIfAbsent 的参数
+  int64_t Delta = 0;  // kIncrement 的增量
+
+  template <class Archive>
+  void serialize(Archive &ar, const unsigned int version) {
+    ar &Op;
+    ar &Key;
+    ar &Value;
+    ar &Delta;
+  }
+};
+
+struct TxnRequest {
+  std::vector<TxnCompare> Compares;  // 全部成立时执行 Success，否则执行 Failure
+  std::vector<TxnOp> Success;
+  std::vector<TxnOp> Failure;
+
+  template <class Archive>
+  void serialize(Archive &ar, const unsigned int version) {
+    ar &Compares;
+    ar &Success;
+    ar &Failure;
+  }
+};
+
+struct TxnOpResult {
+  bool Exist = false;    // 操作前 key 是否存在
+  bool Applied = false;  // 写操作是否真的改变了数据（kAppendIfAbsent 已包含时、kDelete 不存在时为 false）
+  std::string Value;     // kGet / kIncrement 返回操作后的值
+
+  template <class Archive>
+  void serialize(Archive &ar, const unsigned int version) {
+    ar &Exist;
+    ar &Applied;
+    ar &Value;
+  }
+};
+
+struct TxnResponse {
+  bool Succeeded = false;  // 比较是否全部成立（决定执行了哪一组操作）
+  std::string Err;         // 非空表示事务无效（例如对非整数做 kIncrement），没有任何写入生效
+  std::vector<TxnOpResult> Results;
+
+  template <class Archive>
+  void serialize(Archive &ar, const unsigned int version) {
+    ar &Succeeded;
+    ar &Err;
+    ar &Results;
+  }
+};
+
+#endif  // TXN_H
@@ -16,6 +16,12 @@ const int maxRandomizedElectionTime = 500 * debugMul;  // ms
 
 const int CONSENSUS_TIMEOUT = 500 * debugMul;  // ms
 
+// 背压：leader上未提交日志的条数和命令字节数上限，超过时Start拒绝新的命令
+const int MaxUncommittedEntries = 4096;
+const long long MaxUncommittedBytes = 64LL << 20;
+// raft交给kvServer的apply队列容量，队列满时已提交的日志留在raft里，积压到这么多条时Start同样拒绝
+const int ApplyQueueCapacity = 4096;
+
 // 协程相关设置
 
 const int FIBER_THREAD_NUM = 1;              // 协程库中线程池大小
@@ -8,6 +8,8 @@
 #include <boost/archive/text_iarchive.hpp>
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/serialization/access.hpp>
+#include <boost/serialization/vector.hpp>
+#include <boost/serialization/version.hpp>
 #include <condition_variable>  // pthread_condition_t
 #include <functional>
 #include <iostream>
@@ -16,6 +18,8 @@
 #include <random>
 #include <sstream>
 #include <thread>
+#include <vector>
+#include "Txn.h"
 #include "config.h"
 
 template <class F>
@@ -130,12 +134,20 @@ class Op {
   // Your definitions here.
   // Field names must start with capital letters,
   // otherwise RPC will break.
-  std::string Operation;  // "Get" "Put" "Append"
+  // "Get" "Put" "Append" "Batch" "Txn"
+  // "Coalesced"：服务端把多个客户端的Put/Append合并成的一条日志，子操作各自判重
+  // "Scan" "MultiGet"：读屏障，apply时不修改数据
+  std::string Operation;
   std::string Key;
   std::string Value;
   std::string ClientId;  //客户端号码
   int RequestId;         //客户端号码请求的Request的序列号，为了保证线性一致性
                          // IfDuplicate bool // Duplicate command can't be applied twice , but only for PUT and APPEND
+  std::vector<Op> Batch;  // "Batch"的子操作，按顺序应用，只使用Operation/Key/Value（版本1新增）；
+                          // "Coalesced"的子操作是完整的请求，带各自的ClientId/RequestId/TtlMs
+  TxnRequest Txn;         // "Txn"的比较条件和两组操作（版本2新增）
+  int64_t TimestampMs = 0;  // leader提交时的系统时间（毫秒），状态机的逻辑时钟取已应用日志中的最大值（版本3新增）
+  int64_t TtlMs = 0;        // "Put"的存活时间，0表示不过期；"Batch"的子操作同样适用（版本3新增）
 
  public:
   // todo
@@ -176,14 +188,34 @@ class Op {
     ar& Value;
     ar& ClientId;
     ar& RequestId;
+    // 旧版本的日志（升级前持久化的）没有后面新增的字段
+    if (version >= 1) {
+      ar& Batch;
+    }
+    if (version >= 2) {
+      ar& Txn;
+    }
+    if (version >= 3) {
+      ar& TimestampMs;
+      ar& TtlMs;
+    }
   }
 };
 
+BOOST_CLASS_VERSION(Op, 3)
+
 ///////////////////////////////////////////////kvserver reply err to clerk
 
 const std::string OK = "OK";
 const std::string ErrNoKey = "ErrNoKey";
 const std::string ErrWrongLeader = "ErrWrongLeader";
+const std::string ErrScanExpired = "ErrScanExpired";              // 翻页令牌对应的读视图已失效，需要从头重新扫描
+const std::string ErrInvalidTxn = "ErrInvalidTxn";                // 事务执行出错（如对非整数自增），没有任何写入生效
+const std::string ErrWatchResync = "ErrWatchResync";              // watch的起点已不在历史中或者watcher跟不上，需要重新读取后再watch
+const std::string ErrWatchNotFound = "ErrWatchNotFound";          // watcher不存在（过期、被挤掉或者换了节点）
+const std::string ErrSessionExpired = "ErrSessionExpired";        // 会话已过期或被淘汰，需要重新注册会话
+const std::string ErrExportUnsupported = "ErrExportUnsupported";  // 存储引擎的快照格式不支持按kv导出
+const std::string ErrBusy = "ErrBusy";                            // 节点过载，请求没有进入raft，按RetryAfterMs退避后重试
 
 ////////////////////////////////////获取可用端口
 
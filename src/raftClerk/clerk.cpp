@@ -7,8 +7,21 @@
 
 #include "util.h"
 
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <random>
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <vector>
+
+namespace {
+
+constexpr int kCdcIdlePollMs = 100;  // 日志导出追上之后，隔多久再拉取
+
+}  // namespace
+
 std::string Clerk::Get(std::string key) {
   m_requestId++;
   auto requestId = m_requestId;
@@ -24,6 +37,9 @@ std::string Clerk::Get(std::string key) {
     
     raftKVRpcProctoc::GetReply reply;
     bool ok = m_rpcClients[server]->Get(args, &reply);
+    if (ok && BackOffIfBusy(reply)) {
+      continue;
+    }
     
     if (!ok || reply.err() == ErrWrongLeader) {
       // 标记失败，负载均衡器会选择下一个
@@ -44,9 +60,10 @@ std::string Clerk::Get(std::string key) {
   return "";
 }
 
-void Clerk::PutAppend(std::string key, std::string value, std::string op) {
+void Clerk::PutAppend(std::string key, std::string value, std::string op, int64_t ttlMs) {
   m_requestId++;
   auto requestId = m_requestId;
+  bool mayHaveApplied = false;  // 是否有结果未知的尝试（RPC失败、超时）
   
   while (true) {
     // ==================== 新架构：使用负载均衡器选择服务器 ====================
@@ -58,9 +75,13 @@ void Clerk::PutAppend(std::string key, std::string value, std::string op) {
     args.set_op(op);
     args.set_clientid(m_clientId);
     args.set_requestid(requestId);
+    args.set_ttlms(ttlMs);
     
     raftKVRpcProctoc::PutAppendReply reply;
     bool ok = m_rpcClients[server]->PutAppend(args, &reply);
+    if (ok && BackOffIfBusy(reply)) {
+      continue;
+    }
     
     if (!ok || reply.err() == ErrWrongLeader) {
       DPrintf("【Clerk::PutAppend】原以为的leader：{%d}请求失败，向新leader重试，操作：{%s}", server, op.c_str());
@@ -70,10 +91,17 @@ void Clerk::PutAppend(std::string key, std::string value, std::string op) {
       if (reply.err() == ErrWrongLeader) {
         DPrintf("重试原因：非leader");
       }
+      mayHaveApplied = true;
       m_loadBalancer->MarkFailure(server);
       continue;
     }
     
+    if (reply.err() == ErrSessionExpired) {
+      RenewSession(&args, mayHaveApplied, "PutAppend");
+      requestId = args.requestid();
+      continue;
+    }
+
     if (reply.err() == OK) {
       m_loadBalancer->MarkSuccess(server);
       return;
@@ -81,8 +109,394 @@ void Clerk::PutAppend(std::string key, std::string value, std::string op) {
   }
 }
 
+template <typename FetchPage>
+std::vector<std::pair<std::string, std::string>> Clerk::ScanPages(size_t limit, FetchPage &&fetchPage) {
+  std::vector<std::pair<std::string, std::string>> result;
+  std::string pageToken;
+  int server = m_loadBalancer->SelectServer();
+  while (true) {
+    int pageLimit = 0;  // 0 使用服务端默认页大小
+    if (limit > 0) {
+      pageLimit = static_cast<int>(std::min<size_t>(limit - result.size(), INT_MAX));
+    }
+    raftKVRpcProctoc::ScanReply reply;
+    bool ok = fetchPage(server, pageToken, pageLimit, &reply);
+    if (ok && BackOffIfBusy(reply)) {
+      continue;
+    }
+
+    if (!ok || reply.err() == ErrWrongLeader) {
+      m_loadBalancer->MarkFailure(server);
+      if (!pageToken.empty()) {
+        // 读视图保存在服务第一页的节点上，换节点后只能从头开始
+        result.clear();
+        pageToken.clear();
+      }
+      server = m_loadBalancer->SelectServer();
+      continue;
+    }
+    if (reply.err() == ErrScanExpired) {
+      DPrintf("【Clerk::Scan】读点已失效，从头重新扫描");
+      result.clear();
+      pageToken.clear();
+      continue;
+    }
+    if (reply.err() != OK) {
+      continue;
+    }
+    m_loadBalancer->MarkSuccess(server);
+    for (const auto &kv : reply.kvs()) {
+      result.emplace_back(kv.key(), kv.value());
+    }
+    if (reply.nextpagetoken().empty() || (limit > 0 && result.size() >= limit)) {
+      return result;
+    }
+    // 后续分页发给同一个节点，它持有这次扫描的读视图
+    pageToken = reply.nextpagetoken();
+  }
+}
+
+std::vector<std::pair<std::string, std::string>> Clerk::Scan(const std::string &start, const std::string &end,
+                                                             size_t limit) {
+  m_requestId++;
+  auto requestId = m_requestId;
+  return ScanPages(limit, [&](int server, const std::string &pageToken, int pageLimit,
+                              raftKVRpcProctoc::ScanReply *reply) {
+    raftKVRpcProctoc::ScanArgs args;
+    args.set_startkey(start);
+    args.set_endkey(end);
+    args.set_limit(pageLimit);
+    args.set_pagetoken(pageToken);
+    args.set_clientid(m_clientId);
+    args.set_requestid(requestId);
+    return m_rpcClients[server]->Scan(args, reply);
+  });
+}
+
+std::vector<std::pair<std::string, std::string>> Clerk::PrefixScan(const std::string &prefix, size_t limit) {
+  m_requestId++;
+  auto requestId = m_requestId;
+  return ScanPages(limit, [&](int server, const std::string &pageToken, int pageLimit,
+                              raftKVRpcProctoc::ScanReply *reply) {
+    raftKVRpcProctoc::PrefixScanArgs args;
+    args.set_prefix(prefix);
+    args.set_limit(pageLimit);
+    args.set_pagetoken(pageToken);
+    args.set_clientid(m_clientId);
+    args.set_requestid(requestId);
+    return m_rpcClients[server]->PrefixScan(args, reply);
+  });
+}
+
+std::vector<std::string> Clerk::MultiGet(const std::vector<std::string> &keys) {
+  m_requestId++;
+  raftKVRpcProctoc::MultiGetArgs args;
+  for (const auto &key : keys) {
+    args.add_keys(key);
+  }
+  args.set_clientid(m_clientId);
+  args.set_requestid(m_requestId);
+
+  while (true) {
+    int server = m_loadBalancer->SelectServer();
+    raftKVRpcProctoc::MultiGetReply reply;
+    bool ok = m_rpcClients[server]->MultiGet(args, &reply);
+    if (ok && BackOffIfBusy(reply)) {
+      continue;
+    }
+    if (!ok || reply.err() != OK) {
+      m_loadBalancer->MarkFailure(server);
+      continue;
+    }
+    m_loadBalancer->MarkSuccess(server);
+    std::vector<std::string> values;
+    values.reserve(reply.results_size());
+    for (auto &result : *reply.mutable_results()) {
+      values.push_back(result.exist() ? std::move(*result.mutable_value()) : std::string());
+    }
+    return values;
+  }
+}
+
+void Clerk::BatchWrite(const std::vector<WriteOp> &ops) {
+  m_requestId++;
+  raftKVRpcProctoc::BatchWriteArgs args;
+  for (const auto &op : ops) {
+    auto *write = args.add_ops();
+    write->set_op(op.op);
+    write->set_key(op.key);
+    write->set_value(op.value);
+    write->set_ttlms(op.ttlMs);
+  }
+  args.set_clientid(m_clientId);
+  args.set_requestid(m_requestId);
+  bool mayHaveApplied = false;
+
+  while (true) {
+    int server = m_loadBalancer->SelectServer();
+    raftKVRpcProctoc::BatchWriteReply reply;
+    bool ok = m_rpcClients[server]->BatchWrite(args, &reply);
+    if (ok && BackOffIfBusy(reply)) {
+      continue;
+    }
+    if (ok && reply.err() == ErrSessionExpired) {
+      RenewSession(&args, mayHaveApplied, "BatchWrite");
+      continue;
+    }
+    if (!ok || reply.err() != OK) {
+      DPrintf("【Clerk::BatchWrite】节点{%d}请求失败，向新leader重试，共{%d}条写入", server,
+              static_cast<int>(ops.size()));
+      mayHaveApplied = true;
+      m_loadBalancer->MarkFailure(server);
+      continue;
+    }
+    m_loadBalancer->MarkSuccess(server);
+    return;
+  }
+}
+
+template <typename Args>
+void Clerk::SendDelete(Args &args, const char *name,
+                       bool (IKvRpcClient::*call)(const Args &, raftKVRpcProctoc::DeleteReply *)) {
+  m_requestId++;
+  args.set_clientid(m_clientId);
+  args.set_requestid(m_requestId);
+  bool mayHaveApplied = false;
+  while (true) {
+    int server = m_loadBalancer->SelectServer();
+    raftKVRpcProctoc::DeleteReply reply;
+    bool ok = (m_rpcClients[server].get()->*call)(args, &reply);
+    if (ok && BackOffIfBusy(reply)) {
+      continue;
+    }
+    if (ok && reply.err() == ErrSessionExpired) {
+      RenewSession(&args, mayHaveApplied, name);
+      continue;
+    }
+    if (!ok || reply.err() != OK) {
+      DPrintf("【Clerk::%s】节点{%d}请求失败，向新leader重试", name, server);
+      mayHaveApplied = true;
+      m_loadBalancer->MarkFailure(server);
+      continue;
+    }
+    m_loadBalancer->MarkSuccess(server);
+    return;
+  }
+}
+
+void Clerk::Delete(const std::string &key) {
+  raftKVRpcProctoc::DeleteArgs args;
+  args.set_key(key);
+  SendDelete(args, "Delete", &IKvRpcClient::Delete);
+}
+
+void Clerk::DeleteRange(const std::string &start, const std::string &end) {
+  raftKVRpcProctoc::DeleteRangeArgs args;
+  args.set_startkey(start);
+  args.set_endkey(end);
+  SendDelete(args, "DeleteRange", &IKvRpcClient::DeleteRange);
+}
+
+Clerk::WatchResult Clerk::Watch(const std::string &key, bool prefix, int64_t startIndex,
+                                const std::function<bool(const raftKVRpcProctoc::WatchEvent &)> &onEvent) {
+  int64_t nextIndex = startIndex;
+  int64_t watchId = 0;
+  int server = m_loadBalancer->SelectServer();
+  while (true) {
+    raftKVRpcProctoc::WatchArgs args;
+    args.set_key(key);
+    args.set_prefix(prefix);
+    args.set_startindex(nextIndex);
+    args.set_watchid(watchId);
+    raftKVRpcProctoc::WatchReply reply;
+    bool ok = m_rpcClients[server]->Watch(args, &reply);
+    if (!ok) {
+      // 换一个节点，从已经收到的位置重新创建watcher
+      DPrintf("【Clerk::Watch】节点{%d}请求失败，换节点继续", server);
+      m_loadBalancer->MarkFailure(server);
+      server = m_loadBalancer->SelectServer();
+      watchId = 0;
+      continue;
+    }
+    if (BackOffIfBusy(reply)) {
+      continue;  // 没有登记，watcher 和 nextIndex 都不变
+    }
+    if (reply.err() == ErrWatchNotFound) {
+      watchId = 0;
+      continue;
+    }
+    if (reply.err() == ErrWatchResync) {
+      return WatchResult{true, reply.nextindex()};
+    }
+    watchId = reply.watchid();
+    for (const auto &event : reply.events()) {
+      if (!onEvent(event)) {
+        raftKVRpcProctoc::CancelWatchArgs cancelArgs;
+        cancelArgs.set_watchid(watchId);
+        raftKVRpcProctoc::CancelWatchReply cancelReply;
+        m_rpcClients[server]->CancelWatch(cancelArgs, &cancelReply);
+        return WatchResult{false, event.index() + 1};
+      }
+    }
+    nextIndex = reply.nextindex();
+  }
+}
+
+int64_t Clerk::ExportLog(const std::string &consumerId, int64_t fromIndex, const CdcHandler &handler) {
+  int64_t nextIndex = fromIndex;
+  int64_t snapshotIndex = 0;  // 正在回放的快照
+  std::string resumeKey;
+  int server = m_loadBalancer->SelectServer();
+  while (true) {
+    raftKVRpcProctoc::ExportLogArgs args;
+    args.set_consumerid(consumerId);
+    args.set_fromindex(nextIndex);
+    args.set_snapshotindex(snapshotIndex);
+    args.set_snapshotresumekey(resumeKey);
+    raftKVRpcProctoc::ExportLogReply reply;
+    bool ok = m_rpcClients[server]->ExportLog(args, &reply);
+    if (!ok || reply.err() != OK) {
+      DPrintf("【Clerk::ExportLog】节点{%d}请求失败，换节点继续", server);
+      m_loadBalancer->MarkFailure(server);
+      server = m_loadBalancer->SelectServer();
+      continue;
+    }
+    if (reply.snapshotindex() > 0) {
+      // 换了节点或者快照被更新时服务端从新快照的开头给出，这里重新开始回放
+      if (reply.snapshotindex() != snapshotIndex && handler.onSnapshotBegin) {
+        handler.onSnapshotBegin(reply.snapshotindex());
+      }
+      for (const auto &kv : reply.snapshotkvs()) {
+        handler.onSnapshotKv(kv.key(), kv.value());
+      }
+      if (reply.snapshotresumekey().empty()) {
+        snapshotIndex = 0;
+        resumeKey.clear();
+        nextIndex = reply.nextindex();
+      } else {
+        snapshotIndex = reply.snapshotindex();
+        resumeKey = reply.snapshotresumekey();
+      }
+      continue;
+    }
+    for (int i = 0; i < reply.entries_size(); ++i) {
+      const auto &entry = reply.entries(i);
+      if (!handler.onEntry(entry)) {
+        // 服务端合并提交的请求共用一个索引，停在中间时从这个索引重新开始，前面几项会再交付一次
+        bool sameIndexLeft = i + 1 < reply.entries_size() && reply.entries(i + 1).index() == entry.index();
+        return sameIndexLeft ? entry.index() : entry.index() + 1;
+      }
+    }
+    if (reply.nextindex() == nextIndex) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(kCdcIdlePollMs));
+    }
+    nextIndex = reply.nextindex();
+  }
+}
+
+int64_t Clerk::CommitCdcCheckpoint(const std::string &consumerId, int64_t index) {
+  if (consumerId.empty() || index <= 0) {
+    throw std::invalid_argument("CommitCdcCheckpoint: consumerId must be non-empty and index positive");
+  }
+  m_requestId++;
+  raftKVRpcProctoc::CommitCdcCheckpointArgs args;
+  args.set_consumerid(consumerId);
+  args.set_index(index);
+  args.set_clientid(m_clientId);
+  args.set_requestid(m_requestId);
+  while (true) {
+    int server = m_loadBalancer->SelectServer();
+    raftKVRpcProctoc::CommitCdcCheckpointReply reply;
+    bool ok = m_rpcClients[server]->CommitCdcCheckpoint(args, &reply);
+    if (ok && BackOffIfBusy(reply)) {
+      continue;
+    }
+    if (ok && reply.err() == ErrSessionExpired) {
+      // 检查点只前进，同一个检查点应用两次没有影响，总是可以重发
+      RenewSession(&args, false, "CommitCdcCheckpoint");
+      continue;
+    }
+    if (!ok || reply.err() != OK) {
+      m_loadBalancer->MarkFailure(server);
+      continue;
+    }
+    m_loadBalancer->MarkSuccess(server);
+    return reply.index();
+  }
+}
+
+raftKVRpcProctoc::TxnReply Clerk::Txn(raftKVRpcProctoc::TxnArgs args) {
+  m_requestId++;
+  args.set_clientid(m_clientId);
+  args.set_requestid(m_requestId);
+  bool mayHaveApplied = false;
+
+  while (true) {
+    int server = m_loadBalancer->SelectServer();
+    raftKVRpcProctoc::TxnReply reply;
+    bool ok = m_rpcClients[server]->Txn(args, &reply);
+    if (ok && BackOffIfBusy(reply)) {
+      continue;
+    }
+    if (ok && reply.err() == ErrSessionExpired) {
+      RenewSession(&args, mayHaveApplied, "Txn");
+      continue;
+    }
+    if (!ok || (reply.err() != OK && reply.err() != ErrInvalidTxn)) {
+      mayHaveApplied = true;
+      m_loadBalancer->MarkFailure(server);
+      continue;
+    }
+    m_loadBalancer->MarkSuccess(server);
+    return reply;
+  }
+}
+
+int64_t Clerk::Increment(const std::string &key, int64_t delta) {
+  raftKVRpcProctoc::TxnArgs args;
+  auto *op = args.add_success();
+  op->set_op(raftKVRpcProctoc::TxnOp::INCREMENT);
+  op->set_key(key);
+  op->set_delta(delta);
+  raftKVRpcProctoc::TxnReply reply = Txn(std::move(args));
+  if (reply.err() != OK) {
+    throw std::invalid_argument("Increment " + key + ": " + reply.txnerror());
+  }
+  return std::stoll(reply.results(0).value());
+}
+
+bool Clerk::CompareAndSwap(const std::string &key, const std::string &expected, const std::string &desired) {
+  raftKVRpcProctoc::TxnArgs args;
+  auto *cmp = args.add_compares();
+  cmp->set_key(key);
+  if (expected.empty()) {
+    cmp->set_target(raftKVRpcProctoc::TxnCompare::EXISTS);
+    cmp->set_exists(false);
+  } else {
+    cmp->set_target(raftKVRpcProctoc::TxnCompare::VALUE);
+    cmp->set_value(expected);
+  }
+  cmp->set_result(raftKVRpcProctoc::TxnCompare::EQUAL);
+  auto *op = args.add_success();
+  op->set_op(raftKVRpcProctoc::TxnOp::PUT);
+  op->set_key(key);
+  op->set_value(desired);
+  return Txn(std::move(args)).succeeded();
+}
+
+bool Clerk::AppendIfAbsent(const std::string &key, const std::string &value) {
+  raftKVRpcProctoc::TxnArgs args;
+  auto *op = args.add_success();
+  op->set_op(raftKVRpcProctoc::TxnOp::APPEND_IF_ABSENT);
+  op->set_key(key);
+  op->set_value(value);
+  return Txn(std::move(args)).results(0).applied();
+}
+
 void Clerk::Put(std::string key, std::string value) { PutAppend(key, value, "Put"); }
 
+void Clerk::PutWithTtl(std::string key, std::string value, int64_t ttlMs) { PutAppend(key, value, "Put", ttlMs); }
+
 void Clerk::Append(std::string key, std::string value) { PutAppend(key, value, "Append"); }
 //初始化客户端
 void Clerk::Init(std::string configFileName) {
@@ -116,6 +530,31 @@ void Clerk::Init(std::string configFileName) {
   
   // ==================== 新架构：创建负载均衡器 ====================
   m_loadBalancer = std::make_unique<RoundRobinLoadBalancer>(m_servers.size(), 0);
+
+  RegisterSession();
+}
+
+void Clerk::RegisterSession() {
+  raftKVRpcProctoc::RegisterSessionArgs args;
+  std::random_device rd;
+  args.set_nonce((static_cast<uint64_t>(rd()) << 32) | rd());
+  while (true) {
+    int server = m_loadBalancer->SelectServer();
+    raftKVRpcProctoc::RegisterSessionReply reply;
+    bool ok = m_rpcClients[server]->RegisterSession(args, &reply);
+    if (ok && BackOffIfBusy(reply)) {
+      continue;
+    }
+    if (!ok || reply.err() != OK) {
+      m_loadBalancer->MarkFailure(server);
+      continue;
+    }
+    m_loadBalancer->MarkSuccess(server);
+    m_clientId = reply.clientid();
+    m_requestId = 0;
+    DPrintf("【Clerk::RegisterSession】注册会话{%llu}", static_cast<unsigned long long>(reply.sessionid()));
+    return;
+  }
 }
 
 Clerk::Clerk() : m_clientId(Uuid()), m_requestId(0), m_recentLeaderId(0) {}
@@ -35,6 +35,90 @@ public:
             const_cast<raftKVRpcProctoc::PutAppendArgs*>(&args);
         return m_rpcUtil->PutAppend(argsPtr, reply);
     }
+    
+    bool Scan(
+        const raftKVRpcProctoc::ScanArgs& args,
+        raftKVRpcProctoc::ScanReply* reply
+    ) override {
+        return m_rpcUtil->Scan(const_cast<raftKVRpcProctoc::ScanArgs*>(&args), reply);
+    }
+    
+    bool PrefixScan(
+        const raftKVRpcProctoc::PrefixScanArgs& args,
+        raftKVRpcProctoc::ScanReply* reply
+    ) override {
+        return m_rpcUtil->PrefixScan(const_cast<raftKVRpcProctoc::PrefixScanArgs*>(&args), reply);
+    }
+    
+    bool MultiGet(
+        const raftKVRpcProctoc::MultiGetArgs& args,
+        raftKVRpcProctoc::MultiGetReply* reply
+    ) override {
+        return m_rpcUtil->MultiGet(const_cast<raftKVRpcProctoc::MultiGetArgs*>(&args), reply);
+    }
+    
+    bool BatchWrite(
+        const raftKVRpcProctoc::BatchWriteArgs& args,
+        raftKVRpcProctoc::BatchWriteReply* reply
+    ) override {
+        return m_rpcUtil->BatchWrite(const_cast<raftKVRpcProctoc::BatchWriteArgs*>(&args), reply);
+    }
+    
+    bool Txn(
+        const raftKVRpcProctoc::TxnArgs& args,
+        raftKVRpcProctoc::TxnReply* reply
+    ) override {
+        return m_rpcUtil->Txn(const_cast<raftKVRpcProctoc::TxnArgs*>(&args), reply);
+    }
+    
+    bool Delete(
+        const raftKVRpcProctoc::DeleteArgs& args,
+        raftKVRpcProctoc::DeleteReply* reply
+    ) override {
+        return m_rpcUtil->Delete(const_cast<raftKVRpcProctoc::DeleteArgs*>(&args), reply);
+    }
+    
+    bool DeleteRange(
+        const raftKVRpcProctoc::DeleteRangeArgs& args,
+        raftKVRpcProctoc::DeleteReply* reply
+    ) override {
+        return m_rpcUtil->DeleteRange(const_cast<raftKVRpcProctoc::DeleteRangeArgs*>(&args), reply);
+    }
+    
+    bool Watch(
+        const raftKVRpcProctoc::WatchArgs& args,
+        raftKVRpcProctoc::WatchReply* reply
+    ) override {
+        return m_rpcUtil->Watch(const_cast<raftKVRpcProctoc::WatchArgs*>(&args), reply);
+    }
+    
+    bool CancelWatch(
+        const raftKVRpcProctoc::CancelWatchArgs& args,
+        raftKVRpcProctoc::CancelWatchReply* reply
+    ) override {
+        return m_rpcUtil->CancelWatch(const_cast<raftKVRpcProctoc::CancelWatchArgs*>(&args), reply);
+    }
+    
+    bool RegisterSession(
+        const raftKVRpcProctoc::RegisterSessionArgs& args,
+        raftKVRpcProctoc::RegisterSessionReply* reply
+    ) override {
+        return m_rpcUtil->RegisterSession(const_cast<raftKVRpcProctoc::RegisterSessionArgs*>(&args), reply);
+    }
+    
+    bool ExportLog(
+        const raftKVRpcProctoc::ExportLogArgs& args,
+        raftKVRpcProctoc::ExportLogReply* reply
+    ) override {
+        return m_rpcUtil->ExportLog(const_cast<raftKVRpcProctoc::ExportLogArgs*>(&args), reply);
+    }
+    
+    bool CommitCdcCheckpoint(
+        const raftKVRpcProctoc::CommitCdcCheckpointArgs& args,
+        raftKVRpcProctoc::CommitCdcCheckpointReply* reply
+    ) override {
+        return m_rpcUtil->CommitCdcCheckpoint(const_cast<raftKVRpcProctoc::CommitCdcCheckpointArgs*>(&args), reply);
+    }
 };
 
 #endif  // KV_RPC_CLIENT_ADAPTER_H
@@ -10,9 +10,15 @@
 #include <sys/socket.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <algorithm>
 #include <cerrno>
+#include <chrono>
+#include <functional>
 #include <memory>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 #include "kvServerRPC.pb.h"
 #include "mprpcconfig.h"
@@ -20,6 +26,7 @@
 #include "ILoadBalancer.h"  // 新增：负载均衡接口
 #include "KvRpcClientAdapter.h"  // 新增：适配器
 #include "RoundRobinLoadBalancer.h"  // 新增：轮询策略
+#include "util.h"
 class Clerk {
  private:
   // ==================== 保留原有字段（兼容） ====================
@@ -38,16 +45,162 @@ class Clerk {
   }  //用于返回随机的clientId
 
   //    MakeClerk  todo
-  void PutAppend(std::string key, std::string value, std::string op);
+  void PutAppend(std::string key, std::string value, std::string op, int64_t ttlMs = 0);
+
+  // fetchPage 发送一页请求（参数为页令牌、本页条数上限、回复），返回RPC是否成功
+  template <typename FetchPage>
+  std::vector<std::pair<std::string, std::string>> ScanPages(size_t limit, FetchPage &&fetchPage);
+
+  // 向集群注册一个新会话，之后的请求使用会话的clientId，请求号从头开始
+  void RegisterSession();
+
+  // 写请求收到ErrSessionExpired时重新注册会话。之前的尝试都确定没有提交（第一次就被拒绝，或者只收到过ErrBusy）时，
+  // 用新会话重新标记请求，调用方重发；否则之前某次结果未知的尝试可能已经应用、会话随后才被淘汰，
+  // 换新请求号重发会让写入生效两次，只能抛出std::runtime_error(ErrSessionExpired)交给调用方
+  template <typename Args>
+  void RenewSession(Args *args, bool mayHaveApplied, const char *name) {
+    RegisterSession();
+    if (mayHaveApplied) {
+      throw std::runtime_error(ErrSessionExpired + ": " + name + " may or may not have been applied");
+    }
+    m_requestId++;
+    args->set_clientid(m_clientId);
+    args->set_requestid(m_requestId);
+  }
+
+  // 节点过载回复ErrBusy时，按它建议的间隔等待，之后仍向同一节点重试（它很可能就是leader）
+  template <typename Reply>
+  static bool BackOffIfBusy(const Reply &reply) {
+    if (reply.err() != ErrBusy) {
+      return false;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(std::max<int64_t>(1, reply.retryafterms())));
+    return true;
+  }
+
+  // Delete / DeleteRange 共用的发送与重试
+  template <typename Args>
+  void SendDelete(Args &args, const char *name,
+                  bool (IKvRpcClient::*call)(const Args &, raftKVRpcProctoc::DeleteReply *));
 
  public:
+  // 写操作（Put/Append/Delete/BatchWrite/Txn及其封装）在会话过期、且之前有结果未知的尝试时抛出
+  // std::runtime_error(ErrSessionExpired)：写入可能已经生效也可能没有，调用方读取确认后再决定是否重做，
+  // clerk此时已经换了新会话，可以继续使用
+
   //对外暴露的三个功能和初始化
   void Init(std::string configFileName);
   std::string Get(std::string key);
 
   void Put(std::string key, std::string value);
+
+  /**
+   * @brief 写入一个ttlMs毫秒后过期的key；过期时间以leader写进日志的时间为准，过期后Get读不到
+   */
+  void PutWithTtl(std::string key, std::string value, int64_t ttlMs);
   void Append(std::string key, std::string value);
 
+  /**
+   * @brief 删除key，key不存在也视为成功
+   */
+  void Delete(const std::string &key);
+
+  /**
+   * @brief 删除 [start, end) 内的所有key，end为空表示删到最后；整个区间作为一条日志原子地删除
+   */
+  void DeleteRange(const std::string &start, const std::string &end);
+
+  struct WatchResult {
+    bool resync;        // 需要重新同步：重新读取数据后从新的索引再watch
+    int64_t nextIndex;  // 下次从这个索引继续
+  };
+
+  /**
+   * @brief 监听key（prefix为true时监听所有以key开头的key）从startIndex开始的变化，代替轮询Get
+   * 每个事件调用一次onEvent，返回false时停止；节点故障时自动换节点并从断开处继续。
+   * 返回resync时，调用方先重新读取（例如Scan，再用回复的ReadIndex + 1作为startIndex）再继续watch
+   * @param startIndex 起始日志索引（包含），<=0 表示从现在开始
+   */
+  WatchResult Watch(const std::string &key, bool prefix, int64_t startIndex,
+                    const std::function<bool(const raftKVRpcProctoc::WatchEvent &)> &onEvent);
+
+  /**
+   * @brief 日志导出的回调
+   */
+  struct CdcHandler {
+    // 开始回放一个快照：快照是该索引时的全部数据，之前收到的状态应当丢弃（快照里没有的key视为已删除）
+    std::function<void(int64_t snapshotIndex)> onSnapshotBegin;
+    std::function<void(const std::string &key, const std::string &value)> onSnapshotKv;
+    // 每条已提交的写日志调用一次，返回false时停止
+    std::function<bool(const raftKVRpcProctoc::CdcEntry &)> onEntry;
+  };
+
+  /**
+   * @brief 按提交顺序持续导出日志（CDC），追上之后等待新的日志
+   * 请求的日志已经被快照裁掉时，先回放快照再从快照之后继续；节点故障时换节点从断开处继续。
+   * 检查点由调用方在处理完之后用CommitCdcCheckpoint提交，下游写入与检查点之间崩溃时会重放少量日志
+   * @param fromIndex 起始日志索引（包含），<=0 表示从consumerId已提交的检查点之后开始
+   * @return onEntry返回false时，下一条要处理的日志索引
+   */
+  int64_t ExportLog(const std::string &consumerId, int64_t fromIndex, const CdcHandler &handler);
+
+  /**
+   * @brief 记录consumerId已经处理完index及之前的日志；检查点只前进，返回提交后的检查点
+   */
+  int64_t CommitCdcCheckpoint(const std::string &consumerId, int64_t index);
+
+  /**
+   * @brief 读取 [start, end) 内的键值（end 为空表示到最后），按key升序
+   * 自动翻页，所有分页来自同一个读点；读点失效时从头重新扫描
+   * @param limit 最多返回的条数，0 表示不限
+   */
+  std::vector<std::pair<std::string, std::string>> Scan(const std::string &start, const std::string &end,
+                                                        size_t limit = 0);
+  std::vector<std::pair<std::string, std::string>> PrefixScan(const std::string &prefix, size_t limit = 0);
+
+  /**
+   * @brief 一次RPC读取多个key，结果与keys一一对应，不存在的key返回空串（与Get一致）
+   */
+  std::vector<std::string> MultiGet(const std::vector<std::string> &keys);
+
+  /**
+   * @brief 批量写入的一项，op为"Put"、"Append"或"Delete"
+   */
+  struct WriteOp {
+    std::string op;
+    std::string key;
+    std::string value;
+    int64_t ttlMs = 0;  // 仅对"Put"有效
+  };
+
+  /**
+   * @brief 整批写入作为一条日志提交，按顺序原子地生效
+   */
+  void BatchWrite(const std::vector<WriteOp> &ops);
+
+  /**
+   * @brief 执行条件事务，args中的ClientId/RequestId由clerk填写
+   * @return 服务端的回复，Err为OK或ErrInvalidTxn
+   */
+  raftKVRpcProctoc::TxnReply Txn(raftKVRpcProctoc::TxnArgs args);
+
+  /**
+   * @brief 原子自增（不存在按0计），返回自增后的值；值不是整数时抛出std::invalid_argument
+   */
+  int64_t Increment(const std::string &key, int64_t delta = 1);
+
+  /**
+   * @brief 当前值等于expected时写入desired；expected为空表示要求key不存在
+   * @return 是否写入
+   */
+  bool CompareAndSwap(const std::string &key, const std::string &expected, const std::string &desired);
+
+  /**
+   * @brief 当前值不包含value时才追加
+   * @return 是否追加
+   */
+  bool AppendIfAbsent(const std::string &key, const std::string &value);
+
  public:
   Clerk();
 };
@@ -23,6 +23,19 @@ class raftServerRpcUtil {
   //响应其他节点的方法
   bool Get(raftKVRpcProctoc::GetArgs* GetArgs, raftKVRpcProctoc::GetReply* reply);
   bool PutAppend(raftKVRpcProctoc::PutAppendArgs* args, raftKVRpcProctoc::PutAppendReply* reply);
+  bool Scan(raftKVRpcProctoc::ScanArgs* args, raftKVRpcProctoc::ScanReply* reply);
+  bool PrefixScan(raftKVRpcProctoc::PrefixScanArgs* args, raftKVRpcProctoc::ScanReply* reply);
+  bool MultiGet(raftKVRpcProctoc::MultiGetArgs* args, raftKVRpcProctoc::MultiGetReply* reply);
+  bool BatchWrite(raftKVRpcProctoc::BatchWriteArgs* args, raftKVRpcProctoc::BatchWriteReply* reply);
+  bool Txn(raftKVRpcProctoc::TxnArgs* args, raftKVRpcProctoc::TxnReply* reply);
+  bool Delete(raftKVRpcProctoc::DeleteArgs* args, raftKVRpcProctoc::DeleteReply* reply);
+  bool DeleteRange(raftKVRpcProctoc::DeleteRangeArgs* args, raftKVRpcProctoc::DeleteReply* reply);
+  bool Watch(raftKVRpcProctoc::WatchArgs* args, raftKVRpcProctoc::WatchReply* reply);
+  bool CancelWatch(raftKVRpcProctoc::CancelWatchArgs* args, raftKVRpcProctoc::CancelWatchReply* reply);
+  bool RegisterSession(raftKVRpcProctoc::RegisterSessionArgs* args, raftKVRpcProctoc::RegisterSessionReply* reply);
+  bool ExportLog(raftKVRpcProctoc::ExportLogArgs* args, raftKVRpcProctoc::ExportLogReply* reply);
+  bool CommitCdcCheckpoint(raftKVRpcProctoc::CommitCdcCheckpointArgs* args,
+                           raftKVRpcProctoc::CommitCdcCheckpointReply* reply);
 
   raftServerRpcUtil(std::string ip, short port);
   ~raftServerRpcUtil();
@@ -29,3 +29,81 @@ bool raftServerRpcUtil::PutAppend(raftKVRpcProctoc::PutAppendArgs *args, raftKVR
   }
   return !controller.Failed();
 }
+
+bool raftServerRpcUtil::Scan(raftKVRpcProctoc::ScanArgs *args, raftKVRpcProctoc::ScanReply *reply) {
+  MprpcController controller;
+  stub->Scan(&controller, args, reply, nullptr);
+  return !controller.Failed();
+}
+
+bool raftServerRpcUtil::PrefixScan(raftKVRpcProctoc::PrefixScanArgs *args, raftKVRpcProctoc::ScanReply *reply) {
+  MprpcController controller;
+  stub->PrefixScan(&controller, args, reply, nullptr);
+  return !controller.Failed();
+}
+
+bool raftServerRpcUtil::MultiGet(raftKVRpcProctoc::MultiGetArgs *args, raftKVRpcProctoc::MultiGetReply *reply) {
+  MprpcController controller;
+  stub->MultiGet(&controller, args, reply, nullptr);
+  return !controller.Failed();
+}
+
+bool raftServerRpcUtil::BatchWrite(raftKVRpcProctoc::BatchWriteArgs *args, raftKVRpcProctoc::BatchWriteReply *reply) {
+  MprpcController controller;
+  stub->BatchWrite(&controller, args, reply, nullptr);
+  if (controller.Failed()) {
+    std::cout << controller.ErrorText() << endl;
+  }
+  return !controller.Failed();
+}
+
+bool raftServerRpcUtil::Txn(raftKVRpcProctoc::TxnArgs *args, raftKVRpcProctoc::TxnReply *reply) {
+  MprpcController controller;
+  stub->Txn(&controller, args, reply, nullptr);
+  return !controller.Failed();
+}
+
+bool raftServerRpcUtil::Delete(raftKVRpcProctoc::DeleteArgs *args, raftKVRpcProctoc::DeleteReply *reply) {
+  MprpcController controller;
+  stub->Delete(&controller, args, reply, nullptr);
+  return !controller.Failed();
+}
+
+bool raftServerRpcUtil::DeleteRange(raftKVRpcProctoc::DeleteRangeArgs *args, raftKVRpcProctoc::DeleteReply *reply) {
+  MprpcController controller;
+  stub->DeleteRange(&controller, args, reply, nullptr);
+  return !controller.Failed();
+}
+
+bool raftServerRpcUtil::Watch(raftKVRpcProctoc::WatchArgs *args, raftKVRpcProctoc::WatchReply *reply) {
+  MprpcController controller;
+  stub->Watch(&controller, args, reply, nullptr);
+  return !controller.Failed();
+}
+
+bool raftServerRpcUtil::CancelWatch(raftKVRpcProctoc::CancelWatchArgs *args,
+                                    raftKVRpcProctoc::CancelWatchReply *reply) {
+  MprpcController controller;
+  stub->CancelWatch(&controller, args, reply, nullptr);
+  return !controller.Failed();
+}
+
+bool raftServerRpcUtil::RegisterSession(raftKVRpcProctoc::RegisterSessionArgs *args,
+                                        raftKVRpcProctoc::RegisterSessionReply *reply) {
+  MprpcController controller;
+  stub->RegisterSession(&controller, args, reply, nullptr);
+  return !controller.Failed();
+}
+
+bool raftServerRpcUtil::ExportLog(raftKVRpcProctoc::ExportLogArgs *args, raftKVRpcProctoc::ExportLogReply *reply) {
+  MprpcController controller;
+  stub->ExportLog(&controller, args, reply, nullptr);
+  return !controller.Failed();
+}
+
+bool raftServerRpcUtil::CommitCdcCheckpoint(raftKVRpcProctoc::CommitCdcCheckpointArgs *args,
+                                            raftKVRpcProctoc::CommitCdcCheckpointReply *reply) {
+  MprpcController controller;
+  stub->CommitCdcCheckpoint(&controller, args, reply, nullptr);
+  return !controller.Failed();
+}
@@ -0,0 +1,97 @@
+#include "AdmissionController.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// 采样间隔太短时速度抖动大，保留上一次的估计
+constexpr std::chrono::milliseconds kRateSampleInterval(100);
+
+}  // namespace
+
+AdmissionController::AdmissionController(const Options &options)
+    : m_options(options), m_sampledAt(std::chrono::steady_clock::now()) {
+  for (auto &rejected : m_rejected) {
+    rejected.store(0, std::memory_order_relaxed);
+  }
+}
+
+size_t AdmissionController::shareOf(Priority priority) {
+  switch (priority) {
+    case kControl:
+      return 10000;
+    case kRead:
+      return 9000;
+    default:
+      return 7000;
+  }
+}
+
+bool AdmissionController::TryAdmit(Priority priority, size_t applyBacklog, int64_t *retryAfterMs) {
+  const size_t share = shareOf(priority);
+  const size_t inflightLimit = std::max<size_t>(1, m_options.maxInflight * share / 10000);
+  const size_t backlogLimit = std::max<size_t>(1, m_options.maxApplyBacklog * share / 10000);
+
+  size_t backlogExcess = applyBacklog >= backlogLimit ? applyBacklog - backlogLimit + 1 : 0;
+  size_t inflight = m_inflight.load(std::memory_order_relaxed);
+  while (backlogExcess == 0 && inflight < inflightLimit) {
+    if (m_inflight.compare_exchange_weak(inflight, inflight + 1, std::memory_order_relaxed)) {
+      m_admitted.fetch_add(1, std::memory_order_relaxed);
+      return true;
+    }
+  }
+  m_rejected[priority].fetch_add(1, std::memory_order_relaxed);
+  size_t inflightExcess = inflight >= inflightLimit ? inflight - inflightLimit + 1 : 0;
+  *retryAfterMs = this->retryAfterMs(inflightExcess, backlogExcess);
+  return false;
+}
+
+void AdmissionController::Release() {
+  m_inflight.fetch_sub(1, std::memory_order_relaxed);
+  m_completed.fetch_add(1, std::memory_order_relaxed);
+}
+
+int64_t AdmissionController::retryAfterMs(size_t inflightExcess, size_t backlogExcess) {
+  double completedPerMs = 0;
+  double appliedPerMs = 0;
+  {
+    std::lock_guard<std::mutex> lg(m_rateMtx);
+    auto now = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::duration<double, std::milli>(now - m_sampledAt).count();
+    if (elapsed >= kRateSampleInterval.count()) {
+      uint64_t completed = m_completed.load(std::memory_order_relaxed);
+      uint64_t applied = m_applied.load(std::memory_order_relaxed);
+      // 与上一次的估计各占一半，单个窗口的抖动不会让重试间隔大起大落
+      m_completedPerMs = (m_completedPerMs + (completed - m_sampledCompleted) / elapsed) / 2;
+      m_appliedPerMs = (m_appliedPerMs + (applied - m_sampledApplied) / elapsed) / 2;
+      m_sampledAt = now;
+      m_sampledCompleted = completed;
+      m_sampledApplied = applied;
+    }
+    completedPerMs = m_completedPerMs;
+    appliedPerMs = m_appliedPerMs;
+  }
+  // 还没有消化速度的估计（刚启动或者完全卡住）时按最长间隔
+  double waitMs = 0;
+  if (inflightExcess > 0) {
+    waitMs = std::max(waitMs, completedPerMs > 0 ? inflightExcess / completedPerMs
+                                                 : static_cast<double>(m_options.maxRetryAfterMs));
+  }
+  if (backlogExcess > 0) {
+    waitMs = std::max(waitMs, appliedPerMs > 0 ? backlogExcess / appliedPerMs
+                                               : static_cast<double>(m_options.maxRetryAfterMs));
+  }
+  return std::min(m_options.maxRetryAfterMs,
+                  std::max(m_options.minRetryAfterMs, static_cast<int64_t>(std::ceil(waitMs))));
+}
+
+AdmissionController::Stats AdmissionController::GetStats() const {
+  Stats stats;
+  stats.Admitted = m_admitted.load(std::memory_order_relaxed);
+  for (int i = 0; i < kPriorityCount; ++i) {
+    stats.Rejected[i] = m_rejected[i].load(std::memory_order_relaxed);
+  }
+  stats.Inflight = m_inflight.load(std::memory_order_relaxed);
+  return stats;
+}
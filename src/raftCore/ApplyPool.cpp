@@ -0,0 +1,80 @@
+#include "ApplyPool.h"
+
+ApplyPool::ApplyPool(size_t threads) {
+  for (size_t i = 1; i < threads; ++i) {
+    m_workers.emplace_back(&ApplyPool::workerLoop, this);
+  }
+}
+
+ApplyPool::~ApplyPool() {
+  {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    m_stop = true;
+  }
+  m_startCv.notify_all();
+  for (auto &worker : m_workers) {
+    worker.join();
+  }
+}
+
+void ApplyPool::Run(size_t n, const std::function<void(size_t)> &task) {
+  if (n == 0) {
+    return;
+  }
+  if (m_workers.empty() || n == 1) {
+    for (size_t i = 0; i < n; ++i) {
+      task(i);
+    }
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    m_task = &task;
+    m_total = n;
+    m_next.store(0, std::memory_order_relaxed);
+    m_finished.store(0, std::memory_order_relaxed);
+    m_arrived = 0;
+    ++m_generation;
+  }
+  m_startCv.notify_all();
+  runTasks();
+  std::unique_lock<std::mutex> lk(m_mtx);
+  // 每个池中线程都进入过并离开了这一轮，才能复用 m_task 和计数器：醒得晚的线程不会带着旧的一轮进入下一轮
+  m_doneCv.wait(lk, [this] {
+    return m_finished.load(std::memory_order_acquire) == m_total && m_arrived == m_workers.size() && m_active == 0;
+  });
+  m_task = nullptr;
+}
+
+void ApplyPool::runTasks() {
+  while (true) {
+    size_t i = m_next.fetch_add(1, std::memory_order_relaxed);
+    if (i >= m_total) {
+      return;
+    }
+    (*m_task)(i);
+    m_finished.fetch_add(1, std::memory_order_acq_rel);
+  }
+}
+
+void ApplyPool::workerLoop() {
+  uint64_t seen = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lk(m_mtx);
+      m_startCv.wait(lk, [&] { return m_stop || m_generation != seen; });
+      if (m_stop) {
+        return;
+      }
+      seen = m_generation;
+      ++m_arrived;
+      ++m_active;
+    }
+    runTasks();
+    {
+      std::lock_guard<std::mutex> lg(m_mtx);
+      --m_active;
+    }
+    m_doneCv.notify_one();
+  }
+}
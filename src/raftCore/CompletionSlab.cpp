@@ -0,0 +1,121 @@
+#include "CompletionSlab.h"
+
+#include <utility>
+
+namespace {
+
+size_t roundUpToPowerOfTwo(size_t n) {
+  size_t capacity = 1;
+  while (capacity < n) {
+    capacity <<= 1;
+  }
+  return capacity;
+}
+
+}  // namespace
+
+CompletionSlab::CompletionSlab(size_t capacity)
+    : m_mask(roundUpToPowerOfTwo(capacity == 0 ? 1 : capacity) - 1), m_slots(new Slot[m_mask + 1]) {}
+
+uint64_t CompletionSlab::Tag(const std::string &clientId, int requestId) {
+  uint64_t h = std::hash<std::string>{}(clientId);
+  h ^= static_cast<uint64_t>(static_cast<uint32_t>(requestId)) + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+  return h;
+}
+
+CompletionSlab::Callback CompletionSlab::take(Slot &slot) {
+  Callback callback = std::move(slot.callback);
+  slot.callback = nullptr;
+  slot.index = 0;
+  slot.tag = 0;
+  return callback;
+}
+
+void CompletionSlab::Register(int raftIndex, uint64_t tag, Clock::time_point deadline, Callback callback) {
+  Slot &slot = slotOf(raftIndex);
+  Callback evicted;
+  int evictedIndex = 0;
+  bool applied = false;
+  bool known = false;
+  {
+    std::lock_guard<std::mutex> lg(slot.mtx);
+    if (slot.appliedIndex >= raftIndex) {
+      // 登记之前已经apply：相同索引可以直接判断，更大的索引说明结果已经被覆盖
+      known = true;
+      applied = slot.appliedIndex == raftIndex && slot.appliedTag == tag;
+    } else if (slot.index > raftIndex) {
+      // 更新的请求已经占用了这个slot
+      known = true;
+    } else {
+      if (slot.index != 0) {
+        // 更早的请求（同时等待的请求超过容量），或者同一索引上被截断的旧日志
+        evictedIndex = slot.index;
+        evicted = take(slot);
+      }
+      slot.index = raftIndex;
+      slot.tag = tag;
+      slot.deadline = deadline;
+      slot.callback = std::move(callback);
+    }
+  }
+  if (evicted) {
+    evicted(false, evictedIndex);
+  }
+  if (known) {
+    callback(applied, raftIndex);
+  }
+}
+
+void CompletionSlab::Complete(int raftIndex, uint64_t tag) {
+  Slot &slot = slotOf(raftIndex);
+  Callback callback;
+  int waiterIndex = 0;
+  bool applied = false;
+  {
+    std::lock_guard<std::mutex> lg(slot.mtx);
+    slot.appliedIndex = raftIndex;
+    slot.appliedTag = tag;
+    if (slot.index == 0 || slot.index > raftIndex) {
+      return;
+    }
+    // 比本索引早的等待者说明它的日志被跳过了（例如被快照覆盖），同样结束
+    waiterIndex = slot.index;
+    applied = slot.index == raftIndex && slot.tag == tag;
+    callback = take(slot);
+  }
+  callback(applied, waiterIndex);
+}
+
+void CompletionSlab::FailUpTo(int raftIndex) {
+  for (size_t i = 0; i <= m_mask; ++i) {
+    Slot &slot = m_slots[i];
+    Callback callback;
+    int waiterIndex = 0;
+    {
+      std::lock_guard<std::mutex> lg(slot.mtx);
+      if (slot.index == 0 || slot.index > raftIndex) {
+        continue;
+      }
+      waiterIndex = slot.index;
+      callback = take(slot);
+    }
+    callback(false, waiterIndex);
+  }
+}
+
+void CompletionSlab::Expire(Clock::time_point now) {
+  for (size_t i = 0; i <= m_mask; ++i) {
+    Slot &slot = m_slots[i];
+    Callback callback;
+    int waiterIndex = 0;
+    {
+      std::lock_guard<std::mutex> lg(slot.mtx);
+      if (slot.index == 0 || slot.deadline > now) {
+        continue;
+      }
+      waiterIndex = slot.index;
+      callback = take(slot);
+    }
+    callback(false, waiterIndex);
+  }
+}
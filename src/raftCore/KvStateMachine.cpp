@@ -0,0 +1,643 @@
+#include "KvStateMachine.h"
+
+#include <boost/serialization/unordered_map.hpp>
+#include <boost/serialization/utility.hpp>
+#include <boost/serialization/vector.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <limits>
+#include <stdexcept>
+
+#include "skipList.h"
+
+namespace {
+
+// 每条日志最多回收的过期key数，其余留给后面的日志；没回收的key在读路径上同样不可见
+constexpr size_t kMaxExpirePerApply = 256;
+// 每条日志最多删除的过期会话数
+constexpr size_t kMaxSessionExpirePerApply = 256;
+// 一条日志里的写入少于这个数时串行写，唤醒线程池的开销比写入本身还大
+constexpr size_t kParallelApplyMinOps = 32;
+
+// 把 write 输出的字节作为一个 std::string 写进文本归档，格式与 oa << str 相同，但不先拼出完整的字符串。
+// 文本归档里字符串是"长度 空格 内容"：先写一个最长的长度占位，内容直接写进 os，写完后回填实际长度（左侧补空格，
+// 读取时 >> 会跳过）。os 必须是 oa 底层的可回写的流
+void saveStreamedString(boost::archive::text_oarchive &oa, std::ostream &os,
+                        const std::function<void(std::ostream &)> &write) {
+  constexpr std::size_t kPlaceholder = std::numeric_limits<std::size_t>::max();
+  constexpr int kWidth = std::numeric_limits<std::size_t>::digits10 + 1;  // kPlaceholder 的位数
+  oa << kPlaceholder;
+  const std::streampos sizePos = os.tellp() - std::streamoff(kWidth);
+  os.put(' ');
+  const std::streampos begin = os.tellp();
+  write(os);
+  const std::streampos end = os.tellp();
+  os.seekp(sizePos);
+  os << std::setw(kWidth) << static_cast<std::size_t>(end - begin);
+  os.seekp(end);
+}
+
+// 读屏障不需要判重，过期会话的读请求照常处理
+bool isReadBarrier(const std::string &operation) {
+  return operation == "Get" || operation == "Scan" || operation == "MultiGet";
+}
+
+// 不支持读视图的引擎：直接读引擎当前的数据，同一个视图的多次读取之间可能看到新的写入
+class LiveReadView : public IReadView {
+ public:
+  LiveReadView(IStorageEngine *engine, int64_t index) : m_engine(engine), m_index(index) {}
+
+  int64_t Index() const override { return m_index; }
+  bool Get(const std::string &key, std::string *value) const override { return m_engine->Get(key, value); }
+  int64_t Version(const std::string &key) const override {
+    int64_t version = 0;
+    return m_engine->GetVersion(key, &version) ? version : 0;
+  }
+  void Scan(const std::string &start,
+            const std::function<bool(const std::string &, const std::string &)> &visitor) const override {
+    m_engine->Scan(start, visitor);
+  }
+  void SerializeTo(std::ostream &os) const override { m_engine->SerializeTo(os); }
+  bool CollectVersions(std::vector<int64_t> *out) const override { return m_engine->CollectVersions(out); }
+
+ private:
+  IStorageEngine *m_engine;
+  int64_t m_index;
+};
+
+}  // namespace
+
+KvStateMachine::KvStateMachine(std::unique_ptr<IStorageEngine> storage, size_t applyThreads, size_t readCacheBytes)
+    : m_storage(std::move(storage)),
+      m_readCache(readCacheBytes),
+      m_applyPool(std::make_unique<ApplyPool>(applyThreads)) {
+  if (m_storage == nullptr) {
+    throw std::invalid_argument("state machine needs a storage engine");
+  }
+  m_versioned = m_storage->OpenView() != nullptr;
+}
+
+// ==================== IStateMachine ====================
+
+void KvStateMachine::Apply(const std::string &command, int index) {
+  Op op = DeserializeOp(command);
+  ApplyOp(op, index, nullptr);
+}
+
+bool KvStateMachine::ApplyOp(Op &op, int index, std::vector<WatchEvent> *events) {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  // 已经应用过的索引不再执行：会话、时钟和数据都不能被同一条日志推进两次
+  if (index <= m_appliedIndex.load(std::memory_order_relaxed) || !m_storage->BeginApply(index)) {
+    DPrintf("[KvStateMachine::ApplyOp] skip stale index %d, applied %d", index,
+            static_cast<int>(m_appliedIndex.load(std::memory_order_relaxed)));
+    return false;
+  }
+
+  // 时钟随每条日志推进（重复的请求也一样），先回收到期的key再执行本条命令
+  AdvanceClockAndReclaim(op.TimestampMs);
+  m_sessions.Expire(m_clockMs, kMaxSessionExpirePerApply);
+
+  if (op.Operation == "RegisterSession") {
+    // 会话id取这条日志的索引，各副本相同；ClientId 只是客户端的随机数，不是会话
+    m_sessions.Register(index, m_clockMs);
+  } else if (op.Operation == "Coalesced") {
+    // 合并日志本身不判重，子操作各自判重
+    ApplyCoalesced(op, index);
+  } else if (!isReadBarrier(op.Operation) && m_sessions.Rejects(op.ClientId)) {
+    // 会话已经过期，无法判断是否重复，不执行
+    op.ClientId.clear();
+  } else if (!m_sessions.IsDuplicate(op.ClientId, op.RequestId)) {
+    if (op.Operation == "Put") {
+      StorePut(op.Key, op.Value, op.TtlMs);
+    } else if (op.Operation == "Append") {
+      StoreAppend(op.Key, op.Value);
+    } else if (op.Operation == "Batch") {
+      // 一条日志里的整批写入都使用同一个索引，读者要么看到整批，要么一条都看不到
+      std::vector<const Op *> writes;
+      writes.reserve(op.Batch.size());
+      for (const Op &sub : op.Batch) {
+        writes.push_back(&sub);
+      }
+      StoreWrites(writes, index);
+    } else if (op.Operation == "Delete") {
+      ApplyDelete(op.Key);
+    } else if (op.Operation == "DeleteRange") {
+      ApplyDeleteRange(op.Key, op.Value);
+      DPrintf("[KvStateMachine::ApplyOp] index %d DeleteRange [%s, %s)", index, op.Key.c_str(), op.Value.c_str());
+    } else if (op.Operation == "CdcCheckpoint") {
+      ApplyCdcCheckpoint(op.Key, op.Value);
+    }
+    // 事务等求值之后和结果一起记在会话上；读屏障不修改状态，也不记录
+    if (op.Operation == "Txn") {
+      ApplyTxn(op);
+    } else if (!isReadBarrier(op.Operation)) {
+      m_sessions.Record(op.ClientId, op.RequestId, m_clockMs);
+    }
+  }
+  // 读请求和重复的请求也算会话活动
+  if (op.Operation != "RegisterSession") {
+    m_sessions.Touch(op.ClientId, m_clockMs);
+  }
+
+  // 这条日志对读者可见（快照和等待该日志的读请求都在它之后读），再发布过期时间的变化
+  m_storage->FinishApply(index);
+  m_appliedIndex.store(index, std::memory_order_release);
+  RefreshReadCache();
+  PublishTtlChanges();
+  if (events != nullptr) {
+    events->swap(m_pendingEvents);
+  }
+  m_pendingEvents.clear();
+  return true;
+}
+
+std::string KvStateMachine::TakeSnapshot() { return CaptureSnapshot()(); }
+
+std::function<std::string()> KvStateMachine::CaptureSnapshot() {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  // 会话、逻辑时钟、过期时间和检查点在锁内写进一个不带文件头的归档，之后原样接在kv数据和版本号后面，
+  // 结果与一次写完的归档逐字节相同。apply线程持有m_mtx，这些状态此时不会变化
+  std::ostringstream stateOs;
+  {
+    boost::archive::text_oarchive oa(stateOs, boost::archive::no_header);
+    oa << m_clockMs;
+    oa << m_ttl.Deadlines();
+    oa << m_cdcCheckpoints;
+    oa << m_sessions;
+  }
+  std::string state = stateOs.str();
+  if (!state.empty() && state.back() == '\n') {
+    state.pop_back();  // 归档析构时补的换行，原来的快照里没有
+  }
+  m_keysAtLastSnapshot = m_storage->Size();
+  m_deletedSinceSnapshot = 0;
+
+  auto write = [this](const IReadView &view, const std::string &state) {
+    std::stringstream ss;
+    std::string snapshot;
+    {
+      boost::archive::text_oarchive oa(ss);
+      // 引擎数据直接流式写进归档，不经过中间字符串
+      saveStreamedString(oa, ss, [&view](std::ostream &os) { view.SerializeTo(os); });
+      std::vector<int64_t> versions;
+      if (!view.CollectVersions(&versions)) {
+        versions.clear();
+      }
+      // 旧的去重表和事务结果已经并入会话表，原位置写空表，保持快照各项的顺序不变
+      std::unordered_map<std::string, int> lastRequestId;
+      std::unordered_map<std::string, std::pair<int, TxnResponse>> lastTxnResult;
+      oa << lastRequestId;
+      oa << versions;
+      oa << lastTxnResult;
+      ss << ' ' << state;
+      // 交给raft的快照是std::string，这里整份拷出一次
+      snapshot = ss.str();
+    }
+    m_lastSnapshotBytes.store(snapshot.size(), std::memory_order_relaxed);
+    return snapshot;
+  };
+
+  std::shared_ptr<IReadView> view = m_versioned ? m_storage->OpenView() : nullptr;
+  if (view == nullptr) {
+    // 不支持读视图的引擎只能持锁导出
+    std::string snapshot = write(LiveReadView(m_storage.get(), AppliedIndex()), state);
+    return [snapshot = std::move(snapshot)]() mutable { return std::move(snapshot); };
+  }
+  // 多版本引擎：读视图固定在当前已应用的索引上，kv数据和版本号在调用方的线程里导出，apply照常进行
+  return [write, view = std::move(view), state = std::move(state)]() { return write(*view, state); };
+}
+
+void KvStateMachine::InstallSnapshot(const std::string &snapshot) { InstallSnapshot(snapshot, AppliedIndex() + 1); }
+
+bool KvStateMachine::InstallSnapshot(const std::string &snapshot, int64_t index) {
+  std::string kvData;
+  std::unordered_map<std::string, int> lastRequestId;
+  std::vector<int64_t> versions;
+  std::unordered_map<std::string, std::pair<int, TxnResponse>> lastTxnResult;
+  int64_t clockMs = 0;
+  std::unordered_map<std::string, int64_t> deadlines;
+  std::stringstream ss(snapshot);
+  boost::archive::text_iarchive ia(ss);
+  ia >> kvData;
+  ia >> lastRequestId;
+  try {
+    ia >> versions;
+    ia >> lastTxnResult;
+  } catch (const boost::archive::archive_exception &) {
+    // 升级前的快照只有前两项，版本号按安装索引记
+    versions.clear();
+    lastTxnResult.clear();
+  }
+  try {
+    ia >> clockMs;
+    ia >> deadlines;
+  } catch (const boost::archive::archive_exception &) {
+    // 没有过期时间的快照：所有key都不过期
+    clockMs = 0;
+    deadlines.clear();
+  }
+  std::unordered_map<std::string, int64_t> cdcCheckpoints;
+  try {
+    ia >> cdcCheckpoints;
+  } catch (const boost::archive::archive_exception &) {
+    cdcCheckpoints.clear();
+  }
+  ShardedSessionTable sessions;
+  bool hasSessions = true;
+  try {
+    ia >> sessions;
+  } catch (const boost::archive::archive_exception &) {
+    // 没有会话表的快照：由旧的去重表和事务结果转换
+    hasSessions = false;
+  }
+
+  std::lock_guard<std::mutex> lock(m_mtx);
+  // 旧快照不安装：数据、会话和时钟都会回退
+  if (index <= m_appliedIndex.load(std::memory_order_relaxed) ||
+      !m_storage->Install(kvData, index, versions.empty() ? nullptr : &versions)) {
+    DPrintf("[KvStateMachine::InstallSnapshot] skip stale snapshot %d, applied %d", static_cast<int>(index),
+            static_cast<int>(m_appliedIndex.load(std::memory_order_relaxed)));
+    return false;
+  }
+  m_readCache.Clear();
+  m_appliedIndex.store(index, std::memory_order_release);
+  {
+    std::lock_guard<std::shared_mutex> readLock(m_readMtx);
+    m_clockMs = clockMs;
+    m_ttl.Restore(std::move(deadlines), m_clockMs);
+    m_cdcCheckpoints = std::move(cdcCheckpoints);
+  }
+  if (hasSessions) {
+    m_sessions.Assign(std::move(sessions));
+  } else {
+    m_sessions.RestoreLegacy(lastRequestId, std::move(lastTxnResult), m_clockMs);
+  }
+  m_pendingTtl.clear();
+  m_reclaimed.clear();
+  m_pendingEvents.clear();
+  RecordSnapshot(snapshot.size());
+  return true;
+}
+
+void KvStateMachine::DecodeSnapshotKvs(const std::string &snapshot, KvList *kvs) {
+  std::string kvData;
+  std::unordered_map<std::string, int> lastRequestId;
+  std::vector<int64_t> versions;
+  std::unordered_map<std::string, std::pair<int, TxnResponse>> lastTxnResult;
+  int64_t clockMs = 0;
+  std::unordered_map<std::string, int64_t> deadlines;
+  std::stringstream ss(snapshot);
+  boost::archive::text_iarchive ia(ss);
+  ia >> kvData;
+  ia >> lastRequestId;
+  try {
+    ia >> versions;
+    ia >> lastTxnResult;
+    ia >> clockMs;
+    ia >> deadlines;
+  } catch (const boost::archive::archive_exception &) {
+    deadlines.clear();
+  }
+  if (kvData.empty()) {
+    return;
+  }
+  // ChunkedValue按普通字符串序列化，这里直接读成string
+  SkipListDump<std::string, std::string> dump;
+  try {
+    std::stringstream kvStream(kvData);
+    boost::archive::text_iarchive kvArchive(kvStream);
+    kvArchive >> dump;
+  } catch (const boost::archive::archive_exception &e) {
+    throw std::runtime_error(std::string("snapshot kv data is not a SkipListDump: ") + e.what());
+  }
+  kvs->reserve(dump.keyDumpVt_.size());
+  for (size_t i = 0; i < dump.keyDumpVt_.size(); i++) {
+    auto it = deadlines.find(dump.keyDumpVt_[i]);
+    if (it != deadlines.end() && it->second <= clockMs) {
+      continue;
+    }
+    kvs->emplace_back(std::move(dump.keyDumpVt_[i]), std::move(dump.valDumpVt_[i]));
+  }
+}
+
+// ==================== 读 ====================
+
+bool KvStateMachine::Get(const std::string &key, std::string *value) {
+  // 先读数据再看过期时间：过期时间的变化在数据可见之后才发布，看到的过期时间不会比数据旧。
+  // 缓存在数据可见之后才更新，命中的值最多和引擎里的一样新
+  uint64_t ticket = 0;
+  if (!m_readCache.Lookup(key, value, &ticket)) {
+    if (!m_storage->Get(key, value)) {
+      return false;
+    }
+    m_readCache.Fill(key, *value, ticket);
+  }
+  if (KeyExpired(key)) {
+    value->clear();
+    return false;
+  }
+  return true;
+}
+
+std::shared_ptr<IReadView> KvStateMachine::OpenReadView() {
+  if (m_versioned) {
+    return m_storage->OpenView();
+  }
+  return std::make_shared<LiveReadView>(m_storage.get(), AppliedIndex());
+}
+
+std::shared_ptr<IReadView> KvStateMachine::OpenReadView(int64_t index) {
+  if (m_versioned) {
+    return m_storage->OpenView(index);
+  }
+  const int64_t applied = AppliedIndex();
+  if (index > applied) {
+    return nullptr;
+  }
+  return std::make_shared<LiveReadView>(m_storage.get(), applied);
+}
+
+bool KvStateMachine::KeyExpired(const std::string &key) const {
+  std::shared_lock<std::shared_mutex> lock(m_readMtx);
+  return m_ttl.Expired(key, m_clockMs);
+}
+
+void KvStateMachine::UpdateRequestId(const std::string &clientId, int requestId) {
+  int64_t nowMs = 0;
+  {
+    std::shared_lock<std::shared_mutex> lock(m_readMtx);
+    nowMs = m_clockMs;
+  }
+  m_sessions.Record(clientId, requestId, nowMs);
+}
+
+int64_t KvStateMachine::CdcCheckpoint(const std::string &consumerId) const {
+  std::shared_lock<std::shared_mutex> lock(m_readMtx);
+  auto it = m_cdcCheckpoints.find(consumerId);
+  return it == m_cdcCheckpoints.end() ? 0 : it->second;
+}
+
+// ==================== 各类日志 ====================
+
+void KvStateMachine::ApplyCoalesced(const Op &op, int index) {
+  // 先按顺序判重、决定哪些子操作要执行，再（可能并行地）写入，最后按顺序记到会话表。
+  // 同一个客户端在这批里可能有多个请求（包括重试），判重时要算上本批前面已经接受的
+  std::vector<const Op *> writes;
+  writes.reserve(op.Batch.size());
+  std::unordered_map<std::string, int> accepted;
+  for (const Op &sub : op.Batch) {
+    if (m_sessions.Rejects(sub.ClientId) || (sub.Operation != "Put" && sub.Operation != "Append")) {
+      continue;
+    }
+    auto it = accepted.find(sub.ClientId);
+    bool acceptedInBatch = it != accepted.end() && sub.RequestId <= it->second;
+    if (acceptedInBatch || m_sessions.IsDuplicate(sub.ClientId, sub.RequestId)) {
+      m_sessions.Touch(sub.ClientId, m_clockMs);
+      continue;
+    }
+    accepted[sub.ClientId] = sub.RequestId;
+    writes.push_back(&sub);
+  }
+  StoreWrites(writes, index);
+  for (const Op *write : writes) {
+    m_sessions.Record(write->ClientId, write->RequestId, m_clockMs);
+  }
+}
+
+void KvStateMachine::ApplyTxn(const Op &op) {
+  // 多版本引擎：比较和操作读的是上一条日志应用完之后的数据；其他引擎读当前数据，
+  // 本条日志在求值之前只回收过到期的key，两者对求值没有区别
+  std::shared_ptr<IReadView> view = m_versioned ? m_storage->OpenView() : nullptr;
+  std::vector<TxnWrite> writes;
+  TxnResponse resp = ExecuteTxn(
+      op.Txn,
+      [&](const std::string &key, std::string *value) {
+        return !ApplyingExpired(key) && (view != nullptr ? view->Get(key, value) : m_storage->Get(key, value));
+      },
+      [&](const std::string &key, int64_t *version) {
+        if (ApplyingExpired(key)) {
+          *version = 0;
+          return true;
+        }
+        if (view != nullptr) {
+          *version = view->Version(key);
+          return true;
+        }
+        return m_storage->GetVersion(key, version);
+      },
+      &writes);
+  view.reset();
+  for (const auto &w : writes) {
+    switch (w.kind) {
+      case TxnWrite::Kind::kPut:
+        StorePut(w.key, w.value, 0);
+        break;
+      case TxnWrite::Kind::kAppend:
+        StoreAppend(w.key, w.value);
+        break;
+      case TxnWrite::Kind::kDelete:
+        StoreDelete(w.key);
+        break;
+    }
+  }
+  m_sessions.RecordTxn(op.ClientId, op.RequestId, m_clockMs, std::move(resp));
+}
+
+void KvStateMachine::ApplyDelete(const std::string &key) {
+  // 不存在的key不写删除标记，避免白白多出一个版本
+  std::string old;
+  if (m_storage->Get(key, &old)) {
+    StoreDelete(key);
+    ++m_deletedSinceSnapshot;
+  }
+}
+
+void KvStateMachine::ApplyDeleteRange(const std::string &start, const std::string &end) {
+  // 先收集区间内的key再删除，不在引擎遍历的回调里修改引擎
+  std::vector<std::string> keys;
+  OpenReadView()->Scan(start, [&](const std::string &key, const std::string &) {
+    if (!end.empty() && key >= end) {
+      return false;
+    }
+    keys.push_back(key);
+    return true;
+  });
+  for (const auto &key : keys) {
+    StoreDelete(key);
+  }
+  m_deletedSinceSnapshot += keys.size();
+}
+
+void KvStateMachine::ApplyCdcCheckpoint(const std::string &consumerId, const std::string &index) {
+  int64_t value = std::strtoll(index.c_str(), nullptr, 10);
+  if (consumerId.empty() || value <= 0) {
+    return;
+  }
+  std::lock_guard<std::shared_mutex> lock(m_readMtx);
+  int64_t &checkpoint = m_cdcCheckpoints[consumerId];
+  checkpoint = std::max(checkpoint, value);
+}
+
+// ==================== 带过期时间的写入 ====================
+
+void KvStateMachine::AdvanceClockAndReclaim(int64_t timestampMs) {
+  if (timestampMs > m_clockMs) {
+    std::lock_guard<std::shared_mutex> lock(m_readMtx);
+    m_clockMs = timestampMs;
+  }
+  if (m_ttl.Size() == 0) {
+    return;
+  }
+  // 时间轮不在读路径上，取出到期登记不用独占；删除和本条日志的写入一起可见，登记在那之后再去掉
+  m_ttl.CollectExpired(m_clockMs, kMaxExpirePerApply, &m_reclaimed);
+  for (const auto &entry : m_reclaimed) {
+    m_storage->Delete(entry.key);
+    RecordEvent(WatchEvent::kDelete, entry.key, "");
+  }
+}
+
+void KvStateMachine::PublishTtlChanges() {
+  if (m_pendingTtl.empty() && m_reclaimed.empty()) {
+    return;
+  }
+  std::lock_guard<std::shared_mutex> lock(m_readMtx);
+  // 先去掉回收的登记，同一条日志里重新写入的key再设置新的过期时间
+  for (const auto &entry : m_reclaimed) {
+    m_ttl.Forget(entry);
+  }
+  for (const auto &change : m_pendingTtl) {
+    m_ttl.Set(change.first, change.second);
+  }
+  m_reclaimed.clear();
+  m_pendingTtl.clear();
+}
+
+int64_t KvStateMachine::ApplyingDeadline(const std::string &key, const ApplyPartition *part) const {
+  // 一个key的写入只在一个分区里，分区缓冲里有就是最新的；否则看本条日志串行阶段的变化
+  if (part != nullptr) {
+    for (auto it = part->PendingTtl.rbegin(); it != part->PendingTtl.rend(); ++it) {
+      if (it->first == key) {
+        return it->second;
+      }
+    }
+  }
+  for (auto it = m_pendingTtl.rbegin(); it != m_pendingTtl.rend(); ++it) {
+    if (it->first == key) {
+      return it->second;
+    }
+  }
+  auto it = m_ttl.Deadlines().find(key);
+  return it == m_ttl.Deadlines().end() ? 0 : it->second;
+}
+
+bool KvStateMachine::ApplyingExpired(const std::string &key, const ApplyPartition *part) const {
+  int64_t deadline = ApplyingDeadline(key, part);
+  return deadline > 0 && deadline <= m_clockMs;
+}
+
+void KvStateMachine::RecordEvent(int type, const std::string &key, const std::string &value, ApplyPartition *part) {
+  WatchEvent event;
+  event.Index = 0;  // 发布时填上日志索引
+  event.Type = type;
+  event.Key = key;
+  event.Value = value;
+  (part != nullptr ? part->Events : m_pendingEvents).push_back(std::move(event));
+}
+
+void KvStateMachine::StorePut(const std::string &key, const std::string &value, int64_t ttlMs, ApplyPartition *part) {
+  m_storage->Put(key, value);
+  RecordEvent(WatchEvent::kPut, key, value, part);
+  // Put覆盖过期时间：从当前逻辑时钟起算，或者不过期
+  int64_t deadline = ttlMs > 0 ? m_clockMs + ttlMs : 0;
+  if (deadline != 0 || ApplyingDeadline(key, part) != 0) {
+    (part != nullptr ? part->PendingTtl : m_pendingTtl).emplace_back(key, deadline);
+  }
+}
+
+void KvStateMachine::StoreAppend(const std::string &key, const std::string &value, ApplyPartition *part) {
+  // Append保留过期时间；追加到已经过期的key等于写一个新的、不过期的key
+  if (ApplyingExpired(key, part)) {
+    StorePut(key, value, 0, part);
+    return;
+  }
+  m_storage->Append(key, value);
+  RecordEvent(WatchEvent::kAppend, key, value, part);
+}
+
+void KvStateMachine::StoreDelete(const std::string &key, ApplyPartition *part) {
+  m_storage->Delete(key);
+  RecordEvent(WatchEvent::kDelete, key, "", part);
+  if (ApplyingDeadline(key, part) != 0) {
+    (part != nullptr ? part->PendingTtl : m_pendingTtl).emplace_back(key, 0);
+  }
+}
+
+void KvStateMachine::StoreWrite(const Op &write, ApplyPartition *part) {
+  if (write.Operation == "Put") {
+    StorePut(write.Key, write.Value, write.TtlMs, part);
+  } else if (write.Operation == "Append") {
+    StoreAppend(write.Key, write.Value, part);
+  } else if (write.Operation == "Delete") {
+    // 多版本引擎里同一批前面的写入还没对读视图可见，不能先读再决定，直接写删除
+    StoreDelete(write.Key, part);
+    ++(part != nullptr ? part->Deleted : m_deletedSinceSnapshot);
+  }
+}
+
+void KvStateMachine::StoreWrites(const std::vector<const Op *> &writes, int index) {
+  const size_t parts = m_applyPool->Size();
+  if (writes.size() < kParallelApplyMinOps || parts <= 1) {
+    for (const Op *write : writes) {
+      StoreWrite(*write);
+    }
+    return;
+  }
+  m_partitions.resize(parts);
+  std::hash<std::string> hasher;
+  for (const Op *write : writes) {
+    m_partitions[hasher(write->Key) % parts].Writes.push_back(write);
+  }
+  // 工作线程只读m_ttl和m_pendingTtl，发布过期时间在所有写入完成之后
+  m_storage->BeginParallelWrites(index);
+  m_applyPool->Run(parts, [this](size_t p) {
+    ApplyPartition &part = m_partitions[p];
+    for (const Op *write : part.Writes) {
+      StoreWrite(*write, &part);
+    }
+  });
+  m_storage->EndParallelWrites();
+  // 按分区顺序合并，各副本得到相同的顺序；同一个key的变化都在一个分区里，先后不变
+  for (auto &part : m_partitions) {
+    m_pendingTtl.insert(m_pendingTtl.end(), std::make_move_iterator(part.PendingTtl.begin()),
+                        std::make_move_iterator(part.PendingTtl.end()));
+    m_pendingEvents.insert(m_pendingEvents.end(), std::make_move_iterator(part.Events.begin()),
+                           std::make_move_iterator(part.Events.end()));
+    m_deletedSinceSnapshot += part.Deleted;
+    part.Writes.clear();
+    part.PendingTtl.clear();
+    part.Events.clear();
+    part.Deleted = 0;
+  }
+}
+
+void KvStateMachine::RefreshReadCache() {
+  if (!m_readCache.Enabled()) {
+    return;
+  }
+  // 每个数据变化都有对应的事件（包括回收过期key），Put带着完整的value，其余只能去掉
+  for (const auto &event : m_pendingEvents) {
+    if (event.Type == WatchEvent::kPut) {
+      m_readCache.Update(event.Key, event.Value);
+    } else {
+      m_readCache.Invalidate(event.Key);
+    }
+  }
+}
+
+void KvStateMachine::RecordSnapshot(size_t bytes) {
+  m_lastSnapshotBytes.store(bytes, std::memory_order_relaxed);
+  m_keysAtLastSnapshot = m_storage->Size();
+  m_deletedSinceSnapshot = 0;
+}
@@ -0,0 +1,71 @@
+#include "LogTail.h"
+
+#include "raft.h"
+
+LogTail::LogTail(std::shared_ptr<Persister> persister, SnapshotDecoder decoder)
+    : m_persister(std::move(persister)), m_decoder(std::move(decoder)) {}
+
+bool LogTail::Read(int64_t fromIndex, int64_t lastIndex, size_t maxEntries, std::vector<Record> *out,
+                   int64_t *snapshotIndex) {
+  std::lock_guard<std::mutex> lg(m_logMtx);
+  // 缓存里的日志都已提交、不会再变，只有请求的起点超出缓存时才需要重新读文件；
+  // 快照索引只增不减，缓存里记的已经覆盖了 fromIndex，文件里的也一定覆盖
+  if (fromIndex <= lastIndex && fromIndex > m_logLastIndex) {
+    reloadLog(lastIndex);
+  }
+  *snapshotIndex = m_logSnapshotIndex;
+  if (fromIndex <= m_logSnapshotIndex) {
+    return false;
+  }
+  // 快照之后的日志索引连续，第一条是 m_logSnapshotIndex + 1
+  for (size_t i = static_cast<size_t>(fromIndex - m_logSnapshotIndex - 1);
+       i < m_logs.size() && out->size() < maxEntries; ++i) {
+    const auto &entry = m_logs[i];
+    if (entry.logindex() > lastIndex) {
+      break;
+    }
+    out->push_back(Record{entry.logindex(), entry.logterm(), entry.command()});
+  }
+  return true;
+}
+
+void LogTail::reloadLog(int64_t lastIndex) {
+  std::string raftState;
+  m_persister->ReadState(&raftState, nullptr);
+  int lastSnapshotIncludeIndex = 0;
+  std::vector<raftRpcProctoc::LogEntry> logs;
+  Raft::DecodePersistedLog(raftState, &lastSnapshotIncludeIndex, &logs);
+  // lastIndex 之后的日志可能还没提交，之后会被覆盖，不能进缓存
+  while (!logs.empty() && logs.back().logindex() > lastIndex) {
+    logs.pop_back();
+  }
+  m_logSnapshotIndex = lastSnapshotIncludeIndex;
+  m_logLastIndex = logs.empty() ? lastSnapshotIncludeIndex : logs.back().logindex();
+  m_logs = std::move(logs);
+}
+
+std::shared_ptr<const LogTail::Snapshot> LogTail::LatestSnapshot() {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  // 版本号没变说明快照没被替换过，直接用缓存，不读文件
+  if (m_snapshot != nullptr && m_persister->Version().Snapshot == m_snapshotVersion) {
+    return m_snapshot;
+  }
+  std::string raftState;
+  std::string data;
+  Persister::StateVersion version;
+  m_persister->ReadState(&raftState, &data, &version);
+  int lastSnapshotIncludeIndex = 0;
+  std::vector<raftRpcProctoc::LogEntry> logs;
+  Raft::DecodePersistedLog(raftState, &lastSnapshotIncludeIndex, &logs);
+  m_snapshotVersion = version.Snapshot;
+  if (m_snapshot != nullptr && m_snapshot->Index == lastSnapshotIncludeIndex) {
+    return m_snapshot;
+  }
+  auto snapshot = std::make_shared<Snapshot>();
+  snapshot->Index = lastSnapshotIncludeIndex;
+  if (!data.empty()) {
+    m_decoder(data, &snapshot->Kvs);
+  }
+  m_snapshot = std::move(snapshot);
+  return m_snapshot;
+}
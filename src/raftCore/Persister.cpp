@@ -71,11 +71,13 @@ void Persister::Save(std::string raftstate, std::string snapshot) {
   std::lock_guard<std::mutex> lg(m_mtx);
   
   // 保存 RaftState
-  m_pendingRaftState = raftstate;
+  m_raftStateVersion++;
+  m_snapshotVersion++;
+  m_pendingRaftState = std::move(raftstate);
   flushRaftState(true);  // 立即刷盘（保证一致性）
   
   // 保存 Snapshot
-  m_pendingSnapshot = snapshot;
+  m_pendingSnapshot = std::move(snapshot);
   flushSnapshot(true);   // 立即刷盘
 }
 
@@ -83,6 +85,7 @@ void Persister::SaveRaftState(const std::string& data) {
   std::lock_guard<std::mutex> lg(m_mtx);
   
   // 添加到待刷盘缓冲区
+  m_raftStateVersion++;
   m_pendingRaftState = data;
   
   // 检查是否需要刷盘
@@ -148,6 +151,42 @@ std::string Persister::ReadSnapshot() {
   }
 }
 
+void Persister::ReadState(std::string* raftState, std::string* snapshot, StateVersion* version) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+
+  // Save() 在同一把锁内先后写两个文件，这里也在一把锁内读，拿到的快照和日志是同一时刻的
+  flushRaftState(true);
+  *raftState = decodeFile(readFile(m_raftStateFileName));
+  if (snapshot != nullptr) {
+    flushSnapshot(true);
+    *snapshot = decodeFile(readFile(m_snapshotFileName));
+  }
+  if (version != nullptr) {
+    version->RaftState = m_raftStateVersion;
+    version->Snapshot = m_snapshotVersion;
+  }
+}
+
+Persister::StateVersion Persister::Version() {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  StateVersion version;
+  version.RaftState = m_raftStateVersion;
+  version.Snapshot = m_snapshotVersion;
+  return version;
+}
+
+std::string Persister::decodeFile(const std::string& fileData) {
+  if (fileData.empty()) {
+    return "";
+  }
+  try {
+    Compressor::Type type;
+    return Compressor::decompressAdaptive(fileData, &type);
+  } catch (const std::exception& e) {
+    return fileData;  // 未压缩的旧数据
+  }
+}
+
 long long Persister::RaftStateSize() {
   std::lock_guard<std::mutex> lg(m_mtx);
   return m_raftStateSize;
@@ -335,6 +374,7 @@ std::string Persister::readFile(const std::string& filename) {
 
 void Persister::clearRaftState() {
   m_raftStateSize = 0;
+  m_raftStateVersion++;
   m_pendingRaftState.clear();
   
   // 清空文件
@@ -349,6 +389,7 @@ void Persister::clearRaftState() {
 
 void Persister::clearSnapshot() {
   m_snapshotSize = 0;
+  m_snapshotVersion++;
   m_pendingSnapshot.clear();
   
   // 清空文件
@@ -0,0 +1,226 @@
+#include "ReadCache.h"
+
+#include <functional>
+#include <iterator>
+#include <mutex>
+
+namespace {
+
+// 每个缓存项除 key 和 value 之外的大致开销（链表节点、哈希表项）
+constexpr size_t kEntryOverhead = 96;
+// 频率上限，主队列里一个 key 最多连续被跳过这么多次
+constexpr uint8_t kMaxFreq = 3;
+
+}  // namespace
+
+ReadCache::ReadCache(size_t capacityBytes, size_t shards)
+    : m_capacity(capacityBytes),
+      m_shardCount(shards == 0 ? 1 : shards),
+      m_shardCapacity(capacityBytes / m_shardCount),
+      m_maxCharge(m_shardCapacity / 8),
+      m_shards(new Shard[m_shardCount]) {}
+
+size_t ReadCache::chargeOf(const std::string &key, const std::string &value) {
+  return key.size() + value.size() + kEntryOverhead;
+}
+
+ReadCache::Shard &ReadCache::shardOf(const std::string &key) const {
+  return m_shards[std::hash<std::string>()(key) % m_shardCount];
+}
+
+bool ReadCache::Lookup(const std::string &key, std::string *value, uint64_t *ticket) {
+  if (!Enabled()) {
+    *ticket = 0;
+    return false;
+  }
+  Shard &shard = shardOf(key);
+  {
+    std::shared_lock<std::shared_mutex> lock(shard.mtx);
+    auto it = shard.index.find(key);
+    if (it != shard.index.end()) {
+      Entry &entry = *it->second;
+      *value = entry.value;
+      // 并发命中可能丢掉几次计数，频率只用来决定淘汰顺序，不需要精确
+      uint8_t freq = entry.freq.load(std::memory_order_relaxed);
+      if (freq < kMaxFreq) {
+        entry.freq.store(freq + 1, std::memory_order_relaxed);
+      }
+      shard.hits.fetch_add(1, std::memory_order_relaxed);
+      return true;
+    }
+    *ticket = shard.epoch;
+  }
+  shard.misses.fetch_add(1, std::memory_order_relaxed);
+  return false;
+}
+
+void ReadCache::Fill(const std::string &key, const std::string &value, uint64_t ticket) {
+  if (!Enabled()) {
+    return;
+  }
+  const size_t charge = chargeOf(key, value);
+  if (charge > m_maxCharge) {
+    return;
+  }
+  Shard &shard = shardOf(key);
+  std::lock_guard<std::shared_mutex> lock(shard.mtx);
+  if (shard.epoch != ticket || shard.index.count(key) != 0) {
+    return;
+  }
+  // 幽灵队列里的 key 最近刚从小队列淘汰过，说明不是只读一次的，直接进主队列
+  bool toMain = false;
+  auto ghost = shard.ghostIndex.find(key);
+  if (ghost != shard.ghostIndex.end()) {
+    shard.ghost.erase(ghost->second);
+    shard.ghostIndex.erase(ghost);
+    toMain = true;
+  }
+  EntryList &list = toMain ? shard.main : shard.small;
+  list.emplace_front();
+  Entry &entry = list.front();
+  entry.key = key;
+  entry.value = value;
+  entry.inMain = toMain;
+  shard.index.emplace(key, list.begin());
+  shard.bytes += charge;
+  if (!toMain) {
+    shard.smallBytes += charge;
+  }
+  shard.fills.fetch_add(1, std::memory_order_relaxed);
+  evict(shard);
+}
+
+void ReadCache::Update(const std::string &key, const std::string &value) {
+  if (!Enabled()) {
+    return;
+  }
+  Shard &shard = shardOf(key);
+  std::lock_guard<std::shared_mutex> lock(shard.mtx);
+  ++shard.epoch;
+  auto it = shard.index.find(key);
+  if (it == shard.index.end()) {
+    return;
+  }
+  const size_t charge = chargeOf(key, value);
+  if (charge > m_maxCharge) {
+    erase(shard, it->second);
+    return;
+  }
+  Entry &entry = *it->second;
+  const size_t old = chargeOf(entry.key, entry.value);
+  entry.value = value;
+  shard.bytes = shard.bytes - old + charge;
+  if (!entry.inMain) {
+    shard.smallBytes = shard.smallBytes - old + charge;
+  }
+  evict(shard);
+}
+
+void ReadCache::Invalidate(const std::string &key) {
+  if (!Enabled()) {
+    return;
+  }
+  Shard &shard = shardOf(key);
+  std::lock_guard<std::shared_mutex> lock(shard.mtx);
+  ++shard.epoch;
+  auto it = shard.index.find(key);
+  if (it != shard.index.end()) {
+    erase(shard, it->second);
+  }
+}
+
+void ReadCache::Clear() {
+  if (!Enabled()) {
+    return;
+  }
+  for (size_t i = 0; i < m_shardCount; ++i) {
+    Shard &shard = m_shards[i];
+    std::lock_guard<std::shared_mutex> lock(shard.mtx);
+    ++shard.epoch;
+    shard.index.clear();
+    shard.small.clear();
+    shard.main.clear();
+    shard.ghostIndex.clear();
+    shard.ghost.clear();
+    shard.smallBytes = 0;
+    shard.bytes = 0;
+  }
+}
+
+ReadCache::Stats ReadCache::GetStats() const {
+  Stats stats;
+  for (size_t i = 0; i < m_shardCount; ++i) {
+    const Shard &shard = m_shards[i];
+    stats.Hits += shard.hits.load(std::memory_order_relaxed);
+    stats.Misses += shard.misses.load(std::memory_order_relaxed);
+    stats.Fills += shard.fills.load(std::memory_order_relaxed);
+    stats.Evictions += shard.evictions.load(std::memory_order_relaxed);
+    std::shared_lock<std::shared_mutex> lock(shard.mtx);
+    stats.Entries += shard.index.size();
+    stats.Bytes += shard.bytes;
+  }
+  return stats;
+}
+
+void ReadCache::erase(Shard &shard, EntryList::iterator it) {
+  const size_t charge = chargeOf(it->key, it->value);
+  shard.bytes -= charge;
+  if (!it->inMain) {
+    shard.smallBytes -= charge;
+  }
+  shard.index.erase(it->key);
+  (it->inMain ? shard.main : shard.small).erase(it);
+}
+
+void ReadCache::evict(Shard &shard) {
+  while (shard.bytes > m_shardCapacity) {
+    // 小队列超过容量的 10%（或者主队列已空）时从小队列淘汰，否则从主队列淘汰
+    if (!shard.small.empty() && (shard.smallBytes * 10 > m_shardCapacity || shard.main.empty())) {
+      evictSmall(shard);
+    } else {
+      evictMain(shard);
+    }
+  }
+}
+
+void ReadCache::evictSmall(Shard &shard) {
+  auto it = std::prev(shard.small.end());
+  const size_t charge = chargeOf(it->key, it->value);
+  if (it->freq.load(std::memory_order_relaxed) > 1) {
+    // 在小队列里被读过不止一次，转入主队列，频率重新计
+    it->freq.store(0, std::memory_order_relaxed);
+    it->inMain = true;
+    shard.smallBytes -= charge;
+    shard.main.splice(shard.main.begin(), shard.small, it);
+    return;
+  }
+  remember(shard, it->key);
+  shard.evictions.fetch_add(1, std::memory_order_relaxed);
+  erase(shard, it);
+}
+
+void ReadCache::evictMain(Shard &shard) {
+  auto it = std::prev(shard.main.end());
+  uint8_t freq = it->freq.load(std::memory_order_relaxed);
+  if (freq > 0) {
+    // 独占锁下没有并发的命中，频率每轮减一，最多转 kMaxFreq 圈
+    it->freq.store(freq - 1, std::memory_order_relaxed);
+    shard.main.splice(shard.main.begin(), shard.main, it);
+    return;
+  }
+  shard.evictions.fetch_add(1, std::memory_order_relaxed);
+  erase(shard, it);
+}
+
+void ReadCache::remember(Shard &shard, const std::string &key) {
+  // 幽灵队列只存 key，长度与缓存中的 key 数相当
+  if (shard.ghostIndex.count(key) != 0) {
+    return;
+  }
+  shard.ghost.push_front(key);
+  shard.ghostIndex.emplace(key, shard.ghost.begin());
+  while (shard.ghost.size() > shard.index.size() + 1) {
+    shard.ghostIndex.erase(shard.ghost.back());
+    shard.ghost.pop_back();
+  }
+}
@@ -0,0 +1,117 @@
+#include "SessionTable.h"
+
+namespace {
+
+const char kRegisteredPrefix = '#';
+
+}  // namespace
+
+SessionTable::SessionTable(int64_t leaseMs, size_t maxSessions) : m_leaseMs(leaseMs), m_maxSessions(maxSessions) {}
+
+std::string SessionTable::ClientIdOf(uint64_t sessionId) { return kRegisteredPrefix + std::to_string(sessionId); }
+
+bool SessionTable::IsRegistered(const std::string &clientId) {
+  return !clientId.empty() && clientId[0] == kRegisteredPrefix;
+}
+
+std::string SessionTable::Register(uint64_t sessionId, int64_t nowMs) {
+  std::string clientId = ClientIdOf(sessionId);
+  touch(clientId, nowMs);
+  evictOverflow();
+  return clientId;
+}
+
+bool SessionTable::Rejects(const std::string &clientId) const {
+  return IsRegistered(clientId) && m_sessions.find(clientId) == m_sessions.end();
+}
+
+bool SessionTable::IsDuplicate(const std::string &clientId, int requestId) const {
+  auto it = m_sessions.find(clientId);
+  return it != m_sessions.end() && requestId <= it->second.session.LastRequestId;
+}
+
+void SessionTable::Record(const std::string &clientId, int requestId, int64_t nowMs) {
+  Session &session = touch(clientId, nowMs);
+  session.LastRequestId = requestId;
+  evictOverflow();
+}
+
+void SessionTable::Touch(const std::string &clientId, int64_t nowMs) {
+  if (m_sessions.find(clientId) != m_sessions.end()) {
+    touch(clientId, nowMs);
+  }
+}
+
+void SessionTable::RecordTxn(const std::string &clientId, int requestId, TxnResponse resp) {
+  auto it = m_sessions.find(clientId);
+  if (it == m_sessions.end()) {
+    return;
+  }
+  it->second.session.TxnRequestId = requestId;
+  it->second.session.TxnResult = std::move(resp);
+}
+
+bool SessionTable::TxnResult(const std::string &clientId, int requestId, TxnResponse *resp) const {
+  auto it = m_sessions.find(clientId);
+  if (it == m_sessions.end() || it->second.session.TxnRequestId != requestId) {
+    return false;
+  }
+  *resp = it->second.session.TxnResult;
+  return true;
+}
+
+size_t SessionTable::Expire(int64_t nowMs, size_t maxExpire) {
+  size_t expired = 0;
+  while (expired < maxExpire && !m_lru.empty()) {
+    auto it = m_sessions.find(m_lru.front());
+    if (it->second.session.LastActiveMs + m_leaseMs > nowMs) {
+      break;
+    }
+    m_sessions.erase(it);
+    m_lru.pop_front();
+    ++expired;
+  }
+  return expired;
+}
+
+void SessionTable::RestoreLegacy(const std::unordered_map<std::string, int> &lastRequestId,
+                                 std::unordered_map<std::string, std::pair<int, TxnResponse>> &&lastTxnResult,
+                                 int64_t nowMs) {
+  Clear();
+  for (const auto &item : lastRequestId) {
+    touch(item.first, nowMs).LastRequestId = item.second;
+  }
+  for (auto &item : lastTxnResult) {
+    RecordTxn(item.first, item.second.first, std::move(item.second.second));
+  }
+  evictOverflow();
+}
+
+void SessionTable::Restore(const std::string &clientId, Session session) {
+  auto pos = m_lru.insert(m_lru.end(), clientId);
+  m_sessions[clientId] = Slot{std::move(session), pos};
+}
+
+void SessionTable::Clear() {
+  m_sessions.clear();
+  m_lru.clear();
+}
+
+SessionTable::Session &SessionTable::touch(const std::string &clientId, int64_t nowMs) {
+  auto it = m_sessions.find(clientId);
+  if (it == m_sessions.end()) {
+    auto pos = m_lru.insert(m_lru.end(), clientId);
+    it = m_sessions.emplace(clientId, Slot{Session(), pos}).first;
+  } else {
+    m_lru.splice(m_lru.end(), m_lru, it->second.pos);
+  }
+  it->second.session.LastActiveMs = nowMs;
+  return it->second.session;
+}
+
+void SessionTable::evictOverflow() {
+  while (m_sessions.size() > m_maxSessions) {
+    m_sessions.erase(m_lru.front());
+    m_lru.pop_front();
+  }
+}
@@ -0,0 +1,168 @@
+#include "ShardedSessionTable.h"
+
+#include <stdexcept>
+
+namespace {
+
+uint64_t fnv1a(const std::string &s) {
+  uint64_t h = 0xcbf29ce484222325ULL;
+  for (unsigned char c : s) {
+    h ^= c;
+    h *= 0x100000001b3ULL;
+  }
+  return h;
+}
+
+}  // namespace
+
+ShardedSessionTable::ShardedSessionTable(int64_t leaseMs, size_t maxSessions, size_t shards)
+    : m_shardCount(shards == 0 ? 1 : shards), m_shards(new Shard[m_shardCount]) {
+  // 上限向上取整，总数不低于 maxSessions
+  size_t perShard = (maxSessions + m_shardCount - 1) / m_shardCount;
+  for (size_t i = 0; i < m_shardCount; ++i) {
+    m_shards[i].table = SessionTable(leaseMs, perShard == 0 ? 1 : perShard);
+  }
+}
+
+ShardedSessionTable::Shard &ShardedSessionTable::shardOf(const std::string &clientId) const {
+  return m_shards[fnv1a(clientId) % m_shardCount];
+}
+
+std::vector<std::unique_lock<std::mutex>> ShardedSessionTable::lockAll() const {
+  std::vector<std::unique_lock<std::mutex>> locks;
+  locks.reserve(m_shardCount);
+  for (size_t i = 0; i < m_shardCount; ++i) {
+    locks.emplace_back(m_shards[i].mtx);
+  }
+  return locks;
+}
+
+std::string ShardedSessionTable::Register(uint64_t sessionId, int64_t nowMs) {
+  std::string clientId = SessionTable::ClientIdOf(sessionId);
+  Shard &shard = shardOf(clientId);
+  std::lock_guard<std::mutex> lg(shard.mtx);
+  return shard.table.Register(sessionId, nowMs);
+}
+
+bool ShardedSessionTable::Rejects(const std::string &clientId) const {
+  if (!SessionTable::IsRegistered(clientId)) {
+    return false;
+  }
+  Shard &shard = shardOf(clientId);
+  std::lock_guard<std::mutex> lg(shard.mtx);
+  return shard.table.Rejects(clientId);
+}
+
+bool ShardedSessionTable::IsDuplicate(const std::string &clientId, int requestId) const {
+  Shard &shard = shardOf(clientId);
+  std::lock_guard<std::mutex> lg(shard.mtx);
+  return shard.table.IsDuplicate(clientId, requestId);
+}
+
+void ShardedSessionTable::Record(const std::string &clientId, int requestId, int64_t nowMs) {
+  Shard &shard = shardOf(clientId);
+  std::lock_guard<std::mutex> lg(shard.mtx);
+  shard.table.Record(clientId, requestId, nowMs);
+}
+
+void ShardedSessionTable::Touch(const std::string &clientId, int64_t nowMs) {
+  Shard &shard = shardOf(clientId);
+  std::lock_guard<std::mutex> lg(shard.mtx);
+  shard.table.Touch(clientId, nowMs);
+}
+
+void ShardedSessionTable::RecordTxn(const std::string &clientId, int requestId, int64_t nowMs, TxnResponse resp) {
+  Shard &shard = shardOf(clientId);
+  std::lock_guard<std::mutex> lg(shard.mtx);
+  shard.table.Record(clientId, requestId, nowMs);
+  shard.table.RecordTxn(clientId, requestId, std::move(resp));
+}
+
+bool ShardedSessionTable::TxnResult(const std::string &clientId, int requestId, TxnResponse *resp) const {
+  Shard &shard = shardOf(clientId);
+  std::lock_guard<std::mutex> lg(shard.mtx);
+  return shard.table.TxnResult(clientId, requestId, resp);
+}
+
+size_t ShardedSessionTable::Expire(int64_t nowMs, size_t maxExpire) {
+  size_t expired = 0;
+  for (size_t i = 0; i < m_shardCount && expired < maxExpire; ++i) {
+    std::lock_guard<std::mutex> lg(m_shards[i].mtx);
+    expired += m_shards[i].table.Expire(nowMs, maxExpire - expired);
+  }
+  return expired;
+}
+
+void ShardedSessionTable::RestoreLegacy(const std::unordered_map<std::string, int> &lastRequestId,
+                                        std::unordered_map<std::string, std::pair<int, TxnResponse>> &&lastTxnResult,
+                                        int64_t nowMs) {
+  std::vector<std::unordered_map<std::string, int>> requestIds(m_shardCount);
+  std::vector<std::unordered_map<std::string, std::pair<int, TxnResponse>>> txnResults(m_shardCount);
+  for (const auto &item : lastRequestId) {
+    requestIds[fnv1a(item.first) % m_shardCount].insert(item);
+  }
+  for (auto &item : lastTxnResult) {
+    txnResults[fnv1a(item.first) % m_shardCount].emplace(item.first, std::move(item.second));
+  }
+  auto locks = lockAll();
+  for (size_t i = 0; i < m_shardCount; ++i) {
+    m_shards[i].table.RestoreLegacy(requestIds[i], std::move(txnResults[i]), nowMs);
+  }
+}
+
+void ShardedSessionTable::Assign(ShardedSessionTable &&other) {
+  if (other.m_shardCount != m_shardCount) {
+    throw std::invalid_argument("session table shard count mismatch");
+  }
+  auto locks = lockAll();
+  auto otherLocks = other.lockAll();
+  for (size_t i = 0; i < m_shardCount; ++i) {
+    m_shards[i].table = std::move(other.m_shards[i].table);
+  }
+}
+
+void ShardedSessionTable::Clear() {
+  auto locks = lockAll();
+  for (size_t i = 0; i < m_shardCount; ++i) {
+    m_shards[i].table.Clear();
+  }
+}
+
+size_t ShardedSessionTable::Size() const {
+  size_t size = 0;
+  for (size_t i = 0; i < m_shardCount; ++i) {
+    std::lock_guard<std::mutex> lg(m_shards[i].mtx);
+    size += m_shards[i].table.Size();
+  }
+  return size;
+}
+
+std::vector<std::pair<const std::string *, const SessionTable::Session *>> ShardedSessionTable::mergeByActivity()
+    const {
+  using Entry = std::pair<const std::string *, const SessionTable::Session *>;
+  std::vector<std::vector<Entry>> lists(m_shardCount);
+  size_t total = 0;
+  for (size_t i = 0; i < m_shardCount; ++i) {
+    m_shards[i].table.ForEach([&lists, i](const std::string &clientId, const SessionTable::Session &session) {
+      lists[i].emplace_back(&clientId, &session);
+    });
+    total += lists[i].size();
+  }
+  // 分片数很小，每次线性挑出活跃时间最早的分片头
+  std::vector<Entry> merged;
+  merged.reserve(total);
+  std::vector<size_t> pos(m_shardCount, 0);
+  while (merged.size() < total) {
+    size_t best = m_shardCount;
+    for (size_t i = 0; i < m_shardCount; ++i) {
+      if (pos[i] == lists[i].size()) {
+        continue;
+      }
+      if (best == m_shardCount || lists[i][pos[i]].second->LastActiveMs < lists[best][pos[best]].second->LastActiveMs) {
+        best = i;
+      }
+    }
+    merged.push_back(lists[best][pos[best]++]);
+  }
+  return merged;
+}
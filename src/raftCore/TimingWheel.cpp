@@ -0,0 +1,110 @@
+#include "TimingWheel.h"
+
+#include <algorithm>
+
+TimingWheel::TimingWheel(int64_t tickMs) : m_tickMs(std::max<int64_t>(tickMs, 1)), m_current(0), m_size(0) {
+  for (auto &level : m_slots) {
+    level.resize(kSlots);
+  }
+  std::fill(std::begin(m_levelSize), std::end(m_levelSize), 0);
+}
+
+void TimingWheel::Reset(int64_t nowMs) {
+  for (auto &level : m_slots) {
+    for (auto &slot : level) {
+      slot.clear();
+    }
+  }
+  m_overdue.clear();
+  m_size = 0;
+  std::fill(std::begin(m_levelSize), std::end(m_levelSize), 0);
+  m_current = std::max<int64_t>(nowMs, 0) / m_tickMs;
+}
+
+int64_t TimingWheel::tickOf(int64_t ms) const {
+  if (ms <= 0) {
+    return 0;
+  }
+  return (ms + m_tickMs - 1) / m_tickMs;
+}
+
+void TimingWheel::Add(const std::string &key, int64_t deadlineMs) {
+  place(Entry{key, deadlineMs}, tickOf(deadlineMs), &m_overdue);
+}
+
+void TimingWheel::place(Entry entry, int64_t tick, std::vector<Entry> *due) {
+  int64_t delta = tick - m_current;
+  if (delta <= 0) {
+    due->push_back(std::move(entry));
+    return;
+  }
+  if (delta >= kMaxSpan) {
+    // 超出范围：先挂在最高层，下移时再按真实到期时间放置
+    tick = m_current + kMaxSpan - 1;
+    delta = kMaxSpan - 1;
+  }
+  int level = 0;
+  while (delta >= (int64_t{1} << ((level + 1) * kSlotBits))) {
+    ++level;
+  }
+  int64_t idx = (tick >> (level * kSlotBits)) & kSlotMask;
+  m_slots[level][idx].push_back(std::move(entry));
+  ++m_size;
+  ++m_levelSize[level];
+}
+
+void TimingWheel::cascade(int level, std::vector<Entry> *due) {
+  int64_t idx = (m_current >> (level * kSlotBits)) & kSlotMask;
+  std::vector<Entry> entries;
+  entries.swap(m_slots[level][idx]);
+  m_size -= entries.size();
+  m_levelSize[level] -= entries.size();
+  for (auto &entry : entries) {
+    int64_t tick = tickOf(entry.deadlineMs);
+    place(std::move(entry), tick, due);
+  }
+}
+
+void TimingWheel::Advance(int64_t nowMs, std::vector<Entry> *due) {
+  for (auto &entry : m_overdue) {
+    due->push_back(std::move(entry));
+  }
+  m_overdue.clear();
+
+  const int64_t target = std::max<int64_t>(nowMs, 0) / m_tickMs;
+  while (m_current < target) {
+    int lowest = 0;
+    while (lowest < kLevels && m_levelSize[lowest] == 0) {
+      ++lowest;
+    }
+    if (lowest == kLevels) {
+      // 轮上没有条目，直接跳到目标时间
+      m_current = target;
+      break;
+    }
+    if (lowest > 0) {
+      // 更低的层都是空的，下一个可能有事发生的时刻是第 lowest 层的下一个槽边界
+      const int64_t span = int64_t{1} << (lowest * kSlotBits);
+      const int64_t next = (m_current / span + 1) * span;
+      if (next > target) {
+        m_current = target;
+        break;
+      }
+      m_current = next - 1;
+    }
+    ++m_current;
+    // 先下移高层的槽，下移的条目可能正好落在本 tick 的第 0 层槽里
+    for (int level = kLevels - 1; level > 0; --level) {
+      if ((m_current & ((int64_t{1} << (level * kSlotBits)) - 1)) == 0) {
+        cascade(level, due);
+      }
+    }
+    auto &slot = m_slots[0][m_current & kSlotMask];
+    m_size -= slot.size();
+    m_levelSize[0] -= slot.size();
+    for (auto &entry : slot) {
+      due->push_back(std::move(entry));
+    }
+    slot.clear();
+  }
+}
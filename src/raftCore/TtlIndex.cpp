@@ -0,0 +1,36 @@
+#include "TtlIndex.h"
+
+void TtlIndex::Set(const std::string &key, int64_t deadlineMs) {
+  if (deadlineMs <= 0) {
+    Clear(key);
+    return;
+  }
+  m_deadlines[key] = deadlineMs;
+  m_wheel.Add(key, deadlineMs);
+}
+
+void TtlIndex::CollectExpired(int64_t nowMs, size_t max, std::vector<TimingWheel::Entry> *expired) {
+  std::vector<TimingWheel::Entry> due;
+  m_wheel.Advance(nowMs, &due);
+  for (auto &entry : due) {
+    m_due.push_back(std::move(entry));
+  }
+  while (expired->size() < max && !m_due.empty()) {
+    TimingWheel::Entry entry = std::move(m_due.front());
+    m_due.pop_front();
+    auto it = m_deadlines.find(entry.key);
+    if (it == m_deadlines.end() || it->second != entry.deadlineMs) {
+      continue;  // 已经被覆盖、删除或者重新设置了过期时间
+    }
+    expired->push_back(std::move(entry));
+  }
+}
+
+void TtlIndex::Restore(std::unordered_map<std::string, int64_t> deadlines, int64_t nowMs) {
+  m_deadlines = std::move(deadlines);
+  m_due.clear();
+  m_wheel.Reset(nowMs);
+  for (const auto &item : m_deadlines) {
+    m_wheel.Add(item.first, item.second);
+  }
+}
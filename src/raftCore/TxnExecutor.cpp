@@ -0,0 +1,187 @@
+#include "TxnExecutor.h"
+
+#include <cerrno>
+#include <cstdlib>
+#include <limits>
+#include <unordered_map>
+
+namespace {
+
+const std::string kErrNotInteger = "value is not an integer";
+const std::string kErrOverflow = "increment overflows int64";
+const std::string kErrUnknownOp = "unknown txn op";
+
+template <typename T>
+bool compareOrdered(const T &actual, const T &expected, int result) {
+  switch (result) {
+    case TxnCompare::kEqual:
+      return actual == expected;
+    case TxnCompare::kNotEqual:
+      return actual != expected;
+    case TxnCompare::kGreater:
+      return actual > expected;
+    case TxnCompare::kLess:
+      return actual < expected;
+    default:
+      return false;
+  }
+}
+
+bool parseInt64(const std::string &s, int64_t *out) {
+  if (s.empty()) {
+    *out = 0;  // 不存在或空值按 0 计数
+    return true;
+  }
+  errno = 0;
+  char *end = nullptr;
+  long long v = std::strtoll(s.c_str(), &end, 10);
+  if (errno != 0 || end != s.c_str() + s.size()) {
+    return false;
+  }
+  *out = v;
+  return true;
+}
+
+// 事务内的覆盖层：第一次访问某个 key 时从存储读，之后读写都在这里
+class Overlay {
+ public:
+  explicit Overlay(const std::function<bool(const std::string &, std::string *)> &get) : m_get(get) {}
+
+  struct Entry {
+    bool exists;
+    std::string value;
+  };
+
+  Entry &at(const std::string &key) {
+    auto it = m_entries.find(key);
+    if (it == m_entries.end()) {
+      Entry e;
+      e.exists = m_get(key, &e.value);
+      if (!e.exists) e.value.clear();
+      it = m_entries.emplace(key, std::move(e)).first;
+    }
+    return it->second;
+  }
+
+ private:
+  const std::function<bool(const std::string &, std::string *)> &m_get;
+  std::unordered_map<std::string, Entry> m_entries;
+};
+
+bool evaluateCompare(const TxnCompare &cmp, const std::function<bool(const std::string &, std::string *)> &get,
+                     const std::function<bool(const std::string &, int64_t *)> &version) {
+  switch (cmp.Target) {
+    case TxnCompare::kValue: {
+      std::string value;
+      if (!get(cmp.Key, &value)) {
+        return false;
+      }
+      return compareOrdered(value, cmp.Value, cmp.Result);
+    }
+    case TxnCompare::kExists: {
+      std::string value;
+      bool exists = get(cmp.Key, &value);
+      if (cmp.Result == TxnCompare::kEqual) return exists == cmp.Exists;
+      if (cmp.Result == TxnCompare::kNotEqual) return exists != cmp.Exists;
+      return false;
+    }
+    case TxnCompare::kVersion: {
+      int64_t v = 0;
+      if (!version(cmp.Key, &v)) {
+        return false;
+      }
+      return compareOrdered(v, cmp.Version, cmp.Result);
+    }
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+TxnResponse ExecuteTxn(const TxnRequest &txn, const std::function<bool(const std::string &, std::string *)> &get,
+                       const std::function<bool(const std::string &, int64_t *)> &version,
+                       std::vector<TxnWrite> *writes) {
+  writes->clear();
+  TxnResponse resp;
+  resp.Succeeded = true;
+  for (const auto &cmp : txn.Compares) {
+    if (!evaluateCompare(cmp, get, version)) {
+      resp.Succeeded = false;
+      break;
+    }
+  }
+
+  const std::vector<TxnOp> &ops = resp.Succeeded ? txn.Success : txn.Failure;
+  Overlay overlay(get);
+  std::vector<TxnWrite> staged;
+  resp.Results.reserve(ops.size());
+  for (const auto &op : ops) {
+    Overlay::Entry &entry = overlay.at(op.Key);
+    TxnOpResult result;
+    result.Exist = entry.exists;
+    switch (op.Op) {
+      case TxnOp::kGet:
+        result.Value = entry.value;
+        break;
+      case TxnOp::kPut:
+        entry.exists = true;
+        entry.value = op.Value;
+        result.Applied = true;
+        staged.push_back({TxnWrite::Kind::kPut, op.Key, op.Value});
+        break;
+      case TxnOp::kAppend:
+        entry.exists = true;
+        entry.value.append(op.Value);
+        result.Applied = true;
+        staged.push_back({TxnWrite::Kind::kAppend, op.Key, op.Value});
+        break;
+      case TxnOp::kDelete:
+        result.Applied = entry.exists;
+        if (entry.exists) {
+          entry.exists = false;
+          entry.value.clear();
+          staged.push_back({TxnWrite::Kind::kDelete, op.Key, ""});
+        }
+        break;
+      case TxnOp::kIncrement: {
+        int64_t current = 0;
+        if (!parseInt64(entry.value, &current)) {
+          resp.Err = kErrNotInteger + ": " + op.Key;
+          break;
+        }
+        if ((op.Delta > 0 && current > std::numeric_limits<int64_t>::max() - op.Delta) ||
+            (op.Delta < 0 && current < std::numeric_limits<int64_t>::min() - op.Delta)) {
+          resp.Err = kErrOverflow + ": " + op.Key;
+          break;
+        }
+        entry.exists = true;
+        entry.value = std::to_string(current + op.Delta);
+        result.Applied = true;
+        result.Value = entry.value;
+        staged.push_back({TxnWrite::Kind::kPut, op.Key, entry.value});
+        break;
+      }
+      case TxnOp::kAppendIfAbsent:
+        // 当前值中已经包含这段内容时不追加，重复执行结果不变（集合式追加）
+        if (entry.exists && entry.value.find(op.Value) != std::string::npos) {
+          break;
+        }
+        entry.exists = true;
+        entry.value.append(op.Value);
+        result.Applied = true;
+        staged.push_back({TxnWrite::Kind::kAppend, op.Key, op.Value});
+        break;
+      default:
+        resp.Err = kErrUnknownOp;
+        break;
+    }
+    if (!resp.Err.empty()) {
+      resp.Results.clear();
+      return resp;
+    }
+    resp.Results.push_back(std::move(result));
+  }
+  *writes = std::move(staged);
+  return resp;
+}
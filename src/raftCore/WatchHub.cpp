@@ -0,0 +1,245 @@
+#include "WatchHub.h"
+
+#include <algorithm>
+#include <unordered_set>
+
+namespace {
+
+constexpr std::chrono::seconds kWatcherIdleTimeout(30);
+constexpr int64_t kEvictIdleEvery = 256;  // 每发布这么多条日志检查一次空闲的 watcher
+
+size_t eventBytes(const WatchEvent &e) { return e.Key.size() + e.Value.size() + sizeof(WatchEvent); }
+
+}  // namespace
+
+WatchHub::WatchHub(size_t historyEvents, size_t historyBytes, size_t watcherEvents, size_t watcherBytes,
+                   size_t maxWatchers)
+    : m_historyEvents(historyEvents),
+      m_historyBytes(historyBytes),
+      m_watcherEvents(watcherEvents),
+      m_watcherBytes(watcherBytes),
+      m_maxWatchers(maxWatchers) {}
+
+bool WatchHub::matches(const Watcher &w, const std::string &key) const {
+  return w.prefix ? key.compare(0, w.key.size(), w.key) == 0 : key == w.key;
+}
+
+void WatchHub::compact(Watcher *w) {
+  // 从后往前：某个 key 后面已经有 PUT/DELETE 的话，前面的事件都被覆盖
+  std::unordered_set<std::string> superseded;
+  std::deque<WatchEvent> kept;
+  size_t bytes = 0;
+  for (auto it = w->buffer.rbegin(); it != w->buffer.rend(); ++it) {
+    if (superseded.count(it->Key) != 0) {
+      continue;
+    }
+    if (it->Type != WatchEvent::kAppend) {
+      superseded.insert(it->Key);
+    }
+    bytes += eventBytes(*it);
+    kept.push_front(std::move(*it));
+  }
+  w->buffer.swap(kept);
+  w->bytes = bytes;
+}
+
+void WatchHub::deliver(Watcher *w, const WatchEvent &event) {
+  if (w->resync || event.Index < w->fromIndex || !matches(*w, event.Key)) {
+    return;
+  }
+  w->buffer.push_back(event);
+  w->bytes += eventBytes(event);
+  if (w->buffer.size() <= m_watcherEvents && w->bytes <= m_watcherBytes) {
+    return;
+  }
+  compact(w);
+  if (w->buffer.size() > m_watcherEvents || w->bytes > m_watcherBytes) {
+    // 压缩后仍然放不下：这个 watcher 跟不上，丢掉缓冲等它重新同步
+    w->buffer.clear();
+    w->bytes = 0;
+    w->resync = true;
+  }
+}
+
+void WatchHub::Publish(int64_t index, std::vector<WatchEvent> events) {
+  std::vector<Ready> ready;
+  {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    m_lastPublished = index;
+    for (auto &event : events) {
+      event.Index = index;
+      for (auto &item : m_watchers) {
+        deliver(&item.second, event);
+      }
+      m_historyBytesUsed += eventBytes(event);
+      m_history.push_back(std::move(event));
+    }
+    while (!m_history.empty() && (m_history.size() > m_historyEvents || m_historyBytesUsed > m_historyBytes)) {
+      m_compacted = std::max(m_compacted, m_history.front().Index);
+      m_historyBytesUsed -= eventBytes(m_history.front());
+      m_history.pop_front();
+    }
+    if (index % kEvictIdleEvery == 0) {
+      evictIdle(Clock::now());
+    }
+    if (!events.empty()) {
+      for (auto it = m_watchers.begin(); it != m_watchers.end();) {
+        const Watcher &w = it->second;
+        it = w.pending && (w.resync || !w.buffer.empty()) ? complete(it, &ready) : std::next(it);
+      }
+    }
+  }
+  runAll(&ready);
+}
+
+void WatchHub::Reset(int64_t index) {
+  std::vector<Ready> ready;
+  {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    m_history.clear();
+    m_historyBytesUsed = 0;
+    m_compacted = index;
+    m_lastPublished = index;
+    for (auto it = m_watchers.begin(); it != m_watchers.end();) {
+      Watcher &w = it->second;
+      w.buffer.clear();
+      w.bytes = 0;
+      w.resync = true;
+      it = w.pending ? complete(it, &ready) : std::next(it);
+    }
+  }
+  runAll(&ready);
+}
+
+void WatchHub::evictIdle(Clock::time_point now) {
+  for (auto it = m_watchers.begin(); it != m_watchers.end();) {
+    // 挂着轮询的 watcher 不算空闲
+    it = !it->second.pending && it->second.lastPoll + kWatcherIdleTimeout < now ? m_watchers.erase(it) : std::next(it);
+  }
+}
+
+WatchHub::WatcherMap::iterator WatchHub::complete(WatcherMap::iterator it, std::vector<Ready> *ready) {
+  Watcher &w = it->second;
+  PollCallback callback = std::move(w.pending);
+  w.pending = nullptr;
+  w.lastPoll = Clock::now();
+  if (w.resync) {
+    const int64_t nextIndex = m_lastPublished + 1;
+    ready->push_back([callback = std::move(callback), nextIndex] { callback(PollStatus::kResync, {}, nextIndex); });
+    return m_watchers.erase(it);
+  }
+  // 同一条日志的事件一次取完，换节点用 nextIndex 重建时不会重复
+  std::vector<WatchEvent> events;
+  while (!w.buffer.empty() &&
+         (events.size() < w.pendingMaxEvents || w.buffer.front().Index == events.back().Index)) {
+    w.bytes -= eventBytes(w.buffer.front());
+    events.push_back(std::move(w.buffer.front()));
+    w.buffer.pop_front();
+  }
+  const int64_t nextIndex = w.buffer.empty() ? std::max(w.fromIndex, m_lastPublished + 1) : w.buffer.front().Index;
+  ready->push_back([callback = std::move(callback), events = std::move(events), nextIndex]() mutable {
+    callback(PollStatus::kOk, std::move(events), nextIndex);
+  });
+  return std::next(it);
+}
+
+void WatchHub::runAll(std::vector<Ready> *ready) {
+  for (auto &run : *ready) {
+    run();
+  }
+  ready->clear();
+}
+
+int64_t WatchHub::Create(const std::string &key, bool prefix, int64_t startIndex) {
+  std::vector<Ready> ready;
+  int64_t id = 0;
+  {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    const auto now = Clock::now();
+    evictIdle(now);
+    if (startIndex <= 0) {
+      startIndex = m_lastPublished + 1;
+    }
+    if (startIndex <= m_compacted) {
+      return 0;
+    }
+    if (m_watchers.size() >= m_maxWatchers) {
+      // 满了：挤掉最久没有轮询的那个，它挂着的和之后的轮询都按 watcher 不存在处理
+      auto oldest = std::min_element(m_watchers.begin(), m_watchers.end(), [](const auto &a, const auto &b) {
+        return a.second.lastPoll < b.second.lastPoll;
+      });
+      if (oldest->second.pending) {
+        ready.push_back([callback = std::move(oldest->second.pending)] { callback(PollStatus::kNotFound, {}, 0); });
+      }
+      m_watchers.erase(oldest);
+    }
+    id = m_nextId++;
+    Watcher &w = m_watchers[id];
+    w.key = key;
+    w.prefix = prefix;
+    w.fromIndex = startIndex;
+    w.lastPoll = now;
+    for (const auto &event : m_history) {
+      deliver(&w, event);
+    }
+  }
+  runAll(&ready);
+  return id;
+}
+
+void WatchHub::Poll(int64_t watchId, Clock::time_point deadline, size_t maxEvents, PollCallback callback) {
+  std::vector<Ready> ready;
+  {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    auto it = m_watchers.find(watchId);
+    if (it == m_watchers.end()) {
+      ready.push_back([callback = std::move(callback)] { callback(PollStatus::kNotFound, {}, 0); });
+    } else {
+      if (it->second.pending) {
+        // 挂着的轮询缓冲一定为空，也不需要重新同步，这里只会以空结果结束它，不会删除 watcher
+        complete(it, &ready);
+      }
+      Watcher &w = it->second;
+      w.pending = std::move(callback);
+      w.pendingMaxEvents = std::max<size_t>(maxEvents, 1);
+      w.pendingDeadline = deadline;
+      w.lastPoll = Clock::now();
+      if (w.resync || !w.buffer.empty()) {
+        complete(it, &ready);
+      }
+    }
+  }
+  runAll(&ready);
+}
+
+void WatchHub::Expire(Clock::time_point now) {
+  std::vector<Ready> ready;
+  {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    for (auto it = m_watchers.begin(); it != m_watchers.end();) {
+      it = it->second.pending && it->second.pendingDeadline <= now ? complete(it, &ready) : std::next(it);
+    }
+  }
+  runAll(&ready);
+}
+
+void WatchHub::Cancel(int64_t watchId) {
+  std::vector<Ready> ready;
+  {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    auto it = m_watchers.find(watchId);
+    if (it == m_watchers.end()) {
+      return;
+    }
+    if (it->second.pending) {
+      ready.push_back([callback = std::move(it->second.pending)] { callback(PollStatus::kNotFound, {}, 0); });
+    }
+    m_watchers.erase(it);
+  }
+  runAll(&ready);
+}
+
+size_t WatchHub::WatcherCount() const {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  return m_watchers.size();
+}
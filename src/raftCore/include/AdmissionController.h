@@ -0,0 +1,93 @@
+#ifndef ADMISSION_CONTROLLER_H
+#define ADMISSION_CONTROLLER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+/**
+ * @brief KvServer 的准入控制：过载时在请求进入 raft 之前拒绝，回复 ErrBusy 和建议的重试间隔
+ *
+ * 不做准入时每个请求都会调用 Start，raft 接下了等待者早已超时的日志，排在后面的请求全部等到
+ * CONSENSUS_TIMEOUT，延迟越来越高。这里限制两个量：
+ * 1. 在途请求：已经准入、还没有回复的请求（包括在合并队列里等着提交的写请求）
+ * 2. apply 积压：raft 已经提交、交给 apply 线程但还没应用的日志条数
+ *
+ * 优先级：每一类只能用到上限的一部分，写请求 70%，读请求 90%，会话注册和导出检查点这类控制请求 100%。
+ * 写入洪峰先被拒绝，读请求和控制请求仍有余量。raft 节点之间的 RPC 不经过 KvServer 的 handler，不受准入控制，
+ * 准入拒绝得越早，RPC 线程越快空出来处理心跳和日志复制。
+ *
+ * 重试间隔按超出上限的量除以最近的消化速度（在途请求看回复速度，apply 积压看应用速度）估算。
+ * 线程安全。
+ */
+class AdmissionController {
+ public:
+  enum Priority { kControl = 0, kRead = 1, kWrite = 2 };
+  static constexpr int kPriorityCount = 3;
+
+  struct Options {
+    size_t maxInflight = 8192;      // 在途请求上限
+    size_t maxApplyBacklog = 1024;  // apply 积压上限（日志条数）
+    int64_t minRetryAfterMs = 5;
+    int64_t maxRetryAfterMs = 1000;
+  };
+
+  struct Stats {
+    uint64_t Admitted = 0;
+    uint64_t Rejected[kPriorityCount] = {0, 0, 0};  // 按优先级
+    size_t Inflight = 0;
+  };
+
+  AdmissionController() : AdmissionController(Options()) {}
+  explicit AdmissionController(const Options &options);
+
+  AdmissionController(const AdmissionController &) = delete;
+  AdmissionController &operator=(const AdmissionController &) = delete;
+
+  /**
+   * @brief 尝试准入一个请求，成功后请求回复时必须调用一次 Release
+   * @param applyBacklog 当前的 apply 积压（调用方从 apply 队列取得）
+   * @param retryAfterMs 拒绝时输出建议的重试间隔
+   */
+  bool TryAdmit(Priority priority, size_t applyBacklog, int64_t *retryAfterMs);
+
+  void Release();
+
+  /**
+   * @brief apply 线程每应用一条日志调用一次，用于估算积压的消化速度
+   */
+  void OnApplied() { m_applied.fetch_add(1, std::memory_order_relaxed); }
+
+  /**
+   * @brief 准入之后 raft 仍拒绝了提交（未提交或待应用的日志到了上限）时，按 excess 条积压估算重试间隔
+   */
+  int64_t BacklogRetryAfterMs(size_t excess) { return retryAfterMs(0, excess); }
+
+  size_t Inflight() const { return m_inflight.load(std::memory_order_relaxed); }
+
+  Stats GetStats() const;
+
+ private:
+  // 某一类请求能用到的上限，万分比
+  static size_t shareOf(Priority priority);
+  int64_t retryAfterMs(size_t inflightExcess, size_t backlogExcess);
+
+  Options m_options;
+  std::atomic<size_t> m_inflight{0};
+  std::atomic<uint64_t> m_completed{0};  // 累计回复的请求数
+  std::atomic<uint64_t> m_applied{0};    // 累计应用的日志条数
+  std::atomic<uint64_t> m_admitted{0};
+  std::atomic<uint64_t> m_rejected[kPriorityCount];
+
+  // 消化速度的采样，只在拒绝时更新
+  std::mutex m_rateMtx;
+  std::chrono::steady_clock::time_point m_sampledAt;
+  uint64_t m_sampledCompleted = 0;
+  uint64_t m_sampledApplied = 0;
+  double m_completedPerMs = 0;
+  double m_appliedPerMs = 0;
+};
+
+#endif  // ADMISSION_CONTROLLER_H
@@ -0,0 +1,56 @@
+#ifndef APPLY_POOL_H
+#define APPLY_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief apply 线程使用的固定大小线程池：把一组任务分给池中线程和调用线程一起执行，全部完成后返回
+ *
+ * 一次只有一个调用者（apply 线程）。任务按下标领取，哪个线程执行哪个任务不固定，
+ * 任务之间不能有顺序依赖。每一轮都要等所有池中线程进入并离开之后 Run 才返回，
+ * 下一轮不会看到上一轮的任务；唤醒全部线程有固定开销，任务太少时调用方应直接串行执行。
+ */
+class ApplyPool {
+ public:
+  /**
+   * @param threads 并行度（包含调用线程），<=1 时不创建线程，Run 直接在调用线程里执行
+   */
+  explicit ApplyPool(size_t threads);
+  ~ApplyPool();
+
+  ApplyPool(const ApplyPool &) = delete;
+  ApplyPool &operator=(const ApplyPool &) = delete;
+
+  size_t Size() const { return m_workers.size() + 1; }
+
+  /**
+   * @brief 执行 task(0) ... task(n - 1)，全部完成后返回
+   */
+  void Run(size_t n, const std::function<void(size_t)> &task);
+
+ private:
+  void workerLoop();
+  void runTasks();
+
+  std::vector<std::thread> m_workers;
+  std::mutex m_mtx;
+  std::condition_variable m_startCv;
+  std::condition_variable m_doneCv;
+  uint64_t m_generation = 0;
+  bool m_stop = false;
+  size_t m_arrived = 0;  // 已经进入这一轮的池中线程数
+  size_t m_active = 0;   // 正在执行这一轮的池中线程数
+  const std::function<void(size_t)> *m_task = nullptr;
+  size_t m_total = 0;
+  std::atomic<size_t> m_next{0};
+  std::atomic<size_t> m_finished{0};
+};
+
+#endif  // APPLY_POOL_H
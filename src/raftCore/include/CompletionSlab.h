@@ -0,0 +1,84 @@
+#ifndef COMPLETION_SLAB_H
+#define COMPLETION_SLAB_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+/**
+ * @brief 等待日志apply的请求表：预先分配的环形 slot 数组，raft 索引 i 放在 slot[i % N]
+ *
+ * 每个 slot 自带一把锁，登记、apply 回调、超时清理只锁各自的 slot，没有全局锁，也不在登记和注销时分配内存。
+ * slot 里保存占用它的索引作为代数：apply 时代数不符的等待者不会被误回调。
+ * 同时记下最近一次 apply 到该 slot 的索引，Start 返回之后、登记之前日志就已经 apply 的情况在登记时直接回调。
+ *
+ * 同时在等的请求超过 N 个时，新登记的请求会挤掉同一 slot 上更早的请求（以失败回调，客户端重试）。
+ * 请求按 (clientId, requestId) 的 64 位指纹匹配，指纹只用来发现日志被新 leader 覆盖的情况。
+ * 回调都在 slot 锁之外执行。
+ */
+class CompletionSlab {
+ public:
+  // applied：该索引上提交的正是这个请求
+  using Callback = std::function<void(bool applied, int raftIndex)>;
+  using Clock = std::chrono::steady_clock;
+
+  static constexpr size_t kDefaultCapacity = 4096;
+
+  /**
+   * @param capacity slot 数，向上取整到 2 的幂
+   */
+  explicit CompletionSlab(size_t capacity = kDefaultCapacity);
+
+  CompletionSlab(const CompletionSlab &) = delete;
+  CompletionSlab &operator=(const CompletionSlab &) = delete;
+
+  static uint64_t Tag(const std::string &clientId, int requestId);
+
+  /**
+   * @brief 登记等待 raftIndex 的请求
+   * 该索引已经 apply 时立即回调；结果已经被后面的索引覆盖、无从判断时以失败回调
+   */
+  void Register(int raftIndex, uint64_t tag, Clock::time_point deadline, Callback callback);
+
+  /**
+   * @brief 只在 apply 线程调用：raftIndex 上的日志已经 apply，tag 是这条日志的指纹
+   */
+  void Complete(int raftIndex, uint64_t tag);
+
+  /**
+   * @brief 索引不大于 raftIndex 的等待者以失败回调（安装快照后这些索引不会再逐条 apply）
+   */
+  void FailUpTo(int raftIndex);
+
+  /**
+   * @brief deadline 已过的等待者以失败回调
+   */
+  void Expire(Clock::time_point now);
+
+  size_t Capacity() const { return m_mask + 1; }
+
+ private:
+  // 按缓存行对齐，相邻索引的 slot 不会互相干扰
+  struct alignas(64) Slot {
+    std::mutex mtx;
+    int index = 0;  // 等待者的索引（代数），0 表示空
+    uint64_t tag = 0;
+    Clock::time_point deadline;
+    Callback callback;
+    int appliedIndex = 0;  // 最近一次 apply 到这个 slot 的索引
+    uint64_t appliedTag = 0;
+  };
+
+  Slot &slotOf(int raftIndex) { return m_slots[static_cast<size_t>(raftIndex) & m_mask]; }
+
+  // 在 slot 锁内取出等待者，调用方在锁外回调
+  static Callback take(Slot &slot);
+
+  size_t m_mask;
+  std::unique_ptr<Slot[]> m_slots;
+};
+
+#endif  // COMPLETION_SLAB_H
@@ -3,134 +3,204 @@
 
 #include <boost/archive/text_iarchive.hpp>
 #include <boost/archive/text_oarchive.hpp>
-#include <boost/serialization/serialization.hpp>
-#include <boost/serialization/unordered_map.hpp>
+#include <atomic>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <sstream>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
-#include "ApplyMsg.h"
+#include "ApplyPool.h"
 #include "IStateMachine.h"
 #include "IStorageEngine.h"
+#include "ReadCache.h"
+#include "ShardedSessionTable.h"
+#include "TtlIndex.h"
+#include "TxnExecutor.h"
+#include "WatchHub.h"
 #include "util.h"  // Op类定义在这里
 
 /**
- * @brief KV状态机 - 纯业务逻辑实现
- * 
+ * @brief KV状态机 - 纯业务逻辑实现，节点上kv数据、去重表、过期时间和导出检查点唯一的一份
+ *
  * 职责：
- * 1. 执行KV操作（Get/Put/Append）
- * 2. 去重（防止重复执行）
- * 3. 快照管理
- * 
+ * 1. 执行KV操作（Get/Put/Append/Delete/DeleteRange/批量写/合并日志/条件事务）
+ * 2. 去重（防止重复执行）：按客户端会话记录，会话按租约过期、有数量上限
+ * 3. 快照管理：快照格式与存储引擎无关的部分都在这里，kv数据由存储引擎自己序列化
+ * 4. key过期：时间取自日志里leader写入的时间戳，时间轮按到期顺序回收，过期未回收的key对读不可见
+ *
+ * 每条日志的写入夹在存储引擎的BeginApply/FinishApply之间：多版本引擎（mvcc）以日志索引作为版本号，
+ * 整条日志在FinishApply时一起对读者可见，读视图不阻塞apply，范围扫描的各个分页读同一个索引；
+ * 其他引擎写入立即可见，读视图退化为直接读引擎当前的数据。
+ *
+ * 锁：m_mtx只在apply、快照、安装快照之间互斥，读请求不拿它。
+ * 读只需要短暂共享m_readMtx看一眼过期时间，数据由存储引擎自己保护，去重表按clientId分片、自带锁。
+ * 点查先看热点缓存（ReadCache），命中时不进入存储引擎；每条日志可见之后按日志顺序把它改过的key
+ * 在缓存里替换（Put）或去掉（Append/Delete/回收），安装快照时整体清空。
+ * apply线程是唯一的写者，一条日志产生的过期时间变化等这条日志的数据对读者可见之后再一起发布，
+ * 读者不会看到新的过期时间配旧的数据。
+ *
  * 不负责：
  * 1. RPC通信
  * 2. Raft共识
- * 3. 请求路由
+ * 3. 请求路由、等待日志apply的回调、watch的分发
  */
 class KvStateMachine : public IStateMachine {
-private:
-    std::unique_ptr<IStorageEngine> m_storage;
-    std::unordered_map<std::string, int> m_lastRequestId;  // clientId -> requestId (去重用)
-    mutable std::mutex m_mtx;
-    
 public:
-    explicit KvStateMachine(std::unique_ptr<IStorageEngine> storage)
-        : m_storage(std::move(storage)) {}
-    
+    using KvList = std::vector<std::pair<std::string, std::string>>;
+
+    /**
+     * @param storage 存储引擎
+     * @param applyThreads 一条日志里大批写入的并行度（包含apply线程），<=1时串行写入
+     * @param readCacheBytes 点查热点缓存的容量，0表示不缓存
+     */
+    explicit KvStateMachine(std::unique_ptr<IStorageEngine> storage, size_t applyThreads = 1,
+                            size_t readCacheBytes = 0);
+
+    KvStateMachine(const KvStateMachine&) = delete;
+    KvStateMachine& operator=(const KvStateMachine&) = delete;
+
     // ==================== IStateMachine接口实现 ====================
-    
-    /**
-     * @brief 应用一条日志
-     */
-    void Apply(const std::string& command, int index) override {
-        Op op = DeserializeOp(command);
-        
-        std::lock_guard<std::mutex> lock(m_mtx);
-        
-        // 去重检查
-        if (IsDuplicate(op.ClientId, op.RequestId)) {
-            return;
-        }
-        
-        // 执行操作
-        if (op.Operation == "Put") {
-            m_storage->Put(op.Key, op.Value);
-        } else if (op.Operation == "Append") {
-            m_storage->Append(op.Key, op.Value);
-        }
-        // Get操作不修改状态，不需要执行
-        
-        // 更新去重表
-        m_lastRequestId[op.ClientId] = op.RequestId;
+
+    /**
+     * @brief 应用一条日志，不关心产生的变化
+     */
+    void Apply(const std::string& command, int index) override;
+
+    /**
+     * @brief 生成快照：kv数据 + 各key的版本号 + 逻辑时钟和过期时间 + 导出检查点 + 会话表
+     * 等价于 CaptureSnapshot()()，全程在调用线程上完成
+     */
+    std::string TakeSnapshot() override;
+
+    /**
+     * @brief 分两步生成快照的第一步，在apply线程调用，持有m_mtx的时间很短：
+     * 多版本引擎只打开读视图并写出会话表、逻辑时钟、过期时间和导出检查点，
+     * 返回的函数可以在任意线程执行，从读视图导出kv数据和版本号并拼出完整快照，期间apply和读请求照常进行。
+     * 不支持读视图的引擎只能持锁导出，返回时快照已经生成。
+     * 引擎数据是流式写进归档的，但整份快照仍然在内存里拼成std::string：归档先写进std::stringstream，
+     * 再由str()拷出一份，raft的Snapshot、Persister::Save和InstallSnapshot RPC也都按std::string传递，
+     * 生成时内存峰值约为快照大小的两倍
+     */
+    std::function<std::string()> CaptureSnapshot();
+
+    /**
+     * @brief 从快照恢复，安装索引取当前已应用索引的下一个
+     */
+    void InstallSnapshot(const std::string& snapshot) override;
+
+    // ==================== 供KvServer调用 ====================
+
+    /**
+     * @brief 应用一条已经解析好的日志
+     * 会话已经过期、没有执行的写请求会清空op.ClientId，等待它的请求按失败返回
+     * @param events 非空时输出这条日志产生的变化，Index由调用方发布时填写
+     * @return false表示index不在已应用索引之后（重复交付，或者早于已经安装的快照），整条日志被跳过，状态不变
+     */
+    bool ApplyOp(Op& op, int index, std::vector<WatchEvent>* events);
+
+    /**
+     * @brief 安装索引为index的快照。多版本引擎以版本化写入的方式安装，正在进行的读请求仍然读到安装前的数据
+     * @return false表示快照不比已应用的数据新，没有安装
+     */
+    bool InstallSnapshot(const std::string& snapshot, int64_t index);
+
+    /**
+     * @brief 读最新的已应用数据，过期的key不可见；热点key从缓存返回
+     */
+    bool Get(const std::string& key, std::string* value);
+
+    /**
+     * @brief 在最新的已应用数据上打开读视图；引擎不支持读视图时返回直接读引擎的视图
+     * 读视图不过滤过期的key，调用方用KeyExpired判断
+     */
+    std::shared_ptr<IReadView> OpenReadView();
+
+    /**
+     * @brief 在index上重新打开读视图（范围扫描翻页）
+     * @return 多版本引擎已经回收了该索引、或者该索引还没有应用时返回nullptr；
+     *         其他引擎返回直接读当前数据的视图
+     */
+    std::shared_ptr<IReadView> OpenReadView(int64_t index);
+
+    /**
+     * @brief key是否已经过期（过期但还没回收的key对读不可见）
+     */
+    bool KeyExpired(const std::string& key) const;
+
+    int64_t AppliedIndex() const { return m_appliedIndex.load(std::memory_order_acquire); }
+
+    /**
+     * @brief 检查请求是否重复
+     */
+    bool IsDuplicateRequest(const std::string& clientId, int requestId) const {
+        return m_sessions.IsDuplicate(clientId, requestId);
     }
-    
+
     /**
-     * @brief 生成快照
+     * @brief 更新去重表（用于Get操作）
      */
-    std::string TakeSnapshot() override {
-        std::lock_guard<std::mutex> lock(m_mtx);
-        
-        std::stringstream ss;
-        boost::archive::text_oarchive oa(ss);
-        
-        // 序列化存储引擎数据
-        std::string storageData = m_storage->Serialize();
-        oa << storageData;
-        
-        // 序列化去重表
-        oa << m_lastRequestId;
-        
-        return ss.str();
+    void UpdateRequestId(const std::string& clientId, int requestId);
+
+    /**
+     * @brief 已注册的会话是否已经过期（写请求需要客户端重新注册）
+     */
+    bool SessionExpired(const std::string& clientId) const {
+        return m_sessions.Rejects(clientId);
     }
-    
+
+    size_t SessionCount() const {
+        return m_sessions.Size();
+    }
+
     /**
-     * @brief 从快照恢复
+     * @brief 取回某个请求的事务结果（重试的请求不会再次执行）
+     * @return 该client最近一次事务不是这个请求时返回false
      */
-    void InstallSnapshot(const std::string& snapshot) override {
-        std::lock_guard<std::mutex> lock(m_mtx);
-        
-        std::stringstream ss(snapshot);
-        boost::archive::text_iarchive ia(ss);
-        
-        // 反序列化存储引擎数据
-        std::string storageData;
-        ia >> storageData;
-        m_storage->Deserialize(storageData);
-        
-        // 反序列化去重表
-        ia >> m_lastRequestId;
+    bool GetTxnResult(const std::string& clientId, int requestId, TxnResponse* resp) const {
+        return m_sessions.TxnResult(clientId, requestId, resp);
     }
-    
-    // ==================== 业务逻辑接口（供KvServer调用） ====================
-    
+
+    /**
+     * @brief 日志导出消费者已提交的检查点，没有提交过返回0
+     */
+    int64_t CdcCheckpoint(const std::string& consumerId) const;
+
     /**
-     * @brief 执行Get操作
+     * @brief 最近一次生成或安装的快照字节数，大量删除后可据此观察快照是否缩小
      */
-    bool Get(const std::string& key, std::string* value) {
-        std::lock_guard<std::mutex> lock(m_mtx);
-        return m_storage->Get(key, value);
+    size_t LastSnapshotBytes() const {
+        return m_lastSnapshotBytes.load(std::memory_order_relaxed);
     }
-    
+
     /**
-     * @brief 检查请求是否重复
+     * @brief 上一次快照之后真正删掉的key数量和上一次快照时的key数量，
+     * 大批删除之后不等日志变长就可以换成更小的快照（只在apply线程读）
      */
-    bool IsDuplicateRequest(const std::string& clientId, int requestId) {
-        std::lock_guard<std::mutex> lock(m_mtx);
-        return IsDuplicate(clientId, requestId);
+    size_t DeletedSinceSnapshot() const { return m_deletedSinceSnapshot; }
+    size_t KeysAtLastSnapshot() const { return m_keysAtLastSnapshot; }
+
+    /**
+     * @brief 点查缓存的命中率等统计
+     */
+    ReadCache::Stats ReadCacheStats() const {
+        return m_readCache.GetStats();
     }
-    
+
     /**
-     * @brief 更新去重表（用于Get操作）
+     * @brief 当前key数量
      */
-    void UpdateRequestId(const std::string& clientId, int requestId) {
-        std::lock_guard<std::mutex> lock(m_mtx);
-        m_lastRequestId[clientId] = requestId;
+    size_t KeyCount() const {
+        return m_storage->Size();
     }
-    
+
     // ==================== 辅助方法 ====================
-    
+
     /**
      * @brief 序列化Op
      */
@@ -140,7 +210,7 @@ public:
         oa << op;
         return ss.str();
     }
-    
+
     /**
      * @brief 反序列化Op
      */
@@ -151,16 +221,78 @@ public:
         ia >> op;
         return op;
     }
-    
-private:
+
     /**
-     * @brief 检查是否重复（需要持有锁）
+     * @brief 日志导出回放快照用：只取出kv数据，去掉快照时已经过期的key，按key升序
+     * 只认识SkipListDump格式的kv数据（skiplist/art/hash/mvcc/sharded），其他引擎的快照抛出std::runtime_error
      */
-    bool IsDuplicate(const std::string& clientId, int requestId) {
-        auto it = m_lastRequestId.find(clientId);
-        return it != m_lastRequestId.end() && it->second >= requestId;
-    }
+    static void DecodeSnapshotKvs(const std::string& snapshot, KvList* kvs);
+
+private:
+    // 并行apply：一条日志里的大批写入（合并日志、批量写）按key哈希分区，在线程池上并行写入存储，
+    // 同一个key的写入在同一个分区里按原顺序执行。每个分区先把过期时间变化和watch事件记在自己的缓冲里，
+    // 写完后按分区顺序并入m_pendingTtl/m_pendingEvents。日志之间仍然严格按顺序apply
+    struct ApplyPartition {
+        std::vector<const Op*> Writes;
+        std::vector<std::pair<std::string, int64_t>> PendingTtl;
+        std::vector<WatchEvent> Events;
+        size_t Deleted = 0;
+    };
+
+    // ---------- 各类日志（apply线程，持有m_mtx） ----------
+    void ApplyCoalesced(const Op& op, int index);
+    void ApplyTxn(const Op& op);
+    void ApplyDelete(const std::string& key);
+    // 删除 [start, end) 内的所有key，end为空表示不设上界
+    void ApplyDeleteRange(const std::string& start, const std::string& end);
+    // 记录日志导出消费者的检查点，只前进不后退
+    void ApplyCdcCheckpoint(const std::string& consumerId, const std::string& index);
+
+    // ---------- 带过期时间的写入 ----------
+    // part非空时（并行apply的工作线程）变化记到分区的缓冲里，查询也先看分区的缓冲
+    void AdvanceClockAndReclaim(int64_t timestampMs);
+    void PublishTtlChanges();
+    int64_t ApplyingDeadline(const std::string& key, const ApplyPartition* part = nullptr) const;
+    bool ApplyingExpired(const std::string& key, const ApplyPartition* part = nullptr) const;
+    void RecordEvent(int type, const std::string& key, const std::string& value, ApplyPartition* part = nullptr);
+    void StorePut(const std::string& key, const std::string& value, int64_t ttlMs, ApplyPartition* part = nullptr);
+    void StoreAppend(const std::string& key, const std::string& value, ApplyPartition* part = nullptr);
+    void StoreDelete(const std::string& key, ApplyPartition* part = nullptr);
+    // Put/Append/Delete 子操作
+    void StoreWrite(const Op& write, ApplyPartition* part = nullptr);
+    // 写入同一条日志里的一组子操作，数量够多时按key分区并行
+    void StoreWrites(const std::vector<const Op*>& writes, int index);
+
+    // 当前日志可见之后，按事件顺序更新点查缓存
+    void RefreshReadCache();
+
+    void RecordSnapshot(size_t bytes);
+
+    std::unique_ptr<IStorageEngine> m_storage;
+    bool m_versioned;  // 引擎支持读视图（多版本）
+    ShardedSessionTable m_sessions;  // clientId -> 最近的requestId和事务结果 (去重用)，自带分片锁
+
+    TtlIndex m_ttl;
+    int64_t m_clockMs = 0;  // 逻辑时钟：已应用日志中最大的leader时间戳
+    std::unordered_map<std::string, int64_t> m_cdcCheckpoints;  // 日志导出的消费者 -> 已处理到的日志索引
+    mutable std::mutex m_mtx;             // apply、快照、安装快照
+    mutable std::shared_mutex m_readMtx;  // m_ttl、m_clockMs、m_cdcCheckpoints：apply线程修改时独占，读者共享
+    std::atomic<int64_t> m_appliedIndex{0};
+
+    // 当前日志产生的过期时间变化、回收掉的登记和watch事件（apply线程私有）
+    std::vector<std::pair<std::string, int64_t>> m_pendingTtl;  // key -> 新的过期时间，0表示不过期
+    std::vector<TimingWheel::Entry> m_reclaimed;
+    std::vector<WatchEvent> m_pendingEvents;
+
+    ReadCache m_readCache;
+
+    std::unique_ptr<ApplyPool> m_applyPool;
+    std::vector<ApplyPartition> m_partitions;  // apply线程私有，复用缓冲
+
+    // 快照大小跟踪
+    std::atomic<size_t> m_lastSnapshotBytes{0};  // 最近一次生成或安装的快照大小
+    size_t m_keysAtLastSnapshot = 0;
+    size_t m_deletedSinceSnapshot = 0;
 };
 
 #endif  // KV_STATE_MACHINE_H
-
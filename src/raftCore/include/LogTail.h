@@ -0,0 +1,75 @@
+#ifndef LOG_TAIL_H
+#define LOG_TAIL_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Persister.h"
+#include "raftRPC.pb.h"
+#include "util.h"
+
+/**
+ * @brief 从持久化文件读取已提交日志，供日志导出（CDC）使用
+ *
+ * 读的是 Persister 落盘的 raft 状态而不是 Raft::m_logs，不占 raft 的锁，也不受内存中日志裁剪的时机影响。
+ * 请求的索引已经被快照覆盖时，改为提供持久化的快照：快照 + 之后的日志可以还原任意时刻之后的完整变化。
+ * 快照的格式由上层服务决定，通过 SnapshotDecoder 解析成按 key 升序的 kv 列表。
+ *
+ * 线程安全。解析过的日志缓存在内存里，只保留加载时已提交（不超过调用方给的 lastIndex）的部分，这些日志不会再变；
+ * 请求超出缓存的最后一条时才重新读取并解析 raft 状态文件。快照按 Persister 的版本号判断是否变过，没变就不读文件。
+ */
+class LogTail {
+ public:
+  using KvList = std::vector<std::pair<std::string, std::string>>;
+  using SnapshotDecoder = std::function<void(const std::string &snapshot, KvList *kvs)>;
+
+  struct Record {
+    int64_t Index;
+    int64_t Term;
+    std::string Command;  // 序列化的 Op
+  };
+
+  struct Snapshot {
+    int64_t Index = 0;  // 快照包含到的日志索引，0 表示还没有快照
+    KvList Kvs;         // 按 key 升序
+  };
+
+  LogTail(std::shared_ptr<Persister> persister, SnapshotDecoder decoder);
+
+  /**
+   * @brief 读取 [fromIndex, lastIndex] 内的日志，最多 maxEntries 条，追加到 out
+   * @param lastIndex 调用方确认已提交的最大索引，持久化文件中更靠后的日志可能还会被覆盖，不会返回
+   * @param snapshotIndex 输出：持久化状态中的快照索引
+   * @return fromIndex 已经被快照覆盖（日志已裁剪）时返回 false，out 不变
+   */
+  bool Read(int64_t fromIndex, int64_t lastIndex, size_t maxEntries, std::vector<Record> *out,
+            int64_t *snapshotIndex);
+
+  /**
+   * @brief 最近一次持久化的快照，同一个快照只解析一次，之后的分页直接用缓存
+   */
+  std::shared_ptr<const Snapshot> LatestSnapshot();
+
+ private:
+  // 重新读取 raft 状态文件，缓存其中不超过 lastIndex 的日志；调用方持有 m_logMtx
+  void reloadLog(int64_t lastIndex);
+
+  std::shared_ptr<Persister> m_persister;
+  SnapshotDecoder m_decoder;
+
+  std::mutex m_logMtx;                          // 保护下面的日志缓存
+  int64_t m_logSnapshotIndex = 0;               // 缓存加载时的快照索引，m_logs[0] 的索引是它 + 1
+  int64_t m_logLastIndex = 0;                   // 缓存中最后一条日志的索引，没有日志时等于 m_logSnapshotIndex
+  std::vector<raftRpcProctoc::LogEntry> m_logs;
+
+  std::mutex m_mtx;  // 保护 m_snapshot，同时让并发的快照解析只做一次
+  std::shared_ptr<const Snapshot> m_snapshot;
+  uint64_t m_snapshotVersion = 0;  // m_snapshot 对应的 Persister 快照版本号
+};
+
+#endif  // LOG_TAIL_H
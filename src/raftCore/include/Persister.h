@@ -5,6 +5,7 @@
 
 #ifndef SKIP_LIST_ON_RAFT_PERSISTER_H
 #define SKIP_LIST_ON_RAFT_PERSISTER_H
+#include <cstdint>
 #include <fstream>
 #include <mutex>
 #include <chrono>
@@ -45,6 +46,10 @@ class Persister {
   // 文件大小
   long long m_raftStateSize;
   long long m_snapshotSize;
+
+  // 每次 Save/SaveRaftState 递增，读方据此判断内容是否变过，不必重新读文件
+  uint64_t m_raftStateVersion = 0;
+  uint64_t m_snapshotVersion = 0;
   
   // ==================== 批量刷盘相关 ====================
   std::string m_pendingRaftState;           // 待刷盘的 RaftState
@@ -84,6 +89,23 @@ class Persister {
   void SaveRaftState(const std::string& data);
   long long RaftStateSize();
   std::string ReadRaftState();
+
+  struct StateVersion {
+    uint64_t RaftState = 0;
+    uint64_t Snapshot = 0;
+  };
+
+  /**
+   * @brief 一次读出 RaftState 和 Snapshot，两者对应同一次 Save
+   * 不打印日志，供日志导出等需要反复读取的场景使用；snapshot 为 nullptr 时只读 RaftState
+   * @param version 可选输出：读到的内容对应的版本号
+   */
+  void ReadState(std::string* raftState, std::string* snapshot, StateVersion* version = nullptr);
+
+  /**
+   * @brief 当前 RaftState 和 Snapshot 的版本号，不读文件；版本号没变说明内容没变
+   */
+  StateVersion Version();
   explicit Persister(int me);
   ~Persister();
   
@@ -149,6 +171,11 @@ class Persister {
    * @return 文件内容
    */
   std::string readFile(const std::string& filename);
+
+  /**
+   * @brief 解压文件内容，不是压缩格式时原样返回
+   */
+  static std::string decodeFile(const std::string& fileData);
 };
 
 #endif  // SKIP_LIST_ON_RAFT_PERSISTER_H
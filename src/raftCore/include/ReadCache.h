@@ -0,0 +1,125 @@
+#ifndef READ_CACHE_H
+#define READ_CACHE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+/**
+ * @brief 状态机读路径上的热点 key 缓存（S3-FIFO），命中时不经过存储引擎
+ *
+ * 按 key 哈希分片，每个分片一把读写锁：命中只拿共享锁、拷贝 value、把访问频率加一，
+ * 同一个热点 key 的并发读不互相排队，也不碰存储引擎的锁。
+ * 每个分片内是 S3-FIFO：新 key 进小队列（容量的 10%），只被读过一次的 key 很快从小队列淘汰、
+ * 只留下 key 在幽灵队列里；在小队列里被再次读到的 key 进主队列，幽灵队列里的 key 再次进入时直接进主队列。
+ * 主队列按 FIFO 淘汰，访问过的 key 频率减一后回到队头。
+ *
+ * 一致性：只有状态机的 apply 线程调用 Update/Invalidate/Clear，每次都会推进分片的版本号。
+ * 读者未命中时拿到当前版本号（Lookup 的 ticket），读完存储引擎后用 Fill 回填；
+ * 其间分片有过任何写入则放弃回填，避免把刚被覆盖的旧值放进缓存。
+ * 缓存只保存引擎里的原始 value，过期时间由调用方另外判断。
+ */
+class ReadCache {
+ public:
+  struct Stats {
+    uint64_t Hits = 0;
+    uint64_t Misses = 0;
+    uint64_t Fills = 0;      // 未命中后成功回填的次数
+    uint64_t Evictions = 0;  // 因容量淘汰的 key 数
+    size_t Entries = 0;
+    size_t Bytes = 0;
+
+    double HitRatio() const {
+      uint64_t total = Hits + Misses;
+      return total == 0 ? 0.0 : static_cast<double>(Hits) / static_cast<double>(total);
+    }
+  };
+
+  static constexpr size_t kDefaultShards = 16;
+
+  /**
+   * @param capacityBytes 总容量（key + value + 固定开销），0 表示不缓存：Lookup 总是未命中，其余调用都不做事
+   */
+  explicit ReadCache(size_t capacityBytes, size_t shards = kDefaultShards);
+
+  ReadCache(const ReadCache &) = delete;
+  ReadCache &operator=(const ReadCache &) = delete;
+
+  bool Enabled() const { return m_capacity > 0; }
+
+  /**
+   * @brief 查找 key，命中时把 value 拷贝到 *value
+   * @param ticket 未命中时输出分片当前的版本号，回填时原样传给 Fill
+   */
+  bool Lookup(const std::string &key, std::string *value, uint64_t *ticket);
+
+  /**
+   * @brief 未命中的读者从存储引擎读到 value 后回填；分片在 ticket 之后有过写入时不回填
+   */
+  void Fill(const std::string &key, const std::string &value, uint64_t ticket);
+
+  /**
+   * @brief apply 线程：key 被 Put 成 value，已缓存时原地替换，未缓存时不放入（写入不算访问）
+   */
+  void Update(const std::string &key, const std::string &value);
+
+  /**
+   * @brief apply 线程：key 被追加或删除，从缓存中去掉
+   */
+  void Invalidate(const std::string &key);
+
+  /**
+   * @brief apply 线程：安装快照后数据整体替换，清空所有分片（幽灵队列一起清掉）
+   */
+  void Clear();
+
+  Stats GetStats() const;
+
+ private:
+  struct Entry {
+    std::string key;
+    std::string value;
+    std::atomic<uint8_t> freq{0};  // 0~3，命中时在共享锁下增加
+    bool inMain = false;
+  };
+  using EntryList = std::list<Entry>;
+
+  struct Shard {
+    mutable std::shared_mutex mtx;
+    uint64_t epoch = 0;  // 每次 Update/Invalidate/Clear 加一
+    EntryList small;     // 队头是最新进入的
+    EntryList main;
+    std::unordered_map<std::string, EntryList::iterator> index;
+    std::list<std::string> ghost;  // 从小队列淘汰的 key
+    std::unordered_map<std::string, std::list<std::string>::iterator> ghostIndex;
+    size_t smallBytes = 0;
+    size_t bytes = 0;
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> misses{0};
+    std::atomic<uint64_t> fills{0};
+    std::atomic<uint64_t> evictions{0};
+  };
+
+  static size_t chargeOf(const std::string &key, const std::string &value);
+
+  Shard &shardOf(const std::string &key) const;
+  // 以下都在分片独占锁下调用
+  void erase(Shard &shard, EntryList::iterator it);
+  void evict(Shard &shard);
+  void evictSmall(Shard &shard);
+  void evictMain(Shard &shard);
+  void remember(Shard &shard, const std::string &key);
+
+  size_t m_capacity;
+  size_t m_shardCount;
+  size_t m_shardCapacity;
+  size_t m_maxCharge;  // 超过它的 value 不缓存，避免一个大 value 挤掉整个分片
+  std::unique_ptr<Shard[]> m_shards;
+};
+
+#endif  // READ_CACHE_H
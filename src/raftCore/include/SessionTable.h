@@ -0,0 +1,160 @@
+#ifndef SESSION_TABLE_H
+#define SESSION_TABLE_H
+
+#include <boost/serialization/split_member.hpp>
+#include <boost/serialization/string.hpp>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "Txn.h"
+
+/**
+ * @brief 客户端会话表：按 clientId 记录最近一次请求号和事务结果，用于重复请求判断
+ *
+ * 会话通过 RegisterSession 日志创建，会话 id 就是这条日志的 raft 索引（全局唯一的 64 位整数）；
+ * 没有注册过的旧式 clientId 在第一次写入时隐式创建，同样参与过期和淘汰。
+ * 每条日志按日志里的逻辑时钟刷新会话的活跃时间，超过租约没有活动的会话被删除，
+ * 会话数超过上限时淘汰最久没有活动的会话，所以内存和快照大小都有上界。
+ *
+ * 所有修改都发生在 apply 线程、只依赖日志内容，各副本得到相同的表。非线程安全，由调用方加锁。
+ */
+class SessionTable {
+ public:
+  static constexpr int64_t kDefaultLeaseMs = 10 * 60 * 1000;
+  static constexpr size_t kDefaultMaxSessions = 65536;
+
+  struct Session {
+    int LastRequestId = 0;
+    int64_t LastActiveMs = 0;  // 逻辑时钟
+    int TxnRequestId = 0;      // TxnResult 对应的请求号，0 表示没有
+    TxnResponse TxnResult;
+
+    template <class Archive>
+    void serialize(Archive &ar, const unsigned int version) {
+      ar &LastRequestId;
+      ar &LastActiveMs;
+      ar &TxnRequestId;
+      ar &TxnResult;
+    }
+  };
+
+  explicit SessionTable(int64_t leaseMs = kDefaultLeaseMs, size_t maxSessions = kDefaultMaxSessions);
+
+  // m_sessions 里保存着指向 m_lru 的迭代器，只能移动不能拷贝
+  SessionTable(const SessionTable &) = delete;
+  SessionTable &operator=(const SessionTable &) = delete;
+  SessionTable(SessionTable &&) = default;
+  SessionTable &operator=(SessionTable &&) = default;
+
+  /**
+   * @brief 已注册会话使用的 clientId："#" + 会话 id
+   * Clerk 随机生成的旧式 clientId 只含数字，两者不会冲突
+   */
+  static std::string ClientIdOf(uint64_t sessionId);
+  static bool IsRegistered(const std::string &clientId);
+
+  /**
+   * @brief 创建会话，返回它的 clientId
+   */
+  std::string Register(uint64_t sessionId, int64_t nowMs);
+
+  /**
+   * @brief 已注册的会话已经过期或被淘汰：无法再判断重复，这个 clientId 的写请求不能执行
+   */
+  bool Rejects(const std::string &clientId) const;
+
+  bool IsDuplicate(const std::string &clientId, int requestId) const;
+
+  /**
+   * @brief 记录一次执行过的请求并刷新活跃时间；旧式 clientId 不存在时创建
+   */
+  void Record(const std::string &clientId, int requestId, int64_t nowMs);
+
+  /**
+   * @brief 只刷新活跃时间（重复的请求和读请求），不存在时什么也不做
+   */
+  void Touch(const std::string &clientId, int64_t nowMs);
+
+  void RecordTxn(const std::string &clientId, int requestId, TxnResponse resp);
+
+  /**
+   * @brief 取回某个请求的事务结果，该会话最近一次事务不是这个请求时返回 false
+   */
+  bool TxnResult(const std::string &clientId, int requestId, TxnResponse *resp) const;
+
+  /**
+   * @brief 删除在 nowMs 之前租约已经到期的会话，最多 maxExpire 个，返回删除的数量
+   */
+  size_t Expire(int64_t nowMs, size_t maxExpire);
+
+  /**
+   * @brief 从升级前的快照（clientId -> 请求号、clientId -> 事务结果）恢复，活跃时间记为 nowMs
+   */
+  void RestoreLegacy(const std::unordered_map<std::string, int> &lastRequestId,
+                     std::unordered_map<std::string, std::pair<int, TxnResponse>> &&lastTxnResult, int64_t nowMs);
+
+  /**
+   * @brief 恢复快照里的一个会话，放在最近活跃的一端；按活跃时间从早到晚依次调用
+   */
+  void Restore(const std::string &clientId, Session session);
+
+  /**
+   * @brief 按活跃时间从早到晚访问每个会话，visitor 参数为 clientId 和会话
+   */
+  template <class F>
+  void ForEach(F &&visitor) const {
+    for (const auto &clientId : m_lru) {
+      visitor(clientId, m_sessions.at(clientId).session);
+    }
+  }
+
+  void Clear();
+  size_t Size() const { return m_sessions.size(); }
+
+  // 按活跃时间从早到晚保存，恢复后淘汰顺序不变
+  template <class Archive>
+  void save(Archive &ar, const unsigned int version) const {
+    size_t count = m_lru.size();
+    ar &count;
+    for (const auto &clientId : m_lru) {
+      ar &clientId;
+      ar &m_sessions.at(clientId).session;
+    }
+  }
+
+  template <class Archive>
+  void load(Archive &ar, const unsigned int version) {
+    Clear();
+    size_t count = 0;
+    ar &count;
+    for (size_t i = 0; i < count; i++) {
+      std::string clientId;
+      Session session;
+      ar &clientId;
+      ar &session;
+      Restore(clientId, std::move(session));
+    }
+  }
+  BOOST_SERIALIZATION_SPLIT_MEMBER()
+
+ private:
+  struct Slot {
+    Session session;
+    std::list<std::string>::iterator pos;  // 在 m_lru 中的位置
+  };
+
+  // 找到或创建会话，并把它移到最近活跃的一端
+  Session &touch(const std::string &clientId, int64_t nowMs);
+  void evictOverflow();
+
+  int64_t m_leaseMs;
+  size_t m_maxSessions;
+  // 逻辑时钟不会倒退，按刷新顺序排列就是按活跃时间排列，最早活跃的在前面
+  std::list<std::string> m_lru;
+  std::unordered_map<std::string, Slot> m_sessions;
+};
+
+#endif  // SESSION_TABLE_H
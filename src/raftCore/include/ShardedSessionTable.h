@@ -0,0 +1,117 @@
+#ifndef SHARDED_SESSION_TABLE_H
+#define SHARDED_SESSION_TABLE_H
+
+#include <boost/serialization/split_member.hpp>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "SessionTable.h"
+
+/**
+ * @brief 按 clientId 分片的会话表，自带锁
+ *
+ * 去重判断（handler 的预检查、apply 线程的判重和记录）只锁 clientId 所在的分片，
+ * 不再和 kv 数据、过期时间等状态共用一把大锁，不同客户端的请求互不等待。
+ *
+ * 每个分片是一个 SessionTable，会话上限按分片平分，租约过期和淘汰都在分片内按活跃时间进行。
+ * 分片按 clientId 的 FNV-1a 哈希选择，不依赖标准库的 std::hash 实现，各副本上同一个会话落在同一个分片，
+ * 淘汰掉哪些会话只取决于日志。快照按活跃时间把各分片归并成一个序列，格式与 SessionTable 相同。
+ */
+class ShardedSessionTable {
+ public:
+  static constexpr size_t kDefaultShards = 16;
+
+  explicit ShardedSessionTable(int64_t leaseMs = SessionTable::kDefaultLeaseMs,
+                               size_t maxSessions = SessionTable::kDefaultMaxSessions,
+                               size_t shards = kDefaultShards);
+
+  ShardedSessionTable(const ShardedSessionTable &) = delete;
+  ShardedSessionTable &operator=(const ShardedSessionTable &) = delete;
+
+  // 以下接口与 SessionTable 相同，各自只锁一个分片
+  std::string Register(uint64_t sessionId, int64_t nowMs);
+  bool Rejects(const std::string &clientId) const;
+  bool IsDuplicate(const std::string &clientId, int requestId) const;
+  void Record(const std::string &clientId, int requestId, int64_t nowMs);
+  void Touch(const std::string &clientId, int64_t nowMs);
+  bool TxnResult(const std::string &clientId, int requestId, TxnResponse *resp) const;
+
+  /**
+   * @brief 记录一次执行过的事务并保存它的结果
+   * 两步在同一把分片锁内完成，判重看到这个请求时一定也能取到结果
+   */
+  void RecordTxn(const std::string &clientId, int requestId, int64_t nowMs, TxnResponse resp);
+
+  /**
+   * @brief 整体换成 other 的内容，恢复快照时先在 other 上解析、再一次性替换；分片数必须相同
+   */
+  void Assign(ShardedSessionTable &&other);
+
+  /**
+   * @brief 依次在各分片删除租约已经到期的会话，总共最多 maxExpire 个
+   * 总是从第一个分片开始，各副本删除的会话相同
+   */
+  size_t Expire(int64_t nowMs, size_t maxExpire);
+
+  void RestoreLegacy(const std::unordered_map<std::string, int> &lastRequestId,
+                     std::unordered_map<std::string, std::pair<int, TxnResponse>> &&lastTxnResult, int64_t nowMs);
+
+  void Clear();
+  size_t Size() const;
+  size_t ShardCount() const { return m_shardCount; }
+
+  // 持有所有分片的锁写出，看到的是同一时刻的会话表
+  template <class Archive>
+  void save(Archive &ar, const unsigned int version) const {
+    auto locks = lockAll();
+    auto entries = mergeByActivity();
+    size_t count = entries.size();
+    ar &count;
+    for (const auto &entry : entries) {
+      ar &*entry.first;
+      ar &*entry.second;
+    }
+  }
+
+  template <class Archive>
+  void load(Archive &ar, const unsigned int version) {
+    auto locks = lockAll();
+    for (size_t i = 0; i < m_shardCount; ++i) {
+      m_shards[i].table.Clear();
+    }
+    size_t count = 0;
+    ar &count;
+    for (size_t i = 0; i < count; i++) {
+      std::string clientId;
+      SessionTable::Session session;
+      ar &clientId;
+      ar &session;
+      shardOf(clientId).table.Restore(clientId, std::move(session));
+    }
+  }
+  BOOST_SERIALIZATION_SPLIT_MEMBER()
+
+ private:
+  struct alignas(64) Shard {
+    mutable std::mutex mtx;
+    SessionTable table;
+  };
+
+  Shard &shardOf(const std::string &clientId) const;
+
+  // 按分片顺序加锁，持有多把锁的只有快照和恢复，单分片操作不会与之死锁
+  std::vector<std::unique_lock<std::mutex>> lockAll() const;
+
+  // 调用方持有所有分片的锁：按活跃时间从早到晚列出所有会话，同一时间的按分片顺序
+  std::vector<std::pair<const std::string *, const SessionTable::Session *>> mergeByActivity() const;
+
+  size_t m_shardCount;
+  std::unique_ptr<Shard[]> m_shards;
+};
+
+#endif  // SHARDED_SESSION_TABLE_H
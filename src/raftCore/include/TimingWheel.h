@@ -0,0 +1,65 @@
+#ifndef TIMING_WHEEL_H
+#define TIMING_WHEEL_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief 分层时间轮（Varghese & Lauck），用于 key 过期回收
+ *
+ * 4 层、每层 64 个槽，第 n 层一个槽覆盖 64^n 个 tick。条目按到期 tick 与当前 tick 的距离放进对应层，
+ * 时间推进到高层槽的边界时把该槽的条目重新分配到低层（cascade），第 0 层的槽到点即到期。
+ * 插入 O(1)，推进只处理到期和需要下移的条目，不扫描全部 key；低层为空时直接跳到下一个下移边界。
+ * 超出 64^4 个 tick 的条目先放在最高层，下移时按真实到期时间重新放置。
+ *
+ * 时间由调用方给出（状态机里是日志中的时间戳），不读系统时钟；非线程安全。
+ */
+class TimingWheel {
+ public:
+  struct Entry {
+    std::string key;
+    int64_t deadlineMs;
+  };
+
+  explicit TimingWheel(int64_t tickMs = 10);
+
+  /**
+   * @brief 清空并把当前时间设为 nowMs
+   */
+  void Reset(int64_t nowMs);
+
+  /**
+   * @brief 登记一个到期时间，已经到期的直接放进下一次 Advance 的输出
+   * 同一个 key 可以登记多次，旧的登记由调用方在到期时识别并丢弃
+   */
+  void Add(const std::string &key, int64_t deadlineMs);
+
+  /**
+   * @brief 把时间推进到 nowMs，到期的条目（deadline <= nowMs）追加到 due
+   * 按 tick 粒度判断，条目最多比 deadline 晚一个 tick 才输出；时间倒退时什么也不做
+   */
+  void Advance(int64_t nowMs, std::vector<Entry> *due);
+
+  size_t Size() const { return m_size + m_overdue.size(); }
+
+ private:
+  static constexpr int kLevels = 4;
+  static constexpr int kSlotBits = 6;
+  static constexpr int64_t kSlots = 1 << kSlotBits;
+  static constexpr int64_t kSlotMask = kSlots - 1;
+  static constexpr int64_t kMaxSpan = int64_t{1} << (kLevels * kSlotBits);  // 时间轮能直接表示的 tick 数
+
+  int64_t tickOf(int64_t ms) const;  // 向上取整，保证 tick 到点时 deadline 已经过去
+  void place(Entry entry, int64_t tick, std::vector<Entry> *due);
+  void cascade(int level, std::vector<Entry> *due);
+
+  int64_t m_tickMs;
+  int64_t m_current;  // 已经处理到的 tick
+  size_t m_size;      // 槽里的条目数
+  size_t m_levelSize[kLevels];
+  std::vector<std::vector<Entry>> m_slots[kLevels];
+  std::vector<Entry> m_overdue;  // Add 时已经到期的条目
+};
+
+#endif  // TIMING_WHEEL_H
@@ -0,0 +1,73 @@
+#ifndef TTL_INDEX_H
+#define TTL_INDEX_H
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "TimingWheel.h"
+
+/**
+ * @brief key 的过期时间表 + 时间轮，状态机用它判断 key 是否过期、按到期顺序回收
+ *
+ * 时间是状态机的逻辑时钟（已应用日志中 leader 时间戳的最大值），各副本按同样的日志得到同样的结果。
+ * 覆盖写入或删除只改过期时间表，时间轮里的旧登记到期时与表中的时间不符，直接丢弃。
+ * 非线程安全，由状态机加锁。
+ */
+class TtlIndex {
+ public:
+  explicit TtlIndex(int64_t tickMs = 10) : m_wheel(tickMs) {}
+
+  /**
+   * @brief 设置 key 的过期时间（毫秒，逻辑时钟），deadlineMs <= 0 表示不过期
+   */
+  void Set(const std::string &key, int64_t deadlineMs);
+
+  void Clear(const std::string &key) { m_deadlines.erase(key); }
+
+  /**
+   * @brief key 在 nowMs 时是否已经过期；过期但还没回收的 key 对读者不可见
+   */
+  bool Expired(const std::string &key, int64_t nowMs) const {
+    if (m_deadlines.empty()) {
+      return false;
+    }
+    auto it = m_deadlines.find(key);
+    return it != m_deadlines.end() && it->second <= nowMs;
+  }
+
+  /**
+   * @brief 推进到 nowMs，取出最多 max 个仍然有效的到期登记
+   * 一次没取完的留到下一次，避免大量 key 同时过期时单条日志的 apply 耗时过长。
+   * 取出的 key 仍留在表中（继续对读者隐藏），调用方删除数据并让删除对读者可见之后再调用 Forget
+   */
+  void CollectExpired(int64_t nowMs, size_t max, std::vector<TimingWheel::Entry> *expired);
+
+  /**
+   * @brief 删除 key 的过期时间，期间被重新设置过过期时间的 key 保持不变
+   */
+  void Forget(const TimingWheel::Entry &entry) {
+    auto it = m_deadlines.find(entry.key);
+    if (it != m_deadlines.end() && it->second == entry.deadlineMs) {
+      m_deadlines.erase(it);
+    }
+  }
+
+  size_t Size() const { return m_deadlines.size(); }
+
+  const std::unordered_map<std::string, int64_t> &Deadlines() const { return m_deadlines; }
+
+  /**
+   * @brief 从快照恢复：替换过期时间表，并在 nowMs 处重建时间轮
+   */
+  void Restore(std::unordered_map<std::string, int64_t> deadlines, int64_t nowMs);
+
+ private:
+  std::unordered_map<std::string, int64_t> m_deadlines;  // key -> 过期时间
+  TimingWheel m_wheel;
+  std::deque<TimingWheel::Entry> m_due;  // 已经到期、还没处理的登记
+};
+
+#endif  // TTL_INDEX_H
@@ -0,0 +1,39 @@
+#ifndef TXN_EXECUTOR_H
+#define TXN_EXECUTOR_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Txn.h"
+
+/**
+ * @brief 事务求值后需要落到存储上的一次写入
+ * Append 保持为追加，存储引擎可以只写新增的字节
+ */
+struct TxnWrite {
+  enum class Kind { kPut, kAppend, kDelete };
+  Kind kind;
+  std::string key;
+  std::string value;
+};
+
+/**
+ * @brief 在 apply 线程里对一条事务日志求值
+ *
+ * 先用当前数据判断所有比较，再按顺序执行选中的那组操作。操作在内存里的覆盖层上执行，
+ * 后面的操作能看到前面操作的结果；全部成功后才把写入交给调用方，中途出错（Err 非空）时
+ * writes 为空，保证事务要么整体生效，要么完全不生效。
+ * 求值只依赖读到的数据，各副本按日志顺序执行得到相同结果。
+ *
+ * @param get 读 key 的当前值，不存在返回 false
+ * @param version 读 key 最近一次写入的版本（raft 索引），不存在返回 0；
+ *                存储不记录版本时返回 false，此时所有版本比较都不成立
+ * @param writes 输出：需要按顺序应用的写入
+ */
+TxnResponse ExecuteTxn(const TxnRequest &txn, const std::function<bool(const std::string &, std::string *)> &get,
+                       const std::function<bool(const std::string &, int64_t *)> &version,
+                       std::vector<TxnWrite> *writes);
+
+#endif  // TXN_EXECUTOR_H
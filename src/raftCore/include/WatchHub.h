@@ -0,0 +1,122 @@
+#ifndef WATCH_HUB_H
+#define WATCH_HUB_H
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief 一次数据变化，Index 是产生它的 raft 日志索引
+ */
+struct WatchEvent {
+  enum Type { kPut = 0, kAppend = 1, kDelete = 2 };  // 与 kvServerRPC.proto 中的 WatchEvent.EventType 一致
+
+  int64_t Index;
+  int Type;
+  std::string Key;
+  std::string Value;  // kPut：新值；kAppend：追加的部分；kDelete：空
+};
+
+/**
+ * @brief Watch 的事件分发：apply 线程按日志顺序发布事件，RPC 长轮询取走
+ *
+ * 长轮询不占线程：缓冲为空时轮询的回调挂在 watcher 上，Publish 带来事件、Reset/Cancel 或者 Expire 发现超时时
+ * 再回调，RPC handler 登记完立即返回。每个 watcher 同时只挂一个轮询。
+ * - 最近的事件保存在一段有界的历史里，新建的 watcher 可以从历史覆盖的任意索引开始；
+ *   更早的索引已经被压缩，需要重新同步（先读一遍当前数据，再从读到的索引之后开始 watch）。
+ * - 每个 watcher 有自己的有界缓冲。缓冲满时先压缩：同一个 key 只保留最新的事件（PUT/DELETE 覆盖
+ *   之前的所有事件）；压缩后仍然放不下，说明这个 watcher 跟不上，丢弃缓冲并标记为需要重新同步。
+ * - 长时间没有轮询的 watcher 自动删除。
+ *
+ * 线程安全，回调都在锁外执行。
+ */
+class WatchHub {
+ public:
+  enum class PollStatus { kOk, kResync, kNotFound };
+
+  using Clock = std::chrono::steady_clock;
+  // nextIndex：下次从哪个索引继续（换节点后用它重新创建 watcher）
+  using PollCallback = std::function<void(PollStatus status, std::vector<WatchEvent> events, int64_t nextIndex)>;
+
+  WatchHub(size_t historyEvents = 8192, size_t historyBytes = 32 << 20, size_t watcherEvents = 1024,
+           size_t watcherBytes = 1 << 20, size_t maxWatchers = 1024);
+
+  /**
+   * @brief apply 线程调用：发布一条日志产生的所有事件，index 必须递增
+   */
+  void Publish(int64_t index, std::vector<WatchEvent> events);
+
+  /**
+   * @brief 安装快照后调用：数据跳到了 index，历史清空，所有 watcher 需要重新同步
+   */
+  void Reset(int64_t index);
+
+  /**
+   * @brief 创建 watcher
+   * @param startIndex 从哪条日志开始（包含），<= 0 表示从下一条发布的日志开始
+   * @return watcher id；startIndex 已经不在历史中时返回 0
+   */
+  int64_t Create(const std::string &key, bool prefix, int64_t startIndex);
+
+  /**
+   * @brief 取走 watcher 缓冲中的事件：缓冲非空时立即回调，否则挂起到有事件或者 deadline
+   * 同一个 watcher 上一次轮询还挂着（客户端超时后重发）时，先以空结果结束上一次
+   */
+  void Poll(int64_t watchId, Clock::time_point deadline, size_t maxEvents, PollCallback callback);
+
+  /**
+   * @brief deadline 已过的挂起轮询以空结果回调，由超时清理线程定期调用
+   */
+  void Expire(Clock::time_point now);
+
+  void Cancel(int64_t watchId);
+
+  size_t WatcherCount() const;
+
+ private:
+  struct Watcher {
+    std::string key;
+    bool prefix;
+    std::deque<WatchEvent> buffer;
+    size_t bytes = 0;
+    int64_t fromIndex;  // 只接收不小于它的索引上的事件
+    bool resync = false;
+    Clock::time_point lastPoll;
+    PollCallback pending;  // 挂起的轮询，为空表示没有
+    size_t pendingMaxEvents = 0;
+    Clock::time_point pendingDeadline;
+  };
+  using WatcherMap = std::map<int64_t, Watcher>;
+  using Ready = std::function<void()>;
+
+  bool matches(const Watcher &w, const std::string &key) const;
+  void deliver(Watcher *w, const WatchEvent &event);
+  static void compact(Watcher *w);
+  void evictIdle(Clock::time_point now);
+
+  // 在锁内取出挂起轮询的结果，回调放进 ready 由调用方在锁外执行；需要重新同步的 watcher 同时删除
+  // @return 下一个 watcher
+  WatcherMap::iterator complete(WatcherMap::iterator it, std::vector<Ready> *ready);
+  static void runAll(std::vector<Ready> *ready);
+
+  const size_t m_historyEvents;
+  const size_t m_historyBytes;
+  const size_t m_watcherEvents;
+  const size_t m_watcherBytes;
+  const size_t m_maxWatchers;
+
+  mutable std::mutex m_mtx;
+  std::deque<WatchEvent> m_history;
+  size_t m_historyBytesUsed = 0;
+  int64_t m_compacted = 0;      // 不大于它的索引已经不在历史里
+  int64_t m_lastPublished = 0;  // 最近一次发布（或快照安装）的索引
+  int64_t m_nextId = 1;
+  WatcherMap m_watchers;
+};
+
+#endif  // WATCH_HUB_H
@@ -14,58 +14,100 @@
 #include <boost/serialization/export.hpp>
 #include <boost/serialization/serialization.hpp>
 #include <boost/serialization/unordered_map.hpp>
+#include <boost/serialization/utility.hpp>
 #include <boost/serialization/vector.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
 #include <iostream>
+#include <map>
 #include <mutex>
 #include <unordered_map>
 #include "kvServerRPC.pb.h"
 #include "raft.h"
-#include "skipList.h"
-#include "KvStateMachine.h"  // 新增：状态机抽象
-#include "SkipListStorageEngine.h"  // 新增：存储引擎抽象
+#include "AdmissionController.h"
+#include "CompletionSlab.h"
+#include "KvStateMachine.h"
+#include "LogTail.h"
+#include "StorageEngineFactory.h"
+#include "WatchHub.h"
 
 class KvServer : raftKVRpcProctoc::kvServerRpc {
  private:
-  std::mutex m_mtx;
   int m_me;
   std::shared_ptr<Raft> m_raftNode;
-  std::shared_ptr<LockQueue<ApplyMsg> > applyChan;  // kvServer和raft节点的通信管道
+  std::shared_ptr<MpscRing<ApplyMsg> > applyChan;  // kvServer和raft节点的通信管道
   int m_maxRaftState;                               // snapshot if log grows this big
 
-  // ==================== 新架构：使用状态机模式 ====================
-  std::shared_ptr<KvStateMachine> m_stateMachine;  // 状态机（业务逻辑）
-  
-  // ==================== 保留原有字段以兼容 ====================
-  std::string m_serializedKVData;  // todo ： 序列化后的kv数据，理论上可以不用，但是目前没有找到特别好的替代方法
-  SkipList<std::string, std::string> m_skipList;
-  std::unordered_map<std::string, std::string> m_kvDB;
-
-  std::unordered_map<int, LockQueue<Op> *> waitApplyCh;
-  // index(raft) -> chan  //？？？字段含义   waitApplyCh是一个map，键是int，值是Op类型的管道
-
-  std::unordered_map<std::string, int> m_lastRequestId;  // clientid -> requestID  //一个kV服务器可能连接多个client
+  // 状态机：kv数据（存储引擎）、会话表、过期时间和导出检查点都只在这里有一份。
+  // apply线程是唯一的写者；读请求在状态机的读视图上进行，多版本引擎的读不阻塞apply
+  std::unique_ptr<KvStateMachine> m_stateMachine;
+
+  // 等待日志apply的请求，按raft索引登记。handler登记之后立即返回，不占用RPC的IO线程；
+  // apply线程应用该索引后回调，超过CONSENSUS_TIMEOUT还没应用的由清理线程回调。
+  // applied为true表示该索引上提交的正是这个请求（期间没有换leader覆盖日志）
+  // 按 raftIndex % N 放在预先分配的slot里，登记和回调只锁各自的slot
+  using Completion = CompletionSlab::Callback;
+  CompletionSlab m_completions;
+
+  // 准入控制：在途请求或者apply积压超过上限时，handler在提交之前回复ErrBusy；写请求最先被拒绝
+  AdmissionController m_admission;
+
+  // 提案合并：一个很短的窗口内到达的PutAppend攒成一条"Coalesced"日志再提交，
+  // 一次Start、一条AppendEntries记录、一次apply分发，apply时逐个执行并分别回调
+  struct PendingWrite {
+    Op op;
+    Completion callback;
+  };
+  std::mutex m_coalesceMtx;
+  std::condition_variable m_coalesceCv;
+  std::vector<PendingWrite> m_coalesceQueue;
+  size_t m_coalesceBytes = 0;      // 队列里key和value的总大小
+  std::string m_coalesceClientId;  // 合并日志的clientId，只用来匹配回调，不进会话表
+  uint32_t m_coalesceSeq = 0;      // 合并日志的请求号，只有合并线程使用
 
   // last SnapShot point , raftIndex
   int m_lastSnapShotRaftLogIndex;
+  // 后台正在导出快照：同一时间只导出一份，导出完成交给raft之后才会开始下一份
+  std::atomic<bool> m_snapshotInFlight{false};
+
+  // Watch：状态机给出每条日志产生的变化，写入对读者可见之后发布给watcher
+  WatchHub m_watchHub;
+  std::vector<WatchEvent> m_pendingEvents;  // apply线程私有
+  bool m_watchHistoryStarted = false;       // 本进程apply的第一条日志之前的变化不在历史里
+
+  // 日志导出：从持久化文件读已提交的日志，日志已裁剪时回放快照
+  std::unique_ptr<LogTail> m_logTail;
+
+  // 范围扫描翻页：第一页在读屏障之后打开读视图，按读索引保存下来，后续分页直接在同一视图上继续，
+  // 不再经过raft。视图一段时间没有被翻页就释放，避免长期阻止MVCC回收旧版本
+  struct PinnedScanView {
+    std::shared_ptr<IReadView> view;
+    std::chrono::steady_clock::time_point expiry;
+  };
+  std::mutex m_scanMtx;
+  std::map<int64_t, PinnedScanView> m_scanViews;  // 读索引 -> 读视图
 
  public:
   KvServer() = delete;
 
-  KvServer(int me, int maxraftstate, std::string nodeInforFileName, short port);
+  /**
+   * @param storageEngine 状态机使用的存储引擎，可选 "mvcc" / "skiplist" / "art" / "hash" / "btree" / "lsm" / "vlog" /
+   *                      "sharded"，见 CreateStorageEngine。只有 "mvcc" 的读不阻塞apply、范围扫描的分页读同一个索引；
+   *                      日志导出回放快照需要 SkipListDump 格式的快照（btree/lsm/vlog 不支持）
+   */
+  KvServer(int me, int maxraftstate, std::string nodeInforFileName, short port,
+           const std::string &storageEngine = "mvcc");
 
   void StartKVServer();
 
   void DprintfKVDB();
 
-  void ExecuteAppendOpOnKVDB(Op op);
-
   void ExecuteGetOpOnKVDB(Op op, std::string *value, bool *exist);
 
-  void ExecutePutOpOnKVDB(Op op);
-
-  void Get(const raftKVRpcProctoc::GetArgs *args,
-           raftKVRpcProctoc::GetReply
-               *reply);  //将 GetArgs 改为rpc调用的，因为是远程客户端，即服务器宕机对客户端来说是无感的
+  // 以下需要经过raft的handler都是异步的：提交日志后立即返回，回复写好之后才调用done（可能在apply线程或清理线程里）
+  //将 GetArgs 改为rpc调用的，因为是远程客户端，即服务器宕机对客户端来说是无感的
+  void Get(const raftKVRpcProctoc::GetArgs *args, raftKVRpcProctoc::GetReply *reply, google::protobuf::Closure *done);
   /**
    * 從raft節點中獲取消息  （不要誤以爲是執行【GET】命令）
    * @param message
@@ -74,15 +116,84 @@ class KvServer : raftKVRpcProctoc::kvServerRpc {
 
   bool ifRequestDuplicate(std::string ClientId, int RequestId);
 
+  // 已注册的会话已经过期，写请求需要客户端重新注册
+  bool SessionRejected(const std::string &clientId);
+
+  // 注册客户端会话，返回会话id和之后请求使用的clientId
+  void RegisterSession(const raftKVRpcProctoc::RegisterSessionArgs *args, raftKVRpcProctoc::RegisterSessionReply *reply,
+                       google::protobuf::Closure *done);
+
   // clerk 使用RPC远程调用
-  void PutAppend(const raftKVRpcProctoc::PutAppendArgs *args, raftKVRpcProctoc::PutAppendReply *reply);
+  void PutAppend(const raftKVRpcProctoc::PutAppendArgs *args, raftKVRpcProctoc::PutAppendReply *reply,
+                 google::protobuf::Closure *done);
+
+  /**
+   * @brief 范围扫描 [StartKey, EndKey)，按页返回
+   * 第一页先通过raft提交一条只读的屏障日志，保证读到屏障之前所有已提交的写（线性一致）；
+   * 之后的分页携带令牌，在同一个读索引上继续，不同分页之间不会看到中途的写入
+   */
+  void Scan(const raftKVRpcProctoc::ScanArgs *args, raftKVRpcProctoc::ScanReply *reply,
+            google::protobuf::Closure *done);
+
+  void PrefixScan(const raftKVRpcProctoc::PrefixScanArgs *args, raftKVRpcProctoc::ScanReply *reply,
+                  google::protobuf::Closure *done);
+
+  // 所有key共用一次读屏障，在同一个读视图上读取
+  void MultiGet(const raftKVRpcProctoc::MultiGetArgs *args, raftKVRpcProctoc::MultiGetReply *reply,
+                google::protobuf::Closure *done);
+
+  // 整批写入作为一条日志提交：一次Start、一次持久化、一次回调
+  void BatchWrite(const raftKVRpcProctoc::BatchWriteArgs *args, raftKVRpcProctoc::BatchWriteReply *reply,
+                  google::protobuf::Closure *done);
+
+  // 条件事务：比较和写入在apply时一次完成，计数器、锁之类的读-改-写只需要一轮共识
+  void Txn(const raftKVRpcProctoc::TxnArgs *args, raftKVRpcProctoc::TxnReply *reply, google::protobuf::Closure *done);
+
+  // 删除经过raft提交，各副本在同一条日志上删除并释放引擎中的内存
+  void Delete(const raftKVRpcProctoc::DeleteArgs *args, raftKVRpcProctoc::DeleteReply *reply,
+              google::protobuf::Closure *done);
+
+  void DeleteRange(const raftKVRpcProctoc::DeleteRangeArgs *args, raftKVRpcProctoc::DeleteReply *reply,
+                   google::protobuf::Closure *done);
+
+  // 长轮询取变化，不经过raft；任意节点都可以提供，事件按本节点的apply顺序给出。
+  // 没有新事件时把done挂在WatchHub上立即返回，由apply线程发布事件或者超时清理线程回复
+  void Watch(const raftKVRpcProctoc::WatchArgs *args, raftKVRpcProctoc::WatchReply *reply,
+             google::protobuf::Closure *done);
+
+  void CancelWatch(const raftKVRpcProctoc::CancelWatchArgs *args, raftKVRpcProctoc::CancelWatchReply *reply);
+
+  /**
+   * @brief 按索引顺序导出本节点已应用的日志，不经过raft，任意节点都可以提供
+   * 起点已经被快照覆盖时先分页返回快照，消费者回放完快照后从快照索引之后继续
+   */
+  void ExportLog(const raftKVRpcProctoc::ExportLogArgs *args, raftKVRpcProctoc::ExportLogReply *reply);
+
+  void CommitCdcCheckpoint(const raftKVRpcProctoc::CommitCdcCheckpointArgs *args,
+                           raftKVRpcProctoc::CommitCdcCheckpointReply *reply, google::protobuf::Closure *done);
+
+  // 最近一次制作或安装的快照的字节数
+  size_t LastSnapshotBytes() const { return m_stateMachine->LastSnapshotBytes(); }
+
+  // 点查热点缓存的命中次数、未命中次数和占用
+  ReadCache::Stats ReadCacheStats() const { return m_stateMachine->ReadCacheStats(); }
+
+  // 准入控制放行和按优先级拒绝的请求数
+  AdmissionController::Stats AdmissionStats() const { return m_admission.GetStats(); }
 
   ////一直等待raft传来的applyCh
   void ReadRaftApplyCommandLoop();
 
-  void ReadSnapShotToInstall(std::string snapshot);
+  void ReadSnapShotToInstall(std::string snapshot, int snapshotIndex = 0);
+
+  // 该索引已经apply，回调等待它的请求；只在apply线程调用
+  void CompleteRequests(const Op &op, int raftIndex);
 
-  bool SendMessageToWaitChan(const Op &op, int raftIndex);
+  // 清理线程：定期回调等待超时的请求和Watch长轮询
+  void CompletionSweepLoop();
+
+  // 合并线程：取出攒下的写请求，按条数和字节数上限切成若干条日志提交
+  void CoalesceLoop();
 
   // 检查是否需要制作快照，需要的话就向raft之下制作快照
   void IfNeedToSendSnapShotCommand(int raftIndex, int proportion);
@@ -90,7 +201,8 @@ class KvServer : raftKVRpcProctoc::kvServerRpc {
   // Handler the SnapShot from kv.rf.applyCh
   void GetSnapShotFromRaft(ApplyMsg message);
 
-  std::string MakeSnapShot();
+  // 在apply线程调用，返回的函数导出完整快照（可以在其他线程执行），见 KvStateMachine::CaptureSnapshot
+  std::function<std::string()> MakeSnapShot();
 
  public:  // for rpc
   void PutAppend(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::PutAppendArgs *request,
@@ -99,41 +211,87 @@ class KvServer : raftKVRpcProctoc::kvServerRpc {
   void Get(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::GetArgs *request,
            ::raftKVRpcProctoc::GetReply *response, ::google::protobuf::Closure *done) override;
 
-  /////////////////serialiazation start ///////////////////////////////
-  // notice ： func serialize
+  void Scan(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::ScanArgs *request,
+            ::raftKVRpcProctoc::ScanReply *response, ::google::protobuf::Closure *done) override;
+
+  void PrefixScan(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::PrefixScanArgs *request,
+                  ::raftKVRpcProctoc::ScanReply *response, ::google::protobuf::Closure *done) override;
+
+  void MultiGet(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::MultiGetArgs *request,
+                ::raftKVRpcProctoc::MultiGetReply *response, ::google::protobuf::Closure *done) override;
+
+  void BatchWrite(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::BatchWriteArgs *request,
+                  ::raftKVRpcProctoc::BatchWriteReply *response, ::google::protobuf::Closure *done) override;
+
+  void Txn(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::TxnArgs *request,
+           ::raftKVRpcProctoc::TxnReply *response, ::google::protobuf::Closure *done) override;
+
+  void RegisterSession(google::protobuf::RpcController *controller,
+                       const ::raftKVRpcProctoc::RegisterSessionArgs *request,
+                       ::raftKVRpcProctoc::RegisterSessionReply *response, ::google::protobuf::Closure *done) override;
+
+  void Delete(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::DeleteArgs *request,
+              ::raftKVRpcProctoc::DeleteReply *response, ::google::protobuf::Closure *done) override;
+
+  void DeleteRange(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::DeleteRangeArgs *request,
+                   ::raftKVRpcProctoc::DeleteReply *response, ::google::protobuf::Closure *done) override;
+
+  void Watch(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::WatchArgs *request,
+             ::raftKVRpcProctoc::WatchReply *response, ::google::protobuf::Closure *done) override;
+
+  void CancelWatch(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::CancelWatchArgs *request,
+                   ::raftKVRpcProctoc::CancelWatchReply *response, ::google::protobuf::Closure *done) override;
+
+  void ExportLog(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::ExportLogArgs *request,
+                 ::raftKVRpcProctoc::ExportLogReply *response, ::google::protobuf::Closure *done) override;
+
+  void CommitCdcCheckpoint(google::protobuf::RpcController *controller,
+                           const ::raftKVRpcProctoc::CommitCdcCheckpointArgs *request,
+                           ::raftKVRpcProctoc::CommitCdcCheckpointReply *response,
+                           ::google::protobuf::Closure *done) override;
+
  private:
-  friend class boost::serialization::access;
-
-  // When the class Archive corresponds to an output archive, the
-  // & operator is defined similar to <<.  Likewise, when the class Archive
-  // is a type of input archive the & operator is defined similar to >>.
-  template <class Archive>
-  void serialize(Archive &ar, const unsigned int version)  //这里面写需要序列话和反序列化的字段
-  {
-    ar &m_serializedKVData;
-
-    // ar & m_kvDB;
-    ar &m_lastRequestId;
-  }
-
-  std::string getSnapshotData() {
-    m_serializedKVData = m_skipList.dump_file();
-    std::stringstream ss;
-    boost::archive::text_oarchive oa(ss);
-    oa << *this;
-    m_serializedKVData.clear();
-    return ss.str();
-  }
-
-  void parseFromString(const std::string &str) {
-    std::stringstream ss(str);
-    boost::archive::text_iarchive ia(ss);
-    ia >> *this;
-    m_skipList.load_file(m_serializedKVData);
-    m_serializedKVData.clear();
-  }
-
-  /////////////////serialiazation end ///////////////////////////////
+  // 提交一条日志并登记回调，不等待。本节点不是leader时立即以 (false, -1) 回调，
+  // raft背压拒绝时以 (false, kProposalThrottled) 回调。
+  // 读屏障（不修改数据的日志）和各种写共用
+  void ProposeAsync(const Op &op, Completion callback);
+
+  // 把一个写请求交给合并线程，和同一窗口内的其他写请求一起提交
+  void ProposeCoalesced(Op op, Completion callback);
+
+  // 提交合并线程取出的一组写请求；只有一个时按原样提交，不包一层
+  void ProposeWrites(std::vector<PendingWrite> writes);
+
+  // 准入检查：被拒绝时回复ErrBusy并返回nullptr；放行时返回包装过的done，回复时归还名额
+  template <typename Reply>
+  google::protobuf::Closure *Admit(AdmissionController::Priority priority, Reply *reply,
+                                   google::protobuf::Closure *done);
+
+  // 写请求的回调：应用了或者之前已经应用过（重复）回复OK，否则让clerk换节点重试
+  template <typename Reply>
+  Completion WriteCompletion(const Op &op, Reply *reply, google::protobuf::Closure *done);
+
+  // 日志没有应用（超时、不是leader、被raft背压拒绝）时的回复：背压回复ErrBusy和重试间隔，其余ErrWrongLeader
+  template <typename Reply>
+  void ReplyNotApplied(Reply *reply, int raftIndex);
+
+  // 找到翻页令牌对应的读视图，resumeKey输出本页的起点
+  std::shared_ptr<IReadView> FindScanView(const std::string &pageToken, std::string *resumeKey, std::string *err);
+
+  // 保存（或续期）读视图，供后续分页使用
+  void PinScanView(const std::shared_ptr<IReadView> &view);
+
+  void FillScanPage(const std::shared_ptr<IReadView> &view, const std::string &resumeKey, const std::string &end,
+                    const std::string &prefix, int limit, raftKVRpcProctoc::ScanReply *reply);
+
+  // start/end/prefix 三者描述同一个区间：end为空表示无上界，prefix非空时只返回以它开头的key。
+  // 第一页在读屏障的回调里读，后续分页直接在调用线程里读
+  void ScanPage(const std::string &start, const std::string &end, const std::string &prefix, int limit,
+                const std::string &pageToken, const Op &barrier, raftKVRpcProctoc::ScanReply *reply,
+                google::protobuf::Closure *done);
+
+  // 导出快照的一页；snapshotIndex与当前持久化的快照不同时（换了新快照）从头开始
+  void ExportSnapshotPage(int64_t snapshotIndex, const std::string &resumeKey, raftKVRpcProctoc::ExportLogReply *reply);
 };
 
 #endif  // SKIP_LIST_ON_RAFT_KVSERVER_H
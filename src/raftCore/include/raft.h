@@ -12,6 +12,7 @@
 #include <thread>
 #include <vector>
 #include "ApplyMsg.h"
+#include "MpscRing.h"
 #include "Persister.h"
 #include "boost/any.hpp"
 #include "boost/serialization/serialization.hpp"
@@ -52,7 +53,7 @@ class Raft : public raftRpcProctoc::raftRpc {
   // 身份
   Status m_status;
 
-  std::shared_ptr<LockQueue<ApplyMsg>> applyChan;  // client从这里取日志（2B），client与raft通信的接口
+  std::shared_ptr<MpscRing<ApplyMsg>> applyChan;  // client从这里取日志（2B），client与raft通信的接口
   // ApplyMsgQueue chan ApplyMsg // raft内部使用的chan，applyChan是用于和服务层交互，最后好像没用上
 
   // 选举超时
@@ -66,6 +67,10 @@ class Raft : public raftRpcProctoc::raftRpc {
   int m_lastSnapshotIncludeIndex;
   int m_lastSnapshotIncludeTerm;
 
+  // 背压（只在leader上统计）：未提交日志的命令字节数，按提交进度懒惰地扣减
+  long long m_uncommittedBytes = 0;  // (m_bytesSettledIndex, 最后一条日志] 的命令字节数
+  int m_bytesSettledIndex = -1;      // -1 表示需要重新统计（刚当选、日志被快照截断）
+
   // 协程
   std::unique_ptr<monsoon::IOManager> m_ioManager = nullptr;
 
@@ -81,7 +86,8 @@ class Raft : public raftRpcProctoc::raftRpc {
   // 每隔一段时间检查睡眠时间内有没有重置定时器，没有则说明超时了
   // 如果有则设置合适睡眠时间：睡眠到重置时间+超时时间
   void electionTimeOutTicker();
-  std::vector<ApplyMsg> getApplyLogs();
+  // 取出已提交、还没交给kvServer的日志，最多max条
+  std::vector<ApplyMsg> getApplyLogs(size_t max);
   int getNewCommandIndex();
   void getPrevLogInfo(int server, int *preIndex, int *preTerm);
   void GetState(int *term, bool *isLeader);
@@ -112,7 +118,24 @@ class Raft : public raftRpcProctoc::raftRpc {
   void readPersist(std::string data);
   std::string persistData();
 
-  void Start(Op command, int *newLogIndex, int *newLogTerm, bool *isLeader);
+  /**
+   * @brief 解析 persistData() 产生的持久化状态，取出快照下标和快照之后的日志
+   * 不访问 Raft 对象，可以在其他线程里读持久化文件后调用；data 为空时返回空日志
+   */
+  static void DecodePersistedLog(const std::string &data, int *lastSnapshotIncludeIndex,
+                                 std::vector<raftRpcProctoc::LogEntry> *logs);
+
+  /**
+   * @brief 提交一条命令
+   * 不是leader时isLeader为false。是leader但背压生效时同样拒绝，isLeader为true、newLogIndex为-1：
+   * 未提交的日志超过MaxUncommittedEntries条或MaxUncommittedBytes字节（跟随者跟不上），
+   * 或者apply队列满了、已提交的日志在raft里又积压了ApplyQueueCapacity条（状态机应用太慢）
+   * @return 命令是否追加到了日志
+   */
+  bool Start(Op command, int *newLogIndex, int *newLogTerm, bool *isLeader);
+
+  // 把已经提交的日志从m_uncommittedBytes里扣掉，需要时重新统计；持有m_mtx调用
+  void settleUncommittedBytes();
 
   // Snapshot the service says it has created a snapshot that has
   // all info up to and including index. this means the
@@ -136,7 +159,7 @@ class Raft : public raftRpcProctoc::raftRpc {
 
  public:
   void init(std::vector<std::shared_ptr<RaftRpcUtil>> peers, int me, std::shared_ptr<Persister> persister,
-            std::shared_ptr<LockQueue<ApplyMsg>> applyCh);
+            std::shared_ptr<MpscRing<ApplyMsg>> applyCh);
 
  private:
   // for persist
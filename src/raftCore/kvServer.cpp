@@ -2,81 +2,111 @@
 
 #include <rpcprovider.h>
 
+#include "Coding.h"
+#include "TxnExecutor.h"
 #include "mprpcconfig.h"
 
-void KvServer::DprintfKVDB() {
-  if (!Debug) {
-    return;
+namespace {
+
+constexpr int kScanDefaultLimit = 100;
+constexpr int kScanMaxLimit = 1000;
+constexpr size_t kScanMaxReplyBytes = 4 << 20;  // 单页回复的大小上限，超过后提前截断本页
+constexpr std::chrono::seconds kScanViewTtl(10);
+constexpr size_t kMaxScanViews = 16;
+// 删除的key达到上次快照时key数量的一半（且不少于这个数）时提前做快照
+constexpr size_t kMinDeletesForSnapshot = 1024;
+constexpr int kWatchDefaultEvents = 256;
+constexpr int kWatchMaxEvents = 4096;
+constexpr int kWatchDefaultWaitMs = 1000;
+constexpr int kWatchMaxWaitMs = 5000;
+constexpr int kExportDefaultEntries = 256;
+constexpr int kExportMaxEntries = 4096;
+constexpr size_t kExportMaxReplyBytes = 4 << 20;
+constexpr size_t kExportSnapshotPageKvs = 1024;
+// 清理线程检查等待超时的间隔，请求最多比CONSENSUS_TIMEOUT晚这么久失败，Watch长轮询最多比请求的等待时间晚这么久返回
+constexpr std::chrono::milliseconds kCompletionSweepInterval(50);
+// 提案合并：第一个写请求到达后最多再等这么久，或者攒够条数/字节数就立即提交
+constexpr std::chrono::microseconds kCoalesceWindow(200);
+constexpr size_t kCoalesceMaxOps = 128;
+constexpr size_t kCoalesceMaxBytes = 256 << 10;
+// 并行apply的线程数上限（包含apply线程）
+constexpr size_t kMaxApplyThreads = 8;
+// 状态机点查热点缓存的容量
+constexpr size_t kReadCacheBytes = 64 << 20;
+// apply线程每次从apply队列最多取这么多条
+constexpr size_t kApplyPopBatch = 256;
+// raft因背压拒绝提交时ProposeAsync回调的索引，和真实的日志索引（>=1）以及不是leader时的-1区分开
+constexpr int kProposalThrottled = -2;
+
+// 会修改数据的日志；其余（Get、读屏障、检查点）只在IncludeReads时导出
+bool isMutation(const std::string &operation) {
+  return operation == "Put" || operation == "Append" || operation == "Batch" || operation == "Txn" ||
+         operation == "Delete" || operation == "DeleteRange" || operation == "Coalesced";
+}
+
+// 翻页令牌：fixed64 读索引 + 本页最后一个key
+std::string encodePageToken(int64_t readIndex, const std::string &lastKey) {
+  std::string token;
+  coding::PutFixed64(&token, static_cast<uint64_t>(readIndex));
+  token.append(lastKey);
+  return token;
+}
+
+bool decodePageToken(const std::string &token, int64_t *readIndex, std::string *lastKey) {
+  if (token.size() < 8) {
+    return false;
   }
-  std::lock_guard<std::mutex> lg(m_mtx);
-  DEFER {
-    // for (const auto &item: m_kvDB) {
-    //     DPrintf("[DBInfo ----]Key : %s, Value : %s", &item.first, &item.second);
-    // }
-    m_skipList.display_list();
-  };
+  *readIndex = static_cast<int64_t>(coding::DecodeFixed64(token.data()));
+  lastKey->assign(token, 8, std::string::npos);
+  return true;
 }
 
-void KvServer::ExecuteAppendOpOnKVDB(Op op) {
-  // if op.IfDuplicate {   //get请求是可重复执行的，因此可以不用判复
-  //	return
-  // }
-  m_mtx.lock();
+// 准入的请求回复之后归还名额
+class ReleaseAdmission : public google::protobuf::Closure {
+ public:
+  ReleaseAdmission(AdmissionController *admission, google::protobuf::Closure *done)
+      : m_admission(admission), m_done(done) {}
 
-  m_skipList.insert_set_element(op.Key, op.Value);
+  void Run() override {
+    m_done->Run();
+    m_admission->Release();
+    delete this;
+  }
 
-  // if (m_kvDB.find(op.Key) != m_kvDB.end()) {
-  //     m_kvDB[op.Key] = m_kvDB[op.Key] + op.Value;
-  // } else {
-  //     m_kvDB.insert(std::make_pair(op.Key, op.Value));
-  // }
-  m_lastRequestId[op.ClientId] = op.RequestId;
-  m_mtx.unlock();
+ private:
+  AdmissionController *m_admission;
+  google::protobuf::Closure *m_done;
+};
 
-  //    DPrintf("[KVServerExeAPPEND-----]ClientId :%d ,RequestID :%d ,Key : %v, value : %v", op.ClientId, op.RequestId,
-  //    op.Key, op.Value)
-  DprintfKVDB();
-}
+}  // namespace
 
-void KvServer::ExecuteGetOpOnKVDB(Op op, std::string *value, bool *exist) {
-  m_mtx.lock();
-  *value = "";
-  *exist = false;
-  if (m_skipList.search_element(op.Key, *value)) {
-    *exist = true;
-    // *value = m_skipList.se //value已经完成赋值了
-  }
-  // if (m_kvDB.find(op.Key) != m_kvDB.end()) {
-  //     *exist = true;
-  //     *value = m_kvDB[op.Key];
-  // }
-  m_lastRequestId[op.ClientId] = op.RequestId;
-  m_mtx.unlock();
-
-  if (*exist) {
-    //                DPrintf("[KVServerExeGET----]ClientId :%d ,RequestID :%d ,Key : %v, value :%v", op.ClientId,
-    //                op.RequestId, op.Key, value)
-  } else {
-    //        DPrintf("[KVServerExeGET----]ClientId :%d ,RequestID :%d ,Key : %v, But No KEY!!!!", op.ClientId,
-    //        op.RequestId, op.Key)
+void KvServer::DprintfKVDB() {
+  if (!Debug) {
+    return;
   }
-  DprintfKVDB();
+  DEFER {
+    m_stateMachine->OpenReadView()->Scan("", [](const std::string &key, const std::string &value) {
+      std::cout << key << ":" << value << ";";
+      return true;
+    });
+    std::cout << std::endl;
+  };
 }
 
-void KvServer::ExecutePutOpOnKVDB(Op op) {
-  m_mtx.lock();
-  m_skipList.insert_set_element(op.Key, op.Value);
-  // m_kvDB[op.Key] = op.Value;
-  m_lastRequestId[op.ClientId] = op.RequestId;
-  m_mtx.unlock();
-
-  //    DPrintf("[KVServerExePUT----]ClientId :%d ,RequestID :%d ,Key : %v, value : %v", op.ClientId, op.RequestId,
-  //    op.Key, op.Value)
+void KvServer::ExecuteGetOpOnKVDB(Op op, std::string *value, bool *exist) {
+  // 读最新的已应用数据，过期的key不可见；会话表只由apply线程按日志修改，这里（RPC线程）不记录请求号
+  value->clear();
+  *exist = m_stateMachine->Get(op.Key, value);
   DprintfKVDB();
 }
 
 // 处理来自clerk的Get RPC
-void KvServer::Get(const raftKVRpcProctoc::GetArgs *args, raftKVRpcProctoc::GetReply *reply) {
+void KvServer::Get(const raftKVRpcProctoc::GetArgs *args, raftKVRpcProctoc::GetReply *reply,
+                   google::protobuf::Closure *done) {
+  done = Admit(AdmissionController::kRead, reply, done);
+  if (done == nullptr) {
+    return;
+  }
   Op op;
   op.Operation = "Get";
   op.Key = args->key();
@@ -84,83 +114,25 @@ void KvServer::Get(const raftKVRpcProctoc::GetArgs *args, raftKVRpcProctoc::GetR
   op.ClientId = args->clientid();
   op.RequestId = args->requestid();
 
-  int raftIndex = -1;
-  int _ = -1;
-  bool isLeader = false;
-  m_raftNode->Start(op, &raftIndex, &_,
-                    &isLeader);  // raftIndex：raft预计的logIndex
-                                 // ，虽然是预计，但是正确情况下是准确的，op的具体内容对raft来说 是隔离的
-
-  if (!isLeader) {
-    reply->set_err(ErrWrongLeader);
-    return;
-  }
-
-  // create waitForCh
-  m_mtx.lock();
-
-  if (waitApplyCh.find(raftIndex) == waitApplyCh.end()) {
-    waitApplyCh.insert(std::make_pair(raftIndex, new LockQueue<Op>()));
-  }
-  auto chForRaftIndex = waitApplyCh[raftIndex];
-
-  m_mtx.unlock();  //直接解锁，等待任务执行完成，不能一直拿锁等待
-
-  // timeout
-  Op raftCommitOp;
-
-  if (!chForRaftIndex->timeOutPop(CONSENSUS_TIMEOUT, &raftCommitOp)) {
-    //        DPrintf("[GET TIMEOUT!!!]From Client %d (Request %d) To Server %d, key %v, raftIndex %d", args.ClientId,
-    //        args.RequestId, kv.me, op.Key, raftIndex)
-    // todo 2023年06月01日
-    int _ = -1;
-    bool isLeader = false;
-    m_raftNode->GetState(&_, &isLeader);
-
-    if (ifRequestDuplicate(op.ClientId, op.RequestId) && isLeader) {
-      //如果超时，代表raft集群不保证已经commitIndex该日志，但是如果是已经提交过的get请求，是可以再执行的。
-      // 不会违反线性一致性
-      std::string value;
-      bool exist = false;
-      ExecuteGetOpOnKVDB(op, &value, &exist);
-      if (exist) {
-        reply->set_err(OK);
-        reply->set_value(value);
-      } else {
-        reply->set_err(ErrNoKey);
-        reply->set_value("");
-      }
-    } else {
-      reply->set_err(ErrWrongLeader);  //返回这个，其实就是让clerk换一个节点重试
+  // 回调时这条日志已经apply并对读者可见，直接在最新的读视图上读；超时或者日志被覆盖都让clerk换一个节点重试
+  ProposeAsync(op, [this, op, reply, done](bool applied, int raftIndex) {
+    if (!applied) {
+      ReplyNotApplied(reply, raftIndex);
+      done->Run();
+      return;
     }
-  } else {
-    // raft已经提交了该command（op），可以正式开始执行了
-    //         DPrintf("[WaitChanGetRaftApplyMessage<--]Server %d , get Command <-- Index:%d , ClientId %d, RequestId
-    //         %d, Opreation %v, Key :%v, Value :%v", kv.me, raftIndex, op.ClientId, op.RequestId, op.Operation, op.Key,
-    //         op.Value)
-    // todo 这里还要再次检验的原因：感觉不用检验，因为leader只要正确的提交了，那么这些肯定是符合的
-    if (raftCommitOp.ClientId == op.ClientId && raftCommitOp.RequestId == op.RequestId) {
-      std::string value;
-      bool exist = false;
-      ExecuteGetOpOnKVDB(op, &value, &exist);
-      if (exist) {
-        reply->set_err(OK);
-        reply->set_value(value);
-      } else {
-        reply->set_err(ErrNoKey);
-        reply->set_value("");
-      }
+    std::string value;
+    bool exist = false;
+    ExecuteGetOpOnKVDB(op, &value, &exist);
+    if (exist) {
+      reply->set_err(OK);
+      reply->set_value(std::move(value));
     } else {
-      reply->set_err(ErrWrongLeader);
-      //            DPrintf("[GET ] 不满足：raftCommitOp.ClientId{%v} == op.ClientId{%v} && raftCommitOp.RequestId{%v}
-      //            == op.RequestId{%v}", raftCommitOp.ClientId, op.ClientId, raftCommitOp.RequestId, op.RequestId)
+      reply->set_err(ErrNoKey);
+      reply->set_value("");
     }
-  }
-  m_mtx.lock();  // todo 這個可以先弄一個defer，因爲刪除優先級並不高，先把rpc發回去更加重要
-  auto tmp = waitApplyCh[raftIndex];
-  waitApplyCh.erase(raftIndex);
-  delete tmp;
-  m_mtx.unlock();
+    done->Run();
+  });
 }
 
 void KvServer::GetCommandFromRaft(ApplyMsg message) {
@@ -175,123 +147,741 @@ void KvServer::GetCommandFromRaft(ApplyMsg message) {
     return;
   }
 
-  // State Machine (KVServer solute the duplicate problem)
-  // duplicate command will not be exed
-  if (!ifRequestDuplicate(op.ClientId, op.RequestId)) {
-    // execute command
-    if (op.Operation == "Put") {
-      ExecutePutOpOnKVDB(op);
-    }
-    if (op.Operation == "Append") {
-      ExecuteAppendOpOnKVDB(op);
-    }
-    //  kv.lastRequestId[op.ClientId] = op.RequestId  在Executexxx函数里面更新的
+  if (!m_watchHistoryStarted) {
+    m_watchHub.Reset(message.CommandIndex - 1);
+    m_watchHistoryStarted = true;
+  }
+
+  // 判重、执行、发布过期时间都在状态机里；会话已经过期、没有执行的写请求会被清掉clientId，
+  // 等待者按失败返回，clerk重试时由handler的预检查回复ErrSessionExpired
+  if (!m_stateMachine->ApplyOp(op, message.CommandIndex, &m_pendingEvents)) {
+    return;  // 状态机已经应用过这个索引（早于安装的快照），和上面一样跳过
   }
+  if (!m_pendingEvents.empty()) {
+    m_watchHub.Publish(message.CommandIndex, std::move(m_pendingEvents));
+    m_pendingEvents.clear();
+  }
+  // 回调等待这条日志的请求。回调在apply线程里写回复，先于制作快照，回复不用等快照序列化完
+  CompleteRequests(op, message.CommandIndex);
+
   //到这里kvDB已经制作了快照
   if (m_maxRaftState != -1) {
     IfNeedToSendSnapShotCommand(message.CommandIndex, 9);
     //如果raft的log太大（大于指定的比例）就把制作快照
   }
-
-  // Send message to the chan of op.ClientId
-  SendMessageToWaitChan(op, message.CommandIndex);
 }
 
 bool KvServer::ifRequestDuplicate(std::string ClientId, int RequestId) {
-  std::lock_guard<std::mutex> lg(m_mtx);
-  if (m_lastRequestId.find(ClientId) == m_lastRequestId.end()) {
-    return false;
-    // todo :不存在这个client就创建
+  return m_stateMachine->IsDuplicateRequest(ClientId, RequestId);
+}
+
+bool KvServer::SessionRejected(const std::string &clientId) { return m_stateMachine->SessionExpired(clientId); }
+
+template <typename Reply>
+google::protobuf::Closure *KvServer::Admit(AdmissionController::Priority priority, Reply *reply,
+                                           google::protobuf::Closure *done) {
+  int64_t retryAfterMs = 0;
+  if (!m_admission.TryAdmit(priority, applyChan->Size(), &retryAfterMs)) {
+    reply->set_err(ErrBusy);
+    reply->set_retryafterms(retryAfterMs);
+    done->Run();
+    return nullptr;
+  }
+  return new ReleaseAdmission(&m_admission, done);
+}
+
+template <typename Reply>
+KvServer::Completion KvServer::WriteCompletion(const Op &op, Reply *reply, google::protobuf::Closure *done) {
+  return [this, clientId = op.ClientId, requestId = op.RequestId, reply, done](bool applied, int raftIndex) {
+    // 没等到这条日志（超时、日志被新leader覆盖），但请求已经被应用过（例如clerk重试的旧请求），同样视为成功
+    if (applied || ifRequestDuplicate(clientId, requestId)) {
+      reply->set_err(OK);
+    } else {
+      ReplyNotApplied(reply, raftIndex);  //这里返回这个的目的让clerk重新尝试
+    }
+    done->Run();
+  };
+}
+
+template <typename Reply>
+void KvServer::ReplyNotApplied(Reply *reply, int raftIndex) {
+  if (raftIndex == kProposalThrottled) {
+    // 还是leader，只是日志提交或apply跟不上：留在本节点稍后重试，不要换节点
+    reply->set_err(ErrBusy);
+    reply->set_retryafterms(m_admission.BacklogRetryAfterMs(MaxUncommittedEntries / 4));
+  } else {
+    reply->set_err(ErrWrongLeader);
   }
-  return RequestId <= m_lastRequestId[ClientId];
 }
 
 // get和put//append執行的具體細節是不一樣的
 // PutAppend在收到raft消息之後執行，具體函數裏面只判斷冪等性（是否重複）
 // get函數收到raft消息之後在，因爲get無論是否重複都可以再執行
-void KvServer::PutAppend(const raftKVRpcProctoc::PutAppendArgs *args, raftKVRpcProctoc::PutAppendReply *reply) {
+void KvServer::PutAppend(const raftKVRpcProctoc::PutAppendArgs *args, raftKVRpcProctoc::PutAppendReply *reply,
+                         google::protobuf::Closure *done) {
+  if (SessionRejected(args->clientid())) {
+    reply->set_err(ErrSessionExpired);
+    done->Run();
+    return;
+  }
+  done = Admit(AdmissionController::kWrite, reply, done);
+  if (done == nullptr) {
+    return;
+  }
   Op op;
   op.Operation = args->op();
   op.Key = args->key();
   op.Value = args->value();
   op.ClientId = args->clientid();
   op.RequestId = args->requestid();
+  op.TtlMs = args->ttlms();
+  DPrintf("[func -KvServer::PutAppend -kvserver{%d}]From Client %s (Request %d) To Server %d, key %s", m_me,
+          &args->clientid(), args->requestid(), m_me, &op.Key);
+  Completion callback = WriteCompletion(op, reply, done);
+  ProposeCoalesced(std::move(op), std::move(callback));
+}
+
+void KvServer::ProposeCoalesced(Op op, Completion callback) {
+  bool wake = false;
+  {
+    std::lock_guard<std::mutex> lg(m_coalesceMtx);
+    m_coalesceBytes += op.Key.size() + op.Value.size();
+    m_coalesceQueue.push_back(PendingWrite{std::move(op), std::move(callback)});
+    // 队列从空变成非空时合并线程在等第一个请求，攒够时在等窗口结束，其余情况不用唤醒
+    wake = m_coalesceQueue.size() == 1 || m_coalesceQueue.size() >= kCoalesceMaxOps ||
+           m_coalesceBytes >= kCoalesceMaxBytes;
+  }
+  if (wake) {
+    m_coalesceCv.notify_one();
+  }
+}
+
+void KvServer::CoalesceLoop() {
+  std::vector<PendingWrite> pending;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lk(m_coalesceMtx);
+      m_coalesceCv.wait(lk, [this] { return !m_coalesceQueue.empty(); });
+      m_coalesceCv.wait_for(lk, kCoalesceWindow, [this] {
+        return m_coalesceQueue.size() >= kCoalesceMaxOps || m_coalesceBytes >= kCoalesceMaxBytes;
+      });
+      pending.swap(m_coalesceQueue);
+      m_coalesceBytes = 0;
+    }
+    // 合并线程阻塞在Start（持久化）期间到达的请求会攒到下一批，负载越高每批越大
+    std::vector<PendingWrite> writes;
+    size_t bytes = 0;
+    for (auto &write : pending) {
+      size_t size = write.op.Key.size() + write.op.Value.size();
+      if (!writes.empty() && (writes.size() >= kCoalesceMaxOps || bytes + size > kCoalesceMaxBytes)) {
+        ProposeWrites(std::move(writes));
+        writes.clear();
+        bytes = 0;
+      }
+      bytes += size;
+      writes.push_back(std::move(write));
+    }
+    ProposeWrites(std::move(writes));
+    pending.clear();
+  }
+}
+
+void KvServer::ProposeWrites(std::vector<PendingWrite> writes) {
+  if (writes.size() == 1) {
+    ProposeAsync(writes[0].op, std::move(writes[0].callback));
+    return;
+  }
+  Op op;
+  op.Operation = "Coalesced";
+  op.ClientId = m_coalesceClientId;
+  op.RequestId = static_cast<int>(++m_coalesceSeq & 0x7fffffff);
+  op.Batch.reserve(writes.size());
+  std::vector<std::pair<std::string, int>> requests;
+  std::vector<Completion> callbacks;
+  requests.reserve(writes.size());
+  callbacks.reserve(writes.size());
+  for (auto &write : writes) {
+    requests.emplace_back(write.op.ClientId, write.op.RequestId);
+    callbacks.push_back(std::move(write.callback));
+    op.Batch.push_back(std::move(write.op));
+  }
+  ProposeAsync(op, [this, requests = std::move(requests), callbacks = std::move(callbacks)](bool applied,
+                                                                                            int raftIndex) {
+    // 合并日志应用了也不代表每个子操作都执行了（会话过期的会被跳过），按会话表逐个确认
+    for (size_t i = 0; i < callbacks.size(); ++i) {
+      bool executed = applied && ifRequestDuplicate(requests[i].first, requests[i].second);
+      callbacks[i](executed, raftIndex);
+    }
+  });
+}
+
+void KvServer::ProposeAsync(const Op &op, Completion callback) {
   int raftIndex = -1;
   int _ = -1;
-  bool isleader = false;
+  bool isLeader = false;
+  bool appended = m_raftNode->Start(op, &raftIndex, &_, &isLeader);
+  if (!isLeader) {
+    callback(false, -1);
+    return;
+  }
+  if (!appended) {
+    callback(false, kProposalThrottled);
+    return;
+  }
+  // Start返回之后日志可能已经apply了，Register会发现并直接回调
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(CONSENSUS_TIMEOUT);
+  m_completions.Register(raftIndex, CompletionSlab::Tag(op.ClientId, op.RequestId), deadline, std::move(callback));
+}
 
-  m_raftNode->Start(op, &raftIndex, &_, &isleader);
+void KvServer::CompleteRequests(const Op &op, int raftIndex) {
+  //可能发生leader的变更导致日志被覆盖，因此按请求的指纹检查
+  m_completions.Complete(raftIndex, CompletionSlab::Tag(op.ClientId, op.RequestId));
+}
 
-  if (!isleader) {
-    DPrintf(
-        "[func -KvServer::PutAppend -kvserver{%d}]From Client %s (Request %d) To Server %d, key %s, raftIndex %d , but "
-        "not leader",
-        m_me, &args->clientid(), args->requestid(), m_me, &op.Key, raftIndex);
+void KvServer::CompletionSweepLoop() {
+  while (true) {
+    std::this_thread::sleep_for(kCompletionSweepInterval);
+    auto now = std::chrono::steady_clock::now();
+    m_completions.Expire(now);
+    m_watchHub.Expire(now);
+  }
+}
 
-    reply->set_err(ErrWrongLeader);
-    return;
+std::shared_ptr<IReadView> KvServer::FindScanView(const std::string &pageToken, std::string *resumeKey,
+                                                  std::string *err) {
+  int64_t readIndex = 0;
+  if (!decodePageToken(pageToken, &readIndex, resumeKey)) {
+    *err = ErrScanExpired;
+    return nullptr;
   }
-  DPrintf(
-      "[func -KvServer::PutAppend -kvserver{%d}]From Client %s (Request %d) To Server %d, key %s, raftIndex %d , is "
-      "leader ",
-      m_me, &args->clientid(), args->requestid(), m_me, &op.Key, raftIndex);
-  m_mtx.lock();
-  if (waitApplyCh.find(raftIndex) == waitApplyCh.end()) {
-    waitApplyCh.insert(std::make_pair(raftIndex, new LockQueue<Op>()));
+  // 从上一页最后一个key之后继续
+  resumeKey->push_back('\0');
+  {
+    std::lock_guard<std::mutex> lg(m_scanMtx);
+    auto it = m_scanViews.find(readIndex);
+    if (it != m_scanViews.end()) {
+      return it->second.view;
+    }
+  }
+  // 没有保存的视图（过期或者换了节点）：读索引的版本还没被回收时仍然可以重新打开
+  std::shared_ptr<IReadView> reopened = m_stateMachine->OpenReadView(readIndex);
+  if (reopened == nullptr) {
+    *err = ErrScanExpired;
+  }
+  return reopened;
+}
+
+void KvServer::PinScanView(const std::shared_ptr<IReadView> &view) {
+  const auto now = std::chrono::steady_clock::now();
+  std::lock_guard<std::mutex> lg(m_scanMtx);
+  for (auto it = m_scanViews.begin(); it != m_scanViews.end();) {
+    it = it->second.expiry < now ? m_scanViews.erase(it) : std::next(it);
+  }
+  m_scanViews[view->Index()] = PinnedScanView{view, now + kScanViewTtl};
+  if (m_scanViews.size() > kMaxScanViews) {
+    auto oldest = m_scanViews.begin();
+    for (auto it = m_scanViews.begin(); it != m_scanViews.end(); ++it) {
+      if (it->second.expiry < oldest->second.expiry) {
+        oldest = it;
+      }
+    }
+    m_scanViews.erase(oldest);
   }
-  auto chForRaftIndex = waitApplyCh[raftIndex];
+}
 
-  m_mtx.unlock();  //直接解锁，等待任务执行完成，不能一直拿锁等待
+void KvServer::FillScanPage(const std::shared_ptr<IReadView> &view, const std::string &resumeKey,
+                            const std::string &end, const std::string &prefix, int limit,
+                            raftKVRpcProctoc::ScanReply *reply) {
+  PinScanView(view);
+  if (limit <= 0) {
+    limit = kScanDefaultLimit;
+  }
+  limit = std::min(limit, kScanMaxLimit);
 
-  // timeout
-  Op raftCommitOp;
+  size_t bytes = 0;
+  std::string lastKey;
+  bool more = false;
+  view->Scan(resumeKey, [&](const std::string &key, const std::string &value) {
+    if ((!end.empty() && key >= end) || key.compare(0, prefix.size(), prefix) != 0) {
+      return false;
+    }
+    if (m_stateMachine->KeyExpired(key)) {
+      return true;
+    }
+    // 本页已满但区间内还有数据，才需要下一页的令牌
+    if (reply->kvs_size() >= limit || (reply->kvs_size() > 0 && bytes + key.size() + value.size() > kScanMaxReplyBytes)) {
+      more = true;
+      return false;
+    }
+    auto *kv = reply->add_kvs();
+    kv->set_key(key);
+    kv->set_value(value);
+    bytes += key.size() + value.size();
+    lastKey = key;
+    return true;
+  });
 
-  if (!chForRaftIndex->timeOutPop(CONSENSUS_TIMEOUT, &raftCommitOp)) {
-    DPrintf(
-        "[func -KvServer::PutAppend -kvserver{%d}]TIMEOUT PUTAPPEND !!!! Server %d , get Command <-- Index:%d , "
-        "ClientId %s, RequestId %s, Opreation %s Key :%s, Value :%s",
-        m_me, m_me, raftIndex, &op.ClientId, op.RequestId, &op.Operation, &op.Key, &op.Value);
+  reply->set_err(OK);
+  reply->set_readindex(view->Index());
+  if (more) {
+    reply->set_nextpagetoken(encodePageToken(view->Index(), lastKey));
+  }
+}
 
-    if (ifRequestDuplicate(op.ClientId, op.RequestId)) {
-      reply->set_err(OK);  // 超时了,但因为是重复的请求，返回ok，实际上就算没有超时，在真正执行的时候也要判断是否重复
-    } else {
-      reply->set_err(ErrWrongLeader);  ///这里返回这个的目的让clerk重新尝试
+void KvServer::ScanPage(const std::string &start, const std::string &end, const std::string &prefix, int limit,
+                        const std::string &pageToken, const Op &barrier, raftKVRpcProctoc::ScanReply *reply,
+                        google::protobuf::Closure *done) {
+  if (pageToken.empty()) {
+    done = Admit(AdmissionController::kRead, reply, done);
+    if (done == nullptr) {
+      return;
     }
+    ProposeAsync(barrier, [this, start, end, prefix, limit, reply, done](bool applied, int raftIndex) {
+      if (!applied) {
+        ReplyNotApplied(reply, raftIndex);
+        done->Run();
+        return;
+      }
+      // 屏障日志apply之后才会回调，此时最新的已应用索引不小于屏障的索引
+      FillScanPage(m_stateMachine->OpenReadView(), start, end, prefix, limit, reply);
+      done->Run();
+    });
+    return;
+  }
+  // 后续分页不经过raft，直接在调用线程里读
+  std::string resumeKey;
+  std::string err;
+  std::shared_ptr<IReadView> view = FindScanView(pageToken, &resumeKey, &err);
+  if (view == nullptr) {
+    reply->set_err(err);
   } else {
-    DPrintf(
-        "[func -KvServer::PutAppend -kvserver{%d}]WaitChanGetRaftApplyMessage<--Server %d , get Command <-- Index:%d , "
-        "ClientId %s, RequestId %d, Opreation %s, Key :%s, Value :%s",
-        m_me, m_me, raftIndex, &op.ClientId, op.RequestId, &op.Operation, &op.Key, &op.Value);
-    if (raftCommitOp.ClientId == op.ClientId && raftCommitOp.RequestId == op.RequestId) {
-      //可能发生leader的变更导致日志被覆盖，因此必须检查
-      reply->set_err(OK);
+    FillScanPage(view, resumeKey, end, prefix, limit, reply);
+  }
+  done->Run();
+}
+
+void KvServer::Scan(const raftKVRpcProctoc::ScanArgs *args, raftKVRpcProctoc::ScanReply *reply,
+                    google::protobuf::Closure *done) {
+  Op op;
+  op.Operation = "Scan";
+  op.Key = args->startkey();
+  op.ClientId = args->clientid();
+  op.RequestId = args->requestid();
+  ScanPage(args->startkey(), args->endkey(), "", args->limit(), args->pagetoken(), op, reply, done);
+}
+
+void KvServer::PrefixScan(const raftKVRpcProctoc::PrefixScanArgs *args, raftKVRpcProctoc::ScanReply *reply,
+                          google::protobuf::Closure *done) {
+  Op op;
+  op.Operation = "Scan";
+  op.Key = args->prefix();
+  op.ClientId = args->clientid();
+  op.RequestId = args->requestid();
+  ScanPage(args->prefix(), "", args->prefix(), args->limit(), args->pagetoken(), op, reply, done);
+}
+
+void KvServer::MultiGet(const raftKVRpcProctoc::MultiGetArgs *args, raftKVRpcProctoc::MultiGetReply *reply,
+                        google::protobuf::Closure *done) {
+  done = Admit(AdmissionController::kRead, reply, done);
+  if (done == nullptr) {
+    return;
+  }
+  Op op;
+  op.Operation = "MultiGet";
+  op.ClientId = args->clientid();
+  op.RequestId = args->requestid();
+  ProposeAsync(op, [this, args, reply, done](bool applied, int raftIndex) {
+    if (!applied) {
+      ReplyNotApplied(reply, raftIndex);
+      done->Run();
+      return;
+    }
+    // 屏障之后打开一个视图，所有key读到的是同一时刻的数据（多版本引擎）
+    std::shared_ptr<IReadView> view = m_stateMachine->OpenReadView();
+    for (const auto &key : args->keys()) {
+      auto *result = reply->add_results();
+      result->set_exist(view->Get(key, result->mutable_value()));
+    }
+    view.reset();
+    for (int i = 0; i < reply->results_size(); ++i) {
+      auto *result = reply->mutable_results(i);
+      if (result->exist() && m_stateMachine->KeyExpired(args->keys(i))) {
+        result->set_exist(false);
+        result->clear_value();
+      }
+    }
+    reply->set_err(OK);
+    done->Run();
+  });
+}
+
+void KvServer::BatchWrite(const raftKVRpcProctoc::BatchWriteArgs *args, raftKVRpcProctoc::BatchWriteReply *reply,
+                          google::protobuf::Closure *done) {
+  if (SessionRejected(args->clientid())) {
+    reply->set_err(ErrSessionExpired);
+    done->Run();
+    return;
+  }
+  done = Admit(AdmissionController::kWrite, reply, done);
+  if (done == nullptr) {
+    return;
+  }
+  Op op;
+  op.Operation = "Batch";
+  op.ClientId = args->clientid();
+  op.RequestId = args->requestid();
+  op.Batch.reserve(args->ops_size());
+  for (const auto &write : args->ops()) {
+    Op sub;
+    sub.Operation = write.op();
+    sub.Key = write.key();
+    sub.Value = write.value();
+    sub.RequestId = 0;
+    sub.TtlMs = write.ttlms();
+    op.Batch.push_back(std::move(sub));
+  }
+  ProposeAsync(op, WriteCompletion(op, reply, done));
+}
+
+void KvServer::Txn(const raftKVRpcProctoc::TxnArgs *args, raftKVRpcProctoc::TxnReply *reply,
+                   google::protobuf::Closure *done) {
+  if (SessionRejected(args->clientid())) {
+    reply->set_err(ErrSessionExpired);
+    done->Run();
+    return;
+  }
+  done = Admit(AdmissionController::kWrite, reply, done);
+  if (done == nullptr) {
+    return;
+  }
+  Op op;
+  op.Operation = "Txn";
+  op.ClientId = args->clientid();
+  op.RequestId = args->requestid();
+  for (const auto &c : args->compares()) {
+    TxnCompare cmp;
+    cmp.Key = c.key();
+    cmp.Target = c.target();
+    cmp.Result = c.result();
+    cmp.Value = c.value();
+    cmp.Exists = c.exists();
+    cmp.Version = c.version();
+    op.Txn.Compares.push_back(std::move(cmp));
+  }
+  auto convertOps = [](const google::protobuf::RepeatedPtrField<raftKVRpcProctoc::TxnOp> &from,
+                       std::vector<TxnOp> *to) {
+    for (const auto &o : from) {
+      TxnOp txnOp;
+      txnOp.Op = o.op();
+      txnOp.Key = o.key();
+      txnOp.Value = o.value();
+      txnOp.Delta = o.delta();
+      to->push_back(std::move(txnOp));
+    }
+  };
+  convertOps(args->success(), &op.Txn.Success);
+  convertOps(args->failure(), &op.Txn.Failure);
+
+  ProposeAsync(op, [this, clientId = op.ClientId, requestId = op.RequestId, reply, done](bool applied,
+                                                                                         int raftIndex) {
+    // 第一次执行和重试都从会话表取结果：重复的请求在apply时不会再执行
+    TxnResponse resp;
+    bool found = false;
+    if (applied || ifRequestDuplicate(clientId, requestId)) {
+      found = m_stateMachine->GetTxnResult(clientId, requestId, &resp);
+    }
+    if (!found) {
+      ReplyNotApplied(reply, raftIndex);
+    } else if (!resp.Err.empty()) {
+      reply->set_err(ErrInvalidTxn);
+      reply->set_txnerror(resp.Err);
     } else {
-      reply->set_err(ErrWrongLeader);
+      reply->set_err(OK);
+      reply->set_succeeded(resp.Succeeded);
+      for (auto &r : resp.Results) {
+        auto *result = reply->add_results();
+        result->set_exist(r.Exist);
+        result->set_applied(r.Applied);
+        result->set_value(std::move(r.Value));
+      }
     }
+    done->Run();
+  });
+}
+
+void KvServer::Delete(const raftKVRpcProctoc::DeleteArgs *args, raftKVRpcProctoc::DeleteReply *reply,
+                      google::protobuf::Closure *done) {
+  if (SessionRejected(args->clientid())) {
+    reply->set_err(ErrSessionExpired);
+    done->Run();
+    return;
+  }
+  done = Admit(AdmissionController::kWrite, reply, done);
+  if (done == nullptr) {
+    return;
   }
+  Op op;
+  op.Operation = "Delete";
+  op.Key = args->key();
+  op.ClientId = args->clientid();
+  op.RequestId = args->requestid();
+  ProposeAsync(op, WriteCompletion(op, reply, done));
+}
 
-  m_mtx.lock();
+void KvServer::DeleteRange(const raftKVRpcProctoc::DeleteRangeArgs *args, raftKVRpcProctoc::DeleteReply *reply,
+                           google::protobuf::Closure *done) {
+  if (SessionRejected(args->clientid())) {
+    reply->set_err(ErrSessionExpired);
+    done->Run();
+    return;
+  }
+  done = Admit(AdmissionController::kWrite, reply, done);
+  if (done == nullptr) {
+    return;
+  }
+  Op op;
+  op.Operation = "DeleteRange";
+  op.Key = args->startkey();
+  op.Value = args->endkey();
+  op.ClientId = args->clientid();
+  op.RequestId = args->requestid();
+  ProposeAsync(op, WriteCompletion(op, reply, done));
+}
+
+void KvServer::Watch(const raftKVRpcProctoc::WatchArgs *args, raftKVRpcProctoc::WatchReply *reply,
+                     google::protobuf::Closure *done) {
+  // 挂起的轮询同样占着在途名额，登记之前先准入
+  done = Admit(AdmissionController::kRead, reply, done);
+  if (done == nullptr) {
+    return;
+  }
+  int64_t watchId = args->watchid();
+  if (watchId == 0) {
+    watchId = m_watchHub.Create(args->key(), args->prefix(), args->startindex());
+    if (watchId == 0) {
+      reply->set_err(ErrWatchResync);
+      done->Run();
+      return;
+    }
+  }
+  int maxEvents = args->maxevents() > 0 ? std::min(args->maxevents(), kWatchMaxEvents) : kWatchDefaultEvents;
+  int waitMs = args->timeoutms() > 0 ? std::min(args->timeoutms(), kWatchMaxWaitMs) : kWatchDefaultWaitMs;
+
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(waitMs);
+  auto complete = [watchId, reply, done](WatchHub::PollStatus status, std::vector<WatchEvent> events,
+                                        int64_t nextIndex) {
+    if (status == WatchHub::PollStatus::kNotFound) {
+      reply->set_err(ErrWatchNotFound);
+      done->Run();
+      return;
+    }
+    reply->set_nextindex(nextIndex);
+    if (status == WatchHub::PollStatus::kResync) {
+      reply->set_err(ErrWatchResync);
+      done->Run();
+      return;
+    }
+    reply->set_err(OK);
+    reply->set_watchid(watchId);
+    for (auto &event : events) {
+      auto *e = reply->add_events();
+      e->set_type(static_cast<raftKVRpcProctoc::WatchEvent::EventType>(event.Type));
+      e->set_key(std::move(event.Key));
+      e->set_value(std::move(event.Value));
+      e->set_index(event.Index);
+    }
+    done->Run();
+  };
+  m_watchHub.Poll(watchId, deadline, maxEvents, std::move(complete));
+}
 
-  auto tmp = waitApplyCh[raftIndex];
-  waitApplyCh.erase(raftIndex);
-  delete tmp;
-  m_mtx.unlock();
+void KvServer::CancelWatch(const raftKVRpcProctoc::CancelWatchArgs *args, raftKVRpcProctoc::CancelWatchReply *reply) {
+  m_watchHub.Cancel(args->watchid());
+  reply->set_err(OK);
+}
+
+void KvServer::ExportLog(const raftKVRpcProctoc::ExportLogArgs *args, raftKVRpcProctoc::ExportLogReply *reply) {
+  if (args->snapshotindex() > 0) {
+    ExportSnapshotPage(args->snapshotindex(), args->snapshotresumekey(), reply);
+    return;
+  }
+  int64_t fromIndex = args->fromindex();
+  if (fromIndex <= 0) {
+    fromIndex = 1;
+    if (!args->consumerid().empty()) {
+      fromIndex = m_stateMachine->CdcCheckpoint(args->consumerid()) + 1;
+    }
+  }
+  int maxEntries = args->maxentries() > 0 ? std::min(args->maxentries(), kExportMaxEntries) : kExportDefaultEntries;
+
+  // 只导出本节点已经apply的日志，持久化文件里更靠后的日志可能还没提交
+  std::vector<LogTail::Record> records;
+  int64_t snapshotIndex = 0;
+  if (!m_logTail->Read(fromIndex, m_stateMachine->AppliedIndex(), maxEntries, &records, &snapshotIndex)) {
+    ExportSnapshotPage(0, "", reply);
+    return;
+  }
+
+  reply->set_err(OK);
+  int64_t nextIndex = fromIndex;
+  size_t bytes = 0;
+  for (auto &record : records) {
+    if (bytes > 0 && bytes + record.Command.size() > kExportMaxReplyBytes) {
+      break;
+    }
+    nextIndex = record.Index + 1;
+    Op op;
+    op.parseFromString(record.Command);
+    if (!args->includereads() && !isMutation(op.Operation)) {
+      continue;
+    }
+    bytes += record.Command.size();
+    auto addEntry = [&](Op &from) {
+      auto *entry = reply->add_entries();
+      entry->set_index(record.Index);
+      entry->set_term(record.Term);
+      entry->set_operation(from.Operation);
+      entry->set_key(std::move(from.Key));
+      entry->set_value(std::move(from.Value));
+      entry->set_clientid(std::move(from.ClientId));
+      entry->set_requestid(from.RequestId);
+      entry->set_timestampms(op.TimestampMs);
+      entry->set_ttlms(from.TtlMs);
+      return entry;
+    };
+    if (op.Operation == "Coalesced") {
+      // 合并日志是服务端的实现细节，按原来的请求拆开导出，同一条日志的各项索引相同
+      for (auto &sub : op.Batch) {
+        addEntry(sub);
+      }
+      continue;
+    }
+    auto *entry = addEntry(op);
+    for (auto &sub : op.Batch) {
+      auto *write = entry->add_batch();
+      write->set_op(std::move(sub.Operation));
+      write->set_key(std::move(sub.Key));
+      write->set_value(std::move(sub.Value));
+      write->set_ttlms(sub.TtlMs);
+    }
+    if (op.Operation == "Txn") {
+      entry->set_command(std::move(record.Command));
+    }
+  }
+  reply->set_nextindex(nextIndex);
+}
+
+void KvServer::ExportSnapshotPage(int64_t snapshotIndex, const std::string &resumeKey,
+                                  raftKVRpcProctoc::ExportLogReply *reply) {
+  std::shared_ptr<const LogTail::Snapshot> snapshot;
+  try {
+    snapshot = m_logTail->LatestSnapshot();
+  } catch (const std::runtime_error &e) {
+    // 存储引擎的快照不是SkipListDump格式，无法按kv回放
+    DPrintf("[KvServer::ExportSnapshotPage-kvserver{%d}] %s", m_me, e.what());
+    reply->set_err(ErrExportUnsupported);
+    return;
+  }
+  reply->set_err(OK);
+  reply->set_snapshotindex(snapshot->Index);
+  auto it = snapshot->Kvs.begin();
+  if (snapshotIndex == snapshot->Index && !resumeKey.empty()) {
+    it = std::lower_bound(snapshot->Kvs.begin(), snapshot->Kvs.end(), resumeKey,
+                          [](const std::pair<std::string, std::string> &kv, const std::string &key) {
+                            return kv.first < key;
+                          });
+  }
+  size_t bytes = 0;
+  for (size_t n = 0; it != snapshot->Kvs.end() && n < kExportSnapshotPageKvs; ++it, ++n) {
+    if (n > 0 && bytes + it->first.size() + it->second.size() > kExportMaxReplyBytes) {
+      break;
+    }
+    auto *kv = reply->add_snapshotkvs();
+    kv->set_key(it->first);
+    kv->set_value(it->second);
+    bytes += it->first.size() + it->second.size();
+  }
+  if (it != snapshot->Kvs.end()) {
+    reply->set_snapshotresumekey(it->first);
+  } else {
+    reply->set_nextindex(snapshot->Index + 1);
+  }
+}
+
+void KvServer::CommitCdcCheckpoint(const raftKVRpcProctoc::CommitCdcCheckpointArgs *args,
+                                   raftKVRpcProctoc::CommitCdcCheckpointReply *reply,
+                                   google::protobuf::Closure *done) {
+  if (SessionRejected(args->clientid())) {
+    reply->set_err(ErrSessionExpired);
+    done->Run();
+    return;
+  }
+  done = Admit(AdmissionController::kControl, reply, done);
+  if (done == nullptr) {
+    return;
+  }
+  Op op;
+  op.Operation = "CdcCheckpoint";
+  op.Key = args->consumerid();
+  op.Value = std::to_string(args->index());
+  op.ClientId = args->clientid();
+  op.RequestId = args->requestid();
+  ProposeAsync(op, [this, op, reply, done](bool applied, int raftIndex) {
+    if (!applied && !ifRequestDuplicate(op.ClientId, op.RequestId)) {
+      ReplyNotApplied(reply, raftIndex);
+      done->Run();
+      return;
+    }
+    reply->set_err(OK);
+    reply->set_index(m_stateMachine->CdcCheckpoint(op.Key));
+    done->Run();
+  });
+}
+
+void KvServer::RegisterSession(const raftKVRpcProctoc::RegisterSessionArgs *args,
+                               raftKVRpcProctoc::RegisterSessionReply *reply, google::protobuf::Closure *done) {
+  // 注册日志还没有会话，ClientId 填客户端的随机数：各次注册的指纹不同，被截断的注册日志
+  // 即使在同一索引上被别的客户端的注册日志替换，也不会误认成自己的，两个客户端拿到同一个会话。apply 时不看它
+  done = Admit(AdmissionController::kControl, reply, done);
+  if (done == nullptr) {
+    return;
+  }
+  Op op;
+  op.Operation = "RegisterSession";
+  op.ClientId = std::to_string(args->nonce());
+  op.RequestId = 0;
+  ProposeAsync(op, [this, reply, done](bool applied, int raftIndex) {
+    if (!applied) {
+      ReplyNotApplied(reply, raftIndex);
+    } else {
+      reply->set_err(OK);
+      reply->set_sessionid(raftIndex);
+      reply->set_clientid(SessionTable::ClientIdOf(raftIndex));
+    }
+    done->Run();
+  });
 }
 
 void KvServer::ReadRaftApplyCommandLoop() {
+  std::vector<ApplyMsg> messages;
+  messages.reserve(kApplyPopBatch);
   while (true) {
-    //如果只操作applyChan不用拿锁，因为applyChan自己带锁
-    auto message = applyChan->Pop();  //阻塞弹出
+    // applyChan是无锁队列，一次取走所有已经就绪的消息（至少一条，队列空时阻塞），按顺序应用
+    messages.clear();
+    applyChan->PopBatch(&messages, kApplyPopBatch);
     DPrintf(
         "---------------tmp-------------[func-KvServer::ReadRaftApplyCommandLoop()-kvserver{%d}] 收到了下raft的消息",
         m_me);
     // listen to every command applied by its raft ,delivery to relative RPC Handler
 
-    if (message.CommandValid) {
-      GetCommandFromRaft(message);
-    }
-    if (message.SnapshotValid) {
-      GetSnapShotFromRaft(message);
+    for (auto &message : messages) {
+      if (message.CommandValid) {
+        GetCommandFromRaft(std::move(message));
+        m_admission.OnApplied();
+      }
+      if (message.SnapshotValid) {
+        GetSnapShotFromRaft(std::move(message));
+      }
     }
   }
 }
@@ -300,12 +890,17 @@ void KvServer::ReadRaftApplyCommandLoop() {
 //  关于快照raft层与persist的交互：保存kvserver传来的snapshot；生成leaderInstallSnapshot RPC的时候也需要读取snapshot；
 //  因此snapshot的具体格式是由kvserver层来定的，raft只负责传递这个东西
 //  snapShot里面包含kvserver需要维护的persist_lastRequestId 以及kvDB真正保存的数据persist_kvdb
-void KvServer::ReadSnapShotToInstall(std::string snapshot) {
+void KvServer::ReadSnapShotToInstall(std::string snapshot, int snapshotIndex) {
   if (snapshot.empty()) {
     // bootstrap without any state?
     return;
   }
-  parseFromString(snapshot);
+  // 启动时从持久化的快照恢复不知道索引，取已应用索引的下一个
+  if (snapshotIndex > 0) {
+    m_stateMachine->InstallSnapshot(snapshot, snapshotIndex);
+  } else {
+    m_stateMachine->InstallSnapshot(snapshot);
+  }
 
   //    r := bytes.NewBuffer(snapshot)
   //    d := labgob.NewDecoder(r)
@@ -321,73 +916,143 @@ void KvServer::ReadSnapShotToInstall(std::string snapshot) {
   //    }
 }
 
-bool KvServer::SendMessageToWaitChan(const Op &op, int raftIndex) {
-  std::lock_guard<std::mutex> lg(m_mtx);
-  DPrintf(
-      "[RaftApplyMessageSendToWaitChan--> raftserver{%d}] , Send Command --> Index:{%d} , ClientId {%d}, RequestId "
-      "{%d}, Opreation {%v}, Key :{%v}, Value :{%v}",
-      m_me, raftIndex, &op.ClientId, op.RequestId, &op.Operation, &op.Key, &op.Value);
-
-  if (waitApplyCh.find(raftIndex) == waitApplyCh.end()) {
-    return false;
-  }
-  waitApplyCh[raftIndex]->Push(op);
-  DPrintf(
-      "[RaftApplyMessageSendToWaitChan--> raftserver{%d}] , Send Command --> Index:{%d} , ClientId {%d}, RequestId "
-      "{%d}, Opreation {%v}, Key :{%v}, Value :{%v}",
-      m_me, raftIndex, &op.ClientId, op.RequestId, &op.Operation, &op.Key, &op.Value);
-  return true;
-}
-
 void KvServer::IfNeedToSendSnapShotCommand(int raftIndex, int proportion) {
-  if (m_raftNode->GetRaftStateSize() > m_maxRaftState / 10.0) {
-    // Send SnapShot Command
-    auto snapshot = MakeSnapShot();
-    m_raftNode->Snapshot(raftIndex, snapshot);
+  bool logTooLarge = m_raftNode->GetRaftStateSize() > m_maxRaftState / 10.0;
+  // 大批删除之后上一份快照里大多是已经不存在的key，不等日志变长就换成更小的快照
+  size_t deleted = m_stateMachine->DeletedSinceSnapshot();
+  bool shrunk = deleted >= kMinDeletesForSnapshot && deleted * 2 >= m_stateMachine->KeysAtLastSnapshot();
+  if ((logTooLarge || shrunk) && !m_snapshotInFlight.exchange(true)) {
+    // apply线程上只固定读视图、复制会话等小状态；kv数据在后台线程导出，导出完成后再交给raft裁剪日志。
+    // 期间leader发来更新的快照并已安装时，raft会拒绝这份较旧的快照
+    auto finish = MakeSnapShot();
+    size_t keys = m_stateMachine->KeysAtLastSnapshot();
+    std::thread([this, raftIndex, keys, finish = std::move(finish)]() {
+      std::string snapshot = finish();
+      size_t bytes = snapshot.size();
+      m_raftNode->Snapshot(raftIndex, std::move(snapshot));
+      DPrintf("[KvServer::IfNeedToSendSnapShotCommand-kvserver{%d}] snapshot at %d: %d bytes, %d keys", m_me,
+              raftIndex, static_cast<int>(bytes), static_cast<int>(keys));
+      m_snapshotInFlight.store(false);
+    }).detach();
   }
 }
 
 void KvServer::GetSnapShotFromRaft(ApplyMsg message) {
-  std::lock_guard<std::mutex> lg(m_mtx);
-
+  // 只在apply线程调用；会话表整体替换，多版本引擎的数据按版本安装，不影响并发的读
   if (m_raftNode->CondInstallSnapshot(message.SnapshotTerm, message.SnapshotIndex, message.Snapshot)) {
-    ReadSnapShotToInstall(message.Snapshot);
+    ReadSnapShotToInstall(message.Snapshot, message.SnapshotIndex);
     m_lastSnapShotRaftLogIndex = message.SnapshotIndex;
+    m_watchHub.Reset(message.SnapshotIndex);
+    m_watchHistoryStarted = true;
+    // 快照覆盖的日志不会再逐条apply，等待它们的请求不用等到超时
+    m_completions.FailUpTo(message.SnapshotIndex);
   }
 }
 
-std::string KvServer::MakeSnapShot() {
-  std::lock_guard<std::mutex> lg(m_mtx);
-  std::string snapshotData = getSnapshotData();
-  return snapshotData;
+std::function<std::string()> KvServer::MakeSnapShot() {
+  // 读请求不经过状态机的apply锁，多版本引擎的kv数据从读视图导出，Get等RPC和apply在导出期间照常执行
+  return m_stateMachine->CaptureSnapshot();
 }
 
 void KvServer::PutAppend(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::PutAppendArgs *request,
                          ::raftKVRpcProctoc::PutAppendReply *response, ::google::protobuf::Closure *done) {
-  KvServer::PutAppend(request, response);
-  done->Run();
+  KvServer::PutAppend(request, response, done);
 }
 
 void KvServer::Get(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::GetArgs *request,
                    ::raftKVRpcProctoc::GetReply *response, ::google::protobuf::Closure *done) {
-  KvServer::Get(request, response);
+  KvServer::Get(request, response, done);
+}
+
+void KvServer::Scan(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::ScanArgs *request,
+                    ::raftKVRpcProctoc::ScanReply *response, ::google::protobuf::Closure *done) {
+  KvServer::Scan(request, response, done);
+}
+
+void KvServer::PrefixScan(google::protobuf::RpcController *controller,
+                          const ::raftKVRpcProctoc::PrefixScanArgs *request, ::raftKVRpcProctoc::ScanReply *response,
+                          ::google::protobuf::Closure *done) {
+  KvServer::PrefixScan(request, response, done);
+}
+
+void KvServer::MultiGet(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::MultiGetArgs *request,
+                        ::raftKVRpcProctoc::MultiGetReply *response, ::google::protobuf::Closure *done) {
+  KvServer::MultiGet(request, response, done);
+}
+
+void KvServer::BatchWrite(google::protobuf::RpcController *controller,
+                          const ::raftKVRpcProctoc::BatchWriteArgs *request,
+                          ::raftKVRpcProctoc::BatchWriteReply *response, ::google::protobuf::Closure *done) {
+  KvServer::BatchWrite(request, response, done);
+}
+
+void KvServer::Delete(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::DeleteArgs *request,
+                      ::raftKVRpcProctoc::DeleteReply *response, ::google::protobuf::Closure *done) {
+  KvServer::Delete(request, response, done);
+}
+
+void KvServer::DeleteRange(google::protobuf::RpcController *controller,
+                           const ::raftKVRpcProctoc::DeleteRangeArgs *request,
+                           ::raftKVRpcProctoc::DeleteReply *response, ::google::protobuf::Closure *done) {
+  KvServer::DeleteRange(request, response, done);
+}
+
+void KvServer::Watch(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::WatchArgs *request,
+                     ::raftKVRpcProctoc::WatchReply *response, ::google::protobuf::Closure *done) {
+  KvServer::Watch(request, response, done);
+}
+
+void KvServer::CancelWatch(google::protobuf::RpcController *controller,
+                           const ::raftKVRpcProctoc::CancelWatchArgs *request,
+                           ::raftKVRpcProctoc::CancelWatchReply *response, ::google::protobuf::Closure *done) {
+  KvServer::CancelWatch(request, response);
   done->Run();
 }
 
-KvServer::KvServer(int me, int maxraftstate, std::string nodeInforFileName, short port) : m_skipList(6) {
+void KvServer::ExportLog(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::ExportLogArgs *request,
+                         ::raftKVRpcProctoc::ExportLogReply *response, ::google::protobuf::Closure *done) {
+  KvServer::ExportLog(request, response);
+  done->Run();
+}
+
+void KvServer::CommitCdcCheckpoint(google::protobuf::RpcController *controller,
+                                   const ::raftKVRpcProctoc::CommitCdcCheckpointArgs *request,
+                                   ::raftKVRpcProctoc::CommitCdcCheckpointReply *response,
+                                   ::google::protobuf::Closure *done) {
+  KvServer::CommitCdcCheckpoint(request, response, done);
+}
+
+void KvServer::RegisterSession(google::protobuf::RpcController *controller,
+                               const ::raftKVRpcProctoc::RegisterSessionArgs *request,
+                               ::raftKVRpcProctoc::RegisterSessionReply *response, ::google::protobuf::Closure *done) {
+  KvServer::RegisterSession(request, response, done);
+}
+
+void KvServer::Txn(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::TxnArgs *request,
+                   ::raftKVRpcProctoc::TxnReply *response, ::google::protobuf::Closure *done) {
+  KvServer::Txn(request, response, done);
+}
+
+KvServer::KvServer(int me, int maxraftstate, std::string nodeInforFileName, short port,
+                   const std::string &storageEngine) {
   std::shared_ptr<Persister> persister = std::make_shared<Persister>(me);
+  m_logTail = std::make_unique<LogTail>(persister, &KvStateMachine::DecodeSnapshotKvs);
 
   m_me = me;
+  // 进程启动时间区分同一节点重启前后的合并日志
+  m_coalesceClientId = "@" + std::to_string(me) + "." +
+                       std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                          std::chrono::system_clock::now().time_since_epoch())
+                                          .count());
   m_maxRaftState = maxraftstate;
 
-  applyChan = std::make_shared<LockQueue<ApplyMsg> >();
+  applyChan = std::make_shared<MpscRing<ApplyMsg> >(ApplyQueueCapacity);
+
+  // 存储引擎按构造参数选择，数据、会话表和快照都只经过状态机
+  m_stateMachine = std::make_unique<KvStateMachine>(
+      CreateStorageEngine(storageEngine, me),
+      std::max<size_t>(1, std::min<size_t>(std::thread::hardware_concurrency(), kMaxApplyThreads)), kReadCacheBytes);
 
-  // ==================== 新架构：初始化状态机 ====================
-  // 创建存储引擎（使用SkipList）
-  auto storageEngine = std::make_unique<SkipListStorageEngine>(6);
-  // 创建状态机
-  m_stateMachine = std::make_shared<KvStateMachine>(std::move(storageEngine));
-  
   m_raftNode = std::make_shared<Raft>();
   ////////////////clerk层面 kvserver开启rpc接受功能
   //    同时raft与raft节点之间也要开启rpc功能，因此有两个注册
@@ -441,15 +1106,13 @@ KvServer::KvServer(int me, int maxraftstate, std::string nodeInforFileName, shor
   //////////////////////////////////
 
   // You may need initialization code here.
-  // m_kvDB; //kvdb初始化
-  m_skipList;
-  waitApplyCh;
-  m_lastRequestId;
   m_lastSnapShotRaftLogIndex = 0;  // todo:感覺這個函數沒什麼用，不如直接調用raft節點中的snapshot值？？？
   auto snapshot = persister->ReadSnapshot();
   if (!snapshot.empty()) {
     ReadSnapShotToInstall(snapshot);
   }
+  std::thread(&KvServer::CompletionSweepLoop, this).detach();
+  std::thread(&KvServer::CoalesceLoop, this).detach();
   std::thread t2(&KvServer::ReadRaftApplyCommandLoop, this);  //马上向其他节点宣告自己就是leader
   t2.join();  //由於ReadRaftApplyCommandLoop一直不會結束，达到一直卡在这的目的
 }
@@ -1,6 +1,7 @@
 #include "raft.h"
 #include <boost/archive/text_iarchive.hpp>
 #include <boost/archive/text_oarchive.hpp>
+#include <algorithm>
 #include <memory>
 #include "config.h"
 #include "util.h"
@@ -154,21 +155,24 @@ void Raft::AppendEntries1(const raftRpcProctoc::AppendEntriesArgs* args, raftRpc
 
 void Raft::applierTicker() {
   while (true) {
+    // apply队列有界，只取队列放得下的部分，其余留在raft日志里，不在这里复制出一份无界的积压；
+    // 推送时不持有m_mtx，队列满了阻塞也不会挡住心跳和投票
+    size_t queued = applyChan->Size();
+    size_t room = queued >= applyChan->Capacity() ? 0 : applyChan->Capacity() - queued;
     m_mtx.lock();
     if (m_status == Leader) {
       DPrintf("[Raft::applierTicker() - raft{%d}]  m_lastApplied{%d}   m_commitIndex{%d}", m_me, m_lastApplied,
               m_commitIndex);
     }
-    auto applyMsgs = getApplyLogs();
+    auto applyMsgs = getApplyLogs(room);
     m_mtx.unlock();
     //使用匿名函数是因为传递管道的时候不用拿锁
     // todo:好像必须拿锁，因为不拿锁的话如果调用多次applyLog函数，可能会导致应用的顺序不一样
     if (!applyMsgs.empty()) {
       DPrintf("[func- Raft::applierTicker()-raft{%d}] 向kvserver報告的applyMsgs長度爲：{%d}", m_me, applyMsgs.size());
     }
-    for (auto& message : applyMsgs) {
-      applyChan->Push(message);
-    }
+    // 整批交付，只唤醒一次apply线程
+    applyChan->PushBatch(std::move(applyMsgs));
     // usleep(1000 * ApplyInterval);
     sleepNMilliseconds(ApplyInterval);
   }
@@ -358,12 +362,12 @@ void Raft::electionTimeOutTicker() {
   }
 }
 
-std::vector<ApplyMsg> Raft::getApplyLogs() {
+std::vector<ApplyMsg> Raft::getApplyLogs(size_t max) {
   std::vector<ApplyMsg> applyMsgs;
   myAssert(m_commitIndex <= getLastLogIndex(), format("[func-getApplyLogs-rf{%d}] commitIndex{%d} >getLastLogIndex{%d}",
                                                       m_me, m_commitIndex, getLastLogIndex()));
 
-  while (m_lastApplied < m_commitIndex) {
+  while (m_lastApplied < m_commitIndex && applyMsgs.size() < max) {
     m_lastApplied++;
     myAssert(m_logs[getSlicesIndexFromLogIndex(m_lastApplied)].logindex() == m_lastApplied,
              format("rf.logs[rf.getSlicesIndexFromLogIndex(rf.lastApplied)].LogIndex{%d} != rf.lastApplied{%d} ",
@@ -373,7 +377,7 @@ std::vector<ApplyMsg> Raft::getApplyLogs() {
     applyMsg.SnapshotValid = false;
     applyMsg.Command = m_logs[getSlicesIndexFromLogIndex(m_lastApplied)].command();
     applyMsg.CommandIndex = m_lastApplied;
-    applyMsgs.emplace_back(applyMsg);
+    applyMsgs.emplace_back(std::move(applyMsg));
     //        DPrintf("[	applyLog func-rf{%v}	] apply Log,logIndex:%v  ，logTerm：{%v},command：{%v}\n",
     //        rf.me, rf.lastApplied, rf.logs[rf.getSlicesIndexFromLogIndex(rf.lastApplied)].LogTerm,
     //        rf.logs[rf.getSlicesIndexFromLogIndex(rf.lastApplied)].Command)
@@ -475,7 +479,7 @@ void Raft::InstallSnapshot(const raftRpcProctoc::InstallSnapshotRequest* args,
   m_persister->Save(persistData(), args->data());
 }
 
-void Raft::pushMsgToKvServer(ApplyMsg msg) { applyChan->Push(msg); }
+void Raft::pushMsgToKvServer(ApplyMsg msg) { applyChan->Push(std::move(msg)); }
 
 void Raft::leaderHearBeatTicker() {
   while (true) {
@@ -808,6 +812,7 @@ bool Raft::sendRequestVote(int server, std::shared_ptr<raftRpcProctoc::RequestVo
     }
     //	第一次变成leader，初始化状态和nextIndex、matchIndex
     m_status = Leader;
+    m_bytesSettledIndex = -1;  // 未提交日志的字节数在下一次Start时重新统计
 
     DPrintf("[func-sendRequestVote rf{%d}] elect success  ,current term:{%d} ,lastLogIndex:{%d}\n", m_me, m_currentTerm,
             getLastLogIndex());
@@ -944,7 +949,7 @@ void Raft::RequestVote(google::protobuf::RpcController* controller, const ::raft
   done->Run();
 }
 
-void Raft::Start(Op command, int* newLogIndex, int* newLogTerm, bool* isLeader) {
+bool Raft::Start(Op command, int* newLogIndex, int* newLogTerm, bool* isLeader) {
   std::lock_guard<std::mutex> lg1(m_mtx);
   //    m_mtx.lock();
   //    Defer ec1([this]()->void {
@@ -955,9 +960,27 @@ void Raft::Start(Op command, int* newLogIndex, int* newLogTerm, bool* isLeader)
     *newLogIndex = -1;
     *newLogTerm = -1;
     *isLeader = false;
-    return;
+    return false;
   }
 
+  // 背压：提交跟不上或者apply跟不上时拒绝，调用方稍后重试，而不是让日志和apply积压无限增长
+  settleUncommittedBytes();
+  int lastIndex = getLastLogIndex();
+  if (lastIndex - m_commitIndex >= MaxUncommittedEntries || m_uncommittedBytes >= MaxUncommittedBytes ||
+      m_commitIndex - m_lastApplied >= ApplyQueueCapacity) {
+    DPrintf("[func-Start-rf{%d}]  throttled: lastLogIndex{%d} commitIndex{%d} lastApplied{%d} uncommittedBytes{%lld}",
+            m_me, lastIndex, m_commitIndex, m_lastApplied, m_uncommittedBytes);
+    *newLogIndex = -1;
+    *newLogTerm = m_currentTerm;
+    *isLeader = true;
+    return false;
+  }
+
+  // 时间戳由leader写进日志，各副本按日志里的时间判断TTL过期，结果一致
+  command.TimestampMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                            std::chrono::system_clock::now().time_since_epoch())
+                            .count();
+
   raftRpcProctoc::LogEntry newLogEntry;
   newLogEntry.set_command(command.asString());
   newLogEntry.set_logterm(m_currentTerm);
@@ -970,9 +993,26 @@ void Raft::Start(Op command, int* newLogIndex, int* newLogTerm, bool* isLeader)
   DPrintf("[func-Start-rf{%d}]  lastLogIndex:%d,command:%s\n", m_me, lastLogIndex, &command);
   // rf.timer.Reset(10) //接收到命令后马上给follower发送,改成这样不知为何会出现问题，待修正 todo
   persist();
+  m_uncommittedBytes += newLogEntry.command().size();
   *newLogIndex = newLogEntry.logindex();
   *newLogTerm = newLogEntry.logterm();
   *isLeader = true;
+  return true;
+}
+
+void Raft::settleUncommittedBytes() {
+  // 已经扣减到的位置被快照截断（日志不在了），或者提交进度没有跟上记账的位置，就整体重新统计
+  if (m_bytesSettledIndex < m_lastSnapshotIncludeIndex || m_bytesSettledIndex > m_commitIndex) {
+    m_uncommittedBytes = 0;
+    for (int index = std::max(m_commitIndex, m_lastSnapshotIncludeIndex) + 1; index <= getLastLogIndex(); ++index) {
+      m_uncommittedBytes += m_logs[getSlicesIndexFromLogIndex(index)].command().size();
+    }
+    m_bytesSettledIndex = m_commitIndex;
+    return;
+  }
+  for (; m_bytesSettledIndex < m_commitIndex; ++m_bytesSettledIndex) {
+    m_uncommittedBytes -= m_logs[getSlicesIndexFromLogIndex(m_bytesSettledIndex + 1)].command().size();
+  }
 }
 
 // Make
@@ -986,7 +1026,7 @@ void Raft::Start(Op command, int* newLogIndex, int* newLogTerm, bool* isLeader)
 // Make() must return quickly, so it should start goroutines
 // for any long-running work.
 void Raft::init(std::vector<std::shared_ptr<RaftRpcUtil>> peers, int me, std::shared_ptr<Persister> persister,
-                std::shared_ptr<LockQueue<ApplyMsg>> applyCh) {
+                std::shared_ptr<MpscRing<ApplyMsg>> applyCh) {
   m_peers = peers;
   m_persister = persister;
   m_me = me;
@@ -1084,6 +1124,26 @@ void Raft::readPersist(std::string data) {
   }
 }
 
+void Raft::DecodePersistedLog(const std::string& data, int* lastSnapshotIncludeIndex,
+                              std::vector<raftRpcProctoc::LogEntry>* logs) {
+  *lastSnapshotIncludeIndex = 0;
+  logs->clear();
+  if (data.empty()) {
+    return;
+  }
+  std::stringstream iss(data);
+  boost::archive::text_iarchive ia(iss);
+  BoostPersistRaftNode boostPersistRaftNode;
+  ia >> boostPersistRaftNode;
+
+  *lastSnapshotIncludeIndex = boostPersistRaftNode.m_lastSnapshotIncludeIndex;
+  logs->reserve(boostPersistRaftNode.m_logs.size());
+  for (auto& item : boostPersistRaftNode.m_logs) {
+    logs->emplace_back();
+    logs->back().ParseFromString(item);
+  }
+}
+
 void Raft::Snapshot(int index, std::string snapshot) {
   std::lock_guard<std::mutex> lg(m_mtx);
 
@@ -1112,7 +1172,7 @@ void Raft::Snapshot(int index, std::string snapshot) {
   m_lastApplied = std::max(m_lastApplied, index);
 
   // rf.lastApplied = index //lastApplied 和 commit应不应该改变呢？？？ 为什么  不应该改变吧
-  m_persister->Save(persistData(), snapshot);
+  m_persister->Save(persistData(), std::move(snapshot));
 
   DPrintf("[SnapShot]Server %d snapshot snapshot index {%d}, term {%d}, loglen {%d}", m_me, index,
           m_lastSnapshotIncludeTerm, m_logs.size());
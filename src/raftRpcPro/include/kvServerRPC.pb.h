@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3012000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3012004 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,14 +23,13 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/service.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
@@ -44,46 +43,267 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_kvServerRPC_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[4]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_kvServerRPC_2eproto;
 namespace raftKVRpcProctoc {
+class BatchWriteArgs;
+struct BatchWriteArgsDefaultTypeInternal;
+extern BatchWriteArgsDefaultTypeInternal _BatchWriteArgs_default_instance_;
+class BatchWriteReply;
+struct BatchWriteReplyDefaultTypeInternal;
+extern BatchWriteReplyDefaultTypeInternal _BatchWriteReply_default_instance_;
+class CancelWatchArgs;
+struct CancelWatchArgsDefaultTypeInternal;
+extern CancelWatchArgsDefaultTypeInternal _CancelWatchArgs_default_instance_;
+class CancelWatchReply;
+struct CancelWatchReplyDefaultTypeInternal;
+extern CancelWatchReplyDefaultTypeInternal _CancelWatchReply_default_instance_;
+class CdcEntry;
+struct CdcEntryDefaultTypeInternal;
+extern CdcEntryDefaultTypeInternal _CdcEntry_default_instance_;
+class CommitCdcCheckpointArgs;
+struct CommitCdcCheckpointArgsDefaultTypeInternal;
+extern CommitCdcCheckpointArgsDefaultTypeInternal _CommitCdcCheckpointArgs_default_instance_;
+class CommitCdcCheckpointReply;
+struct CommitCdcCheckpointReplyDefaultTypeInternal;
+extern CommitCdcCheckpointReplyDefaultTypeInternal _CommitCdcCheckpointReply_default_instance_;
+class DeleteArgs;
+struct DeleteArgsDefaultTypeInternal;
+extern DeleteArgsDefaultTypeInternal _DeleteArgs_default_instance_;
+class DeleteRangeArgs;
+struct DeleteRangeArgsDefaultTypeInternal;
+extern DeleteRangeArgsDefaultTypeInternal _DeleteRangeArgs_default_instance_;
+class DeleteReply;
+struct DeleteReplyDefaultTypeInternal;
+extern DeleteReplyDefaultTypeInternal _DeleteReply_default_instance_;
+class ExportLogArgs;
+struct ExportLogArgsDefaultTypeInternal;
+extern ExportLogArgsDefaultTypeInternal _ExportLogArgs_default_instance_;
+class ExportLogReply;
+struct ExportLogReplyDefaultTypeInternal;
+extern ExportLogReplyDefaultTypeInternal _ExportLogReply_default_instance_;
 class GetArgs;
-class GetArgsDefaultTypeInternal;
+struct GetArgsDefaultTypeInternal;
 extern GetArgsDefaultTypeInternal _GetArgs_default_instance_;
 class GetReply;
-class GetReplyDefaultTypeInternal;
+struct GetReplyDefaultTypeInternal;
 extern GetReplyDefaultTypeInternal _GetReply_default_instance_;
+class GetResult;
+struct GetResultDefaultTypeInternal;
+extern GetResultDefaultTypeInternal _GetResult_default_instance_;
+class KeyValue;
+struct KeyValueDefaultTypeInternal;
+extern KeyValueDefaultTypeInternal _KeyValue_default_instance_;
+class MultiGetArgs;
+struct MultiGetArgsDefaultTypeInternal;
+extern MultiGetArgsDefaultTypeInternal _MultiGetArgs_default_instance_;
+class MultiGetReply;
+struct MultiGetReplyDefaultTypeInternal;
+extern MultiGetReplyDefaultTypeInternal _MultiGetReply_default_instance_;
+class PrefixScanArgs;
+struct PrefixScanArgsDefaultTypeInternal;
+extern PrefixScanArgsDefaultTypeInternal _PrefixScanArgs_default_instance_;
 class PutAppendArgs;
-class PutAppendArgsDefaultTypeInternal;
+struct PutAppendArgsDefaultTypeInternal;
 extern PutAppendArgsDefaultTypeInternal _PutAppendArgs_default_instance_;
 class PutAppendReply;
-class PutAppendReplyDefaultTypeInternal;
+struct PutAppendReplyDefaultTypeInternal;
 extern PutAppendReplyDefaultTypeInternal _PutAppendReply_default_instance_;
+class RegisterSessionArgs;
+struct RegisterSessionArgsDefaultTypeInternal;
+extern RegisterSessionArgsDefaultTypeInternal _RegisterSessionArgs_default_instance_;
+class RegisterSessionReply;
+struct RegisterSessionReplyDefaultTypeInternal;
+extern RegisterSessionReplyDefaultTypeInternal _RegisterSessionReply_default_instance_;
+class ScanArgs;
+struct ScanArgsDefaultTypeInternal;
+extern ScanArgsDefaultTypeInternal _ScanArgs_default_instance_;
+class ScanReply;
+struct ScanReplyDefaultTypeInternal;
+extern ScanReplyDefaultTypeInternal _ScanReply_default_instance_;
+class TxnArgs;
+struct TxnArgsDefaultTypeInternal;
+extern TxnArgsDefaultTypeInternal _TxnArgs_default_instance_;
+class TxnCompare;
+struct TxnCompareDefaultTypeInternal;
+extern TxnCompareDefaultTypeInternal _TxnCompare_default_instance_;
+class TxnOp;
+struct TxnOpDefaultTypeInternal;
+extern TxnOpDefaultTypeInternal _TxnOp_default_instance_;
+class TxnOpResult;
+struct TxnOpResultDefaultTypeInternal;
+extern TxnOpResultDefaultTypeInternal _TxnOpResult_default_instance_;
+class TxnReply;
+struct TxnReplyDefaultTypeInternal;
+extern TxnReplyDefaultTypeInternal _TxnReply_default_instance_;
+class WatchArgs;
+struct WatchArgsDefaultTypeInternal;
+extern WatchArgsDefaultTypeInternal _WatchArgs_default_instance_;
+class WatchEvent;
+struct WatchEventDefaultTypeInternal;
+extern WatchEventDefaultTypeInternal _WatchEvent_default_instance_;
+class WatchReply;
+struct WatchReplyDefaultTypeInternal;
+extern WatchReplyDefaultTypeInternal _WatchReply_default_instance_;
+class WriteOp;
+struct WriteOpDefaultTypeInternal;
+extern WriteOpDefaultTypeInternal _WriteOp_default_instance_;
 }  // namespace raftKVRpcProctoc
 PROTOBUF_NAMESPACE_OPEN
+template<> ::raftKVRpcProctoc::BatchWriteArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::BatchWriteArgs>(Arena*);
+template<> ::raftKVRpcProctoc::BatchWriteReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::BatchWriteReply>(Arena*);
+template<> ::raftKVRpcProctoc::CancelWatchArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::CancelWatchArgs>(Arena*);
+template<> ::raftKVRpcProctoc::CancelWatchReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::CancelWatchReply>(Arena*);
+template<> ::raftKVRpcProctoc::CdcEntry* Arena::CreateMaybeMessage<::raftKVRpcProctoc::CdcEntry>(Arena*);
+template<> ::raftKVRpcProctoc::CommitCdcCheckpointArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::CommitCdcCheckpointArgs>(Arena*);
+template<> ::raftKVRpcProctoc::CommitCdcCheckpointReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::CommitCdcCheckpointReply>(Arena*);
+template<> ::raftKVRpcProctoc::DeleteArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::DeleteArgs>(Arena*);
+template<> ::raftKVRpcProctoc::DeleteRangeArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::DeleteRangeArgs>(Arena*);
+template<> ::raftKVRpcProctoc::DeleteReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::DeleteReply>(Arena*);
+template<> ::raftKVRpcProctoc::ExportLogArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::ExportLogArgs>(Arena*);
+template<> ::raftKVRpcProctoc::ExportLogReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::ExportLogReply>(Arena*);
 template<> ::raftKVRpcProctoc::GetArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::GetArgs>(Arena*);
 template<> ::raftKVRpcProctoc::GetReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::GetReply>(Arena*);
+template<> ::raftKVRpcProctoc::GetResult* Arena::CreateMaybeMessage<::raftKVRpcProctoc::GetResult>(Arena*);
+template<> ::raftKVRpcProctoc::KeyValue* Arena::CreateMaybeMessage<::raftKVRpcProctoc::KeyValue>(Arena*);
+template<> ::raftKVRpcProctoc::MultiGetArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::MultiGetArgs>(Arena*);
+template<> ::raftKVRpcProctoc::MultiGetReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::MultiGetReply>(Arena*);
+template<> ::raftKVRpcProctoc::PrefixScanArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::PrefixScanArgs>(Arena*);
 template<> ::raftKVRpcProctoc::PutAppendArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::PutAppendArgs>(Arena*);
 template<> ::raftKVRpcProctoc::PutAppendReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::PutAppendReply>(Arena*);
+template<> ::raftKVRpcProctoc::RegisterSessionArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::RegisterSessionArgs>(Arena*);
+template<> ::raftKVRpcProctoc::RegisterSessionReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::RegisterSessionReply>(Arena*);
+template<> ::raftKVRpcProctoc::ScanArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::ScanArgs>(Arena*);
+template<> ::raftKVRpcProctoc::ScanReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::ScanReply>(Arena*);
+template<> ::raftKVRpcProctoc::TxnArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::TxnArgs>(Arena*);
+template<> ::raftKVRpcProctoc::TxnCompare* Arena::CreateMaybeMessage<::raftKVRpcProctoc::TxnCompare>(Arena*);
+template<> ::raftKVRpcProctoc::TxnOp* Arena::CreateMaybeMessage<::raftKVRpcProctoc::TxnOp>(Arena*);
+template<> ::raftKVRpcProctoc::TxnOpResult* Arena::CreateMaybeMessage<::raftKVRpcProctoc::TxnOpResult>(Arena*);
+template<> ::raftKVRpcProctoc::TxnReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::TxnReply>(Arena*);
+template<> ::raftKVRpcProctoc::WatchArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::WatchArgs>(Arena*);
+template<> ::raftKVRpcProctoc::WatchEvent* Arena::CreateMaybeMessage<::raftKVRpcProctoc::WatchEvent>(Arena*);
+template<> ::raftKVRpcProctoc::WatchReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::WatchReply>(Arena*);
+template<> ::raftKVRpcProctoc::WriteOp* Arena::CreateMaybeMessage<::raftKVRpcProctoc::WriteOp>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace raftKVRpcProctoc {
 
+enum TxnCompare_Target : int {
+  TxnCompare_Target_VALUE = 0,
+  TxnCompare_Target_EXISTS = 1,
+  TxnCompare_Target_VERSION = 2,
+  TxnCompare_Target_TxnCompare_Target_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  TxnCompare_Target_TxnCompare_Target_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool TxnCompare_Target_IsValid(int value);
+constexpr TxnCompare_Target TxnCompare_Target_Target_MIN = TxnCompare_Target_VALUE;
+constexpr TxnCompare_Target TxnCompare_Target_Target_MAX = TxnCompare_Target_VERSION;
+constexpr int TxnCompare_Target_Target_ARRAYSIZE = TxnCompare_Target_Target_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TxnCompare_Target_descriptor();
+template<typename T>
+inline const std::string& TxnCompare_Target_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, TxnCompare_Target>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function TxnCompare_Target_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    TxnCompare_Target_descriptor(), enum_t_value);
+}
+inline bool TxnCompare_Target_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, TxnCompare_Target* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<TxnCompare_Target>(
+    TxnCompare_Target_descriptor(), name, value);
+}
+enum TxnCompare_Result : int {
+  TxnCompare_Result_EQUAL = 0,
+  TxnCompare_Result_NOT_EQUAL = 1,
+  TxnCompare_Result_GREATER = 2,
+  TxnCompare_Result_LESS = 3,
+  TxnCompare_Result_TxnCompare_Result_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  TxnCompare_Result_TxnCompare_Result_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool TxnCompare_Result_IsValid(int value);
+constexpr TxnCompare_Result TxnCompare_Result_Result_MIN = TxnCompare_Result_EQUAL;
+constexpr TxnCompare_Result TxnCompare_Result_Result_MAX = TxnCompare_Result_LESS;
+constexpr int TxnCompare_Result_Result_ARRAYSIZE = TxnCompare_Result_Result_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TxnCompare_Result_descriptor();
+template<typename T>
+inline const std::string& TxnCompare_Result_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, TxnCompare_Result>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function TxnCompare_Result_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    TxnCompare_Result_descriptor(), enum_t_value);
+}
+inline bool TxnCompare_Result_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, TxnCompare_Result* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<TxnCompare_Result>(
+    TxnCompare_Result_descriptor(), name, value);
+}
+enum TxnOp_OpType : int {
+  TxnOp_OpType_GET = 0,
+  TxnOp_OpType_PUT = 1,
+  TxnOp_OpType_APPEND = 2,
+  TxnOp_OpType_DELETE = 3,
+  TxnOp_OpType_INCREMENT = 4,
+  TxnOp_OpType_APPEND_IF_ABSENT = 5,
+  TxnOp_OpType_TxnOp_OpType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  TxnOp_OpType_TxnOp_OpType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool TxnOp_OpType_IsValid(int value);
+constexpr TxnOp_OpType TxnOp_OpType_OpType_MIN = TxnOp_OpType_GET;
+constexpr TxnOp_OpType TxnOp_OpType_OpType_MAX = TxnOp_OpType_APPEND_IF_ABSENT;
+constexpr int TxnOp_OpType_OpType_ARRAYSIZE = TxnOp_OpType_OpType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TxnOp_OpType_descriptor();
+template<typename T>
+inline const std::string& TxnOp_OpType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, TxnOp_OpType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function TxnOp_OpType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    TxnOp_OpType_descriptor(), enum_t_value);
+}
+inline bool TxnOp_OpType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, TxnOp_OpType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<TxnOp_OpType>(
+    TxnOp_OpType_descriptor(), name, value);
+}
+enum WatchEvent_EventType : int {
+  WatchEvent_EventType_PUT = 0,
+  WatchEvent_EventType_APPEND = 1,
+  WatchEvent_EventType_DELETE = 2,
+  WatchEvent_EventType_WatchEvent_EventType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  WatchEvent_EventType_WatchEvent_EventType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool WatchEvent_EventType_IsValid(int value);
+constexpr WatchEvent_EventType WatchEvent_EventType_EventType_MIN = WatchEvent_EventType_PUT;
+constexpr WatchEvent_EventType WatchEvent_EventType_EventType_MAX = WatchEvent_EventType_DELETE;
+constexpr int WatchEvent_EventType_EventType_ARRAYSIZE = WatchEvent_EventType_EventType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* WatchEvent_EventType_descriptor();
+template<typename T>
+inline const std::string& WatchEvent_EventType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, WatchEvent_EventType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function WatchEvent_EventType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    WatchEvent_EventType_descriptor(), enum_t_value);
+}
+inline bool WatchEvent_EventType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, WatchEvent_EventType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<WatchEvent_EventType>(
+    WatchEvent_EventType_descriptor(), name, value);
+}
 // ===================================================================
 
-class GetArgs PROTOBUF_FINAL :
+class GetArgs final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.GetArgs) */ {
  public:
-  inline GetArgs() : GetArgs(nullptr) {};
-  virtual ~GetArgs();
+  inline GetArgs() : GetArgs(nullptr) {}
+  ~GetArgs() override;
+  explicit PROTOBUF_CONSTEXPR GetArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GetArgs(const GetArgs& from);
   GetArgs(GetArgs&& from) noexcept
@@ -96,8 +316,13 @@ class GetArgs PROTOBUF_FINAL :
     return *this;
   }
   inline GetArgs& operator=(GetArgs&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -108,14 +333,14 @@ class GetArgs PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetArgs& default_instance() {
+    return *internal_default_instance();
   }
-  static const GetArgs& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GetArgs* internal_default_instance() {
     return reinterpret_cast<const GetArgs*>(
                &_GetArgs_default_instance_);
@@ -128,7 +353,12 @@ class GetArgs PROTOBUF_FINAL :
   }
   inline void Swap(GetArgs* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -136,56 +366,53 @@ class GetArgs PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(GetArgs* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GetArgs* New() const final {
-    return CreateMaybeMessage<GetArgs>(nullptr);
-  }
-
-  GetArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GetArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GetArgs>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GetArgs& from);
-  void MergeFrom(const GetArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetArgs& from) {
+    GetArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GetArgs* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftKVRpcProctoc.GetArgs";
   }
   protected:
-  explicit GetArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit GetArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_kvServerRPC_2eproto);
-    return ::descriptor_table_kvServerRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -199,60 +426,38 @@ class GetArgs PROTOBUF_FINAL :
   // bytes Key = 1;
   void clear_key();
   const std::string& key() const;
-  void set_key(const std::string& value);
-  void set_key(std::string&& value);
-  void set_key(const char* value);
-  void set_key(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
   std::string* mutable_key();
-  std::string* release_key();
+  PROTOBUF_NODISCARD std::string* release_key();
   void set_allocated_key(std::string* key);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_key();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_key(
-      std::string* key);
   private:
   const std::string& _internal_key() const;
-  void _internal_set_key(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
   std::string* _internal_mutable_key();
   public:
 
   // bytes ClientId = 2;
   void clear_clientid();
   const std::string& clientid() const;
-  void set_clientid(const std::string& value);
-  void set_clientid(std::string&& value);
-  void set_clientid(const char* value);
-  void set_clientid(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_clientid(ArgT0&& arg0, ArgT... args);
   std::string* mutable_clientid();
-  std::string* release_clientid();
+  PROTOBUF_NODISCARD std::string* release_clientid();
   void set_allocated_clientid(std::string* clientid);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_clientid();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_clientid(
-      std::string* clientid);
   private:
   const std::string& _internal_clientid() const;
-  void _internal_set_clientid(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_clientid(const std::string& value);
   std::string* _internal_mutable_clientid();
   public:
 
   // int32 RequestId = 3;
   void clear_requestid();
-  ::PROTOBUF_NAMESPACE_ID::int32 requestid() const;
-  void set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t requestid() const;
+  void set_requestid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_requestid() const;
-  void _internal_set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_requestid() const;
+  void _internal_set_requestid(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.GetArgs)
@@ -262,19 +467,23 @@ class GetArgs PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clientid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 requestid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clientid_;
+    int32_t requestid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kvServerRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GetReply PROTOBUF_FINAL :
+class GetReply final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.GetReply) */ {
  public:
-  inline GetReply() : GetReply(nullptr) {};
-  virtual ~GetReply();
+  inline GetReply() : GetReply(nullptr) {}
+  ~GetReply() override;
+  explicit PROTOBUF_CONSTEXPR GetReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GetReply(const GetReply& from);
   GetReply(GetReply&& from) noexcept
@@ -287,8 +496,13 @@ class GetReply PROTOBUF_FINAL :
     return *this;
   }
   inline GetReply& operator=(GetReply&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -299,14 +513,14 @@ class GetReply PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetReply& default_instance() {
+    return *internal_default_instance();
   }
-  static const GetReply& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GetReply* internal_default_instance() {
     return reinterpret_cast<const GetReply*>(
                &_GetReply_default_instance_);
@@ -319,7 +533,12 @@ class GetReply PROTOBUF_FINAL :
   }
   inline void Swap(GetReply* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -327,56 +546,53 @@ class GetReply PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(GetReply* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GetReply* New() const final {
-    return CreateMaybeMessage<GetReply>(nullptr);
-  }
-
-  GetReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GetReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GetReply>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GetReply& from);
-  void MergeFrom(const GetReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetReply& from) {
+    GetReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GetReply* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftKVRpcProctoc.GetReply";
   }
   protected:
-  explicit GetReply(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit GetReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_kvServerRPC_2eproto);
-    return ::descriptor_table_kvServerRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -385,57 +601,45 @@ class GetReply PROTOBUF_FINAL :
   enum : int {
     kErrFieldNumber = 1,
     kValueFieldNumber = 2,
+    kRetryAfterMsFieldNumber = 3,
   };
   // bytes Err = 1;
   void clear_err();
   const std::string& err() const;
-  void set_err(const std::string& value);
-  void set_err(std::string&& value);
-  void set_err(const char* value);
-  void set_err(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
   std::string* mutable_err();
-  std::string* release_err();
+  PROTOBUF_NODISCARD std::string* release_err();
   void set_allocated_err(std::string* err);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_err();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_err(
-      std::string* err);
   private:
   const std::string& _internal_err() const;
-  void _internal_set_err(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
   std::string* _internal_mutable_err();
   public:
 
   // bytes Value = 2;
   void clear_value();
   const std::string& value() const;
-  void set_value(const std::string& value);
-  void set_value(std::string&& value);
-  void set_value(const char* value);
-  void set_value(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
   std::string* mutable_value();
-  std::string* release_value();
+  PROTOBUF_NODISCARD std::string* release_value();
   void set_allocated_value(std::string* value);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_value();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_value(
-      std::string* value);
   private:
   const std::string& _internal_value() const;
-  void _internal_set_value(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
   std::string* _internal_mutable_value();
   public:
 
+  // int64 RetryAfterMs = 3;
+  void clear_retryafterms();
+  int64_t retryafterms() const;
+  void set_retryafterms(int64_t value);
+  private:
+  int64_t _internal_retryafterms() const;
+  void _internal_set_retryafterms(int64_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.GetReply)
  private:
   class _Internal;
@@ -443,18 +647,23 @@ class GetReply PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    int64_t retryafterms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kvServerRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PutAppendArgs PROTOBUF_FINAL :
+class PutAppendArgs final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.PutAppendArgs) */ {
  public:
-  inline PutAppendArgs() : PutAppendArgs(nullptr) {};
-  virtual ~PutAppendArgs();
+  inline PutAppendArgs() : PutAppendArgs(nullptr) {}
+  ~PutAppendArgs() override;
+  explicit PROTOBUF_CONSTEXPR PutAppendArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PutAppendArgs(const PutAppendArgs& from);
   PutAppendArgs(PutAppendArgs&& from) noexcept
@@ -467,8 +676,13 @@ class PutAppendArgs PROTOBUF_FINAL :
     return *this;
   }
   inline PutAppendArgs& operator=(PutAppendArgs&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -479,14 +693,14 @@ class PutAppendArgs PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PutAppendArgs& default_instance() {
+    return *internal_default_instance();
   }
-  static const PutAppendArgs& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const PutAppendArgs* internal_default_instance() {
     return reinterpret_cast<const PutAppendArgs*>(
                &_PutAppendArgs_default_instance_);
@@ -499,7 +713,12 @@ class PutAppendArgs PROTOBUF_FINAL :
   }
   inline void Swap(PutAppendArgs* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -507,56 +726,53 @@ class PutAppendArgs PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(PutAppendArgs* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline PutAppendArgs* New() const final {
-    return CreateMaybeMessage<PutAppendArgs>(nullptr);
-  }
-
-  PutAppendArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  PutAppendArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PutAppendArgs>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PutAppendArgs& from);
-  void MergeFrom(const PutAppendArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PutAppendArgs& from) {
+    PutAppendArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(PutAppendArgs* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftKVRpcProctoc.PutAppendArgs";
   }
   protected:
-  explicit PutAppendArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit PutAppendArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_kvServerRPC_2eproto);
-    return ::descriptor_table_kvServerRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -567,115 +783,81 @@ class PutAppendArgs PROTOBUF_FINAL :
     kValueFieldNumber = 2,
     kOpFieldNumber = 3,
     kClientIdFieldNumber = 4,
+    kTtlMsFieldNumber = 6,
     kRequestIdFieldNumber = 5,
   };
   // bytes Key = 1;
   void clear_key();
   const std::string& key() const;
-  void set_key(const std::string& value);
-  void set_key(std::string&& value);
-  void set_key(const char* value);
-  void set_key(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
   std::string* mutable_key();
-  std::string* release_key();
+  PROTOBUF_NODISCARD std::string* release_key();
   void set_allocated_key(std::string* key);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_key();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_key(
-      std::string* key);
   private:
   const std::string& _internal_key() const;
-  void _internal_set_key(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
   std::string* _internal_mutable_key();
   public:
 
   // bytes Value = 2;
   void clear_value();
   const std::string& value() const;
-  void set_value(const std::string& value);
-  void set_value(std::string&& value);
-  void set_value(const char* value);
-  void set_value(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
   std::string* mutable_value();
-  std::string* release_value();
+  PROTOBUF_NODISCARD std::string* release_value();
   void set_allocated_value(std::string* value);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_value();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_value(
-      std::string* value);
   private:
   const std::string& _internal_value() const;
-  void _internal_set_value(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
   std::string* _internal_mutable_value();
   public:
 
   // bytes Op = 3;
   void clear_op();
   const std::string& op() const;
-  void set_op(const std::string& value);
-  void set_op(std::string&& value);
-  void set_op(const char* value);
-  void set_op(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_op(ArgT0&& arg0, ArgT... args);
   std::string* mutable_op();
-  std::string* release_op();
+  PROTOBUF_NODISCARD std::string* release_op();
   void set_allocated_op(std::string* op);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_op();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_op(
-      std::string* op);
   private:
   const std::string& _internal_op() const;
-  void _internal_set_op(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_op(const std::string& value);
   std::string* _internal_mutable_op();
   public:
 
   // bytes ClientId = 4;
   void clear_clientid();
   const std::string& clientid() const;
-  void set_clientid(const std::string& value);
-  void set_clientid(std::string&& value);
-  void set_clientid(const char* value);
-  void set_clientid(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_clientid(ArgT0&& arg0, ArgT... args);
   std::string* mutable_clientid();
-  std::string* release_clientid();
+  PROTOBUF_NODISCARD std::string* release_clientid();
   void set_allocated_clientid(std::string* clientid);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_clientid();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_clientid(
-      std::string* clientid);
   private:
   const std::string& _internal_clientid() const;
-  void _internal_set_clientid(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_clientid(const std::string& value);
   std::string* _internal_mutable_clientid();
   public:
 
+  // int64 TtlMs = 6;
+  void clear_ttlms();
+  int64_t ttlms() const;
+  void set_ttlms(int64_t value);
+  private:
+  int64_t _internal_ttlms() const;
+  void _internal_set_ttlms(int64_t value);
+  public:
+
   // int32 RequestId = 5;
   void clear_requestid();
-  ::PROTOBUF_NAMESPACE_ID::int32 requestid() const;
-  void set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t requestid() const;
+  void set_requestid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_requestid() const;
-  void _internal_set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_requestid() const;
+  void _internal_set_requestid(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.PutAppendArgs)
@@ -685,21 +867,26 @@ class PutAppendArgs PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr op_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clientid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 requestid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr op_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clientid_;
+    int64_t ttlms_;
+    int32_t requestid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kvServerRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PutAppendReply PROTOBUF_FINAL :
+class PutAppendReply final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.PutAppendReply) */ {
  public:
-  inline PutAppendReply() : PutAppendReply(nullptr) {};
-  virtual ~PutAppendReply();
+  inline PutAppendReply() : PutAppendReply(nullptr) {}
+  ~PutAppendReply() override;
+  explicit PROTOBUF_CONSTEXPR PutAppendReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PutAppendReply(const PutAppendReply& from);
   PutAppendReply(PutAppendReply&& from) noexcept
@@ -712,8 +899,13 @@ class PutAppendReply PROTOBUF_FINAL :
     return *this;
   }
   inline PutAppendReply& operator=(PutAppendReply&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -724,14 +916,14 @@ class PutAppendReply PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PutAppendReply& default_instance() {
+    return *internal_default_instance();
   }
-  static const PutAppendReply& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const PutAppendReply* internal_default_instance() {
     return reinterpret_cast<const PutAppendReply*>(
                &_PutAppendReply_default_instance_);
@@ -744,7 +936,12 @@ class PutAppendReply PROTOBUF_FINAL :
   }
   inline void Swap(PutAppendReply* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -752,56 +949,53 @@ class PutAppendReply PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(PutAppendReply* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline PutAppendReply* New() const final {
-    return CreateMaybeMessage<PutAppendReply>(nullptr);
-  }
-
-  PutAppendReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  PutAppendReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PutAppendReply>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PutAppendReply& from);
-  void MergeFrom(const PutAppendReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PutAppendReply& from) {
+    PutAppendReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(PutAppendReply* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftKVRpcProctoc.PutAppendReply";
   }
   protected:
-  explicit PutAppendReply(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit PutAppendReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_kvServerRPC_2eproto);
-    return ::descriptor_table_kvServerRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -809,32 +1003,31 @@ class PutAppendReply PROTOBUF_FINAL :
 
   enum : int {
     kErrFieldNumber = 1,
+    kRetryAfterMsFieldNumber = 2,
   };
   // bytes Err = 1;
   void clear_err();
   const std::string& err() const;
-  void set_err(const std::string& value);
-  void set_err(std::string&& value);
-  void set_err(const char* value);
-  void set_err(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
   std::string* mutable_err();
-  std::string* release_err();
+  PROTOBUF_NODISCARD std::string* release_err();
   void set_allocated_err(std::string* err);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_err();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_err(
-      std::string* err);
   private:
   const std::string& _internal_err() const;
-  void _internal_set_err(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
   std::string* _internal_mutable_err();
   public:
 
+  // int64 RetryAfterMs = 2;
+  void clear_retryafterms();
+  int64_t retryafterms() const;
+  void set_retryafterms(int64_t value);
+  private:
+  int64_t _internal_retryafterms() const;
+  void _internal_set_retryafterms(int64_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.PutAppendReply)
  private:
   class _Internal;
@@ -842,867 +1035,11012 @@ class PutAppendReply PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    int64_t retryafterms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kvServerRPC_2eproto;
 };
-// ===================================================================
-
-class kvServerRpc_Stub;
+// -------------------------------------------------------------------
 
-class kvServerRpc : public ::PROTOBUF_NAMESPACE_ID::Service {
- protected:
-  // This class should be treated as an abstract interface.
-  inline kvServerRpc() {};
+class ScanArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.ScanArgs) */ {
  public:
-  virtual ~kvServerRpc();
+  inline ScanArgs() : ScanArgs(nullptr) {}
+  ~ScanArgs() override;
+  explicit PROTOBUF_CONSTEXPR ScanArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  typedef kvServerRpc_Stub Stub;
+  ScanArgs(const ScanArgs& from);
+  ScanArgs(ScanArgs&& from) noexcept
+    : ScanArgs() {
+    *this = ::std::move(from);
+  }
 
-  static const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* descriptor();
+  inline ScanArgs& operator=(const ScanArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ScanArgs& operator=(ScanArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  virtual void PutAppend(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::raftKVRpcProctoc::PutAppendArgs* request,
-                       ::raftKVRpcProctoc::PutAppendReply* response,
-                       ::google::protobuf::Closure* done);
-  virtual void Get(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::raftKVRpcProctoc::GetArgs* request,
-                       ::raftKVRpcProctoc::GetReply* response,
-                       ::google::protobuf::Closure* done);
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ScanArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ScanArgs* internal_default_instance() {
+    return reinterpret_cast<const ScanArgs*>(
+               &_ScanArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
 
-  // implements Service ----------------------------------------------
+  friend void swap(ScanArgs& a, ScanArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ScanArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ScanArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
-  const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* GetDescriptor();
-  void CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
-                  ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                  const ::PROTOBUF_NAMESPACE_ID::Message* request,
-                  ::PROTOBUF_NAMESPACE_ID::Message* response,
-                  ::google::protobuf::Closure* done);
-  const ::PROTOBUF_NAMESPACE_ID::Message& GetRequestPrototype(
-    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
-  const ::PROTOBUF_NAMESPACE_ID::Message& GetResponsePrototype(
-    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+  // implements Message ----------------------------------------------
 
- private:
-  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(kvServerRpc);
-};
+  ScanArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ScanArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ScanArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ScanArgs& from) {
+    ScanArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-class kvServerRpc_Stub : public kvServerRpc {
- public:
-  kvServerRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel);
-  kvServerRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel,
-                   ::PROTOBUF_NAMESPACE_ID::Service::ChannelOwnership ownership);
-  ~kvServerRpc_Stub();
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  inline ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel() { return channel_; }
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ScanArgs* other);
 
-  // implements kvServerRpc ------------------------------------------
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.ScanArgs";
+  }
+  protected:
+  explicit ScanArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-  void PutAppend(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::raftKVRpcProctoc::PutAppendArgs* request,
-                       ::raftKVRpcProctoc::PutAppendReply* response,
-                       ::google::protobuf::Closure* done);
-  void Get(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::raftKVRpcProctoc::GetArgs* request,
-                       ::raftKVRpcProctoc::GetReply* response,
-                       ::google::protobuf::Closure* done);
- private:
-  ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel_;
-  bool owns_channel_;
-  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(kvServerRpc_Stub);
-};
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-// ===================================================================
+  // nested types ----------------------------------------------------
 
+  // accessors -------------------------------------------------------
 
-// ===================================================================
+  enum : int {
+    kStartKeyFieldNumber = 1,
+    kEndKeyFieldNumber = 2,
+    kPageTokenFieldNumber = 4,
+    kClientIdFieldNumber = 5,
+    kLimitFieldNumber = 3,
+    kRequestIdFieldNumber = 6,
+  };
+  // bytes StartKey = 1;
+  void clear_startkey();
+  const std::string& startkey() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_startkey(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_startkey();
+  PROTOBUF_NODISCARD std::string* release_startkey();
+  void set_allocated_startkey(std::string* startkey);
+  private:
+  const std::string& _internal_startkey() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_startkey(const std::string& value);
+  std::string* _internal_mutable_startkey();
+  public:
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// GetArgs
+  // bytes EndKey = 2;
+  void clear_endkey();
+  const std::string& endkey() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_endkey(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_endkey();
+  PROTOBUF_NODISCARD std::string* release_endkey();
+  void set_allocated_endkey(std::string* endkey);
+  private:
+  const std::string& _internal_endkey() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_endkey(const std::string& value);
+  std::string* _internal_mutable_endkey();
+  public:
 
-// bytes Key = 1;
-inline void GetArgs::clear_key() {
-  key_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& GetArgs::key() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetArgs.Key)
-  return _internal_key();
-}
-inline void GetArgs::set_key(const std::string& value) {
-  _internal_set_key(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetArgs.Key)
-}
-inline std::string* GetArgs::mutable_key() {
-  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.GetArgs.Key)
-  return _internal_mutable_key();
-}
-inline const std::string& GetArgs::_internal_key() const {
-  return key_.Get();
-}
-inline void GetArgs::_internal_set_key(const std::string& value) {
+  // bytes PageToken = 4;
+  void clear_pagetoken();
+  const std::string& pagetoken() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_pagetoken(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_pagetoken();
+  PROTOBUF_NODISCARD std::string* release_pagetoken();
+  void set_allocated_pagetoken(std::string* pagetoken);
+  private:
+  const std::string& _internal_pagetoken() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_pagetoken(const std::string& value);
+  std::string* _internal_mutable_pagetoken();
+  public:
 
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void GetArgs::set_key(std::string&& value) {
+  // bytes ClientId = 5;
+  void clear_clientid();
+  const std::string& clientid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_clientid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_clientid();
+  PROTOBUF_NODISCARD std::string* release_clientid();
+  void set_allocated_clientid(std::string* clientid);
+  private:
+  const std::string& _internal_clientid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_clientid(const std::string& value);
+  std::string* _internal_mutable_clientid();
+  public:
 
-  key_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.GetArgs.Key)
-}
-inline void GetArgs::set_key(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+  // int32 Limit = 3;
+  void clear_limit();
+  int32_t limit() const;
+  void set_limit(int32_t value);
+  private:
+  int32_t _internal_limit() const;
+  void _internal_set_limit(int32_t value);
+  public:
 
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.GetArgs.Key)
-}
-inline void GetArgs::set_key(const void* value,
-    size_t size) {
+  // int32 RequestId = 6;
+  void clear_requestid();
+  int32_t requestid() const;
+  void set_requestid(int32_t value);
+  private:
+  int32_t _internal_requestid() const;
+  void _internal_set_requestid(int32_t value);
+  public:
 
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.GetArgs.Key)
-}
-inline std::string* GetArgs::_internal_mutable_key() {
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.ScanArgs)
+ private:
+  class _Internal;
 
-  return key_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline std::string* GetArgs::release_key() {
-  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.GetArgs.Key)
-  return key_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline void GetArgs::set_allocated_key(std::string* key) {
-  if (key != nullptr) {
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr startkey_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr endkey_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr pagetoken_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clientid_;
+    int32_t limit_;
+    int32_t requestid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
 
-  } else {
+class PrefixScanArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.PrefixScanArgs) */ {
+ public:
+  inline PrefixScanArgs() : PrefixScanArgs(nullptr) {}
+  ~PrefixScanArgs() override;
+  explicit PROTOBUF_CONSTEXPR PrefixScanArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
+  PrefixScanArgs(const PrefixScanArgs& from);
+  PrefixScanArgs(PrefixScanArgs&& from) noexcept
+    : PrefixScanArgs() {
+    *this = ::std::move(from);
   }
-  key_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), key,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.GetArgs.Key)
-}
-inline std::string* GetArgs::unsafe_arena_release_key() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftKVRpcProctoc.GetArgs.Key)
-  GOOGLE_DCHECK(GetArena() != nullptr);
 
-  return key_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void GetArgs::unsafe_arena_set_allocated_key(
-    std::string* key) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (key != nullptr) {
-
-  } else {
+  inline PrefixScanArgs& operator=(const PrefixScanArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PrefixScanArgs& operator=(PrefixScanArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PrefixScanArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PrefixScanArgs* internal_default_instance() {
+    return reinterpret_cast<const PrefixScanArgs*>(
+               &_PrefixScanArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(PrefixScanArgs& a, PrefixScanArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PrefixScanArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PrefixScanArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PrefixScanArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PrefixScanArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PrefixScanArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PrefixScanArgs& from) {
+    PrefixScanArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PrefixScanArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.PrefixScanArgs";
+  }
+  protected:
+  explicit PrefixScanArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPrefixFieldNumber = 1,
+    kPageTokenFieldNumber = 3,
+    kClientIdFieldNumber = 4,
+    kLimitFieldNumber = 2,
+    kRequestIdFieldNumber = 5,
+  };
+  // bytes Prefix = 1;
+  void clear_prefix();
+  const std::string& prefix() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_prefix(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_prefix();
+  PROTOBUF_NODISCARD std::string* release_prefix();
+  void set_allocated_prefix(std::string* prefix);
+  private:
+  const std::string& _internal_prefix() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_prefix(const std::string& value);
+  std::string* _internal_mutable_prefix();
+  public:
+
+  // bytes PageToken = 3;
+  void clear_pagetoken();
+  const std::string& pagetoken() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_pagetoken(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_pagetoken();
+  PROTOBUF_NODISCARD std::string* release_pagetoken();
+  void set_allocated_pagetoken(std::string* pagetoken);
+  private:
+  const std::string& _internal_pagetoken() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_pagetoken(const std::string& value);
+  std::string* _internal_mutable_pagetoken();
+  public:
+
+  // bytes ClientId = 4;
+  void clear_clientid();
+  const std::string& clientid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_clientid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_clientid();
+  PROTOBUF_NODISCARD std::string* release_clientid();
+  void set_allocated_clientid(std::string* clientid);
+  private:
+  const std::string& _internal_clientid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_clientid(const std::string& value);
+  std::string* _internal_mutable_clientid();
+  public:
+
+  // int32 Limit = 2;
+  void clear_limit();
+  int32_t limit() const;
+  void set_limit(int32_t value);
+  private:
+  int32_t _internal_limit() const;
+  void _internal_set_limit(int32_t value);
+  public:
+
+  // int32 RequestId = 5;
+  void clear_requestid();
+  int32_t requestid() const;
+  void set_requestid(int32_t value);
+  private:
+  int32_t _internal_requestid() const;
+  void _internal_set_requestid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.PrefixScanArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr prefix_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr pagetoken_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clientid_;
+    int32_t limit_;
+    int32_t requestid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class KeyValue final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.KeyValue) */ {
+ public:
+  inline KeyValue() : KeyValue(nullptr) {}
+  ~KeyValue() override;
+  explicit PROTOBUF_CONSTEXPR KeyValue(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  KeyValue(const KeyValue& from);
+  KeyValue(KeyValue&& from) noexcept
+    : KeyValue() {
+    *this = ::std::move(from);
+  }
+
+  inline KeyValue& operator=(const KeyValue& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline KeyValue& operator=(KeyValue&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const KeyValue& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const KeyValue* internal_default_instance() {
+    return reinterpret_cast<const KeyValue*>(
+               &_KeyValue_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(KeyValue& a, KeyValue& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(KeyValue* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(KeyValue* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  KeyValue* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<KeyValue>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const KeyValue& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const KeyValue& from) {
+    KeyValue::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(KeyValue* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.KeyValue";
+  }
+  protected:
+  explicit KeyValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
+  // bytes Key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // bytes Value = 2;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.KeyValue)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ScanReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.ScanReply) */ {
+ public:
+  inline ScanReply() : ScanReply(nullptr) {}
+  ~ScanReply() override;
+  explicit PROTOBUF_CONSTEXPR ScanReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ScanReply(const ScanReply& from);
+  ScanReply(ScanReply&& from) noexcept
+    : ScanReply() {
+    *this = ::std::move(from);
+  }
+
+  inline ScanReply& operator=(const ScanReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ScanReply& operator=(ScanReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ScanReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ScanReply* internal_default_instance() {
+    return reinterpret_cast<const ScanReply*>(
+               &_ScanReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(ScanReply& a, ScanReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ScanReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ScanReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ScanReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ScanReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ScanReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ScanReply& from) {
+    ScanReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ScanReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.ScanReply";
+  }
+  protected:
+  explicit ScanReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKvsFieldNumber = 2,
+    kErrFieldNumber = 1,
+    kNextPageTokenFieldNumber = 3,
+    kReadIndexFieldNumber = 4,
+    kRetryAfterMsFieldNumber = 5,
+  };
+  // repeated .raftKVRpcProctoc.KeyValue Kvs = 2;
+  int kvs_size() const;
+  private:
+  int _internal_kvs_size() const;
+  public:
+  void clear_kvs();
+  ::raftKVRpcProctoc::KeyValue* mutable_kvs(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::KeyValue >*
+      mutable_kvs();
+  private:
+  const ::raftKVRpcProctoc::KeyValue& _internal_kvs(int index) const;
+  ::raftKVRpcProctoc::KeyValue* _internal_add_kvs();
+  public:
+  const ::raftKVRpcProctoc::KeyValue& kvs(int index) const;
+  ::raftKVRpcProctoc::KeyValue* add_kvs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::KeyValue >&
+      kvs() const;
+
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // bytes NextPageToken = 3;
+  void clear_nextpagetoken();
+  const std::string& nextpagetoken() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_nextpagetoken(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_nextpagetoken();
+  PROTOBUF_NODISCARD std::string* release_nextpagetoken();
+  void set_allocated_nextpagetoken(std::string* nextpagetoken);
+  private:
+  const std::string& _internal_nextpagetoken() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_nextpagetoken(const std::string& value);
+  std::string* _internal_mutable_nextpagetoken();
+  public:
+
+  // int64 ReadIndex = 4;
+  void clear_readindex();
+  int64_t readindex() const;
+  void set_readindex(int64_t value);
+  private:
+  int64_t _internal_readindex() const;
+  void _internal_set_readindex(int64_t value);
+  public:
+
+  // int64 RetryAfterMs = 5;
+  void clear_retryafterms();
+  int64_t retryafterms() const;
+  void set_retryafterms(int64_t value);
+  private:
+  int64_t _internal_retryafterms() const;
+  void _internal_set_retryafterms(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.ScanReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::KeyValue > kvs_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr nextpagetoken_;
+    int64_t readindex_;
+    int64_t retryafterms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MultiGetArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.MultiGetArgs) */ {
+ public:
+  inline MultiGetArgs() : MultiGetArgs(nullptr) {}
+  ~MultiGetArgs() override;
+  explicit PROTOBUF_CONSTEXPR MultiGetArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MultiGetArgs(const MultiGetArgs& from);
+  MultiGetArgs(MultiGetArgs&& from) noexcept
+    : MultiGetArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline MultiGetArgs& operator=(const MultiGetArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MultiGetArgs& operator=(MultiGetArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MultiGetArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MultiGetArgs* internal_default_instance() {
+    return reinterpret_cast<const MultiGetArgs*>(
+               &_MultiGetArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(MultiGetArgs& a, MultiGetArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MultiGetArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MultiGetArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MultiGetArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MultiGetArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MultiGetArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MultiGetArgs& from) {
+    MultiGetArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MultiGetArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.MultiGetArgs";
+  }
+  protected:
+  explicit MultiGetArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeysFieldNumber = 1,
+    kClientIdFieldNumber = 2,
+    kRequestIdFieldNumber = 3,
+  };
+  // repeated bytes Keys = 1;
+  int keys_size() const;
+  private:
+  int _internal_keys_size() const;
+  public:
+  void clear_keys();
+  const std::string& keys(int index) const;
+  std::string* mutable_keys(int index);
+  void set_keys(int index, const std::string& value);
+  void set_keys(int index, std::string&& value);
+  void set_keys(int index, const char* value);
+  void set_keys(int index, const void* value, size_t size);
+  std::string* add_keys();
+  void add_keys(const std::string& value);
+  void add_keys(std::string&& value);
+  void add_keys(const char* value);
+  void add_keys(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& keys() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_keys();
+  private:
+  const std::string& _internal_keys(int index) const;
+  std::string* _internal_add_keys();
+  public:
+
+  // bytes ClientId = 2;
+  void clear_clientid();
+  const std::string& clientid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_clientid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_clientid();
+  PROTOBUF_NODISCARD std::string* release_clientid();
+  void set_allocated_clientid(std::string* clientid);
+  private:
+  const std::string& _internal_clientid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_clientid(const std::string& value);
+  std::string* _internal_mutable_clientid();
+  public:
+
+  // int32 RequestId = 3;
+  void clear_requestid();
+  int32_t requestid() const;
+  void set_requestid(int32_t value);
+  private:
+  int32_t _internal_requestid() const;
+  void _internal_set_requestid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.MultiGetArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> keys_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clientid_;
+    int32_t requestid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetResult final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.GetResult) */ {
+ public:
+  inline GetResult() : GetResult(nullptr) {}
+  ~GetResult() override;
+  explicit PROTOBUF_CONSTEXPR GetResult(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetResult(const GetResult& from);
+  GetResult(GetResult&& from) noexcept
+    : GetResult() {
+    *this = ::std::move(from);
+  }
+
+  inline GetResult& operator=(const GetResult& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetResult& operator=(GetResult&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetResult& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetResult* internal_default_instance() {
+    return reinterpret_cast<const GetResult*>(
+               &_GetResult_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(GetResult& a, GetResult& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetResult* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetResult* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetResult>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetResult& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetResult& from) {
+    GetResult::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetResult* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.GetResult";
+  }
+  protected:
+  explicit GetResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValueFieldNumber = 2,
+    kExistFieldNumber = 1,
+  };
+  // bytes Value = 2;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // bool Exist = 1;
+  void clear_exist();
+  bool exist() const;
+  void set_exist(bool value);
+  private:
+  bool _internal_exist() const;
+  void _internal_set_exist(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.GetResult)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    bool exist_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MultiGetReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.MultiGetReply) */ {
+ public:
+  inline MultiGetReply() : MultiGetReply(nullptr) {}
+  ~MultiGetReply() override;
+  explicit PROTOBUF_CONSTEXPR MultiGetReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MultiGetReply(const MultiGetReply& from);
+  MultiGetReply(MultiGetReply&& from) noexcept
+    : MultiGetReply() {
+    *this = ::std::move(from);
+  }
+
+  inline MultiGetReply& operator=(const MultiGetReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MultiGetReply& operator=(MultiGetReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MultiGetReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MultiGetReply* internal_default_instance() {
+    return reinterpret_cast<const MultiGetReply*>(
+               &_MultiGetReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(MultiGetReply& a, MultiGetReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MultiGetReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MultiGetReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MultiGetReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MultiGetReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MultiGetReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MultiGetReply& from) {
+    MultiGetReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MultiGetReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.MultiGetReply";
+  }
+  protected:
+  explicit MultiGetReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResultsFieldNumber = 2,
+    kErrFieldNumber = 1,
+    kRetryAfterMsFieldNumber = 3,
+  };
+  // repeated .raftKVRpcProctoc.GetResult Results = 2;
+  int results_size() const;
+  private:
+  int _internal_results_size() const;
+  public:
+  void clear_results();
+  ::raftKVRpcProctoc::GetResult* mutable_results(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::GetResult >*
+      mutable_results();
+  private:
+  const ::raftKVRpcProctoc::GetResult& _internal_results(int index) const;
+  ::raftKVRpcProctoc::GetResult* _internal_add_results();
+  public:
+  const ::raftKVRpcProctoc::GetResult& results(int index) const;
+  ::raftKVRpcProctoc::GetResult* add_results();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::GetResult >&
+      results() const;
+
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // int64 RetryAfterMs = 3;
+  void clear_retryafterms();
+  int64_t retryafterms() const;
+  void set_retryafterms(int64_t value);
+  private:
+  int64_t _internal_retryafterms() const;
+  void _internal_set_retryafterms(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.MultiGetReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::GetResult > results_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    int64_t retryafterms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WriteOp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.WriteOp) */ {
+ public:
+  inline WriteOp() : WriteOp(nullptr) {}
+  ~WriteOp() override;
+  explicit PROTOBUF_CONSTEXPR WriteOp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WriteOp(const WriteOp& from);
+  WriteOp(WriteOp&& from) noexcept
+    : WriteOp() {
+    *this = ::std::move(from);
+  }
+
+  inline WriteOp& operator=(const WriteOp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WriteOp& operator=(WriteOp&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WriteOp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WriteOp* internal_default_instance() {
+    return reinterpret_cast<const WriteOp*>(
+               &_WriteOp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(WriteOp& a, WriteOp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WriteOp* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WriteOp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WriteOp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WriteOp>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WriteOp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WriteOp& from) {
+    WriteOp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WriteOp* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.WriteOp";
+  }
+  protected:
+  explicit WriteOp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOpFieldNumber = 1,
+    kKeyFieldNumber = 2,
+    kValueFieldNumber = 3,
+    kTtlMsFieldNumber = 4,
+  };
+  // bytes Op = 1;
+  void clear_op();
+  const std::string& op() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_op(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_op();
+  PROTOBUF_NODISCARD std::string* release_op();
+  void set_allocated_op(std::string* op);
+  private:
+  const std::string& _internal_op() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_op(const std::string& value);
+  std::string* _internal_mutable_op();
+  public:
+
+  // bytes Key = 2;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // bytes Value = 3;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // int64 TtlMs = 4;
+  void clear_ttlms();
+  int64_t ttlms() const;
+  void set_ttlms(int64_t value);
+  private:
+  int64_t _internal_ttlms() const;
+  void _internal_set_ttlms(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.WriteOp)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr op_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    int64_t ttlms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BatchWriteArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.BatchWriteArgs) */ {
+ public:
+  inline BatchWriteArgs() : BatchWriteArgs(nullptr) {}
+  ~BatchWriteArgs() override;
+  explicit PROTOBUF_CONSTEXPR BatchWriteArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BatchWriteArgs(const BatchWriteArgs& from);
+  BatchWriteArgs(BatchWriteArgs&& from) noexcept
+    : BatchWriteArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline BatchWriteArgs& operator=(const BatchWriteArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BatchWriteArgs& operator=(BatchWriteArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BatchWriteArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BatchWriteArgs* internal_default_instance() {
+    return reinterpret_cast<const BatchWriteArgs*>(
+               &_BatchWriteArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(BatchWriteArgs& a, BatchWriteArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BatchWriteArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BatchWriteArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BatchWriteArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchWriteArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BatchWriteArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchWriteArgs& from) {
+    BatchWriteArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BatchWriteArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.BatchWriteArgs";
+  }
+  protected:
+  explicit BatchWriteArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOpsFieldNumber = 1,
+    kClientIdFieldNumber = 2,
+    kRequestIdFieldNumber = 3,
+  };
+  // repeated .raftKVRpcProctoc.WriteOp Ops = 1;
+  int ops_size() const;
+  private:
+  int _internal_ops_size() const;
+  public:
+  void clear_ops();
+  ::raftKVRpcProctoc::WriteOp* mutable_ops(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::WriteOp >*
+      mutable_ops();
+  private:
+  const ::raftKVRpcProctoc::WriteOp& _internal_ops(int index) const;
+  ::raftKVRpcProctoc::WriteOp* _internal_add_ops();
+  public:
+  const ::raftKVRpcProctoc::WriteOp& ops(int index) const;
+  ::raftKVRpcProctoc::WriteOp* add_ops();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::WriteOp >&
+      ops() const;
+
+  // bytes ClientId = 2;
+  void clear_clientid();
+  const std::string& clientid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_clientid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_clientid();
+  PROTOBUF_NODISCARD std::string* release_clientid();
+  void set_allocated_clientid(std::string* clientid);
+  private:
+  const std::string& _internal_clientid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_clientid(const std::string& value);
+  std::string* _internal_mutable_clientid();
+  public:
+
+  // int32 RequestId = 3;
+  void clear_requestid();
+  int32_t requestid() const;
+  void set_requestid(int32_t value);
+  private:
+  int32_t _internal_requestid() const;
+  void _internal_set_requestid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.BatchWriteArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::WriteOp > ops_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clientid_;
+    int32_t requestid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BatchWriteReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.BatchWriteReply) */ {
+ public:
+  inline BatchWriteReply() : BatchWriteReply(nullptr) {}
+  ~BatchWriteReply() override;
+  explicit PROTOBUF_CONSTEXPR BatchWriteReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BatchWriteReply(const BatchWriteReply& from);
+  BatchWriteReply(BatchWriteReply&& from) noexcept
+    : BatchWriteReply() {
+    *this = ::std::move(from);
+  }
+
+  inline BatchWriteReply& operator=(const BatchWriteReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BatchWriteReply& operator=(BatchWriteReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BatchWriteReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BatchWriteReply* internal_default_instance() {
+    return reinterpret_cast<const BatchWriteReply*>(
+               &_BatchWriteReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(BatchWriteReply& a, BatchWriteReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BatchWriteReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BatchWriteReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BatchWriteReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchWriteReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BatchWriteReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchWriteReply& from) {
+    BatchWriteReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BatchWriteReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.BatchWriteReply";
+  }
+  protected:
+  explicit BatchWriteReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrFieldNumber = 1,
+    kRetryAfterMsFieldNumber = 2,
+  };
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // int64 RetryAfterMs = 2;
+  void clear_retryafterms();
+  int64_t retryafterms() const;
+  void set_retryafterms(int64_t value);
+  private:
+  int64_t _internal_retryafterms() const;
+  void _internal_set_retryafterms(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.BatchWriteReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    int64_t retryafterms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TxnCompare final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.TxnCompare) */ {
+ public:
+  inline TxnCompare() : TxnCompare(nullptr) {}
+  ~TxnCompare() override;
+  explicit PROTOBUF_CONSTEXPR TxnCompare(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TxnCompare(const TxnCompare& from);
+  TxnCompare(TxnCompare&& from) noexcept
+    : TxnCompare() {
+    *this = ::std::move(from);
+  }
+
+  inline TxnCompare& operator=(const TxnCompare& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TxnCompare& operator=(TxnCompare&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TxnCompare& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TxnCompare* internal_default_instance() {
+    return reinterpret_cast<const TxnCompare*>(
+               &_TxnCompare_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(TxnCompare& a, TxnCompare& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TxnCompare* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TxnCompare* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TxnCompare* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TxnCompare>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TxnCompare& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TxnCompare& from) {
+    TxnCompare::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TxnCompare* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.TxnCompare";
+  }
+  protected:
+  explicit TxnCompare(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef TxnCompare_Target Target;
+  static constexpr Target VALUE =
+    TxnCompare_Target_VALUE;
+  static constexpr Target EXISTS =
+    TxnCompare_Target_EXISTS;
+  static constexpr Target VERSION =
+    TxnCompare_Target_VERSION;
+  static inline bool Target_IsValid(int value) {
+    return TxnCompare_Target_IsValid(value);
+  }
+  static constexpr Target Target_MIN =
+    TxnCompare_Target_Target_MIN;
+  static constexpr Target Target_MAX =
+    TxnCompare_Target_Target_MAX;
+  static constexpr int Target_ARRAYSIZE =
+    TxnCompare_Target_Target_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Target_descriptor() {
+    return TxnCompare_Target_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Target_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Target>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Target_Name.");
+    return TxnCompare_Target_Name(enum_t_value);
+  }
+  static inline bool Target_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Target* value) {
+    return TxnCompare_Target_Parse(name, value);
+  }
+
+  typedef TxnCompare_Result Result;
+  static constexpr Result EQUAL =
+    TxnCompare_Result_EQUAL;
+  static constexpr Result NOT_EQUAL =
+    TxnCompare_Result_NOT_EQUAL;
+  static constexpr Result GREATER =
+    TxnCompare_Result_GREATER;
+  static constexpr Result LESS =
+    TxnCompare_Result_LESS;
+  static inline bool Result_IsValid(int value) {
+    return TxnCompare_Result_IsValid(value);
+  }
+  static constexpr Result Result_MIN =
+    TxnCompare_Result_Result_MIN;
+  static constexpr Result Result_MAX =
+    TxnCompare_Result_Result_MAX;
+  static constexpr int Result_ARRAYSIZE =
+    TxnCompare_Result_Result_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Result_descriptor() {
+    return TxnCompare_Result_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Result_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Result>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Result_Name.");
+    return TxnCompare_Result_Name(enum_t_value);
+  }
+  static inline bool Result_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Result* value) {
+    return TxnCompare_Result_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 4,
+    kTargetFieldNumber = 2,
+    kResultFieldNumber = 3,
+    kVersionFieldNumber = 6,
+    kExistsFieldNumber = 5,
+  };
+  // bytes Key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // bytes Value = 4;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // .raftKVRpcProctoc.TxnCompare.Target target = 2;
+  void clear_target();
+  ::raftKVRpcProctoc::TxnCompare_Target target() const;
+  void set_target(::raftKVRpcProctoc::TxnCompare_Target value);
+  private:
+  ::raftKVRpcProctoc::TxnCompare_Target _internal_target() const;
+  void _internal_set_target(::raftKVRpcProctoc::TxnCompare_Target value);
+  public:
+
+  // .raftKVRpcProctoc.TxnCompare.Result result = 3;
+  void clear_result();
+  ::raftKVRpcProctoc::TxnCompare_Result result() const;
+  void set_result(::raftKVRpcProctoc::TxnCompare_Result value);
+  private:
+  ::raftKVRpcProctoc::TxnCompare_Result _internal_result() const;
+  void _internal_set_result(::raftKVRpcProctoc::TxnCompare_Result value);
+  public:
+
+  // int64 Version = 6;
+  void clear_version();
+  int64_t version() const;
+  void set_version(int64_t value);
+  private:
+  int64_t _internal_version() const;
+  void _internal_set_version(int64_t value);
+  public:
+
+  // bool Exists = 5;
+  void clear_exists();
+  bool exists() const;
+  void set_exists(bool value);
+  private:
+  bool _internal_exists() const;
+  void _internal_set_exists(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.TxnCompare)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    int target_;
+    int result_;
+    int64_t version_;
+    bool exists_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TxnOp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.TxnOp) */ {
+ public:
+  inline TxnOp() : TxnOp(nullptr) {}
+  ~TxnOp() override;
+  explicit PROTOBUF_CONSTEXPR TxnOp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TxnOp(const TxnOp& from);
+  TxnOp(TxnOp&& from) noexcept
+    : TxnOp() {
+    *this = ::std::move(from);
+  }
+
+  inline TxnOp& operator=(const TxnOp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TxnOp& operator=(TxnOp&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TxnOp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TxnOp* internal_default_instance() {
+    return reinterpret_cast<const TxnOp*>(
+               &_TxnOp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(TxnOp& a, TxnOp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TxnOp* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TxnOp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TxnOp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TxnOp>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TxnOp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TxnOp& from) {
+    TxnOp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TxnOp* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.TxnOp";
+  }
+  protected:
+  explicit TxnOp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef TxnOp_OpType OpType;
+  static constexpr OpType GET =
+    TxnOp_OpType_GET;
+  static constexpr OpType PUT =
+    TxnOp_OpType_PUT;
+  static constexpr OpType APPEND =
+    TxnOp_OpType_APPEND;
+  static constexpr OpType DELETE =
+    TxnOp_OpType_DELETE;
+  static constexpr OpType INCREMENT =
+    TxnOp_OpType_INCREMENT;
+  static constexpr OpType APPEND_IF_ABSENT =
+    TxnOp_OpType_APPEND_IF_ABSENT;
+  static inline bool OpType_IsValid(int value) {
+    return TxnOp_OpType_IsValid(value);
+  }
+  static constexpr OpType OpType_MIN =
+    TxnOp_OpType_OpType_MIN;
+  static constexpr OpType OpType_MAX =
+    TxnOp_OpType_OpType_MAX;
+  static constexpr int OpType_ARRAYSIZE =
+    TxnOp_OpType_OpType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  OpType_descriptor() {
+    return TxnOp_OpType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& OpType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, OpType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function OpType_Name.");
+    return TxnOp_OpType_Name(enum_t_value);
+  }
+  static inline bool OpType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      OpType* value) {
+    return TxnOp_OpType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 2,
+    kValueFieldNumber = 3,
+    kDeltaFieldNumber = 4,
+    kOpFieldNumber = 1,
+  };
+  // bytes Key = 2;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // bytes Value = 3;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // int64 Delta = 4;
+  void clear_delta();
+  int64_t delta() const;
+  void set_delta(int64_t value);
+  private:
+  int64_t _internal_delta() const;
+  void _internal_set_delta(int64_t value);
+  public:
+
+  // .raftKVRpcProctoc.TxnOp.OpType Op = 1;
+  void clear_op();
+  ::raftKVRpcProctoc::TxnOp_OpType op() const;
+  void set_op(::raftKVRpcProctoc::TxnOp_OpType value);
+  private:
+  ::raftKVRpcProctoc::TxnOp_OpType _internal_op() const;
+  void _internal_set_op(::raftKVRpcProctoc::TxnOp_OpType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.TxnOp)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    int64_t delta_;
+    int op_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TxnArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.TxnArgs) */ {
+ public:
+  inline TxnArgs() : TxnArgs(nullptr) {}
+  ~TxnArgs() override;
+  explicit PROTOBUF_CONSTEXPR TxnArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TxnArgs(const TxnArgs& from);
+  TxnArgs(TxnArgs&& from) noexcept
+    : TxnArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline TxnArgs& operator=(const TxnArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TxnArgs& operator=(TxnArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TxnArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TxnArgs* internal_default_instance() {
+    return reinterpret_cast<const TxnArgs*>(
+               &_TxnArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(TxnArgs& a, TxnArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TxnArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TxnArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TxnArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TxnArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TxnArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TxnArgs& from) {
+    TxnArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TxnArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.TxnArgs";
+  }
+  protected:
+  explicit TxnArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kComparesFieldNumber = 1,
+    kSuccessFieldNumber = 2,
+    kFailureFieldNumber = 3,
+    kClientIdFieldNumber = 4,
+    kRequestIdFieldNumber = 5,
+  };
+  // repeated .raftKVRpcProctoc.TxnCompare Compares = 1;
+  int compares_size() const;
+  private:
+  int _internal_compares_size() const;
+  public:
+  void clear_compares();
+  ::raftKVRpcProctoc::TxnCompare* mutable_compares(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnCompare >*
+      mutable_compares();
+  private:
+  const ::raftKVRpcProctoc::TxnCompare& _internal_compares(int index) const;
+  ::raftKVRpcProctoc::TxnCompare* _internal_add_compares();
+  public:
+  const ::raftKVRpcProctoc::TxnCompare& compares(int index) const;
+  ::raftKVRpcProctoc::TxnCompare* add_compares();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnCompare >&
+      compares() const;
+
+  // repeated .raftKVRpcProctoc.TxnOp Success = 2;
+  int success_size() const;
+  private:
+  int _internal_success_size() const;
+  public:
+  void clear_success();
+  ::raftKVRpcProctoc::TxnOp* mutable_success(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnOp >*
+      mutable_success();
+  private:
+  const ::raftKVRpcProctoc::TxnOp& _internal_success(int index) const;
+  ::raftKVRpcProctoc::TxnOp* _internal_add_success();
+  public:
+  const ::raftKVRpcProctoc::TxnOp& success(int index) const;
+  ::raftKVRpcProctoc::TxnOp* add_success();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnOp >&
+      success() const;
+
+  // repeated .raftKVRpcProctoc.TxnOp Failure = 3;
+  int failure_size() const;
+  private:
+  int _internal_failure_size() const;
+  public:
+  void clear_failure();
+  ::raftKVRpcProctoc::TxnOp* mutable_failure(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnOp >*
+      mutable_failure();
+  private:
+  const ::raftKVRpcProctoc::TxnOp& _internal_failure(int index) const;
+  ::raftKVRpcProctoc::TxnOp* _internal_add_failure();
+  public:
+  const ::raftKVRpcProctoc::TxnOp& failure(int index) const;
+  ::raftKVRpcProctoc::TxnOp* add_failure();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnOp >&
+      failure() const;
+
+  // bytes ClientId = 4;
+  void clear_clientid();
+  const std::string& clientid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_clientid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_clientid();
+  PROTOBUF_NODISCARD std::string* release_clientid();
+  void set_allocated_clientid(std::string* clientid);
+  private:
+  const std::string& _internal_clientid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_clientid(const std::string& value);
+  std::string* _internal_mutable_clientid();
+  public:
+
+  // int32 RequestId = 5;
+  void clear_requestid();
+  int32_t requestid() const;
+  void set_requestid(int32_t value);
+  private:
+  int32_t _internal_requestid() const;
+  void _internal_set_requestid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.TxnArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnCompare > compares_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnOp > success_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnOp > failure_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clientid_;
+    int32_t requestid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TxnOpResult final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.TxnOpResult) */ {
+ public:
+  inline TxnOpResult() : TxnOpResult(nullptr) {}
+  ~TxnOpResult() override;
+  explicit PROTOBUF_CONSTEXPR TxnOpResult(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TxnOpResult(const TxnOpResult& from);
+  TxnOpResult(TxnOpResult&& from) noexcept
+    : TxnOpResult() {
+    *this = ::std::move(from);
+  }
+
+  inline TxnOpResult& operator=(const TxnOpResult& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TxnOpResult& operator=(TxnOpResult&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TxnOpResult& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TxnOpResult* internal_default_instance() {
+    return reinterpret_cast<const TxnOpResult*>(
+               &_TxnOpResult_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(TxnOpResult& a, TxnOpResult& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TxnOpResult* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TxnOpResult* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TxnOpResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TxnOpResult>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TxnOpResult& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TxnOpResult& from) {
+    TxnOpResult::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TxnOpResult* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.TxnOpResult";
+  }
+  protected:
+  explicit TxnOpResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValueFieldNumber = 3,
+    kExistFieldNumber = 1,
+    kAppliedFieldNumber = 2,
+  };
+  // bytes Value = 3;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // bool Exist = 1;
+  void clear_exist();
+  bool exist() const;
+  void set_exist(bool value);
+  private:
+  bool _internal_exist() const;
+  void _internal_set_exist(bool value);
+  public:
+
+  // bool Applied = 2;
+  void clear_applied();
+  bool applied() const;
+  void set_applied(bool value);
+  private:
+  bool _internal_applied() const;
+  void _internal_set_applied(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.TxnOpResult)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    bool exist_;
+    bool applied_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TxnReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.TxnReply) */ {
+ public:
+  inline TxnReply() : TxnReply(nullptr) {}
+  ~TxnReply() override;
+  explicit PROTOBUF_CONSTEXPR TxnReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TxnReply(const TxnReply& from);
+  TxnReply(TxnReply&& from) noexcept
+    : TxnReply() {
+    *this = ::std::move(from);
+  }
+
+  inline TxnReply& operator=(const TxnReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TxnReply& operator=(TxnReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TxnReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TxnReply* internal_default_instance() {
+    return reinterpret_cast<const TxnReply*>(
+               &_TxnReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(TxnReply& a, TxnReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TxnReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TxnReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TxnReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TxnReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TxnReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TxnReply& from) {
+    TxnReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TxnReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.TxnReply";
+  }
+  protected:
+  explicit TxnReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResultsFieldNumber = 3,
+    kErrFieldNumber = 1,
+    kTxnErrorFieldNumber = 4,
+    kRetryAfterMsFieldNumber = 5,
+    kSucceededFieldNumber = 2,
+  };
+  // repeated .raftKVRpcProctoc.TxnOpResult Results = 3;
+  int results_size() const;
+  private:
+  int _internal_results_size() const;
+  public:
+  void clear_results();
+  ::raftKVRpcProctoc::TxnOpResult* mutable_results(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnOpResult >*
+      mutable_results();
+  private:
+  const ::raftKVRpcProctoc::TxnOpResult& _internal_results(int index) const;
+  ::raftKVRpcProctoc::TxnOpResult* _internal_add_results();
+  public:
+  const ::raftKVRpcProctoc::TxnOpResult& results(int index) const;
+  ::raftKVRpcProctoc::TxnOpResult* add_results();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnOpResult >&
+      results() const;
+
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // bytes TxnError = 4;
+  void clear_txnerror();
+  const std::string& txnerror() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_txnerror(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_txnerror();
+  PROTOBUF_NODISCARD std::string* release_txnerror();
+  void set_allocated_txnerror(std::string* txnerror);
+  private:
+  const std::string& _internal_txnerror() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_txnerror(const std::string& value);
+  std::string* _internal_mutable_txnerror();
+  public:
+
+  // int64 RetryAfterMs = 5;
+  void clear_retryafterms();
+  int64_t retryafterms() const;
+  void set_retryafterms(int64_t value);
+  private:
+  int64_t _internal_retryafterms() const;
+  void _internal_set_retryafterms(int64_t value);
+  public:
+
+  // bool Succeeded = 2;
+  void clear_succeeded();
+  bool succeeded() const;
+  void set_succeeded(bool value);
+  private:
+  bool _internal_succeeded() const;
+  void _internal_set_succeeded(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.TxnReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnOpResult > results_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr txnerror_;
+    int64_t retryafterms_;
+    bool succeeded_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DeleteArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.DeleteArgs) */ {
+ public:
+  inline DeleteArgs() : DeleteArgs(nullptr) {}
+  ~DeleteArgs() override;
+  explicit PROTOBUF_CONSTEXPR DeleteArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DeleteArgs(const DeleteArgs& from);
+  DeleteArgs(DeleteArgs&& from) noexcept
+    : DeleteArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline DeleteArgs& operator=(const DeleteArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DeleteArgs& operator=(DeleteArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DeleteArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DeleteArgs* internal_default_instance() {
+    return reinterpret_cast<const DeleteArgs*>(
+               &_DeleteArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(DeleteArgs& a, DeleteArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DeleteArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DeleteArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DeleteArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DeleteArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DeleteArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DeleteArgs& from) {
+    DeleteArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DeleteArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.DeleteArgs";
+  }
+  protected:
+  explicit DeleteArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kClientIdFieldNumber = 2,
+    kRequestIdFieldNumber = 3,
+  };
+  // bytes Key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // bytes ClientId = 2;
+  void clear_clientid();
+  const std::string& clientid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_clientid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_clientid();
+  PROTOBUF_NODISCARD std::string* release_clientid();
+  void set_allocated_clientid(std::string* clientid);
+  private:
+  const std::string& _internal_clientid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_clientid(const std::string& value);
+  std::string* _internal_mutable_clientid();
+  public:
+
+  // int32 RequestId = 3;
+  void clear_requestid();
+  int32_t requestid() const;
+  void set_requestid(int32_t value);
+  private:
+  int32_t _internal_requestid() const;
+  void _internal_set_requestid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.DeleteArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clientid_;
+    int32_t requestid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DeleteRangeArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.DeleteRangeArgs) */ {
+ public:
+  inline DeleteRangeArgs() : DeleteRangeArgs(nullptr) {}
+  ~DeleteRangeArgs() override;
+  explicit PROTOBUF_CONSTEXPR DeleteRangeArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DeleteRangeArgs(const DeleteRangeArgs& from);
+  DeleteRangeArgs(DeleteRangeArgs&& from) noexcept
+    : DeleteRangeArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline DeleteRangeArgs& operator=(const DeleteRangeArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DeleteRangeArgs& operator=(DeleteRangeArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DeleteRangeArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DeleteRangeArgs* internal_default_instance() {
+    return reinterpret_cast<const DeleteRangeArgs*>(
+               &_DeleteRangeArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(DeleteRangeArgs& a, DeleteRangeArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DeleteRangeArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DeleteRangeArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DeleteRangeArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DeleteRangeArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DeleteRangeArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DeleteRangeArgs& from) {
+    DeleteRangeArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DeleteRangeArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.DeleteRangeArgs";
+  }
+  protected:
+  explicit DeleteRangeArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStartKeyFieldNumber = 1,
+    kEndKeyFieldNumber = 2,
+    kClientIdFieldNumber = 3,
+    kRequestIdFieldNumber = 4,
+  };
+  // bytes StartKey = 1;
+  void clear_startkey();
+  const std::string& startkey() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_startkey(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_startkey();
+  PROTOBUF_NODISCARD std::string* release_startkey();
+  void set_allocated_startkey(std::string* startkey);
+  private:
+  const std::string& _internal_startkey() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_startkey(const std::string& value);
+  std::string* _internal_mutable_startkey();
+  public:
+
+  // bytes EndKey = 2;
+  void clear_endkey();
+  const std::string& endkey() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_endkey(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_endkey();
+  PROTOBUF_NODISCARD std::string* release_endkey();
+  void set_allocated_endkey(std::string* endkey);
+  private:
+  const std::string& _internal_endkey() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_endkey(const std::string& value);
+  std::string* _internal_mutable_endkey();
+  public:
+
+  // bytes ClientId = 3;
+  void clear_clientid();
+  const std::string& clientid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_clientid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_clientid();
+  PROTOBUF_NODISCARD std::string* release_clientid();
+  void set_allocated_clientid(std::string* clientid);
+  private:
+  const std::string& _internal_clientid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_clientid(const std::string& value);
+  std::string* _internal_mutable_clientid();
+  public:
+
+  // int32 RequestId = 4;
+  void clear_requestid();
+  int32_t requestid() const;
+  void set_requestid(int32_t value);
+  private:
+  int32_t _internal_requestid() const;
+  void _internal_set_requestid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.DeleteRangeArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr startkey_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr endkey_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clientid_;
+    int32_t requestid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DeleteReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.DeleteReply) */ {
+ public:
+  inline DeleteReply() : DeleteReply(nullptr) {}
+  ~DeleteReply() override;
+  explicit PROTOBUF_CONSTEXPR DeleteReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DeleteReply(const DeleteReply& from);
+  DeleteReply(DeleteReply&& from) noexcept
+    : DeleteReply() {
+    *this = ::std::move(from);
+  }
+
+  inline DeleteReply& operator=(const DeleteReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DeleteReply& operator=(DeleteReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DeleteReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DeleteReply* internal_default_instance() {
+    return reinterpret_cast<const DeleteReply*>(
+               &_DeleteReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(DeleteReply& a, DeleteReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DeleteReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DeleteReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DeleteReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DeleteReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DeleteReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DeleteReply& from) {
+    DeleteReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DeleteReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.DeleteReply";
+  }
+  protected:
+  explicit DeleteReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrFieldNumber = 1,
+    kRetryAfterMsFieldNumber = 2,
+  };
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // int64 RetryAfterMs = 2;
+  void clear_retryafterms();
+  int64_t retryafterms() const;
+  void set_retryafterms(int64_t value);
+  private:
+  int64_t _internal_retryafterms() const;
+  void _internal_set_retryafterms(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.DeleteReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    int64_t retryafterms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WatchEvent final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.WatchEvent) */ {
+ public:
+  inline WatchEvent() : WatchEvent(nullptr) {}
+  ~WatchEvent() override;
+  explicit PROTOBUF_CONSTEXPR WatchEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WatchEvent(const WatchEvent& from);
+  WatchEvent(WatchEvent&& from) noexcept
+    : WatchEvent() {
+    *this = ::std::move(from);
+  }
+
+  inline WatchEvent& operator=(const WatchEvent& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WatchEvent& operator=(WatchEvent&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WatchEvent& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WatchEvent* internal_default_instance() {
+    return reinterpret_cast<const WatchEvent*>(
+               &_WatchEvent_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(WatchEvent& a, WatchEvent& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WatchEvent* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WatchEvent* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WatchEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WatchEvent>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WatchEvent& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WatchEvent& from) {
+    WatchEvent::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WatchEvent* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.WatchEvent";
+  }
+  protected:
+  explicit WatchEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef WatchEvent_EventType EventType;
+  static constexpr EventType PUT =
+    WatchEvent_EventType_PUT;
+  static constexpr EventType APPEND =
+    WatchEvent_EventType_APPEND;
+  static constexpr EventType DELETE =
+    WatchEvent_EventType_DELETE;
+  static inline bool EventType_IsValid(int value) {
+    return WatchEvent_EventType_IsValid(value);
+  }
+  static constexpr EventType EventType_MIN =
+    WatchEvent_EventType_EventType_MIN;
+  static constexpr EventType EventType_MAX =
+    WatchEvent_EventType_EventType_MAX;
+  static constexpr int EventType_ARRAYSIZE =
+    WatchEvent_EventType_EventType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  EventType_descriptor() {
+    return WatchEvent_EventType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& EventType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, EventType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function EventType_Name.");
+    return WatchEvent_EventType_Name(enum_t_value);
+  }
+  static inline bool EventType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      EventType* value) {
+    return WatchEvent_EventType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 2,
+    kValueFieldNumber = 3,
+    kIndexFieldNumber = 4,
+    kTypeFieldNumber = 1,
+  };
+  // bytes Key = 2;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // bytes Value = 3;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // int64 Index = 4;
+  void clear_index();
+  int64_t index() const;
+  void set_index(int64_t value);
+  private:
+  int64_t _internal_index() const;
+  void _internal_set_index(int64_t value);
+  public:
+
+  // .raftKVRpcProctoc.WatchEvent.EventType Type = 1;
+  void clear_type();
+  ::raftKVRpcProctoc::WatchEvent_EventType type() const;
+  void set_type(::raftKVRpcProctoc::WatchEvent_EventType value);
+  private:
+  ::raftKVRpcProctoc::WatchEvent_EventType _internal_type() const;
+  void _internal_set_type(::raftKVRpcProctoc::WatchEvent_EventType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.WatchEvent)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    int64_t index_;
+    int type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WatchArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.WatchArgs) */ {
+ public:
+  inline WatchArgs() : WatchArgs(nullptr) {}
+  ~WatchArgs() override;
+  explicit PROTOBUF_CONSTEXPR WatchArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WatchArgs(const WatchArgs& from);
+  WatchArgs(WatchArgs&& from) noexcept
+    : WatchArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline WatchArgs& operator=(const WatchArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WatchArgs& operator=(WatchArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WatchArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WatchArgs* internal_default_instance() {
+    return reinterpret_cast<const WatchArgs*>(
+               &_WatchArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(WatchArgs& a, WatchArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WatchArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WatchArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WatchArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WatchArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WatchArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WatchArgs& from) {
+    WatchArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WatchArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.WatchArgs";
+  }
+  protected:
+  explicit WatchArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kStartIndexFieldNumber = 3,
+    kPrefixFieldNumber = 2,
+    kMaxEventsFieldNumber = 5,
+    kWatchIdFieldNumber = 4,
+    kTimeoutMsFieldNumber = 6,
+  };
+  // bytes Key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // int64 StartIndex = 3;
+  void clear_startindex();
+  int64_t startindex() const;
+  void set_startindex(int64_t value);
+  private:
+  int64_t _internal_startindex() const;
+  void _internal_set_startindex(int64_t value);
+  public:
+
+  // bool Prefix = 2;
+  void clear_prefix();
+  bool prefix() const;
+  void set_prefix(bool value);
+  private:
+  bool _internal_prefix() const;
+  void _internal_set_prefix(bool value);
+  public:
+
+  // int32 MaxEvents = 5;
+  void clear_maxevents();
+  int32_t maxevents() const;
+  void set_maxevents(int32_t value);
+  private:
+  int32_t _internal_maxevents() const;
+  void _internal_set_maxevents(int32_t value);
+  public:
+
+  // int64 WatchId = 4;
+  void clear_watchid();
+  int64_t watchid() const;
+  void set_watchid(int64_t value);
+  private:
+  int64_t _internal_watchid() const;
+  void _internal_set_watchid(int64_t value);
+  public:
+
+  // int32 TimeoutMs = 6;
+  void clear_timeoutms();
+  int32_t timeoutms() const;
+  void set_timeoutms(int32_t value);
+  private:
+  int32_t _internal_timeoutms() const;
+  void _internal_set_timeoutms(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.WatchArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    int64_t startindex_;
+    bool prefix_;
+    int32_t maxevents_;
+    int64_t watchid_;
+    int32_t timeoutms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WatchReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.WatchReply) */ {
+ public:
+  inline WatchReply() : WatchReply(nullptr) {}
+  ~WatchReply() override;
+  explicit PROTOBUF_CONSTEXPR WatchReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WatchReply(const WatchReply& from);
+  WatchReply(WatchReply&& from) noexcept
+    : WatchReply() {
+    *this = ::std::move(from);
+  }
+
+  inline WatchReply& operator=(const WatchReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WatchReply& operator=(WatchReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WatchReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WatchReply* internal_default_instance() {
+    return reinterpret_cast<const WatchReply*>(
+               &_WatchReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(WatchReply& a, WatchReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WatchReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WatchReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WatchReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WatchReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WatchReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WatchReply& from) {
+    WatchReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WatchReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.WatchReply";
+  }
+  protected:
+  explicit WatchReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEventsFieldNumber = 3,
+    kErrFieldNumber = 1,
+    kWatchIdFieldNumber = 2,
+    kNextIndexFieldNumber = 4,
+    kRetryAfterMsFieldNumber = 5,
+  };
+  // repeated .raftKVRpcProctoc.WatchEvent Events = 3;
+  int events_size() const;
+  private:
+  int _internal_events_size() const;
+  public:
+  void clear_events();
+  ::raftKVRpcProctoc::WatchEvent* mutable_events(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::WatchEvent >*
+      mutable_events();
+  private:
+  const ::raftKVRpcProctoc::WatchEvent& _internal_events(int index) const;
+  ::raftKVRpcProctoc::WatchEvent* _internal_add_events();
+  public:
+  const ::raftKVRpcProctoc::WatchEvent& events(int index) const;
+  ::raftKVRpcProctoc::WatchEvent* add_events();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::WatchEvent >&
+      events() const;
+
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // int64 WatchId = 2;
+  void clear_watchid();
+  int64_t watchid() const;
+  void set_watchid(int64_t value);
+  private:
+  int64_t _internal_watchid() const;
+  void _internal_set_watchid(int64_t value);
+  public:
+
+  // int64 NextIndex = 4;
+  void clear_nextindex();
+  int64_t nextindex() const;
+  void set_nextindex(int64_t value);
+  private:
+  int64_t _internal_nextindex() const;
+  void _internal_set_nextindex(int64_t value);
+  public:
+
+  // int64 RetryAfterMs = 5;
+  void clear_retryafterms();
+  int64_t retryafterms() const;
+  void set_retryafterms(int64_t value);
+  private:
+  int64_t _internal_retryafterms() const;
+  void _internal_set_retryafterms(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.WatchReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::WatchEvent > events_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    int64_t watchid_;
+    int64_t nextindex_;
+    int64_t retryafterms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CancelWatchArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.CancelWatchArgs) */ {
+ public:
+  inline CancelWatchArgs() : CancelWatchArgs(nullptr) {}
+  ~CancelWatchArgs() override;
+  explicit PROTOBUF_CONSTEXPR CancelWatchArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CancelWatchArgs(const CancelWatchArgs& from);
+  CancelWatchArgs(CancelWatchArgs&& from) noexcept
+    : CancelWatchArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline CancelWatchArgs& operator=(const CancelWatchArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CancelWatchArgs& operator=(CancelWatchArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CancelWatchArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CancelWatchArgs* internal_default_instance() {
+    return reinterpret_cast<const CancelWatchArgs*>(
+               &_CancelWatchArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  friend void swap(CancelWatchArgs& a, CancelWatchArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CancelWatchArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CancelWatchArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CancelWatchArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CancelWatchArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CancelWatchArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CancelWatchArgs& from) {
+    CancelWatchArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CancelWatchArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.CancelWatchArgs";
+  }
+  protected:
+  explicit CancelWatchArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kWatchIdFieldNumber = 1,
+  };
+  // int64 WatchId = 1;
+  void clear_watchid();
+  int64_t watchid() const;
+  void set_watchid(int64_t value);
+  private:
+  int64_t _internal_watchid() const;
+  void _internal_set_watchid(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.CancelWatchArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t watchid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CancelWatchReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.CancelWatchReply) */ {
+ public:
+  inline CancelWatchReply() : CancelWatchReply(nullptr) {}
+  ~CancelWatchReply() override;
+  explicit PROTOBUF_CONSTEXPR CancelWatchReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CancelWatchReply(const CancelWatchReply& from);
+  CancelWatchReply(CancelWatchReply&& from) noexcept
+    : CancelWatchReply() {
+    *this = ::std::move(from);
+  }
+
+  inline CancelWatchReply& operator=(const CancelWatchReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CancelWatchReply& operator=(CancelWatchReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CancelWatchReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CancelWatchReply* internal_default_instance() {
+    return reinterpret_cast<const CancelWatchReply*>(
+               &_CancelWatchReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  friend void swap(CancelWatchReply& a, CancelWatchReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CancelWatchReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CancelWatchReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CancelWatchReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CancelWatchReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CancelWatchReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CancelWatchReply& from) {
+    CancelWatchReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CancelWatchReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.CancelWatchReply";
+  }
+  protected:
+  explicit CancelWatchReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrFieldNumber = 1,
+  };
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.CancelWatchReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RegisterSessionArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.RegisterSessionArgs) */ {
+ public:
+  inline RegisterSessionArgs() : RegisterSessionArgs(nullptr) {}
+  ~RegisterSessionArgs() override;
+  explicit PROTOBUF_CONSTEXPR RegisterSessionArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RegisterSessionArgs(const RegisterSessionArgs& from);
+  RegisterSessionArgs(RegisterSessionArgs&& from) noexcept
+    : RegisterSessionArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline RegisterSessionArgs& operator=(const RegisterSessionArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RegisterSessionArgs& operator=(RegisterSessionArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RegisterSessionArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RegisterSessionArgs* internal_default_instance() {
+    return reinterpret_cast<const RegisterSessionArgs*>(
+               &_RegisterSessionArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  friend void swap(RegisterSessionArgs& a, RegisterSessionArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RegisterSessionArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RegisterSessionArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RegisterSessionArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RegisterSessionArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RegisterSessionArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RegisterSessionArgs& from) {
+    RegisterSessionArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RegisterSessionArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.RegisterSessionArgs";
+  }
+  protected:
+  explicit RegisterSessionArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNonceFieldNumber = 1,
+  };
+  // uint64 Nonce = 1;
+  void clear_nonce();
+  uint64_t nonce() const;
+  void set_nonce(uint64_t value);
+  private:
+  uint64_t _internal_nonce() const;
+  void _internal_set_nonce(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.RegisterSessionArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t nonce_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RegisterSessionReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.RegisterSessionReply) */ {
+ public:
+  inline RegisterSessionReply() : RegisterSessionReply(nullptr) {}
+  ~RegisterSessionReply() override;
+  explicit PROTOBUF_CONSTEXPR RegisterSessionReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RegisterSessionReply(const RegisterSessionReply& from);
+  RegisterSessionReply(RegisterSessionReply&& from) noexcept
+    : RegisterSessionReply() {
+    *this = ::std::move(from);
+  }
+
+  inline RegisterSessionReply& operator=(const RegisterSessionReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RegisterSessionReply& operator=(RegisterSessionReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RegisterSessionReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RegisterSessionReply* internal_default_instance() {
+    return reinterpret_cast<const RegisterSessionReply*>(
+               &_RegisterSessionReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    28;
+
+  friend void swap(RegisterSessionReply& a, RegisterSessionReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RegisterSessionReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RegisterSessionReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RegisterSessionReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RegisterSessionReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RegisterSessionReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RegisterSessionReply& from) {
+    RegisterSessionReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RegisterSessionReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.RegisterSessionReply";
+  }
+  protected:
+  explicit RegisterSessionReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrFieldNumber = 1,
+    kClientIdFieldNumber = 3,
+    kSessionIdFieldNumber = 2,
+    kRetryAfterMsFieldNumber = 4,
+  };
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // bytes ClientId = 3;
+  void clear_clientid();
+  const std::string& clientid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_clientid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_clientid();
+  PROTOBUF_NODISCARD std::string* release_clientid();
+  void set_allocated_clientid(std::string* clientid);
+  private:
+  const std::string& _internal_clientid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_clientid(const std::string& value);
+  std::string* _internal_mutable_clientid();
+  public:
+
+  // uint64 SessionId = 2;
+  void clear_sessionid();
+  uint64_t sessionid() const;
+  void set_sessionid(uint64_t value);
+  private:
+  uint64_t _internal_sessionid() const;
+  void _internal_set_sessionid(uint64_t value);
+  public:
+
+  // int64 RetryAfterMs = 4;
+  void clear_retryafterms();
+  int64_t retryafterms() const;
+  void set_retryafterms(int64_t value);
+  private:
+  int64_t _internal_retryafterms() const;
+  void _internal_set_retryafterms(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.RegisterSessionReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clientid_;
+    uint64_t sessionid_;
+    int64_t retryafterms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CdcEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.CdcEntry) */ {
+ public:
+  inline CdcEntry() : CdcEntry(nullptr) {}
+  ~CdcEntry() override;
+  explicit PROTOBUF_CONSTEXPR CdcEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CdcEntry(const CdcEntry& from);
+  CdcEntry(CdcEntry&& from) noexcept
+    : CdcEntry() {
+    *this = ::std::move(from);
+  }
+
+  inline CdcEntry& operator=(const CdcEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CdcEntry& operator=(CdcEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CdcEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CdcEntry* internal_default_instance() {
+    return reinterpret_cast<const CdcEntry*>(
+               &_CdcEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    29;
+
+  friend void swap(CdcEntry& a, CdcEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CdcEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CdcEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CdcEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CdcEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CdcEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CdcEntry& from) {
+    CdcEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CdcEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.CdcEntry";
+  }
+  protected:
+  explicit CdcEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBatchFieldNumber = 10,
+    kOperationFieldNumber = 3,
+    kKeyFieldNumber = 4,
+    kValueFieldNumber = 5,
+    kClientIdFieldNumber = 6,
+    kCommandFieldNumber = 11,
+    kIndexFieldNumber = 1,
+    kTermFieldNumber = 2,
+    kTimestampMsFieldNumber = 8,
+    kTtlMsFieldNumber = 9,
+    kRequestIdFieldNumber = 7,
+  };
+  // repeated .raftKVRpcProctoc.WriteOp Batch = 10;
+  int batch_size() const;
+  private:
+  int _internal_batch_size() const;
+  public:
+  void clear_batch();
+  ::raftKVRpcProctoc::WriteOp* mutable_batch(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::WriteOp >*
+      mutable_batch();
+  private:
+  const ::raftKVRpcProctoc::WriteOp& _internal_batch(int index) const;
+  ::raftKVRpcProctoc::WriteOp* _internal_add_batch();
+  public:
+  const ::raftKVRpcProctoc::WriteOp& batch(int index) const;
+  ::raftKVRpcProctoc::WriteOp* add_batch();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::WriteOp >&
+      batch() const;
+
+  // bytes Operation = 3;
+  void clear_operation();
+  const std::string& operation() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_operation(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_operation();
+  PROTOBUF_NODISCARD std::string* release_operation();
+  void set_allocated_operation(std::string* operation);
+  private:
+  const std::string& _internal_operation() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_operation(const std::string& value);
+  std::string* _internal_mutable_operation();
+  public:
+
+  // bytes Key = 4;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // bytes Value = 5;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // bytes ClientId = 6;
+  void clear_clientid();
+  const std::string& clientid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_clientid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_clientid();
+  PROTOBUF_NODISCARD std::string* release_clientid();
+  void set_allocated_clientid(std::string* clientid);
+  private:
+  const std::string& _internal_clientid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_clientid(const std::string& value);
+  std::string* _internal_mutable_clientid();
+  public:
+
+  // bytes Command = 11;
+  void clear_command();
+  const std::string& command() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_command(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_command();
+  PROTOBUF_NODISCARD std::string* release_command();
+  void set_allocated_command(std::string* command);
+  private:
+  const std::string& _internal_command() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_command(const std::string& value);
+  std::string* _internal_mutable_command();
+  public:
+
+  // int64 Index = 1;
+  void clear_index();
+  int64_t index() const;
+  void set_index(int64_t value);
+  private:
+  int64_t _internal_index() const;
+  void _internal_set_index(int64_t value);
+  public:
+
+  // int64 Term = 2;
+  void clear_term();
+  int64_t term() const;
+  void set_term(int64_t value);
+  private:
+  int64_t _internal_term() const;
+  void _internal_set_term(int64_t value);
+  public:
+
+  // int64 TimestampMs = 8;
+  void clear_timestampms();
+  int64_t timestampms() const;
+  void set_timestampms(int64_t value);
+  private:
+  int64_t _internal_timestampms() const;
+  void _internal_set_timestampms(int64_t value);
+  public:
+
+  // int64 TtlMs = 9;
+  void clear_ttlms();
+  int64_t ttlms() const;
+  void set_ttlms(int64_t value);
+  private:
+  int64_t _internal_ttlms() const;
+  void _internal_set_ttlms(int64_t value);
+  public:
+
+  // int32 RequestId = 7;
+  void clear_requestid();
+  int32_t requestid() const;
+  void set_requestid(int32_t value);
+  private:
+  int32_t _internal_requestid() const;
+  void _internal_set_requestid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.CdcEntry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::WriteOp > batch_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr operation_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clientid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr command_;
+    int64_t index_;
+    int64_t term_;
+    int64_t timestampms_;
+    int64_t ttlms_;
+    int32_t requestid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ExportLogArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.ExportLogArgs) */ {
+ public:
+  inline ExportLogArgs() : ExportLogArgs(nullptr) {}
+  ~ExportLogArgs() override;
+  explicit PROTOBUF_CONSTEXPR ExportLogArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ExportLogArgs(const ExportLogArgs& from);
+  ExportLogArgs(ExportLogArgs&& from) noexcept
+    : ExportLogArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline ExportLogArgs& operator=(const ExportLogArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ExportLogArgs& operator=(ExportLogArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ExportLogArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ExportLogArgs* internal_default_instance() {
+    return reinterpret_cast<const ExportLogArgs*>(
+               &_ExportLogArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    30;
+
+  friend void swap(ExportLogArgs& a, ExportLogArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ExportLogArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ExportLogArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ExportLogArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ExportLogArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ExportLogArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ExportLogArgs& from) {
+    ExportLogArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ExportLogArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.ExportLogArgs";
+  }
+  protected:
+  explicit ExportLogArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kConsumerIdFieldNumber = 1,
+    kSnapshotResumeKeyFieldNumber = 6,
+    kFromIndexFieldNumber = 2,
+    kMaxEntriesFieldNumber = 3,
+    kIncludeReadsFieldNumber = 4,
+    kSnapshotIndexFieldNumber = 5,
+  };
+  // bytes ConsumerId = 1;
+  void clear_consumerid();
+  const std::string& consumerid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_consumerid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_consumerid();
+  PROTOBUF_NODISCARD std::string* release_consumerid();
+  void set_allocated_consumerid(std::string* consumerid);
+  private:
+  const std::string& _internal_consumerid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_consumerid(const std::string& value);
+  std::string* _internal_mutable_consumerid();
+  public:
+
+  // bytes SnapshotResumeKey = 6;
+  void clear_snapshotresumekey();
+  const std::string& snapshotresumekey() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_snapshotresumekey(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_snapshotresumekey();
+  PROTOBUF_NODISCARD std::string* release_snapshotresumekey();
+  void set_allocated_snapshotresumekey(std::string* snapshotresumekey);
+  private:
+  const std::string& _internal_snapshotresumekey() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_snapshotresumekey(const std::string& value);
+  std::string* _internal_mutable_snapshotresumekey();
+  public:
+
+  // int64 FromIndex = 2;
+  void clear_fromindex();
+  int64_t fromindex() const;
+  void set_fromindex(int64_t value);
+  private:
+  int64_t _internal_fromindex() const;
+  void _internal_set_fromindex(int64_t value);
+  public:
+
+  // int32 MaxEntries = 3;
+  void clear_maxentries();
+  int32_t maxentries() const;
+  void set_maxentries(int32_t value);
+  private:
+  int32_t _internal_maxentries() const;
+  void _internal_set_maxentries(int32_t value);
+  public:
+
+  // bool IncludeReads = 4;
+  void clear_includereads();
+  bool includereads() const;
+  void set_includereads(bool value);
+  private:
+  bool _internal_includereads() const;
+  void _internal_set_includereads(bool value);
+  public:
+
+  // int64 SnapshotIndex = 5;
+  void clear_snapshotindex();
+  int64_t snapshotindex() const;
+  void set_snapshotindex(int64_t value);
+  private:
+  int64_t _internal_snapshotindex() const;
+  void _internal_set_snapshotindex(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.ExportLogArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr consumerid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr snapshotresumekey_;
+    int64_t fromindex_;
+    int32_t maxentries_;
+    bool includereads_;
+    int64_t snapshotindex_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ExportLogReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.ExportLogReply) */ {
+ public:
+  inline ExportLogReply() : ExportLogReply(nullptr) {}
+  ~ExportLogReply() override;
+  explicit PROTOBUF_CONSTEXPR ExportLogReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ExportLogReply(const ExportLogReply& from);
+  ExportLogReply(ExportLogReply&& from) noexcept
+    : ExportLogReply() {
+    *this = ::std::move(from);
+  }
+
+  inline ExportLogReply& operator=(const ExportLogReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ExportLogReply& operator=(ExportLogReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ExportLogReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ExportLogReply* internal_default_instance() {
+    return reinterpret_cast<const ExportLogReply*>(
+               &_ExportLogReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    31;
+
+  friend void swap(ExportLogReply& a, ExportLogReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ExportLogReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ExportLogReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ExportLogReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ExportLogReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ExportLogReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ExportLogReply& from) {
+    ExportLogReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ExportLogReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.ExportLogReply";
+  }
+  protected:
+  explicit ExportLogReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntriesFieldNumber = 2,
+    kSnapshotKvsFieldNumber = 5,
+    kErrFieldNumber = 1,
+    kSnapshotResumeKeyFieldNumber = 6,
+    kNextIndexFieldNumber = 3,
+    kSnapshotIndexFieldNumber = 4,
+  };
+  // repeated .raftKVRpcProctoc.CdcEntry Entries = 2;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::raftKVRpcProctoc::CdcEntry* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::CdcEntry >*
+      mutable_entries();
+  private:
+  const ::raftKVRpcProctoc::CdcEntry& _internal_entries(int index) const;
+  ::raftKVRpcProctoc::CdcEntry* _internal_add_entries();
+  public:
+  const ::raftKVRpcProctoc::CdcEntry& entries(int index) const;
+  ::raftKVRpcProctoc::CdcEntry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::CdcEntry >&
+      entries() const;
+
+  // repeated .raftKVRpcProctoc.KeyValue SnapshotKvs = 5;
+  int snapshotkvs_size() const;
+  private:
+  int _internal_snapshotkvs_size() const;
+  public:
+  void clear_snapshotkvs();
+  ::raftKVRpcProctoc::KeyValue* mutable_snapshotkvs(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::KeyValue >*
+      mutable_snapshotkvs();
+  private:
+  const ::raftKVRpcProctoc::KeyValue& _internal_snapshotkvs(int index) const;
+  ::raftKVRpcProctoc::KeyValue* _internal_add_snapshotkvs();
+  public:
+  const ::raftKVRpcProctoc::KeyValue& snapshotkvs(int index) const;
+  ::raftKVRpcProctoc::KeyValue* add_snapshotkvs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::KeyValue >&
+      snapshotkvs() const;
+
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // bytes SnapshotResumeKey = 6;
+  void clear_snapshotresumekey();
+  const std::string& snapshotresumekey() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_snapshotresumekey(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_snapshotresumekey();
+  PROTOBUF_NODISCARD std::string* release_snapshotresumekey();
+  void set_allocated_snapshotresumekey(std::string* snapshotresumekey);
+  private:
+  const std::string& _internal_snapshotresumekey() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_snapshotresumekey(const std::string& value);
+  std::string* _internal_mutable_snapshotresumekey();
+  public:
+
+  // int64 NextIndex = 3;
+  void clear_nextindex();
+  int64_t nextindex() const;
+  void set_nextindex(int64_t value);
+  private:
+  int64_t _internal_nextindex() const;
+  void _internal_set_nextindex(int64_t value);
+  public:
+
+  // int64 SnapshotIndex = 4;
+  void clear_snapshotindex();
+  int64_t snapshotindex() const;
+  void set_snapshotindex(int64_t value);
+  private:
+  int64_t _internal_snapshotindex() const;
+  void _internal_set_snapshotindex(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.ExportLogReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::CdcEntry > entries_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::KeyValue > snapshotkvs_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr snapshotresumekey_;
+    int64_t nextindex_;
+    int64_t snapshotindex_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CommitCdcCheckpointArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.CommitCdcCheckpointArgs) */ {
+ public:
+  inline CommitCdcCheckpointArgs() : CommitCdcCheckpointArgs(nullptr) {}
+  ~CommitCdcCheckpointArgs() override;
+  explicit PROTOBUF_CONSTEXPR CommitCdcCheckpointArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CommitCdcCheckpointArgs(const CommitCdcCheckpointArgs& from);
+  CommitCdcCheckpointArgs(CommitCdcCheckpointArgs&& from) noexcept
+    : CommitCdcCheckpointArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline CommitCdcCheckpointArgs& operator=(const CommitCdcCheckpointArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CommitCdcCheckpointArgs& operator=(CommitCdcCheckpointArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CommitCdcCheckpointArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CommitCdcCheckpointArgs* internal_default_instance() {
+    return reinterpret_cast<const CommitCdcCheckpointArgs*>(
+               &_CommitCdcCheckpointArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    32;
+
+  friend void swap(CommitCdcCheckpointArgs& a, CommitCdcCheckpointArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CommitCdcCheckpointArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CommitCdcCheckpointArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CommitCdcCheckpointArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CommitCdcCheckpointArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CommitCdcCheckpointArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CommitCdcCheckpointArgs& from) {
+    CommitCdcCheckpointArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CommitCdcCheckpointArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.CommitCdcCheckpointArgs";
+  }
+  protected:
+  explicit CommitCdcCheckpointArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kConsumerIdFieldNumber = 1,
+    kClientIdFieldNumber = 3,
+    kIndexFieldNumber = 2,
+    kRequestIdFieldNumber = 4,
+  };
+  // bytes ConsumerId = 1;
+  void clear_consumerid();
+  const std::string& consumerid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_consumerid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_consumerid();
+  PROTOBUF_NODISCARD std::string* release_consumerid();
+  void set_allocated_consumerid(std::string* consumerid);
+  private:
+  const std::string& _internal_consumerid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_consumerid(const std::string& value);
+  std::string* _internal_mutable_consumerid();
+  public:
+
+  // bytes ClientId = 3;
+  void clear_clientid();
+  const std::string& clientid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_clientid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_clientid();
+  PROTOBUF_NODISCARD std::string* release_clientid();
+  void set_allocated_clientid(std::string* clientid);
+  private:
+  const std::string& _internal_clientid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_clientid(const std::string& value);
+  std::string* _internal_mutable_clientid();
+  public:
+
+  // int64 Index = 2;
+  void clear_index();
+  int64_t index() const;
+  void set_index(int64_t value);
+  private:
+  int64_t _internal_index() const;
+  void _internal_set_index(int64_t value);
+  public:
+
+  // int32 RequestId = 4;
+  void clear_requestid();
+  int32_t requestid() const;
+  void set_requestid(int32_t value);
+  private:
+  int32_t _internal_requestid() const;
+  void _internal_set_requestid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.CommitCdcCheckpointArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr consumerid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clientid_;
+    int64_t index_;
+    int32_t requestid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CommitCdcCheckpointReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.CommitCdcCheckpointReply) */ {
+ public:
+  inline CommitCdcCheckpointReply() : CommitCdcCheckpointReply(nullptr) {}
+  ~CommitCdcCheckpointReply() override;
+  explicit PROTOBUF_CONSTEXPR CommitCdcCheckpointReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CommitCdcCheckpointReply(const CommitCdcCheckpointReply& from);
+  CommitCdcCheckpointReply(CommitCdcCheckpointReply&& from) noexcept
+    : CommitCdcCheckpointReply() {
+    *this = ::std::move(from);
+  }
+
+  inline CommitCdcCheckpointReply& operator=(const CommitCdcCheckpointReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CommitCdcCheckpointReply& operator=(CommitCdcCheckpointReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CommitCdcCheckpointReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CommitCdcCheckpointReply* internal_default_instance() {
+    return reinterpret_cast<const CommitCdcCheckpointReply*>(
+               &_CommitCdcCheckpointReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    33;
+
+  friend void swap(CommitCdcCheckpointReply& a, CommitCdcCheckpointReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CommitCdcCheckpointReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CommitCdcCheckpointReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CommitCdcCheckpointReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CommitCdcCheckpointReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CommitCdcCheckpointReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CommitCdcCheckpointReply& from) {
+    CommitCdcCheckpointReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CommitCdcCheckpointReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.CommitCdcCheckpointReply";
+  }
+  protected:
+  explicit CommitCdcCheckpointReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrFieldNumber = 1,
+    kIndexFieldNumber = 2,
+    kRetryAfterMsFieldNumber = 3,
+  };
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // int64 Index = 2;
+  void clear_index();
+  int64_t index() const;
+  void set_index(int64_t value);
+  private:
+  int64_t _internal_index() const;
+  void _internal_set_index(int64_t value);
+  public:
+
+  // int64 RetryAfterMs = 3;
+  void clear_retryafterms();
+  int64_t retryafterms() const;
+  void set_retryafterms(int64_t value);
+  private:
+  int64_t _internal_retryafterms() const;
+  void _internal_set_retryafterms(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.CommitCdcCheckpointReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    int64_t index_;
+    int64_t retryafterms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// ===================================================================
+
+class kvServerRpc_Stub;
+
+class kvServerRpc : public ::PROTOBUF_NAMESPACE_ID::Service {
+ protected:
+  // This class should be treated as an abstract interface.
+  inline kvServerRpc() {};
+ public:
+  virtual ~kvServerRpc();
+
+  typedef kvServerRpc_Stub Stub;
+
+  static const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* descriptor();
+
+  virtual void PutAppend(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::PutAppendArgs* request,
+                       ::raftKVRpcProctoc::PutAppendReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void Get(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::GetArgs* request,
+                       ::raftKVRpcProctoc::GetReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void Scan(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::ScanArgs* request,
+                       ::raftKVRpcProctoc::ScanReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void PrefixScan(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::PrefixScanArgs* request,
+                       ::raftKVRpcProctoc::ScanReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void MultiGet(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::MultiGetArgs* request,
+                       ::raftKVRpcProctoc::MultiGetReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void BatchWrite(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::BatchWriteArgs* request,
+                       ::raftKVRpcProctoc::BatchWriteReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void Txn(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::TxnArgs* request,
+                       ::raftKVRpcProctoc::TxnReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void Delete(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::DeleteArgs* request,
+                       ::raftKVRpcProctoc::DeleteReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void DeleteRange(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::DeleteRangeArgs* request,
+                       ::raftKVRpcProctoc::DeleteReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void Watch(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::WatchArgs* request,
+                       ::raftKVRpcProctoc::WatchReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void CancelWatch(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::CancelWatchArgs* request,
+                       ::raftKVRpcProctoc::CancelWatchReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void RegisterSession(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::RegisterSessionArgs* request,
+                       ::raftKVRpcProctoc::RegisterSessionReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void ExportLog(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::ExportLogArgs* request,
+                       ::raftKVRpcProctoc::ExportLogReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void CommitCdcCheckpoint(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::CommitCdcCheckpointArgs* request,
+                       ::raftKVRpcProctoc::CommitCdcCheckpointReply* response,
+                       ::google::protobuf::Closure* done);
+
+  // implements Service ----------------------------------------------
+
+  const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* GetDescriptor();
+  void CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
+                  ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                  const ::PROTOBUF_NAMESPACE_ID::Message* request,
+                  ::PROTOBUF_NAMESPACE_ID::Message* response,
+                  ::google::protobuf::Closure* done);
+  const ::PROTOBUF_NAMESPACE_ID::Message& GetRequestPrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+  const ::PROTOBUF_NAMESPACE_ID::Message& GetResponsePrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+
+ private:
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(kvServerRpc);
+};
+
+class kvServerRpc_Stub : public kvServerRpc {
+ public:
+  kvServerRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel);
+  kvServerRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel,
+                   ::PROTOBUF_NAMESPACE_ID::Service::ChannelOwnership ownership);
+  ~kvServerRpc_Stub();
+
+  inline ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel() { return channel_; }
+
+  // implements kvServerRpc ------------------------------------------
+
+  void PutAppend(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::PutAppendArgs* request,
+                       ::raftKVRpcProctoc::PutAppendReply* response,
+                       ::google::protobuf::Closure* done);
+  void Get(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::GetArgs* request,
+                       ::raftKVRpcProctoc::GetReply* response,
+                       ::google::protobuf::Closure* done);
+  void Scan(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::ScanArgs* request,
+                       ::raftKVRpcProctoc::ScanReply* response,
+                       ::google::protobuf::Closure* done);
+  void PrefixScan(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::PrefixScanArgs* request,
+                       ::raftKVRpcProctoc::ScanReply* response,
+                       ::google::protobuf::Closure* done);
+  void MultiGet(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::MultiGetArgs* request,
+                       ::raftKVRpcProctoc::MultiGetReply* response,
+                       ::google::protobuf::Closure* done);
+  void BatchWrite(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::BatchWriteArgs* request,
+                       ::raftKVRpcProctoc::BatchWriteReply* response,
+                       ::google::protobuf::Closure* done);
+  void Txn(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::TxnArgs* request,
+                       ::raftKVRpcProctoc::TxnReply* response,
+                       ::google::protobuf::Closure* done);
+  void Delete(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::DeleteArgs* request,
+                       ::raftKVRpcProctoc::DeleteReply* response,
+                       ::google::protobuf::Closure* done);
+  void DeleteRange(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::DeleteRangeArgs* request,
+                       ::raftKVRpcProctoc::DeleteReply* response,
+                       ::google::protobuf::Closure* done);
+  void Watch(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::WatchArgs* request,
+                       ::raftKVRpcProctoc::WatchReply* response,
+                       ::google::protobuf::Closure* done);
+  void CancelWatch(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::CancelWatchArgs* request,
+                       ::raftKVRpcProctoc::CancelWatchReply* response,
+                       ::google::protobuf::Closure* done);
+  void RegisterSession(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::RegisterSessionArgs* request,
+                       ::raftKVRpcProctoc::RegisterSessionReply* response,
+                       ::google::protobuf::Closure* done);
+  void ExportLog(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::ExportLogArgs* request,
+                       ::raftKVRpcProctoc::ExportLogReply* response,
+                       ::google::protobuf::Closure* done);
+  void CommitCdcCheckpoint(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::CommitCdcCheckpointArgs* request,
+                       ::raftKVRpcProctoc::CommitCdcCheckpointReply* response,
+                       ::google::protobuf::Closure* done);
+ private:
+  ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel_;
+  bool owns_channel_;
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(kvServerRpc_Stub);
+};
+
+
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// GetArgs
+
+// bytes Key = 1;
+inline void GetArgs::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& GetArgs::key() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetArgs.Key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetArgs::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetArgs.Key)
+}
+inline std::string* GetArgs::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.GetArgs.Key)
+  return _s;
+}
+inline const std::string& GetArgs::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void GetArgs::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetArgs::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetArgs::release_key() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.GetArgs.Key)
+  return _impl_.key_.Release();
+}
+inline void GetArgs::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.GetArgs.Key)
+}
+
+// bytes ClientId = 2;
+inline void GetArgs::clear_clientid() {
+  _impl_.clientid_.ClearToEmpty();
+}
+inline const std::string& GetArgs::clientid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetArgs.ClientId)
+  return _internal_clientid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetArgs::set_clientid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.clientid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetArgs.ClientId)
+}
+inline std::string* GetArgs::mutable_clientid() {
+  std::string* _s = _internal_mutable_clientid();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.GetArgs.ClientId)
+  return _s;
+}
+inline const std::string& GetArgs::_internal_clientid() const {
+  return _impl_.clientid_.Get();
+}
+inline void GetArgs::_internal_set_clientid(const std::string& value) {
+  
+  _impl_.clientid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetArgs::_internal_mutable_clientid() {
+  
+  return _impl_.clientid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetArgs::release_clientid() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.GetArgs.ClientId)
+  return _impl_.clientid_.Release();
+}
+inline void GetArgs::set_allocated_clientid(std::string* clientid) {
+  if (clientid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.clientid_.SetAllocated(clientid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.clientid_.IsDefault()) {
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.GetArgs.ClientId)
+}
+
+// int32 RequestId = 3;
+inline void GetArgs::clear_requestid() {
+  _impl_.requestid_ = 0;
+}
+inline int32_t GetArgs::_internal_requestid() const {
+  return _impl_.requestid_;
+}
+inline int32_t GetArgs::requestid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetArgs.RequestId)
+  return _internal_requestid();
+}
+inline void GetArgs::_internal_set_requestid(int32_t value) {
+  
+  _impl_.requestid_ = value;
+}
+inline void GetArgs::set_requestid(int32_t value) {
+  _internal_set_requestid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetArgs.RequestId)
+}
+
+// -------------------------------------------------------------------
+
+// GetReply
+
+// bytes Err = 1;
+inline void GetReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
+}
+inline const std::string& GetReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetReply.Err)
+  return _internal_err();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetReply.Err)
+}
+inline std::string* GetReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.GetReply.Err)
+  return _s;
+}
+inline const std::string& GetReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void GetReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.GetReply.Err)
+  return _impl_.err_.Release();
+}
+inline void GetReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.GetReply.Err)
+}
+
+// bytes Value = 2;
+inline void GetReply::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& GetReply::value() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetReply.Value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetReply::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetReply.Value)
+}
+inline std::string* GetReply::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.GetReply.Value)
+  return _s;
+}
+inline const std::string& GetReply::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void GetReply::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetReply::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetReply::release_value() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.GetReply.Value)
+  return _impl_.value_.Release();
+}
+inline void GetReply::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.GetReply.Value)
+}
+
+// int64 RetryAfterMs = 3;
+inline void GetReply::clear_retryafterms() {
+  _impl_.retryafterms_ = int64_t{0};
+}
+inline int64_t GetReply::_internal_retryafterms() const {
+  return _impl_.retryafterms_;
+}
+inline int64_t GetReply::retryafterms() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetReply.RetryAfterMs)
+  return _internal_retryafterms();
+}
+inline void GetReply::_internal_set_retryafterms(int64_t value) {
+  
+  _impl_.retryafterms_ = value;
+}
+inline void GetReply::set_retryafterms(int64_t value) {
+  _internal_set_retryafterms(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetReply.RetryAfterMs)
+}
+
+// -------------------------------------------------------------------
+
+// PutAppendArgs
+
+// bytes Key = 1;
+inline void PutAppendArgs::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& PutAppendArgs::key() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.Key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutAppendArgs::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.Key)
+}
+inline std::string* PutAppendArgs::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendArgs.Key)
+  return _s;
+}
+inline const std::string& PutAppendArgs::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void PutAppendArgs::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutAppendArgs::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutAppendArgs::release_key() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendArgs.Key)
+  return _impl_.key_.Release();
+}
+inline void PutAppendArgs::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendArgs.Key)
+}
+
+// bytes Value = 2;
+inline void PutAppendArgs::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& PutAppendArgs::value() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.Value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutAppendArgs::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.Value)
+}
+inline std::string* PutAppendArgs::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendArgs.Value)
+  return _s;
+}
+inline const std::string& PutAppendArgs::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void PutAppendArgs::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutAppendArgs::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutAppendArgs::release_value() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendArgs.Value)
+  return _impl_.value_.Release();
+}
+inline void PutAppendArgs::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendArgs.Value)
+}
+
+// bytes Op = 3;
+inline void PutAppendArgs::clear_op() {
+  _impl_.op_.ClearToEmpty();
+}
+inline const std::string& PutAppendArgs::op() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.Op)
+  return _internal_op();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutAppendArgs::set_op(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.op_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.Op)
+}
+inline std::string* PutAppendArgs::mutable_op() {
+  std::string* _s = _internal_mutable_op();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendArgs.Op)
+  return _s;
+}
+inline const std::string& PutAppendArgs::_internal_op() const {
+  return _impl_.op_.Get();
+}
+inline void PutAppendArgs::_internal_set_op(const std::string& value) {
+  
+  _impl_.op_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutAppendArgs::_internal_mutable_op() {
+  
+  return _impl_.op_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutAppendArgs::release_op() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendArgs.Op)
+  return _impl_.op_.Release();
+}
+inline void PutAppendArgs::set_allocated_op(std::string* op) {
+  if (op != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.op_.SetAllocated(op, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.op_.IsDefault()) {
+    _impl_.op_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendArgs.Op)
+}
+
+// bytes ClientId = 4;
+inline void PutAppendArgs::clear_clientid() {
+  _impl_.clientid_.ClearToEmpty();
+}
+inline const std::string& PutAppendArgs::clientid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.ClientId)
+  return _internal_clientid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutAppendArgs::set_clientid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.clientid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.ClientId)
+}
+inline std::string* PutAppendArgs::mutable_clientid() {
+  std::string* _s = _internal_mutable_clientid();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendArgs.ClientId)
+  return _s;
+}
+inline const std::string& PutAppendArgs::_internal_clientid() const {
+  return _impl_.clientid_.Get();
+}
+inline void PutAppendArgs::_internal_set_clientid(const std::string& value) {
+  
+  _impl_.clientid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutAppendArgs::_internal_mutable_clientid() {
+  
+  return _impl_.clientid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutAppendArgs::release_clientid() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendArgs.ClientId)
+  return _impl_.clientid_.Release();
+}
+inline void PutAppendArgs::set_allocated_clientid(std::string* clientid) {
+  if (clientid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.clientid_.SetAllocated(clientid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.clientid_.IsDefault()) {
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendArgs.ClientId)
+}
+
+// int32 RequestId = 5;
+inline void PutAppendArgs::clear_requestid() {
+  _impl_.requestid_ = 0;
+}
+inline int32_t PutAppendArgs::_internal_requestid() const {
+  return _impl_.requestid_;
+}
+inline int32_t PutAppendArgs::requestid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.RequestId)
+  return _internal_requestid();
+}
+inline void PutAppendArgs::_internal_set_requestid(int32_t value) {
+  
+  _impl_.requestid_ = value;
+}
+inline void PutAppendArgs::set_requestid(int32_t value) {
+  _internal_set_requestid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.RequestId)
+}
+
+// int64 TtlMs = 6;
+inline void PutAppendArgs::clear_ttlms() {
+  _impl_.ttlms_ = int64_t{0};
+}
+inline int64_t PutAppendArgs::_internal_ttlms() const {
+  return _impl_.ttlms_;
+}
+inline int64_t PutAppendArgs::ttlms() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.TtlMs)
+  return _internal_ttlms();
+}
+inline void PutAppendArgs::_internal_set_ttlms(int64_t value) {
+  
+  _impl_.ttlms_ = value;
+}
+inline void PutAppendArgs::set_ttlms(int64_t value) {
+  _internal_set_ttlms(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.TtlMs)
+}
+
+// -------------------------------------------------------------------
+
+// PutAppendReply
+
+// bytes Err = 1;
+inline void PutAppendReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
+}
+inline const std::string& PutAppendReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendReply.Err)
+  return _internal_err();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutAppendReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendReply.Err)
+}
+inline std::string* PutAppendReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendReply.Err)
+  return _s;
+}
+inline const std::string& PutAppendReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void PutAppendReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutAppendReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutAppendReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendReply.Err)
+  return _impl_.err_.Release();
+}
+inline void PutAppendReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendReply.Err)
+}
+
+// int64 RetryAfterMs = 2;
+inline void PutAppendReply::clear_retryafterms() {
+  _impl_.retryafterms_ = int64_t{0};
+}
+inline int64_t PutAppendReply::_internal_retryafterms() const {
+  return _impl_.retryafterms_;
+}
+inline int64_t PutAppendReply::retryafterms() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendReply.RetryAfterMs)
+  return _internal_retryafterms();
+}
+inline void PutAppendReply::_internal_set_retryafterms(int64_t value) {
+  
+  _impl_.retryafterms_ = value;
+}
+inline void PutAppendReply::set_retryafterms(int64_t value) {
+  _internal_set_retryafterms(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendReply.RetryAfterMs)
+}
+
+// -------------------------------------------------------------------
+
+// ScanArgs
+
+// bytes StartKey = 1;
+inline void ScanArgs::clear_startkey() {
+  _impl_.startkey_.ClearToEmpty();
+}
+inline const std::string& ScanArgs::startkey() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanArgs.StartKey)
+  return _internal_startkey();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScanArgs::set_startkey(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.startkey_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanArgs.StartKey)
+}
+inline std::string* ScanArgs::mutable_startkey() {
+  std::string* _s = _internal_mutable_startkey();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.ScanArgs.StartKey)
+  return _s;
+}
+inline const std::string& ScanArgs::_internal_startkey() const {
+  return _impl_.startkey_.Get();
+}
+inline void ScanArgs::_internal_set_startkey(const std::string& value) {
+  
+  _impl_.startkey_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ScanArgs::_internal_mutable_startkey() {
+  
+  return _impl_.startkey_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScanArgs::release_startkey() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.ScanArgs.StartKey)
+  return _impl_.startkey_.Release();
+}
+inline void ScanArgs::set_allocated_startkey(std::string* startkey) {
+  if (startkey != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.startkey_.SetAllocated(startkey, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.startkey_.IsDefault()) {
+    _impl_.startkey_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.ScanArgs.StartKey)
+}
+
+// bytes EndKey = 2;
+inline void ScanArgs::clear_endkey() {
+  _impl_.endkey_.ClearToEmpty();
+}
+inline const std::string& ScanArgs::endkey() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanArgs.EndKey)
+  return _internal_endkey();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScanArgs::set_endkey(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.endkey_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanArgs.EndKey)
+}
+inline std::string* ScanArgs::mutable_endkey() {
+  std::string* _s = _internal_mutable_endkey();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.ScanArgs.EndKey)
+  return _s;
+}
+inline const std::string& ScanArgs::_internal_endkey() const {
+  return _impl_.endkey_.Get();
+}
+inline void ScanArgs::_internal_set_endkey(const std::string& value) {
+  
+  _impl_.endkey_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ScanArgs::_internal_mutable_endkey() {
+  
+  return _impl_.endkey_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScanArgs::release_endkey() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.ScanArgs.EndKey)
+  return _impl_.endkey_.Release();
+}
+inline void ScanArgs::set_allocated_endkey(std::string* endkey) {
+  if (endkey != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.endkey_.SetAllocated(endkey, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.endkey_.IsDefault()) {
+    _impl_.endkey_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.ScanArgs.EndKey)
+}
+
+// int32 Limit = 3;
+inline void ScanArgs::clear_limit() {
+  _impl_.limit_ = 0;
+}
+inline int32_t ScanArgs::_internal_limit() const {
+  return _impl_.limit_;
+}
+inline int32_t ScanArgs::limit() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanArgs.Limit)
+  return _internal_limit();
+}
+inline void ScanArgs::_internal_set_limit(int32_t value) {
+  
+  _impl_.limit_ = value;
+}
+inline void ScanArgs::set_limit(int32_t value) {
+  _internal_set_limit(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanArgs.Limit)
+}
+
+// bytes PageToken = 4;
+inline void ScanArgs::clear_pagetoken() {
+  _impl_.pagetoken_.ClearToEmpty();
+}
+inline const std::string& ScanArgs::pagetoken() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanArgs.PageToken)
+  return _internal_pagetoken();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScanArgs::set_pagetoken(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.pagetoken_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanArgs.PageToken)
+}
+inline std::string* ScanArgs::mutable_pagetoken() {
+  std::string* _s = _internal_mutable_pagetoken();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.ScanArgs.PageToken)
+  return _s;
+}
+inline const std::string& ScanArgs::_internal_pagetoken() const {
+  return _impl_.pagetoken_.Get();
+}
+inline void ScanArgs::_internal_set_pagetoken(const std::string& value) {
+  
+  _impl_.pagetoken_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ScanArgs::_internal_mutable_pagetoken() {
+  
+  return _impl_.pagetoken_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScanArgs::release_pagetoken() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.ScanArgs.PageToken)
+  return _impl_.pagetoken_.Release();
+}
+inline void ScanArgs::set_allocated_pagetoken(std::string* pagetoken) {
+  if (pagetoken != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.pagetoken_.SetAllocated(pagetoken, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.pagetoken_.IsDefault()) {
+    _impl_.pagetoken_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.ScanArgs.PageToken)
+}
+
+// bytes ClientId = 5;
+inline void ScanArgs::clear_clientid() {
+  _impl_.clientid_.ClearToEmpty();
+}
+inline const std::string& ScanArgs::clientid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanArgs.ClientId)
+  return _internal_clientid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScanArgs::set_clientid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.clientid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanArgs.ClientId)
+}
+inline std::string* ScanArgs::mutable_clientid() {
+  std::string* _s = _internal_mutable_clientid();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.ScanArgs.ClientId)
+  return _s;
+}
+inline const std::string& ScanArgs::_internal_clientid() const {
+  return _impl_.clientid_.Get();
+}
+inline void ScanArgs::_internal_set_clientid(const std::string& value) {
+  
+  _impl_.clientid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ScanArgs::_internal_mutable_clientid() {
+  
+  return _impl_.clientid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScanArgs::release_clientid() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.ScanArgs.ClientId)
+  return _impl_.clientid_.Release();
+}
+inline void ScanArgs::set_allocated_clientid(std::string* clientid) {
+  if (clientid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.clientid_.SetAllocated(clientid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.clientid_.IsDefault()) {
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.ScanArgs.ClientId)
+}
+
+// int32 RequestId = 6;
+inline void ScanArgs::clear_requestid() {
+  _impl_.requestid_ = 0;
+}
+inline int32_t ScanArgs::_internal_requestid() const {
+  return _impl_.requestid_;
+}
+inline int32_t ScanArgs::requestid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanArgs.RequestId)
+  return _internal_requestid();
+}
+inline void ScanArgs::_internal_set_requestid(int32_t value) {
+  
+  _impl_.requestid_ = value;
+}
+inline void ScanArgs::set_requestid(int32_t value) {
+  _internal_set_requestid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanArgs.RequestId)
+}
+
+// -------------------------------------------------------------------
+
+// PrefixScanArgs
+
+// bytes Prefix = 1;
+inline void PrefixScanArgs::clear_prefix() {
+  _impl_.prefix_.ClearToEmpty();
+}
+inline const std::string& PrefixScanArgs::prefix() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PrefixScanArgs.Prefix)
+  return _internal_prefix();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PrefixScanArgs::set_prefix(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.prefix_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PrefixScanArgs.Prefix)
+}
+inline std::string* PrefixScanArgs::mutable_prefix() {
+  std::string* _s = _internal_mutable_prefix();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PrefixScanArgs.Prefix)
+  return _s;
+}
+inline const std::string& PrefixScanArgs::_internal_prefix() const {
+  return _impl_.prefix_.Get();
+}
+inline void PrefixScanArgs::_internal_set_prefix(const std::string& value) {
+  
+  _impl_.prefix_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PrefixScanArgs::_internal_mutable_prefix() {
+  
+  return _impl_.prefix_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PrefixScanArgs::release_prefix() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PrefixScanArgs.Prefix)
+  return _impl_.prefix_.Release();
+}
+inline void PrefixScanArgs::set_allocated_prefix(std::string* prefix) {
+  if (prefix != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.prefix_.SetAllocated(prefix, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.prefix_.IsDefault()) {
+    _impl_.prefix_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PrefixScanArgs.Prefix)
+}
+
+// int32 Limit = 2;
+inline void PrefixScanArgs::clear_limit() {
+  _impl_.limit_ = 0;
+}
+inline int32_t PrefixScanArgs::_internal_limit() const {
+  return _impl_.limit_;
+}
+inline int32_t PrefixScanArgs::limit() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PrefixScanArgs.Limit)
+  return _internal_limit();
+}
+inline void PrefixScanArgs::_internal_set_limit(int32_t value) {
+  
+  _impl_.limit_ = value;
+}
+inline void PrefixScanArgs::set_limit(int32_t value) {
+  _internal_set_limit(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PrefixScanArgs.Limit)
+}
+
+// bytes PageToken = 3;
+inline void PrefixScanArgs::clear_pagetoken() {
+  _impl_.pagetoken_.ClearToEmpty();
+}
+inline const std::string& PrefixScanArgs::pagetoken() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PrefixScanArgs.PageToken)
+  return _internal_pagetoken();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PrefixScanArgs::set_pagetoken(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.pagetoken_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PrefixScanArgs.PageToken)
+}
+inline std::string* PrefixScanArgs::mutable_pagetoken() {
+  std::string* _s = _internal_mutable_pagetoken();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PrefixScanArgs.PageToken)
+  return _s;
+}
+inline const std::string& PrefixScanArgs::_internal_pagetoken() const {
+  return _impl_.pagetoken_.Get();
+}
+inline void PrefixScanArgs::_internal_set_pagetoken(const std::string& value) {
+  
+  _impl_.pagetoken_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PrefixScanArgs::_internal_mutable_pagetoken() {
+  
+  return _impl_.pagetoken_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PrefixScanArgs::release_pagetoken() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PrefixScanArgs.PageToken)
+  return _impl_.pagetoken_.Release();
+}
+inline void PrefixScanArgs::set_allocated_pagetoken(std::string* pagetoken) {
+  if (pagetoken != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.pagetoken_.SetAllocated(pagetoken, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.pagetoken_.IsDefault()) {
+    _impl_.pagetoken_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PrefixScanArgs.PageToken)
+}
+
+// bytes ClientId = 4;
+inline void PrefixScanArgs::clear_clientid() {
+  _impl_.clientid_.ClearToEmpty();
+}
+inline const std::string& PrefixScanArgs::clientid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PrefixScanArgs.ClientId)
+  return _internal_clientid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PrefixScanArgs::set_clientid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.clientid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PrefixScanArgs.ClientId)
+}
+inline std::string* PrefixScanArgs::mutable_clientid() {
+  std::string* _s = _internal_mutable_clientid();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PrefixScanArgs.ClientId)
+  return _s;
+}
+inline const std::string& PrefixScanArgs::_internal_clientid() const {
+  return _impl_.clientid_.Get();
+}
+inline void PrefixScanArgs::_internal_set_clientid(const std::string& value) {
+  
+  _impl_.clientid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PrefixScanArgs::_internal_mutable_clientid() {
+  
+  return _impl_.clientid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PrefixScanArgs::release_clientid() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PrefixScanArgs.ClientId)
+  return _impl_.clientid_.Release();
+}
+inline void PrefixScanArgs::set_allocated_clientid(std::string* clientid) {
+  if (clientid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.clientid_.SetAllocated(clientid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.clientid_.IsDefault()) {
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PrefixScanArgs.ClientId)
+}
+
+// int32 RequestId = 5;
+inline void PrefixScanArgs::clear_requestid() {
+  _impl_.requestid_ = 0;
+}
+inline int32_t PrefixScanArgs::_internal_requestid() const {
+  return _impl_.requestid_;
+}
+inline int32_t PrefixScanArgs::requestid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PrefixScanArgs.RequestId)
+  return _internal_requestid();
+}
+inline void PrefixScanArgs::_internal_set_requestid(int32_t value) {
+  
+  _impl_.requestid_ = value;
+}
+inline void PrefixScanArgs::set_requestid(int32_t value) {
+  _internal_set_requestid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PrefixScanArgs.RequestId)
+}
+
+// -------------------------------------------------------------------
+
+// KeyValue
+
+// bytes Key = 1;
+inline void KeyValue::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& KeyValue::key() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.KeyValue.Key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KeyValue::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.KeyValue.Key)
+}
+inline std::string* KeyValue::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.KeyValue.Key)
+  return _s;
+}
+inline const std::string& KeyValue::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void KeyValue::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* KeyValue::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* KeyValue::release_key() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.KeyValue.Key)
+  return _impl_.key_.Release();
+}
+inline void KeyValue::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.KeyValue.Key)
+}
+
+// bytes Value = 2;
+inline void KeyValue::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& KeyValue::value() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.KeyValue.Value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KeyValue::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.KeyValue.Value)
+}
+inline std::string* KeyValue::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.KeyValue.Value)
+  return _s;
+}
+inline const std::string& KeyValue::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void KeyValue::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* KeyValue::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* KeyValue::release_value() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.KeyValue.Value)
+  return _impl_.value_.Release();
+}
+inline void KeyValue::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.KeyValue.Value)
+}
+
+// -------------------------------------------------------------------
+
+// ScanReply
+
+// bytes Err = 1;
+inline void ScanReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
+}
+inline const std::string& ScanReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanReply.Err)
+  return _internal_err();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScanReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanReply.Err)
+}
+inline std::string* ScanReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.ScanReply.Err)
+  return _s;
+}
+inline const std::string& ScanReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void ScanReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ScanReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScanReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.ScanReply.Err)
+  return _impl_.err_.Release();
+}
+inline void ScanReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.ScanReply.Err)
+}
+
+// repeated .raftKVRpcProctoc.KeyValue Kvs = 2;
+inline int ScanReply::_internal_kvs_size() const {
+  return _impl_.kvs_.size();
+}
+inline int ScanReply::kvs_size() const {
+  return _internal_kvs_size();
+}
+inline void ScanReply::clear_kvs() {
+  _impl_.kvs_.Clear();
+}
+inline ::raftKVRpcProctoc::KeyValue* ScanReply::mutable_kvs(int index) {
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.ScanReply.Kvs)
+  return _impl_.kvs_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::KeyValue >*
+ScanReply::mutable_kvs() {
+  // @@protoc_insertion_point(field_mutable_list:raftKVRpcProctoc.ScanReply.Kvs)
+  return &_impl_.kvs_;
+}
+inline const ::raftKVRpcProctoc::KeyValue& ScanReply::_internal_kvs(int index) const {
+  return _impl_.kvs_.Get(index);
+}
+inline const ::raftKVRpcProctoc::KeyValue& ScanReply::kvs(int index) const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanReply.Kvs)
+  return _internal_kvs(index);
+}
+inline ::raftKVRpcProctoc::KeyValue* ScanReply::_internal_add_kvs() {
+  return _impl_.kvs_.Add();
+}
+inline ::raftKVRpcProctoc::KeyValue* ScanReply::add_kvs() {
+  ::raftKVRpcProctoc::KeyValue* _add = _internal_add_kvs();
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.ScanReply.Kvs)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::KeyValue >&
+ScanReply::kvs() const {
+  // @@protoc_insertion_point(field_list:raftKVRpcProctoc.ScanReply.Kvs)
+  return _impl_.kvs_;
+}
+
+// bytes NextPageToken = 3;
+inline void ScanReply::clear_nextpagetoken() {
+  _impl_.nextpagetoken_.ClearToEmpty();
+}
+inline const std::string& ScanReply::nextpagetoken() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanReply.NextPageToken)
+  return _internal_nextpagetoken();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScanReply::set_nextpagetoken(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.nextpagetoken_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanReply.NextPageToken)
+}
+inline std::string* ScanReply::mutable_nextpagetoken() {
+  std::string* _s = _internal_mutable_nextpagetoken();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.ScanReply.NextPageToken)
+  return _s;
+}
+inline const std::string& ScanReply::_internal_nextpagetoken() const {
+  return _impl_.nextpagetoken_.Get();
+}
+inline void ScanReply::_internal_set_nextpagetoken(const std::string& value) {
+  
+  _impl_.nextpagetoken_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ScanReply::_internal_mutable_nextpagetoken() {
+  
+  return _impl_.nextpagetoken_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScanReply::release_nextpagetoken() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.ScanReply.NextPageToken)
+  return _impl_.nextpagetoken_.Release();
+}
+inline void ScanReply::set_allocated_nextpagetoken(std::string* nextpagetoken) {
+  if (nextpagetoken != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.nextpagetoken_.SetAllocated(nextpagetoken, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.nextpagetoken_.IsDefault()) {
+    _impl_.nextpagetoken_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.ScanReply.NextPageToken)
+}
+
+// int64 ReadIndex = 4;
+inline void ScanReply::clear_readindex() {
+  _impl_.readindex_ = int64_t{0};
+}
+inline int64_t ScanReply::_internal_readindex() const {
+  return _impl_.readindex_;
+}
+inline int64_t ScanReply::readindex() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanReply.ReadIndex)
+  return _internal_readindex();
+}
+inline void ScanReply::_internal_set_readindex(int64_t value) {
+  
+  _impl_.readindex_ = value;
+}
+inline void ScanReply::set_readindex(int64_t value) {
+  _internal_set_readindex(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanReply.ReadIndex)
+}
+
+// int64 RetryAfterMs = 5;
+inline void ScanReply::clear_retryafterms() {
+  _impl_.retryafterms_ = int64_t{0};
+}
+inline int64_t ScanReply::_internal_retryafterms() const {
+  return _impl_.retryafterms_;
+}
+inline int64_t ScanReply::retryafterms() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanReply.RetryAfterMs)
+  return _internal_retryafterms();
+}
+inline void ScanReply::_internal_set_retryafterms(int64_t value) {
+  
+  _impl_.retryafterms_ = value;
+}
+inline void ScanReply::set_retryafterms(int64_t value) {
+  _internal_set_retryafterms(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanReply.RetryAfterMs)
+}
+
+// -------------------------------------------------------------------
+
+// MultiGetArgs
+
+// repeated bytes Keys = 1;
+inline int MultiGetArgs::_internal_keys_size() const {
+  return _impl_.keys_.size();
+}
+inline int MultiGetArgs::keys_size() const {
+  return _internal_keys_size();
+}
+inline void MultiGetArgs::clear_keys() {
+  _impl_.keys_.Clear();
+}
+inline std::string* MultiGetArgs::add_keys() {
+  std::string* _s = _internal_add_keys();
+  // @@protoc_insertion_point(field_add_mutable:raftKVRpcProctoc.MultiGetArgs.Keys)
+  return _s;
+}
+inline const std::string& MultiGetArgs::_internal_keys(int index) const {
+  return _impl_.keys_.Get(index);
+}
+inline const std::string& MultiGetArgs::keys(int index) const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.MultiGetArgs.Keys)
+  return _internal_keys(index);
+}
+inline std::string* MultiGetArgs::mutable_keys(int index) {
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.MultiGetArgs.Keys)
+  return _impl_.keys_.Mutable(index);
+}
+inline void MultiGetArgs::set_keys(int index, const std::string& value) {
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.MultiGetArgs.Keys)
+}
+inline void MultiGetArgs::set_keys(int index, std::string&& value) {
+  _impl_.keys_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.MultiGetArgs.Keys)
+}
+inline void MultiGetArgs::set_keys(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.MultiGetArgs.Keys)
+}
+inline void MultiGetArgs::set_keys(int index, const void* value, size_t size) {
+  _impl_.keys_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.MultiGetArgs.Keys)
+}
+inline std::string* MultiGetArgs::_internal_add_keys() {
+  return _impl_.keys_.Add();
+}
+inline void MultiGetArgs::add_keys(const std::string& value) {
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.MultiGetArgs.Keys)
+}
+inline void MultiGetArgs::add_keys(std::string&& value) {
+  _impl_.keys_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.MultiGetArgs.Keys)
+}
+inline void MultiGetArgs::add_keys(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:raftKVRpcProctoc.MultiGetArgs.Keys)
+}
+inline void MultiGetArgs::add_keys(const void* value, size_t size) {
+  _impl_.keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:raftKVRpcProctoc.MultiGetArgs.Keys)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+MultiGetArgs::keys() const {
+  // @@protoc_insertion_point(field_list:raftKVRpcProctoc.MultiGetArgs.Keys)
+  return _impl_.keys_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+MultiGetArgs::mutable_keys() {
+  // @@protoc_insertion_point(field_mutable_list:raftKVRpcProctoc.MultiGetArgs.Keys)
+  return &_impl_.keys_;
+}
+
+// bytes ClientId = 2;
+inline void MultiGetArgs::clear_clientid() {
+  _impl_.clientid_.ClearToEmpty();
+}
+inline const std::string& MultiGetArgs::clientid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.MultiGetArgs.ClientId)
+  return _internal_clientid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MultiGetArgs::set_clientid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.clientid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.MultiGetArgs.ClientId)
+}
+inline std::string* MultiGetArgs::mutable_clientid() {
+  std::string* _s = _internal_mutable_clientid();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.MultiGetArgs.ClientId)
+  return _s;
+}
+inline const std::string& MultiGetArgs::_internal_clientid() const {
+  return _impl_.clientid_.Get();
+}
+inline void MultiGetArgs::_internal_set_clientid(const std::string& value) {
+  
+  _impl_.clientid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MultiGetArgs::_internal_mutable_clientid() {
+  
+  return _impl_.clientid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MultiGetArgs::release_clientid() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.MultiGetArgs.ClientId)
+  return _impl_.clientid_.Release();
+}
+inline void MultiGetArgs::set_allocated_clientid(std::string* clientid) {
+  if (clientid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.clientid_.SetAllocated(clientid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.clientid_.IsDefault()) {
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.MultiGetArgs.ClientId)
+}
+
+// int32 RequestId = 3;
+inline void MultiGetArgs::clear_requestid() {
+  _impl_.requestid_ = 0;
+}
+inline int32_t MultiGetArgs::_internal_requestid() const {
+  return _impl_.requestid_;
+}
+inline int32_t MultiGetArgs::requestid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.MultiGetArgs.RequestId)
+  return _internal_requestid();
+}
+inline void MultiGetArgs::_internal_set_requestid(int32_t value) {
+  
+  _impl_.requestid_ = value;
+}
+inline void MultiGetArgs::set_requestid(int32_t value) {
+  _internal_set_requestid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.MultiGetArgs.RequestId)
+}
+
+// -------------------------------------------------------------------
+
+// GetResult
+
+// bool Exist = 1;
+inline void GetResult::clear_exist() {
+  _impl_.exist_ = false;
+}
+inline bool GetResult::_internal_exist() const {
+  return _impl_.exist_;
+}
+inline bool GetResult::exist() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetResult.Exist)
+  return _internal_exist();
+}
+inline void GetResult::_internal_set_exist(bool value) {
+  
+  _impl_.exist_ = value;
+}
+inline void GetResult::set_exist(bool value) {
+  _internal_set_exist(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetResult.Exist)
+}
+
+// bytes Value = 2;
+inline void GetResult::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& GetResult::value() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetResult.Value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetResult::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetResult.Value)
+}
+inline std::string* GetResult::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.GetResult.Value)
+  return _s;
+}
+inline const std::string& GetResult::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void GetResult::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetResult::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetResult::release_value() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.GetResult.Value)
+  return _impl_.value_.Release();
+}
+inline void GetResult::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.GetResult.Value)
+}
+
+// -------------------------------------------------------------------
+
+// MultiGetReply
+
+// bytes Err = 1;
+inline void MultiGetReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
+}
+inline const std::string& MultiGetReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.MultiGetReply.Err)
+  return _internal_err();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MultiGetReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.MultiGetReply.Err)
+}
+inline std::string* MultiGetReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.MultiGetReply.Err)
+  return _s;
+}
+inline const std::string& MultiGetReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void MultiGetReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MultiGetReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MultiGetReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.MultiGetReply.Err)
+  return _impl_.err_.Release();
+}
+inline void MultiGetReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.MultiGetReply.Err)
+}
+
+// repeated .raftKVRpcProctoc.GetResult Results = 2;
+inline int MultiGetReply::_internal_results_size() const {
+  return _impl_.results_.size();
+}
+inline int MultiGetReply::results_size() const {
+  return _internal_results_size();
+}
+inline void MultiGetReply::clear_results() {
+  _impl_.results_.Clear();
+}
+inline ::raftKVRpcProctoc::GetResult* MultiGetReply::mutable_results(int index) {
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.MultiGetReply.Results)
+  return _impl_.results_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::GetResult >*
+MultiGetReply::mutable_results() {
+  // @@protoc_insertion_point(field_mutable_list:raftKVRpcProctoc.MultiGetReply.Results)
+  return &_impl_.results_;
+}
+inline const ::raftKVRpcProctoc::GetResult& MultiGetReply::_internal_results(int index) const {
+  return _impl_.results_.Get(index);
+}
+inline const ::raftKVRpcProctoc::GetResult& MultiGetReply::results(int index) const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.MultiGetReply.Results)
+  return _internal_results(index);
+}
+inline ::raftKVRpcProctoc::GetResult* MultiGetReply::_internal_add_results() {
+  return _impl_.results_.Add();
+}
+inline ::raftKVRpcProctoc::GetResult* MultiGetReply::add_results() {
+  ::raftKVRpcProctoc::GetResult* _add = _internal_add_results();
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.MultiGetReply.Results)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::GetResult >&
+MultiGetReply::results() const {
+  // @@protoc_insertion_point(field_list:raftKVRpcProctoc.MultiGetReply.Results)
+  return _impl_.results_;
+}
+
+// int64 RetryAfterMs = 3;
+inline void MultiGetReply::clear_retryafterms() {
+  _impl_.retryafterms_ = int64_t{0};
+}
+inline int64_t MultiGetReply::_internal_retryafterms() const {
+  return _impl_.retryafterms_;
+}
+inline int64_t MultiGetReply::retryafterms() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.MultiGetReply.RetryAfterMs)
+  return _internal_retryafterms();
+}
+inline void MultiGetReply::_internal_set_retryafterms(int64_t value) {
+  
+  _impl_.retryafterms_ = value;
+}
+inline void MultiGetReply::set_retryafterms(int64_t value) {
+  _internal_set_retryafterms(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.MultiGetReply.RetryAfterMs)
+}
+
+// -------------------------------------------------------------------
+
+// WriteOp
+
+// bytes Op = 1;
+inline void WriteOp::clear_op() {
+  _impl_.op_.ClearToEmpty();
+}
+inline const std::string& WriteOp::op() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.WriteOp.Op)
+  return _internal_op();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WriteOp::set_op(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.op_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.WriteOp.Op)
+}
+inline std::string* WriteOp::mutable_op() {
+  std::string* _s = _internal_mutable_op();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.WriteOp.Op)
+  return _s;
+}
+inline const std::string& WriteOp::_internal_op() const {
+  return _impl_.op_.Get();
+}
+inline void WriteOp::_internal_set_op(const std::string& value) {
+  
+  _impl_.op_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WriteOp::_internal_mutable_op() {
+  
+  return _impl_.op_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WriteOp::release_op() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.WriteOp.Op)
+  return _impl_.op_.Release();
+}
+inline void WriteOp::set_allocated_op(std::string* op) {
+  if (op != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.op_.SetAllocated(op, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.op_.IsDefault()) {
+    _impl_.op_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.WriteOp.Op)
+}
+
+// bytes Key = 2;
+inline void WriteOp::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& WriteOp::key() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.WriteOp.Key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WriteOp::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.WriteOp.Key)
+}
+inline std::string* WriteOp::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.WriteOp.Key)
+  return _s;
+}
+inline const std::string& WriteOp::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void WriteOp::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WriteOp::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WriteOp::release_key() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.WriteOp.Key)
+  return _impl_.key_.Release();
+}
+inline void WriteOp::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.WriteOp.Key)
+}
+
+// bytes Value = 3;
+inline void WriteOp::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& WriteOp::value() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.WriteOp.Value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WriteOp::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.WriteOp.Value)
+}
+inline std::string* WriteOp::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.WriteOp.Value)
+  return _s;
+}
+inline const std::string& WriteOp::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void WriteOp::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WriteOp::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WriteOp::release_value() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.WriteOp.Value)
+  return _impl_.value_.Release();
+}
+inline void WriteOp::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.WriteOp.Value)
+}
+
+// int64 TtlMs = 4;
+inline void WriteOp::clear_ttlms() {
+  _impl_.ttlms_ = int64_t{0};
+}
+inline int64_t WriteOp::_internal_ttlms() const {
+  return _impl_.ttlms_;
+}
+inline int64_t WriteOp::ttlms() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.WriteOp.TtlMs)
+  return _internal_ttlms();
+}
+inline void WriteOp::_internal_set_ttlms(int64_t value) {
+  
+  _impl_.ttlms_ = value;
+}
+inline void WriteOp::set_ttlms(int64_t value) {
+  _internal_set_ttlms(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.WriteOp.TtlMs)
+}
+
+// -------------------------------------------------------------------
+
+// BatchWriteArgs
+
+// repeated .raftKVRpcProctoc.WriteOp Ops = 1;
+inline int BatchWriteArgs::_internal_ops_size() const {
+  return _impl_.ops_.size();
+}
+inline int BatchWriteArgs::ops_size() const {
+  return _internal_ops_size();
+}
+inline void BatchWriteArgs::clear_ops() {
+  _impl_.ops_.Clear();
+}
+inline ::raftKVRpcProctoc::WriteOp* BatchWriteArgs::mutable_ops(int index) {
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.BatchWriteArgs.Ops)
+  return _impl_.ops_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::WriteOp >*
+BatchWriteArgs::mutable_ops() {
+  // @@protoc_insertion_point(field_mutable_list:raftKVRpcProctoc.BatchWriteArgs.Ops)
+  return &_impl_.ops_;
+}
+inline const ::raftKVRpcProctoc::WriteOp& BatchWriteArgs::_internal_ops(int index) const {
+  return _impl_.ops_.Get(index);
+}
+inline const ::raftKVRpcProctoc::WriteOp& BatchWriteArgs::ops(int index) const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.BatchWriteArgs.Ops)
+  return _internal_ops(index);
+}
+inline ::raftKVRpcProctoc::WriteOp* BatchWriteArgs::_internal_add_ops() {
+  return _impl_.ops_.Add();
+}
+inline ::raftKVRpcProctoc::WriteOp* BatchWriteArgs::add_ops() {
+  ::raftKVRpcProctoc::WriteOp* _add = _internal_add_ops();
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.BatchWriteArgs.Ops)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::WriteOp >&
+BatchWriteArgs::ops() const {
+  // @@protoc_insertion_point(field_list:raftKVRpcProctoc.BatchWriteArgs.Ops)
+  return _impl_.ops_;
+}
+
+// bytes ClientId = 2;
+inline void BatchWriteArgs::clear_clientid() {
+  _impl_.clientid_.ClearToEmpty();
+}
+inline const std::string& BatchWriteArgs::clientid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.BatchWriteArgs.ClientId)
+  return _internal_clientid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BatchWriteArgs::set_clientid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.clientid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.BatchWriteArgs.ClientId)
+}
+inline std::string* BatchWriteArgs::mutable_clientid() {
+  std::string* _s = _internal_mutable_clientid();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.BatchWriteArgs.ClientId)
+  return _s;
+}
+inline const std::string& BatchWriteArgs::_internal_clientid() const {
+  return _impl_.clientid_.Get();
+}
+inline void BatchWriteArgs::_internal_set_clientid(const std::string& value) {
+  
+  _impl_.clientid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BatchWriteArgs::_internal_mutable_clientid() {
+  
+  return _impl_.clientid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BatchWriteArgs::release_clientid() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.BatchWriteArgs.ClientId)
+  return _impl_.clientid_.Release();
+}
+inline void BatchWriteArgs::set_allocated_clientid(std::string* clientid) {
+  if (clientid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.clientid_.SetAllocated(clientid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.clientid_.IsDefault()) {
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.BatchWriteArgs.ClientId)
+}
+
+// int32 RequestId = 3;
+inline void BatchWriteArgs::clear_requestid() {
+  _impl_.requestid_ = 0;
+}
+inline int32_t BatchWriteArgs::_internal_requestid() const {
+  return _impl_.requestid_;
+}
+inline int32_t BatchWriteArgs::requestid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.BatchWriteArgs.RequestId)
+  return _internal_requestid();
+}
+inline void BatchWriteArgs::_internal_set_requestid(int32_t value) {
+  
+  _impl_.requestid_ = value;
+}
+inline void BatchWriteArgs::set_requestid(int32_t value) {
+  _internal_set_requestid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.BatchWriteArgs.RequestId)
+}
+
+// -------------------------------------------------------------------
+
+// BatchWriteReply
+
+// bytes Err = 1;
+inline void BatchWriteReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
+}
+inline const std::string& BatchWriteReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.BatchWriteReply.Err)
+  return _internal_err();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BatchWriteReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.BatchWriteReply.Err)
+}
+inline std::string* BatchWriteReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.BatchWriteReply.Err)
+  return _s;
+}
+inline const std::string& BatchWriteReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void BatchWriteReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BatchWriteReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BatchWriteReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.BatchWriteReply.Err)
+  return _impl_.err_.Release();
+}
+inline void BatchWriteReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.BatchWriteReply.Err)
+}
+
+// int64 RetryAfterMs = 2;
+inline void BatchWriteReply::clear_retryafterms() {
+  _impl_.retryafterms_ = int64_t{0};
+}
+inline int64_t BatchWriteReply::_internal_retryafterms() const {
+  return _impl_.retryafterms_;
+}
+inline int64_t BatchWriteReply::retryafterms() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.BatchWriteReply.RetryAfterMs)
+  return _internal_retryafterms();
+}
+inline void BatchWriteReply::_internal_set_retryafterms(int64_t value) {
+  
+  _impl_.retryafterms_ = value;
+}
+inline void BatchWriteReply::set_retryafterms(int64_t value) {
+  _internal_set_retryafterms(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.BatchWriteReply.RetryAfterMs)
+}
+
+// -------------------------------------------------------------------
+
+// TxnCompare
+
+// bytes Key = 1;
+inline void TxnCompare::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& TxnCompare::key() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnCompare.Key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TxnCompare::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TxnCompare.Key)
+}
+inline std::string* TxnCompare::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.TxnCompare.Key)
+  return _s;
+}
+inline const std::string& TxnCompare::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void TxnCompare::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TxnCompare::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TxnCompare::release_key() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.TxnCompare.Key)
+  return _impl_.key_.Release();
+}
+inline void TxnCompare::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.TxnCompare.Key)
+}
+
+// .raftKVRpcProctoc.TxnCompare.Target target = 2;
+inline void TxnCompare::clear_target() {
+  _impl_.target_ = 0;
+}
+inline ::raftKVRpcProctoc::TxnCompare_Target TxnCompare::_internal_target() const {
+  return static_cast< ::raftKVRpcProctoc::TxnCompare_Target >(_impl_.target_);
+}
+inline ::raftKVRpcProctoc::TxnCompare_Target TxnCompare::target() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnCompare.target)
+  return _internal_target();
+}
+inline void TxnCompare::_internal_set_target(::raftKVRpcProctoc::TxnCompare_Target value) {
+  
+  _impl_.target_ = value;
+}
+inline void TxnCompare::set_target(::raftKVRpcProctoc::TxnCompare_Target value) {
+  _internal_set_target(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TxnCompare.target)
+}
+
+// .raftKVRpcProctoc.TxnCompare.Result result = 3;
+inline void TxnCompare::clear_result() {
+  _impl_.result_ = 0;
+}
+inline ::raftKVRpcProctoc::TxnCompare_Result TxnCompare::_internal_result() const {
+  return static_cast< ::raftKVRpcProctoc::TxnCompare_Result >(_impl_.result_);
+}
+inline ::raftKVRpcProctoc::TxnCompare_Result TxnCompare::result() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnCompare.result)
+  return _internal_result();
+}
+inline void TxnCompare::_internal_set_result(::raftKVRpcProctoc::TxnCompare_Result value) {
+  
+  _impl_.result_ = value;
+}
+inline void TxnCompare::set_result(::raftKVRpcProctoc::TxnCompare_Result value) {
+  _internal_set_result(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TxnCompare.result)
+}
+
+// bytes Value = 4;
+inline void TxnCompare::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& TxnCompare::value() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnCompare.Value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TxnCompare::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TxnCompare.Value)
+}
+inline std::string* TxnCompare::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.TxnCompare.Value)
+  return _s;
+}
+inline const std::string& TxnCompare::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void TxnCompare::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TxnCompare::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TxnCompare::release_value() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.TxnCompare.Value)
+  return _impl_.value_.Release();
+}
+inline void TxnCompare::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.TxnCompare.Value)
+}
+
+// bool Exists = 5;
+inline void TxnCompare::clear_exists() {
+  _impl_.exists_ = false;
+}
+inline bool TxnCompare::_internal_exists() const {
+  return _impl_.exists_;
+}
+inline bool TxnCompare::exists() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnCompare.Exists)
+  return _internal_exists();
+}
+inline void TxnCompare::_internal_set_exists(bool value) {
+  
+  _impl_.exists_ = value;
+}
+inline void TxnCompare::set_exists(bool value) {
+  _internal_set_exists(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TxnCompare.Exists)
+}
+
+// int64 Version = 6;
+inline void TxnCompare::clear_version() {
+  _impl_.version_ = int64_t{0};
+}
+inline int64_t TxnCompare::_internal_version() const {
+  return _impl_.version_;
+}
+inline int64_t TxnCompare::version() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnCompare.Version)
+  return _internal_version();
+}
+inline void TxnCompare::_internal_set_version(int64_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void TxnCompare::set_version(int64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TxnCompare.Version)
+}
+
+// -------------------------------------------------------------------
+
+// TxnOp
+
+// .raftKVRpcProctoc.TxnOp.OpType Op = 1;
+inline void TxnOp::clear_op() {
+  _impl_.op_ = 0;
+}
+inline ::raftKVRpcProctoc::TxnOp_OpType TxnOp::_internal_op() const {
+  return static_cast< ::raftKVRpcProctoc::TxnOp_OpType >(_impl_.op_);
+}
+inline ::raftKVRpcProctoc::TxnOp_OpType TxnOp::op() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnOp.Op)
+  return _internal_op();
+}
+inline void TxnOp::_internal_set_op(::raftKVRpcProctoc::TxnOp_OpType value) {
+  
+  _impl_.op_ = value;
+}
+inline void TxnOp::set_op(::raftKVRpcProctoc::TxnOp_OpType value) {
+  _internal_set_op(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TxnOp.Op)
+}
+
+// bytes Key = 2;
+inline void TxnOp::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& TxnOp::key() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnOp.Key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TxnOp::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TxnOp.Key)
+}
+inline std::string* TxnOp::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.TxnOp.Key)
+  return _s;
+}
+inline const std::string& TxnOp::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void TxnOp::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TxnOp::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TxnOp::release_key() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.TxnOp.Key)
+  return _impl_.key_.Release();
+}
+inline void TxnOp::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.TxnOp.Key)
+}
+
+// bytes Value = 3;
+inline void TxnOp::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& TxnOp::value() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnOp.Value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TxnOp::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TxnOp.Value)
+}
+inline std::string* TxnOp::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.TxnOp.Value)
+  return _s;
+}
+inline const std::string& TxnOp::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void TxnOp::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TxnOp::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TxnOp::release_value() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.TxnOp.Value)
+  return _impl_.value_.Release();
+}
+inline void TxnOp::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.TxnOp.Value)
+}
+
+// int64 Delta = 4;
+inline void TxnOp::clear_delta() {
+  _impl_.delta_ = int64_t{0};
+}
+inline int64_t TxnOp::_internal_delta() const {
+  return _impl_.delta_;
+}
+inline int64_t TxnOp::delta() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnOp.Delta)
+  return _internal_delta();
+}
+inline void TxnOp::_internal_set_delta(int64_t value) {
+  
+  _impl_.delta_ = value;
+}
+inline void TxnOp::set_delta(int64_t value) {
+  _internal_set_delta(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TxnOp.Delta)
+}
+
+// -------------------------------------------------------------------
+
+// TxnArgs
+
+// repeated .raftKVRpcProctoc.TxnCompare Compares = 1;
+inline int TxnArgs::_internal_compares_size() const {
+  return _impl_.compares_.size();
+}
+inline int TxnArgs::compares_size() const {
+  return _internal_compares_size();
+}
+inline void TxnArgs::clear_compares() {
+  _impl_.compares_.Clear();
+}
+inline ::raftKVRpcProctoc::TxnCompare* TxnArgs::mutable_compares(int index) {
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.TxnArgs.Compares)
+  return _impl_.compares_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnCompare >*
+TxnArgs::mutable_compares() {
+  // @@protoc_insertion_point(field_mutable_list:raftKVRpcProctoc.TxnArgs.Compares)
+  return &_impl_.compares_;
+}
+inline const ::raftKVRpcProctoc::TxnCompare& TxnArgs::_internal_compares(int index) const {
+  return _impl_.compares_.Get(index);
+}
+inline const ::raftKVRpcProctoc::TxnCompare& TxnArgs::compares(int index) const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnArgs.Compares)
+  return _internal_compares(index);
+}
+inline ::raftKVRpcProctoc::TxnCompare* TxnArgs::_internal_add_compares() {
+  return _impl_.compares_.Add();
+}
+inline ::raftKVRpcProctoc::TxnCompare* TxnArgs::add_compares() {
+  ::raftKVRpcProctoc::TxnCompare* _add = _internal_add_compares();
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.TxnArgs.Compares)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnCompare >&
+TxnArgs::compares() const {
+  // @@protoc_insertion_point(field_list:raftKVRpcProctoc.TxnArgs.Compares)
+  return _impl_.compares_;
+}
+
+// repeated .raftKVRpcProctoc.TxnOp Success = 2;
+inline int TxnArgs::_internal_success_size() const {
+  return _impl_.success_.size();
+}
+inline int TxnArgs::success_size() const {
+  return _internal_success_size();
+}
+inline void TxnArgs::clear_success() {
+  _impl_.success_.Clear();
+}
+inline ::raftKVRpcProctoc::TxnOp* TxnArgs::mutable_success(int index) {
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.TxnArgs.Success)
+  return _impl_.success_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnOp >*
+TxnArgs::mutable_success() {
+  // @@protoc_insertion_point(field_mutable_list:raftKVRpcProctoc.TxnArgs.Success)
+  return &_impl_.success_;
+}
+inline const ::raftKVRpcProctoc::TxnOp& TxnArgs::_internal_success(int index) const {
+  return _impl_.success_.Get(index);
+}
+inline const ::raftKVRpcProctoc::TxnOp& TxnArgs::success(int index) const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnArgs.Success)
+  return _internal_success(index);
+}
+inline ::raftKVRpcProctoc::TxnOp* TxnArgs::_internal_add_success() {
+  return _impl_.success_.Add();
+}
+inline ::raftKVRpcProctoc::TxnOp* TxnArgs::add_success() {
+  ::raftKVRpcProctoc::TxnOp* _add = _internal_add_success();
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.TxnArgs.Success)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnOp >&
+TxnArgs::success() const {
+  // @@protoc_insertion_point(field_list:raftKVRpcProctoc.TxnArgs.Success)
+  return _impl_.success_;
+}
+
+// repeated .raftKVRpcProctoc.TxnOp Failure = 3;
+inline int TxnArgs::_internal_failure_size() const {
+  return _impl_.failure_.size();
+}
+inline int TxnArgs::failure_size() const {
+  return _internal_failure_size();
+}
+inline void TxnArgs::clear_failure() {
+  _impl_.failure_.Clear();
+}
+inline ::raftKVRpcProctoc::TxnOp* TxnArgs::mutable_failure(int index) {
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.TxnArgs.Failure)
+  return _impl_.failure_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnOp >*
+TxnArgs::mutable_failure() {
+  // @@protoc_insertion_point(field_mutable_list:raftKVRpcProctoc.TxnArgs.Failure)
+  return &_impl_.failure_;
+}
+inline const ::raftKVRpcProctoc::TxnOp& TxnArgs::_internal_failure(int index) const {
+  return _impl_.failure_.Get(index);
+}
+inline const ::raftKVRpcProctoc::TxnOp& TxnArgs::failure(int index) const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnArgs.Failure)
+  return _internal_failure(index);
+}
+inline ::raftKVRpcProctoc::TxnOp* TxnArgs::_internal_add_failure() {
+  return _impl_.failure_.Add();
+}
+inline ::raftKVRpcProctoc::TxnOp* TxnArgs::add_failure() {
+  ::raftKVRpcProctoc::TxnOp* _add = _internal_add_failure();
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.TxnArgs.Failure)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnOp >&
+TxnArgs::failure() const {
+  // @@protoc_insertion_point(field_list:raftKVRpcProctoc.TxnArgs.Failure)
+  return _impl_.failure_;
+}
+
+// bytes ClientId = 4;
+inline void TxnArgs::clear_clientid() {
+  _impl_.clientid_.ClearToEmpty();
+}
+inline const std::string& TxnArgs::clientid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnArgs.ClientId)
+  return _internal_clientid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TxnArgs::set_clientid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.clientid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TxnArgs.ClientId)
+}
+inline std::string* TxnArgs::mutable_clientid() {
+  std::string* _s = _internal_mutable_clientid();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.TxnArgs.ClientId)
+  return _s;
+}
+inline const std::string& TxnArgs::_internal_clientid() const {
+  return _impl_.clientid_.Get();
+}
+inline void TxnArgs::_internal_set_clientid(const std::string& value) {
+  
+  _impl_.clientid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TxnArgs::_internal_mutable_clientid() {
+  
+  return _impl_.clientid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TxnArgs::release_clientid() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.TxnArgs.ClientId)
+  return _impl_.clientid_.Release();
+}
+inline void TxnArgs::set_allocated_clientid(std::string* clientid) {
+  if (clientid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.clientid_.SetAllocated(clientid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.clientid_.IsDefault()) {
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.TxnArgs.ClientId)
+}
+
+// int32 RequestId = 5;
+inline void TxnArgs::clear_requestid() {
+  _impl_.requestid_ = 0;
+}
+inline int32_t TxnArgs::_internal_requestid() const {
+  return _impl_.requestid_;
+}
+inline int32_t TxnArgs::requestid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnArgs.RequestId)
+  return _internal_requestid();
+}
+inline void TxnArgs::_internal_set_requestid(int32_t value) {
+  
+  _impl_.requestid_ = value;
+}
+inline void TxnArgs::set_requestid(int32_t value) {
+  _internal_set_requestid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TxnArgs.RequestId)
+}
+
+// -------------------------------------------------------------------
+
+// TxnOpResult
+
+// bool Exist = 1;
+inline void TxnOpResult::clear_exist() {
+  _impl_.exist_ = false;
+}
+inline bool TxnOpResult::_internal_exist() const {
+  return _impl_.exist_;
+}
+inline bool TxnOpResult::exist() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnOpResult.Exist)
+  return _internal_exist();
+}
+inline void TxnOpResult::_internal_set_exist(bool value) {
+  
+  _impl_.exist_ = value;
+}
+inline void TxnOpResult::set_exist(bool value) {
+  _internal_set_exist(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TxnOpResult.Exist)
+}
+
+// bool Applied = 2;
+inline void TxnOpResult::clear_applied() {
+  _impl_.applied_ = false;
+}
+inline bool TxnOpResult::_internal_applied() const {
+  return _impl_.applied_;
+}
+inline bool TxnOpResult::applied() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnOpResult.Applied)
+  return _internal_applied();
+}
+inline void TxnOpResult::_internal_set_applied(bool value) {
+  
+  _impl_.applied_ = value;
+}
+inline void TxnOpResult::set_applied(bool value) {
+  _internal_set_applied(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TxnOpResult.Applied)
+}
+
+// bytes Value = 3;
+inline void TxnOpResult::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& TxnOpResult::value() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnOpResult.Value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TxnOpResult::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TxnOpResult.Value)
+}
+inline std::string* TxnOpResult::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.TxnOpResult.Value)
+  return _s;
+}
+inline const std::string& TxnOpResult::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void TxnOpResult::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TxnOpResult::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TxnOpResult::release_value() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.TxnOpResult.Value)
+  return _impl_.value_.Release();
+}
+inline void TxnOpResult::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.TxnOpResult.Value)
+}
+
+// -------------------------------------------------------------------
+
+// TxnReply
+
+// bytes Err = 1;
+inline void TxnReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
+}
+inline const std::string& TxnReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnReply.Err)
+  return _internal_err();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TxnReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TxnReply.Err)
+}
+inline std::string* TxnReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.TxnReply.Err)
+  return _s;
+}
+inline const std::string& TxnReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void TxnReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TxnReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TxnReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.TxnReply.Err)
+  return _impl_.err_.Release();
+}
+inline void TxnReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.TxnReply.Err)
+}
+
+// bool Succeeded = 2;
+inline void TxnReply::clear_succeeded() {
+  _impl_.succeeded_ = false;
+}
+inline bool TxnReply::_internal_succeeded() const {
+  return _impl_.succeeded_;
+}
+inline bool TxnReply::succeeded() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnReply.Succeeded)
+  return _internal_succeeded();
+}
+inline void TxnReply::_internal_set_succeeded(bool value) {
+  
+  _impl_.succeeded_ = value;
+}
+inline void TxnReply::set_succeeded(bool value) {
+  _internal_set_succeeded(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TxnReply.Succeeded)
+}
+
+// repeated .raftKVRpcProctoc.TxnOpResult Results = 3;
+inline int TxnReply::_internal_results_size() const {
+  return _impl_.results_.size();
+}
+inline int TxnReply::results_size() const {
+  return _internal_results_size();
+}
+inline void TxnReply::clear_results() {
+  _impl_.results_.Clear();
+}
+inline ::raftKVRpcProctoc::TxnOpResult* TxnReply::mutable_results(int index) {
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.TxnReply.Results)
+  return _impl_.results_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnOpResult >*
+TxnReply::mutable_results() {
+  // @@protoc_insertion_point(field_mutable_list:raftKVRpcProctoc.TxnReply.Results)
+  return &_impl_.results_;
+}
+inline const ::raftKVRpcProctoc::TxnOpResult& TxnReply::_internal_results(int index) const {
+  return _impl_.results_.Get(index);
+}
+inline const ::raftKVRpcProctoc::TxnOpResult& TxnReply::results(int index) const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnReply.Results)
+  return _internal_results(index);
+}
+inline ::raftKVRpcProctoc::TxnOpResult* TxnReply::_internal_add_results() {
+  return _impl_.results_.Add();
+}
+inline ::raftKVRpcProctoc::TxnOpResult* TxnReply::add_results() {
+  ::raftKVRpcProctoc::TxnOpResult* _add = _internal_add_results();
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.TxnReply.Results)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::TxnOpResult >&
+TxnReply::results() const {
+  // @@protoc_insertion_point(field_list:raftKVRpcProctoc.TxnReply.Results)
+  return _impl_.results_;
+}
+
+// bytes TxnError = 4;
+inline void TxnReply::clear_txnerror() {
+  _impl_.txnerror_.ClearToEmpty();
+}
+inline const std::string& TxnReply::txnerror() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnReply.TxnError)
+  return _internal_txnerror();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TxnReply::set_txnerror(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.txnerror_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TxnReply.TxnError)
+}
+inline std::string* TxnReply::mutable_txnerror() {
+  std::string* _s = _internal_mutable_txnerror();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.TxnReply.TxnError)
+  return _s;
+}
+inline const std::string& TxnReply::_internal_txnerror() const {
+  return _impl_.txnerror_.Get();
+}
+inline void TxnReply::_internal_set_txnerror(const std::string& value) {
+  
+  _impl_.txnerror_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TxnReply::_internal_mutable_txnerror() {
+  
+  return _impl_.txnerror_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TxnReply::release_txnerror() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.TxnReply.TxnError)
+  return _impl_.txnerror_.Release();
+}
+inline void TxnReply::set_allocated_txnerror(std::string* txnerror) {
+  if (txnerror != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.txnerror_.SetAllocated(txnerror, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.txnerror_.IsDefault()) {
+    _impl_.txnerror_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.TxnReply.TxnError)
+}
+
+// int64 RetryAfterMs = 5;
+inline void TxnReply::clear_retryafterms() {
+  _impl_.retryafterms_ = int64_t{0};
+}
+inline int64_t TxnReply::_internal_retryafterms() const {
+  return _impl_.retryafterms_;
+}
+inline int64_t TxnReply::retryafterms() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TxnReply.RetryAfterMs)
+  return _internal_retryafterms();
+}
+inline void TxnReply::_internal_set_retryafterms(int64_t value) {
+  
+  _impl_.retryafterms_ = value;
+}
+inline void TxnReply::set_retryafterms(int64_t value) {
+  _internal_set_retryafterms(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TxnReply.RetryAfterMs)
+}
+
+// -------------------------------------------------------------------
+
+// DeleteArgs
+
+// bytes Key = 1;
+inline void DeleteArgs::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& DeleteArgs::key() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.DeleteArgs.Key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DeleteArgs::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.DeleteArgs.Key)
+}
+inline std::string* DeleteArgs::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.DeleteArgs.Key)
+  return _s;
+}
+inline const std::string& DeleteArgs::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void DeleteArgs::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DeleteArgs::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DeleteArgs::release_key() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.DeleteArgs.Key)
+  return _impl_.key_.Release();
+}
+inline void DeleteArgs::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.DeleteArgs.Key)
+}
+
+// bytes ClientId = 2;
+inline void DeleteArgs::clear_clientid() {
+  _impl_.clientid_.ClearToEmpty();
+}
+inline const std::string& DeleteArgs::clientid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.DeleteArgs.ClientId)
+  return _internal_clientid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DeleteArgs::set_clientid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.clientid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.DeleteArgs.ClientId)
+}
+inline std::string* DeleteArgs::mutable_clientid() {
+  std::string* _s = _internal_mutable_clientid();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.DeleteArgs.ClientId)
+  return _s;
+}
+inline const std::string& DeleteArgs::_internal_clientid() const {
+  return _impl_.clientid_.Get();
+}
+inline void DeleteArgs::_internal_set_clientid(const std::string& value) {
+  
+  _impl_.clientid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DeleteArgs::_internal_mutable_clientid() {
+  
+  return _impl_.clientid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DeleteArgs::release_clientid() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.DeleteArgs.ClientId)
+  return _impl_.clientid_.Release();
+}
+inline void DeleteArgs::set_allocated_clientid(std::string* clientid) {
+  if (clientid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.clientid_.SetAllocated(clientid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.clientid_.IsDefault()) {
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.DeleteArgs.ClientId)
+}
+
+// int32 RequestId = 3;
+inline void DeleteArgs::clear_requestid() {
+  _impl_.requestid_ = 0;
+}
+inline int32_t DeleteArgs::_internal_requestid() const {
+  return _impl_.requestid_;
+}
+inline int32_t DeleteArgs::requestid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.DeleteArgs.RequestId)
+  return _internal_requestid();
+}
+inline void DeleteArgs::_internal_set_requestid(int32_t value) {
+  
+  _impl_.requestid_ = value;
+}
+inline void DeleteArgs::set_requestid(int32_t value) {
+  _internal_set_requestid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.DeleteArgs.RequestId)
+}
+
+// -------------------------------------------------------------------
+
+// DeleteRangeArgs
+
+// bytes StartKey = 1;
+inline void DeleteRangeArgs::clear_startkey() {
+  _impl_.startkey_.ClearToEmpty();
+}
+inline const std::string& DeleteRangeArgs::startkey() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.DeleteRangeArgs.StartKey)
+  return _internal_startkey();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DeleteRangeArgs::set_startkey(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.startkey_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.DeleteRangeArgs.StartKey)
+}
+inline std::string* DeleteRangeArgs::mutable_startkey() {
+  std::string* _s = _internal_mutable_startkey();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.DeleteRangeArgs.StartKey)
+  return _s;
+}
+inline const std::string& DeleteRangeArgs::_internal_startkey() const {
+  return _impl_.startkey_.Get();
+}
+inline void DeleteRangeArgs::_internal_set_startkey(const std::string& value) {
+  
+  _impl_.startkey_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DeleteRangeArgs::_internal_mutable_startkey() {
+  
+  return _impl_.startkey_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DeleteRangeArgs::release_startkey() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.DeleteRangeArgs.StartKey)
+  return _impl_.startkey_.Release();
+}
+inline void DeleteRangeArgs::set_allocated_startkey(std::string* startkey) {
+  if (startkey != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.startkey_.SetAllocated(startkey, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.startkey_.IsDefault()) {
+    _impl_.startkey_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.DeleteRangeArgs.StartKey)
+}
+
+// bytes EndKey = 2;
+inline void DeleteRangeArgs::clear_endkey() {
+  _impl_.endkey_.ClearToEmpty();
+}
+inline const std::string& DeleteRangeArgs::endkey() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.DeleteRangeArgs.EndKey)
+  return _internal_endkey();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DeleteRangeArgs::set_endkey(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.endkey_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.DeleteRangeArgs.EndKey)
+}
+inline std::string* DeleteRangeArgs::mutable_endkey() {
+  std::string* _s = _internal_mutable_endkey();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.DeleteRangeArgs.EndKey)
+  return _s;
+}
+inline const std::string& DeleteRangeArgs::_internal_endkey() const {
+  return _impl_.endkey_.Get();
+}
+inline void DeleteRangeArgs::_internal_set_endkey(const std::string& value) {
+  
+  _impl_.endkey_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DeleteRangeArgs::_internal_mutable_endkey() {
+  
+  return _impl_.endkey_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DeleteRangeArgs::release_endkey() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.DeleteRangeArgs.EndKey)
+  return _impl_.endkey_.Release();
+}
+inline void DeleteRangeArgs::set_allocated_endkey(std::string* endkey) {
+  if (endkey != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.endkey_.SetAllocated(endkey, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.endkey_.IsDefault()) {
+    _impl_.endkey_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.DeleteRangeArgs.EndKey)
+}
+
+// bytes ClientId = 3;
+inline void DeleteRangeArgs::clear_clientid() {
+  _impl_.clientid_.ClearToEmpty();
+}
+inline const std::string& DeleteRangeArgs::clientid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.DeleteRangeArgs.ClientId)
+  return _internal_clientid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DeleteRangeArgs::set_clientid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.clientid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.DeleteRangeArgs.ClientId)
+}
+inline std::string* DeleteRangeArgs::mutable_clientid() {
+  std::string* _s = _internal_mutable_clientid();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.DeleteRangeArgs.ClientId)
+  return _s;
+}
+inline const std::string& DeleteRangeArgs::_internal_clientid() const {
+  return _impl_.clientid_.Get();
+}
+inline void DeleteRangeArgs::_internal_set_clientid(const std::string& value) {
+  
+  _impl_.clientid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DeleteRangeArgs::_internal_mutable_clientid() {
+  
+  return _impl_.clientid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DeleteRangeArgs::release_clientid() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.DeleteRangeArgs.ClientId)
+  return _impl_.clientid_.Release();
+}
+inline void DeleteRangeArgs::set_allocated_clientid(std::string* clientid) {
+  if (clientid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.clientid_.SetAllocated(clientid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.clientid_.IsDefault()) {
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.DeleteRangeArgs.ClientId)
+}
+
+// int32 RequestId = 4;
+inline void DeleteRangeArgs::clear_requestid() {
+  _impl_.requestid_ = 0;
+}
+inline int32_t DeleteRangeArgs::_internal_requestid() const {
+  return _impl_.requestid_;
+}
+inline int32_t DeleteRangeArgs::requestid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.DeleteRangeArgs.RequestId)
+  return _internal_requestid();
+}
+inline void DeleteRangeArgs::_internal_set_requestid(int32_t value) {
+  
+  _impl_.requestid_ = value;
+}
+inline void DeleteRangeArgs::set_requestid(int32_t value) {
+  _internal_set_requestid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.DeleteRangeArgs.RequestId)
+}
+
+// -------------------------------------------------------------------
+
+// DeleteReply
+
+// bytes Err = 1;
+inline void DeleteReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
+}
+inline const std::string& DeleteReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.DeleteReply.Err)
+  return _internal_err();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DeleteReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.DeleteReply.Err)
+}
+inline std::string* DeleteReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.DeleteReply.Err)
+  return _s;
+}
+inline const std::string& DeleteReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void DeleteReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DeleteReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DeleteReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.DeleteReply.Err)
+  return _impl_.err_.Release();
+}
+inline void DeleteReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.DeleteReply.Err)
+}
+
+// int64 RetryAfterMs = 2;
+inline void DeleteReply::clear_retryafterms() {
+  _impl_.retryafterms_ = int64_t{0};
+}
+inline int64_t DeleteReply::_internal_retryafterms() const {
+  return _impl_.retryafterms_;
+}
+inline int64_t DeleteReply::retryafterms() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.DeleteReply.RetryAfterMs)
+  return _internal_retryafterms();
+}
+inline void DeleteReply::_internal_set_retryafterms(int64_t value) {
+  
+  _impl_.retryafterms_ = value;
+}
+inline void DeleteReply::set_retryafterms(int64_t value) {
+  _internal_set_retryafterms(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.DeleteReply.RetryAfterMs)
+}
+
+// -------------------------------------------------------------------
+
+// WatchEvent
+
+// .raftKVRpcProctoc.WatchEvent.EventType Type = 1;
+inline void WatchEvent::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::raftKVRpcProctoc::WatchEvent_EventType WatchEvent::_internal_type() const {
+  return static_cast< ::raftKVRpcProctoc::WatchEvent_EventType >(_impl_.type_);
+}
+inline ::raftKVRpcProctoc::WatchEvent_EventType WatchEvent::type() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.WatchEvent.Type)
+  return _internal_type();
+}
+inline void WatchEvent::_internal_set_type(::raftKVRpcProctoc::WatchEvent_EventType value) {
+  
+  _impl_.type_ = value;
+}
+inline void WatchEvent::set_type(::raftKVRpcProctoc::WatchEvent_EventType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.WatchEvent.Type)
+}
+
+// bytes Key = 2;
+inline void WatchEvent::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& WatchEvent::key() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.WatchEvent.Key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WatchEvent::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.WatchEvent.Key)
+}
+inline std::string* WatchEvent::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.WatchEvent.Key)
+  return _s;
+}
+inline const std::string& WatchEvent::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void WatchEvent::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WatchEvent::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WatchEvent::release_key() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.WatchEvent.Key)
+  return _impl_.key_.Release();
+}
+inline void WatchEvent::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.WatchEvent.Key)
+}
+
+// bytes Value = 3;
+inline void WatchEvent::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& WatchEvent::value() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.WatchEvent.Value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WatchEvent::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.WatchEvent.Value)
+}
+inline std::string* WatchEvent::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.WatchEvent.Value)
+  return _s;
+}
+inline const std::string& WatchEvent::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void WatchEvent::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WatchEvent::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WatchEvent::release_value() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.WatchEvent.Value)
+  return _impl_.value_.Release();
+}
+inline void WatchEvent::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.WatchEvent.Value)
+}
+
+// int64 Index = 4;
+inline void WatchEvent::clear_index() {
+  _impl_.index_ = int64_t{0};
+}
+inline int64_t WatchEvent::_internal_index() const {
+  return _impl_.index_;
+}
+inline int64_t WatchEvent::index() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.WatchEvent.Index)
+  return _internal_index();
+}
+inline void WatchEvent::_internal_set_index(int64_t value) {
+  
+  _impl_.index_ = value;
+}
+inline void WatchEvent::set_index(int64_t value) {
+  _internal_set_index(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.WatchEvent.Index)
+}
+
+// -------------------------------------------------------------------
+
+// WatchArgs
+
+// bytes Key = 1;
+inline void WatchArgs::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& WatchArgs::key() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.WatchArgs.Key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WatchArgs::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.WatchArgs.Key)
+}
+inline std::string* WatchArgs::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.WatchArgs.Key)
+  return _s;
+}
+inline const std::string& WatchArgs::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void WatchArgs::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WatchArgs::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WatchArgs::release_key() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.WatchArgs.Key)
+  return _impl_.key_.Release();
+}
+inline void WatchArgs::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.WatchArgs.Key)
+}
+
+// bool Prefix = 2;
+inline void WatchArgs::clear_prefix() {
+  _impl_.prefix_ = false;
+}
+inline bool WatchArgs::_internal_prefix() const {
+  return _impl_.prefix_;
+}
+inline bool WatchArgs::prefix() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.WatchArgs.Prefix)
+  return _internal_prefix();
+}
+inline void WatchArgs::_internal_set_prefix(bool value) {
+  
+  _impl_.prefix_ = value;
+}
+inline void WatchArgs::set_prefix(bool value) {
+  _internal_set_prefix(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.WatchArgs.Prefix)
+}
+
+// int64 StartIndex = 3;
+inline void WatchArgs::clear_startindex() {
+  _impl_.startindex_ = int64_t{0};
+}
+inline int64_t WatchArgs::_internal_startindex() const {
+  return _impl_.startindex_;
+}
+inline int64_t WatchArgs::startindex() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.WatchArgs.StartIndex)
+  return _internal_startindex();
+}
+inline void WatchArgs::_internal_set_startindex(int64_t value) {
+  
+  _impl_.startindex_ = value;
+}
+inline void WatchArgs::set_startindex(int64_t value) {
+  _internal_set_startindex(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.WatchArgs.StartIndex)
+}
+
+// int64 WatchId = 4;
+inline void WatchArgs::clear_watchid() {
+  _impl_.watchid_ = int64_t{0};
+}
+inline int64_t WatchArgs::_internal_watchid() const {
+  return _impl_.watchid_;
+}
+inline int64_t WatchArgs::watchid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.WatchArgs.WatchId)
+  return _internal_watchid();
+}
+inline void WatchArgs::_internal_set_watchid(int64_t value) {
+  
+  _impl_.watchid_ = value;
+}
+inline void WatchArgs::set_watchid(int64_t value) {
+  _internal_set_watchid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.WatchArgs.WatchId)
+}
+
+// int32 MaxEvents = 5;
+inline void WatchArgs::clear_maxevents() {
+  _impl_.maxevents_ = 0;
+}
+inline int32_t WatchArgs::_internal_maxevents() const {
+  return _impl_.maxevents_;
+}
+inline int32_t WatchArgs::maxevents() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.WatchArgs.MaxEvents)
+  return _internal_maxevents();
+}
+inline void WatchArgs::_internal_set_maxevents(int32_t value) {
+  
+  _impl_.maxevents_ = value;
+}
+inline void WatchArgs::set_maxevents(int32_t value) {
+  _internal_set_maxevents(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.WatchArgs.MaxEvents)
+}
+
+// int32 TimeoutMs = 6;
+inline void WatchArgs::clear_timeoutms() {
+  _impl_.timeoutms_ = 0;
+}
+inline int32_t WatchArgs::_internal_timeoutms() const {
+  return _impl_.timeoutms_;
+}
+inline int32_t WatchArgs::timeoutms() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.WatchArgs.TimeoutMs)
+  return _internal_timeoutms();
+}
+inline void WatchArgs::_internal_set_timeoutms(int32_t value) {
+  
+  _impl_.timeoutms_ = value;
+}
+inline void WatchArgs::set_timeoutms(int32_t value) {
+  _internal_set_timeoutms(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.WatchArgs.TimeoutMs)
+}
+
+// -------------------------------------------------------------------
+
+// WatchReply
+
+// bytes Err = 1;
+inline void WatchReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
+}
+inline const std::string& WatchReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.WatchReply.Err)
+  return _internal_err();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WatchReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.WatchReply.Err)
+}
+inline std::string* WatchReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.WatchReply.Err)
+  return _s;
+}
+inline const std::string& WatchReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void WatchReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WatchReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WatchReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.WatchReply.Err)
+  return _impl_.err_.Release();
+}
+inline void WatchReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.WatchReply.Err)
+}
+
+// int64 WatchId = 2;
+inline void WatchReply::clear_watchid() {
+  _impl_.watchid_ = int64_t{0};
+}
+inline int64_t WatchReply::_internal_watchid() const {
+  return _impl_.watchid_;
+}
+inline int64_t WatchReply::watchid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.WatchReply.WatchId)
+  return _internal_watchid();
+}
+inline void WatchReply::_internal_set_watchid(int64_t value) {
+  
+  _impl_.watchid_ = value;
+}
+inline void WatchReply::set_watchid(int64_t value) {
+  _internal_set_watchid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.WatchReply.WatchId)
+}
+
+// repeated .raftKVRpcProctoc.WatchEvent Events = 3;
+inline int WatchReply::_internal_events_size() const {
+  return _impl_.events_.size();
+}
+inline int WatchReply::events_size() const {
+  return _internal_events_size();
+}
+inline void WatchReply::clear_events() {
+  _impl_.events_.Clear();
+}
+inline ::raftKVRpcProctoc::WatchEvent* WatchReply::mutable_events(int index) {
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.WatchReply.Events)
+  return _impl_.events_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::WatchEvent >*
+WatchReply::mutable_events() {
+  // @@protoc_insertion_point(field_mutable_list:raftKVRpcProctoc.WatchReply.Events)
+  return &_impl_.events_;
+}
+inline const ::raftKVRpcProctoc::WatchEvent& WatchReply::_internal_events(int index) const {
+  return _impl_.events_.Get(index);
+}
+inline const ::raftKVRpcProctoc::WatchEvent& WatchReply::events(int index) const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.WatchReply.Events)
+  return _internal_events(index);
+}
+inline ::raftKVRpcProctoc::WatchEvent* WatchReply::_internal_add_events() {
+  return _impl_.events_.Add();
+}
+inline ::raftKVRpcProctoc::WatchEvent* WatchReply::add_events() {
+  ::raftKVRpcProctoc::WatchEvent* _add = _internal_add_events();
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.WatchReply.Events)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::WatchEvent >&
+WatchReply::events() const {
+  // @@protoc_insertion_point(field_list:raftKVRpcProctoc.WatchReply.Events)
+  return _impl_.events_;
+}
+
+// int64 NextIndex = 4;
+inline void WatchReply::clear_nextindex() {
+  _impl_.nextindex_ = int64_t{0};
+}
+inline int64_t WatchReply::_internal_nextindex() const {
+  return _impl_.nextindex_;
+}
+inline int64_t WatchReply::nextindex() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.WatchReply.NextIndex)
+  return _internal_nextindex();
+}
+inline void WatchReply::_internal_set_nextindex(int64_t value) {
+  
+  _impl_.nextindex_ = value;
+}
+inline void WatchReply::set_nextindex(int64_t value) {
+  _internal_set_nextindex(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.WatchReply.NextIndex)
+}
+
+// int64 RetryAfterMs = 5;
+inline void WatchReply::clear_retryafterms() {
+  _impl_.retryafterms_ = int64_t{0};
+}
+inline int64_t WatchReply::_internal_retryafterms() const {
+  return _impl_.retryafterms_;
+}
+inline int64_t WatchReply::retryafterms() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.WatchReply.RetryAfterMs)
+  return _internal_retryafterms();
+}
+inline void WatchReply::_internal_set_retryafterms(int64_t value) {
+  
+  _impl_.retryafterms_ = value;
+}
+inline void WatchReply::set_retryafterms(int64_t value) {
+  _internal_set_retryafterms(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.WatchReply.RetryAfterMs)
+}
 
+// -------------------------------------------------------------------
+
+// CancelWatchArgs
+
+// int64 WatchId = 1;
+inline void CancelWatchArgs::clear_watchid() {
+  _impl_.watchid_ = int64_t{0};
+}
+inline int64_t CancelWatchArgs::_internal_watchid() const {
+  return _impl_.watchid_;
+}
+inline int64_t CancelWatchArgs::watchid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.CancelWatchArgs.WatchId)
+  return _internal_watchid();
+}
+inline void CancelWatchArgs::_internal_set_watchid(int64_t value) {
+  
+  _impl_.watchid_ = value;
+}
+inline void CancelWatchArgs::set_watchid(int64_t value) {
+  _internal_set_watchid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.CancelWatchArgs.WatchId)
+}
+
+// -------------------------------------------------------------------
+
+// CancelWatchReply
+
+// bytes Err = 1;
+inline void CancelWatchReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
+}
+inline const std::string& CancelWatchReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.CancelWatchReply.Err)
+  return _internal_err();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CancelWatchReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.CancelWatchReply.Err)
+}
+inline std::string* CancelWatchReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.CancelWatchReply.Err)
+  return _s;
+}
+inline const std::string& CancelWatchReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void CancelWatchReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CancelWatchReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CancelWatchReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.CancelWatchReply.Err)
+  return _impl_.err_.Release();
+}
+inline void CancelWatchReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
   }
-  key_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      key, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftKVRpcProctoc.GetArgs.Key)
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.CancelWatchReply.Err)
 }
 
-// bytes ClientId = 2;
-inline void GetArgs::clear_clientid() {
-  clientid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// -------------------------------------------------------------------
+
+// RegisterSessionArgs
+
+// uint64 Nonce = 1;
+inline void RegisterSessionArgs::clear_nonce() {
+  _impl_.nonce_ = uint64_t{0u};
 }
-inline const std::string& GetArgs::clientid() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetArgs.ClientId)
-  return _internal_clientid();
+inline uint64_t RegisterSessionArgs::_internal_nonce() const {
+  return _impl_.nonce_;
 }
-inline void GetArgs::set_clientid(const std::string& value) {
-  _internal_set_clientid(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetArgs.ClientId)
+inline uint64_t RegisterSessionArgs::nonce() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.RegisterSessionArgs.Nonce)
+  return _internal_nonce();
 }
-inline std::string* GetArgs::mutable_clientid() {
-  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.GetArgs.ClientId)
-  return _internal_mutable_clientid();
+inline void RegisterSessionArgs::_internal_set_nonce(uint64_t value) {
+  
+  _impl_.nonce_ = value;
 }
-inline const std::string& GetArgs::_internal_clientid() const {
-  return clientid_.Get();
+inline void RegisterSessionArgs::set_nonce(uint64_t value) {
+  _internal_set_nonce(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.RegisterSessionArgs.Nonce)
+}
+
+// -------------------------------------------------------------------
+
+// RegisterSessionReply
+
+// bytes Err = 1;
+inline void RegisterSessionReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
+}
+inline const std::string& RegisterSessionReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.RegisterSessionReply.Err)
+  return _internal_err();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RegisterSessionReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.RegisterSessionReply.Err)
+}
+inline std::string* RegisterSessionReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.RegisterSessionReply.Err)
+  return _s;
+}
+inline const std::string& RegisterSessionReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void RegisterSessionReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RegisterSessionReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RegisterSessionReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.RegisterSessionReply.Err)
+  return _impl_.err_.Release();
+}
+inline void RegisterSessionReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.RegisterSessionReply.Err)
 }
-inline void GetArgs::_internal_set_clientid(const std::string& value) {
 
-  clientid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+// uint64 SessionId = 2;
+inline void RegisterSessionReply::clear_sessionid() {
+  _impl_.sessionid_ = uint64_t{0u};
+}
+inline uint64_t RegisterSessionReply::_internal_sessionid() const {
+  return _impl_.sessionid_;
+}
+inline uint64_t RegisterSessionReply::sessionid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.RegisterSessionReply.SessionId)
+  return _internal_sessionid();
+}
+inline void RegisterSessionReply::_internal_set_sessionid(uint64_t value) {
+  
+  _impl_.sessionid_ = value;
+}
+inline void RegisterSessionReply::set_sessionid(uint64_t value) {
+  _internal_set_sessionid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.RegisterSessionReply.SessionId)
 }
-inline void GetArgs::set_clientid(std::string&& value) {
 
-  clientid_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.GetArgs.ClientId)
+// bytes ClientId = 3;
+inline void RegisterSessionReply::clear_clientid() {
+  _impl_.clientid_.ClearToEmpty();
+}
+inline const std::string& RegisterSessionReply::clientid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.RegisterSessionReply.ClientId)
+  return _internal_clientid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RegisterSessionReply::set_clientid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.clientid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.RegisterSessionReply.ClientId)
+}
+inline std::string* RegisterSessionReply::mutable_clientid() {
+  std::string* _s = _internal_mutable_clientid();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.RegisterSessionReply.ClientId)
+  return _s;
+}
+inline const std::string& RegisterSessionReply::_internal_clientid() const {
+  return _impl_.clientid_.Get();
+}
+inline void RegisterSessionReply::_internal_set_clientid(const std::string& value) {
+  
+  _impl_.clientid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RegisterSessionReply::_internal_mutable_clientid() {
+  
+  return _impl_.clientid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RegisterSessionReply::release_clientid() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.RegisterSessionReply.ClientId)
+  return _impl_.clientid_.Release();
+}
+inline void RegisterSessionReply::set_allocated_clientid(std::string* clientid) {
+  if (clientid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.clientid_.SetAllocated(clientid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.clientid_.IsDefault()) {
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.RegisterSessionReply.ClientId)
 }
-inline void GetArgs::set_clientid(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
 
-  clientid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.GetArgs.ClientId)
+// int64 RetryAfterMs = 4;
+inline void RegisterSessionReply::clear_retryafterms() {
+  _impl_.retryafterms_ = int64_t{0};
+}
+inline int64_t RegisterSessionReply::_internal_retryafterms() const {
+  return _impl_.retryafterms_;
 }
-inline void GetArgs::set_clientid(const void* value,
-    size_t size) {
+inline int64_t RegisterSessionReply::retryafterms() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.RegisterSessionReply.RetryAfterMs)
+  return _internal_retryafterms();
+}
+inline void RegisterSessionReply::_internal_set_retryafterms(int64_t value) {
+  
+  _impl_.retryafterms_ = value;
+}
+inline void RegisterSessionReply::set_retryafterms(int64_t value) {
+  _internal_set_retryafterms(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.RegisterSessionReply.RetryAfterMs)
+}
+
+// -------------------------------------------------------------------
+
+// CdcEntry
 
-  clientid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.GetArgs.ClientId)
+// int64 Index = 1;
+inline void CdcEntry::clear_index() {
+  _impl_.index_ = int64_t{0};
+}
+inline int64_t CdcEntry::_internal_index() const {
+  return _impl_.index_;
+}
+inline int64_t CdcEntry::index() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.CdcEntry.Index)
+  return _internal_index();
+}
+inline void CdcEntry::_internal_set_index(int64_t value) {
+  
+  _impl_.index_ = value;
+}
+inline void CdcEntry::set_index(int64_t value) {
+  _internal_set_index(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.CdcEntry.Index)
 }
-inline std::string* GetArgs::_internal_mutable_clientid() {
 
-  return clientid_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// int64 Term = 2;
+inline void CdcEntry::clear_term() {
+  _impl_.term_ = int64_t{0};
 }
-inline std::string* GetArgs::release_clientid() {
-  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.GetArgs.ClientId)
-  return clientid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline int64_t CdcEntry::_internal_term() const {
+  return _impl_.term_;
+}
+inline int64_t CdcEntry::term() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.CdcEntry.Term)
+  return _internal_term();
+}
+inline void CdcEntry::_internal_set_term(int64_t value) {
+  
+  _impl_.term_ = value;
+}
+inline void CdcEntry::set_term(int64_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.CdcEntry.Term)
 }
-inline void GetArgs::set_allocated_clientid(std::string* clientid) {
-  if (clientid != nullptr) {
 
+// bytes Operation = 3;
+inline void CdcEntry::clear_operation() {
+  _impl_.operation_.ClearToEmpty();
+}
+inline const std::string& CdcEntry::operation() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.CdcEntry.Operation)
+  return _internal_operation();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CdcEntry::set_operation(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.operation_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.CdcEntry.Operation)
+}
+inline std::string* CdcEntry::mutable_operation() {
+  std::string* _s = _internal_mutable_operation();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.CdcEntry.Operation)
+  return _s;
+}
+inline const std::string& CdcEntry::_internal_operation() const {
+  return _impl_.operation_.Get();
+}
+inline void CdcEntry::_internal_set_operation(const std::string& value) {
+  
+  _impl_.operation_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CdcEntry::_internal_mutable_operation() {
+  
+  return _impl_.operation_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CdcEntry::release_operation() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.CdcEntry.Operation)
+  return _impl_.operation_.Release();
+}
+inline void CdcEntry::set_allocated_operation(std::string* operation) {
+  if (operation != nullptr) {
+    
   } else {
-
+    
   }
-  clientid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), clientid,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.GetArgs.ClientId)
+  _impl_.operation_.SetAllocated(operation, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.operation_.IsDefault()) {
+    _impl_.operation_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.CdcEntry.Operation)
 }
-inline std::string* GetArgs::unsafe_arena_release_clientid() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftKVRpcProctoc.GetArgs.ClientId)
-  GOOGLE_DCHECK(GetArena() != nullptr);
 
-  return clientid_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+// bytes Key = 4;
+inline void CdcEntry::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& CdcEntry::key() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.CdcEntry.Key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CdcEntry::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.CdcEntry.Key)
+}
+inline std::string* CdcEntry::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.CdcEntry.Key)
+  return _s;
+}
+inline const std::string& CdcEntry::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void CdcEntry::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CdcEntry::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CdcEntry::release_key() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.CdcEntry.Key)
+  return _impl_.key_.Release();
+}
+inline void CdcEntry::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.CdcEntry.Key)
 }
-inline void GetArgs::unsafe_arena_set_allocated_clientid(
-    std::string* clientid) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (clientid != nullptr) {
 
+// bytes Value = 5;
+inline void CdcEntry::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& CdcEntry::value() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.CdcEntry.Value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CdcEntry::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.CdcEntry.Value)
+}
+inline std::string* CdcEntry::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.CdcEntry.Value)
+  return _s;
+}
+inline const std::string& CdcEntry::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void CdcEntry::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CdcEntry::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CdcEntry::release_value() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.CdcEntry.Value)
+  return _impl_.value_.Release();
+}
+inline void CdcEntry::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
   } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.CdcEntry.Value)
+}
 
+// bytes ClientId = 6;
+inline void CdcEntry::clear_clientid() {
+  _impl_.clientid_.ClearToEmpty();
+}
+inline const std::string& CdcEntry::clientid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.CdcEntry.ClientId)
+  return _internal_clientid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CdcEntry::set_clientid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.clientid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.CdcEntry.ClientId)
+}
+inline std::string* CdcEntry::mutable_clientid() {
+  std::string* _s = _internal_mutable_clientid();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.CdcEntry.ClientId)
+  return _s;
+}
+inline const std::string& CdcEntry::_internal_clientid() const {
+  return _impl_.clientid_.Get();
+}
+inline void CdcEntry::_internal_set_clientid(const std::string& value) {
+  
+  _impl_.clientid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CdcEntry::_internal_mutable_clientid() {
+  
+  return _impl_.clientid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CdcEntry::release_clientid() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.CdcEntry.ClientId)
+  return _impl_.clientid_.Release();
+}
+inline void CdcEntry::set_allocated_clientid(std::string* clientid) {
+  if (clientid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.clientid_.SetAllocated(clientid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.clientid_.IsDefault()) {
+    _impl_.clientid_.Set("", GetArenaForAllocation());
   }
-  clientid_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      clientid, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftKVRpcProctoc.GetArgs.ClientId)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.CdcEntry.ClientId)
 }
 
-// int32 RequestId = 3;
-inline void GetArgs::clear_requestid() {
-  requestid_ = 0;
+// int32 RequestId = 7;
+inline void CdcEntry::clear_requestid() {
+  _impl_.requestid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GetArgs::_internal_requestid() const {
-  return requestid_;
+inline int32_t CdcEntry::_internal_requestid() const {
+  return _impl_.requestid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GetArgs::requestid() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetArgs.RequestId)
+inline int32_t CdcEntry::requestid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.CdcEntry.RequestId)
   return _internal_requestid();
 }
-inline void GetArgs::_internal_set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  requestid_ = value;
+inline void CdcEntry::_internal_set_requestid(int32_t value) {
+  
+  _impl_.requestid_ = value;
 }
-inline void GetArgs::set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void CdcEntry::set_requestid(int32_t value) {
   _internal_set_requestid(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetArgs.RequestId)
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.CdcEntry.RequestId)
 }
 
-// -------------------------------------------------------------------
-
-// GetReply
-
-// bytes Err = 1;
-inline void GetReply::clear_err() {
-  err_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// int64 TimestampMs = 8;
+inline void CdcEntry::clear_timestampms() {
+  _impl_.timestampms_ = int64_t{0};
 }
-inline const std::string& GetReply::err() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetReply.Err)
-  return _internal_err();
+inline int64_t CdcEntry::_internal_timestampms() const {
+  return _impl_.timestampms_;
 }
-inline void GetReply::set_err(const std::string& value) {
-  _internal_set_err(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetReply.Err)
+inline int64_t CdcEntry::timestampms() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.CdcEntry.TimestampMs)
+  return _internal_timestampms();
 }
-inline std::string* GetReply::mutable_err() {
-  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.GetReply.Err)
-  return _internal_mutable_err();
+inline void CdcEntry::_internal_set_timestampms(int64_t value) {
+  
+  _impl_.timestampms_ = value;
 }
-inline const std::string& GetReply::_internal_err() const {
-  return err_.Get();
+inline void CdcEntry::set_timestampms(int64_t value) {
+  _internal_set_timestampms(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.CdcEntry.TimestampMs)
 }
-inline void GetReply::_internal_set_err(const std::string& value) {
 
-  err_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+// int64 TtlMs = 9;
+inline void CdcEntry::clear_ttlms() {
+  _impl_.ttlms_ = int64_t{0};
 }
-inline void GetReply::set_err(std::string&& value) {
-
-  err_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.GetReply.Err)
+inline int64_t CdcEntry::_internal_ttlms() const {
+  return _impl_.ttlms_;
 }
-inline void GetReply::set_err(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-
-  err_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.GetReply.Err)
+inline int64_t CdcEntry::ttlms() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.CdcEntry.TtlMs)
+  return _internal_ttlms();
 }
-inline void GetReply::set_err(const void* value,
-    size_t size) {
-
-  err_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.GetReply.Err)
+inline void CdcEntry::_internal_set_ttlms(int64_t value) {
+  
+  _impl_.ttlms_ = value;
+}
+inline void CdcEntry::set_ttlms(int64_t value) {
+  _internal_set_ttlms(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.CdcEntry.TtlMs)
 }
-inline std::string* GetReply::_internal_mutable_err() {
 
-  return err_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// repeated .raftKVRpcProctoc.WriteOp Batch = 10;
+inline int CdcEntry::_internal_batch_size() const {
+  return _impl_.batch_.size();
 }
-inline std::string* GetReply::release_err() {
-  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.GetReply.Err)
-  return err_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline int CdcEntry::batch_size() const {
+  return _internal_batch_size();
+}
+inline void CdcEntry::clear_batch() {
+  _impl_.batch_.Clear();
+}
+inline ::raftKVRpcProctoc::WriteOp* CdcEntry::mutable_batch(int index) {
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.CdcEntry.Batch)
+  return _impl_.batch_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::WriteOp >*
+CdcEntry::mutable_batch() {
+  // @@protoc_insertion_point(field_mutable_list:raftKVRpcProctoc.CdcEntry.Batch)
+  return &_impl_.batch_;
+}
+inline const ::raftKVRpcProctoc::WriteOp& CdcEntry::_internal_batch(int index) const {
+  return _impl_.batch_.Get(index);
+}
+inline const ::raftKVRpcProctoc::WriteOp& CdcEntry::batch(int index) const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.CdcEntry.Batch)
+  return _internal_batch(index);
+}
+inline ::raftKVRpcProctoc::WriteOp* CdcEntry::_internal_add_batch() {
+  return _impl_.batch_.Add();
+}
+inline ::raftKVRpcProctoc::WriteOp* CdcEntry::add_batch() {
+  ::raftKVRpcProctoc::WriteOp* _add = _internal_add_batch();
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.CdcEntry.Batch)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::WriteOp >&
+CdcEntry::batch() const {
+  // @@protoc_insertion_point(field_list:raftKVRpcProctoc.CdcEntry.Batch)
+  return _impl_.batch_;
 }
-inline void GetReply::set_allocated_err(std::string* err) {
-  if (err != nullptr) {
 
+// bytes Command = 11;
+inline void CdcEntry::clear_command() {
+  _impl_.command_.ClearToEmpty();
+}
+inline const std::string& CdcEntry::command() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.CdcEntry.Command)
+  return _internal_command();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CdcEntry::set_command(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.command_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.CdcEntry.Command)
+}
+inline std::string* CdcEntry::mutable_command() {
+  std::string* _s = _internal_mutable_command();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.CdcEntry.Command)
+  return _s;
+}
+inline const std::string& CdcEntry::_internal_command() const {
+  return _impl_.command_.Get();
+}
+inline void CdcEntry::_internal_set_command(const std::string& value) {
+  
+  _impl_.command_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CdcEntry::_internal_mutable_command() {
+  
+  return _impl_.command_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CdcEntry::release_command() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.CdcEntry.Command)
+  return _impl_.command_.Release();
+}
+inline void CdcEntry::set_allocated_command(std::string* command) {
+  if (command != nullptr) {
+    
   } else {
-
+    
   }
-  err_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), err,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.GetReply.Err)
+  _impl_.command_.SetAllocated(command, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.command_.IsDefault()) {
+    _impl_.command_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.CdcEntry.Command)
 }
-inline std::string* GetReply::unsafe_arena_release_err() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftKVRpcProctoc.GetReply.Err)
-  GOOGLE_DCHECK(GetArena() != nullptr);
 
-  return err_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void GetReply::unsafe_arena_set_allocated_err(
-    std::string* err) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (err != nullptr) {
+// -------------------------------------------------------------------
 
-  } else {
+// ExportLogArgs
 
+// bytes ConsumerId = 1;
+inline void ExportLogArgs::clear_consumerid() {
+  _impl_.consumerid_.ClearToEmpty();
+}
+inline const std::string& ExportLogArgs::consumerid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ExportLogArgs.ConsumerId)
+  return _internal_consumerid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ExportLogArgs::set_consumerid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.consumerid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ExportLogArgs.ConsumerId)
+}
+inline std::string* ExportLogArgs::mutable_consumerid() {
+  std::string* _s = _internal_mutable_consumerid();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.ExportLogArgs.ConsumerId)
+  return _s;
+}
+inline const std::string& ExportLogArgs::_internal_consumerid() const {
+  return _impl_.consumerid_.Get();
+}
+inline void ExportLogArgs::_internal_set_consumerid(const std::string& value) {
+  
+  _impl_.consumerid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ExportLogArgs::_internal_mutable_consumerid() {
+  
+  return _impl_.consumerid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ExportLogArgs::release_consumerid() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.ExportLogArgs.ConsumerId)
+  return _impl_.consumerid_.Release();
+}
+inline void ExportLogArgs::set_allocated_consumerid(std::string* consumerid) {
+  if (consumerid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.consumerid_.SetAllocated(consumerid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.consumerid_.IsDefault()) {
+    _impl_.consumerid_.Set("", GetArenaForAllocation());
   }
-  err_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      err, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftKVRpcProctoc.GetReply.Err)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.ExportLogArgs.ConsumerId)
 }
 
-// bytes Value = 2;
-inline void GetReply::clear_value() {
-  value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// int64 FromIndex = 2;
+inline void ExportLogArgs::clear_fromindex() {
+  _impl_.fromindex_ = int64_t{0};
 }
-inline const std::string& GetReply::value() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetReply.Value)
-  return _internal_value();
+inline int64_t ExportLogArgs::_internal_fromindex() const {
+  return _impl_.fromindex_;
 }
-inline void GetReply::set_value(const std::string& value) {
-  _internal_set_value(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetReply.Value)
+inline int64_t ExportLogArgs::fromindex() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ExportLogArgs.FromIndex)
+  return _internal_fromindex();
 }
-inline std::string* GetReply::mutable_value() {
-  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.GetReply.Value)
-  return _internal_mutable_value();
+inline void ExportLogArgs::_internal_set_fromindex(int64_t value) {
+  
+  _impl_.fromindex_ = value;
 }
-inline const std::string& GetReply::_internal_value() const {
-  return value_.Get();
+inline void ExportLogArgs::set_fromindex(int64_t value) {
+  _internal_set_fromindex(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ExportLogArgs.FromIndex)
 }
-inline void GetReply::_internal_set_value(const std::string& value) {
 
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+// int32 MaxEntries = 3;
+inline void ExportLogArgs::clear_maxentries() {
+  _impl_.maxentries_ = 0;
 }
-inline void GetReply::set_value(std::string&& value) {
-
-  value_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.GetReply.Value)
+inline int32_t ExportLogArgs::_internal_maxentries() const {
+  return _impl_.maxentries_;
 }
-inline void GetReply::set_value(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.GetReply.Value)
+inline int32_t ExportLogArgs::maxentries() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ExportLogArgs.MaxEntries)
+  return _internal_maxentries();
+}
+inline void ExportLogArgs::_internal_set_maxentries(int32_t value) {
+  
+  _impl_.maxentries_ = value;
+}
+inline void ExportLogArgs::set_maxentries(int32_t value) {
+  _internal_set_maxentries(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ExportLogArgs.MaxEntries)
 }
-inline void GetReply::set_value(const void* value,
-    size_t size) {
 
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.GetReply.Value)
+// bool IncludeReads = 4;
+inline void ExportLogArgs::clear_includereads() {
+  _impl_.includereads_ = false;
+}
+inline bool ExportLogArgs::_internal_includereads() const {
+  return _impl_.includereads_;
+}
+inline bool ExportLogArgs::includereads() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ExportLogArgs.IncludeReads)
+  return _internal_includereads();
+}
+inline void ExportLogArgs::_internal_set_includereads(bool value) {
+  
+  _impl_.includereads_ = value;
+}
+inline void ExportLogArgs::set_includereads(bool value) {
+  _internal_set_includereads(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ExportLogArgs.IncludeReads)
 }
-inline std::string* GetReply::_internal_mutable_value() {
 
-  return value_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// int64 SnapshotIndex = 5;
+inline void ExportLogArgs::clear_snapshotindex() {
+  _impl_.snapshotindex_ = int64_t{0};
 }
-inline std::string* GetReply::release_value() {
-  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.GetReply.Value)
-  return value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline int64_t ExportLogArgs::_internal_snapshotindex() const {
+  return _impl_.snapshotindex_;
+}
+inline int64_t ExportLogArgs::snapshotindex() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ExportLogArgs.SnapshotIndex)
+  return _internal_snapshotindex();
+}
+inline void ExportLogArgs::_internal_set_snapshotindex(int64_t value) {
+  
+  _impl_.snapshotindex_ = value;
+}
+inline void ExportLogArgs::set_snapshotindex(int64_t value) {
+  _internal_set_snapshotindex(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ExportLogArgs.SnapshotIndex)
 }
-inline void GetReply::set_allocated_value(std::string* value) {
-  if (value != nullptr) {
 
+// bytes SnapshotResumeKey = 6;
+inline void ExportLogArgs::clear_snapshotresumekey() {
+  _impl_.snapshotresumekey_.ClearToEmpty();
+}
+inline const std::string& ExportLogArgs::snapshotresumekey() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ExportLogArgs.SnapshotResumeKey)
+  return _internal_snapshotresumekey();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ExportLogArgs::set_snapshotresumekey(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.snapshotresumekey_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ExportLogArgs.SnapshotResumeKey)
+}
+inline std::string* ExportLogArgs::mutable_snapshotresumekey() {
+  std::string* _s = _internal_mutable_snapshotresumekey();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.ExportLogArgs.SnapshotResumeKey)
+  return _s;
+}
+inline const std::string& ExportLogArgs::_internal_snapshotresumekey() const {
+  return _impl_.snapshotresumekey_.Get();
+}
+inline void ExportLogArgs::_internal_set_snapshotresumekey(const std::string& value) {
+  
+  _impl_.snapshotresumekey_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ExportLogArgs::_internal_mutable_snapshotresumekey() {
+  
+  return _impl_.snapshotresumekey_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ExportLogArgs::release_snapshotresumekey() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.ExportLogArgs.SnapshotResumeKey)
+  return _impl_.snapshotresumekey_.Release();
+}
+inline void ExportLogArgs::set_allocated_snapshotresumekey(std::string* snapshotresumekey) {
+  if (snapshotresumekey != nullptr) {
+    
   } else {
-
+    
   }
-  value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.GetReply.Value)
+  _impl_.snapshotresumekey_.SetAllocated(snapshotresumekey, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.snapshotresumekey_.IsDefault()) {
+    _impl_.snapshotresumekey_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.ExportLogArgs.SnapshotResumeKey)
 }
-inline std::string* GetReply::unsafe_arena_release_value() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftKVRpcProctoc.GetReply.Value)
-  GOOGLE_DCHECK(GetArena() != nullptr);
 
-  return value_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+// -------------------------------------------------------------------
+
+// ExportLogReply
+
+// bytes Err = 1;
+inline void ExportLogReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
+}
+inline const std::string& ExportLogReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ExportLogReply.Err)
+  return _internal_err();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ExportLogReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ExportLogReply.Err)
+}
+inline std::string* ExportLogReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.ExportLogReply.Err)
+  return _s;
+}
+inline const std::string& ExportLogReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void ExportLogReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ExportLogReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ExportLogReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.ExportLogReply.Err)
+  return _impl_.err_.Release();
 }
-inline void GetReply::unsafe_arena_set_allocated_value(
-    std::string* value) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (value != nullptr) {
-
+inline void ExportLogReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
   } else {
-
+    
   }
-  value_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      value, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftKVRpcProctoc.GetReply.Value)
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.ExportLogReply.Err)
 }
 
-// -------------------------------------------------------------------
-
-// PutAppendArgs
-
-// bytes Key = 1;
-inline void PutAppendArgs::clear_key() {
-  key_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// repeated .raftKVRpcProctoc.CdcEntry Entries = 2;
+inline int ExportLogReply::_internal_entries_size() const {
+  return _impl_.entries_.size();
 }
-inline const std::string& PutAppendArgs::key() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.Key)
-  return _internal_key();
+inline int ExportLogReply::entries_size() const {
+  return _internal_entries_size();
 }
-inline void PutAppendArgs::set_key(const std::string& value) {
-  _internal_set_key(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.Key)
+inline void ExportLogReply::clear_entries() {
+  _impl_.entries_.Clear();
 }
-inline std::string* PutAppendArgs::mutable_key() {
-  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendArgs.Key)
-  return _internal_mutable_key();
+inline ::raftKVRpcProctoc::CdcEntry* ExportLogReply::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.ExportLogReply.Entries)
+  return _impl_.entries_.Mutable(index);
 }
-inline const std::string& PutAppendArgs::_internal_key() const {
-  return key_.Get();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::CdcEntry >*
+ExportLogReply::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:raftKVRpcProctoc.ExportLogReply.Entries)
+  return &_impl_.entries_;
 }
-inline void PutAppendArgs::_internal_set_key(const std::string& value) {
-
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline const ::raftKVRpcProctoc::CdcEntry& ExportLogReply::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
 }
-inline void PutAppendArgs::set_key(std::string&& value) {
-
-  key_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.PutAppendArgs.Key)
+inline const ::raftKVRpcProctoc::CdcEntry& ExportLogReply::entries(int index) const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ExportLogReply.Entries)
+  return _internal_entries(index);
 }
-inline void PutAppendArgs::set_key(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.PutAppendArgs.Key)
+inline ::raftKVRpcProctoc::CdcEntry* ExportLogReply::_internal_add_entries() {
+  return _impl_.entries_.Add();
 }
-inline void PutAppendArgs::set_key(const void* value,
-    size_t size) {
-
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.PutAppendArgs.Key)
+inline ::raftKVRpcProctoc::CdcEntry* ExportLogReply::add_entries() {
+  ::raftKVRpcProctoc::CdcEntry* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.ExportLogReply.Entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::CdcEntry >&
+ExportLogReply::entries() const {
+  // @@protoc_insertion_point(field_list:raftKVRpcProctoc.ExportLogReply.Entries)
+  return _impl_.entries_;
 }
-inline std::string* PutAppendArgs::_internal_mutable_key() {
 
-  return key_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// int64 NextIndex = 3;
+inline void ExportLogReply::clear_nextindex() {
+  _impl_.nextindex_ = int64_t{0};
 }
-inline std::string* PutAppendArgs::release_key() {
-  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendArgs.Key)
-  return key_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline int64_t ExportLogReply::_internal_nextindex() const {
+  return _impl_.nextindex_;
 }
-inline void PutAppendArgs::set_allocated_key(std::string* key) {
-  if (key != nullptr) {
-
-  } else {
-
-  }
-  key_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), key,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendArgs.Key)
+inline int64_t ExportLogReply::nextindex() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ExportLogReply.NextIndex)
+  return _internal_nextindex();
 }
-inline std::string* PutAppendArgs::unsafe_arena_release_key() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftKVRpcProctoc.PutAppendArgs.Key)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-
-  return key_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+inline void ExportLogReply::_internal_set_nextindex(int64_t value) {
+  
+  _impl_.nextindex_ = value;
 }
-inline void PutAppendArgs::unsafe_arena_set_allocated_key(
-    std::string* key) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (key != nullptr) {
-
-  } else {
-
-  }
-  key_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      key, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftKVRpcProctoc.PutAppendArgs.Key)
+inline void ExportLogReply::set_nextindex(int64_t value) {
+  _internal_set_nextindex(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ExportLogReply.NextIndex)
 }
 
-// bytes Value = 2;
-inline void PutAppendArgs::clear_value() {
-  value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// int64 SnapshotIndex = 4;
+inline void ExportLogReply::clear_snapshotindex() {
+  _impl_.snapshotindex_ = int64_t{0};
 }
-inline const std::string& PutAppendArgs::value() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.Value)
-  return _internal_value();
+inline int64_t ExportLogReply::_internal_snapshotindex() const {
+  return _impl_.snapshotindex_;
 }
-inline void PutAppendArgs::set_value(const std::string& value) {
-  _internal_set_value(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.Value)
+inline int64_t ExportLogReply::snapshotindex() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ExportLogReply.SnapshotIndex)
+  return _internal_snapshotindex();
 }
-inline std::string* PutAppendArgs::mutable_value() {
-  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendArgs.Value)
-  return _internal_mutable_value();
+inline void ExportLogReply::_internal_set_snapshotindex(int64_t value) {
+  
+  _impl_.snapshotindex_ = value;
 }
-inline const std::string& PutAppendArgs::_internal_value() const {
-  return value_.Get();
+inline void ExportLogReply::set_snapshotindex(int64_t value) {
+  _internal_set_snapshotindex(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ExportLogReply.SnapshotIndex)
 }
-inline void PutAppendArgs::_internal_set_value(const std::string& value) {
 
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+// repeated .raftKVRpcProctoc.KeyValue SnapshotKvs = 5;
+inline int ExportLogReply::_internal_snapshotkvs_size() const {
+  return _impl_.snapshotkvs_.size();
 }
-inline void PutAppendArgs::set_value(std::string&& value) {
-
-  value_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.PutAppendArgs.Value)
+inline int ExportLogReply::snapshotkvs_size() const {
+  return _internal_snapshotkvs_size();
 }
-inline void PutAppendArgs::set_value(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.PutAppendArgs.Value)
+inline void ExportLogReply::clear_snapshotkvs() {
+  _impl_.snapshotkvs_.Clear();
 }
-inline void PutAppendArgs::set_value(const void* value,
-    size_t size) {
-
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.PutAppendArgs.Value)
+inline ::raftKVRpcProctoc::KeyValue* ExportLogReply::mutable_snapshotkvs(int index) {
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.ExportLogReply.SnapshotKvs)
+  return _impl_.snapshotkvs_.Mutable(index);
 }
-inline std::string* PutAppendArgs::_internal_mutable_value() {
-
-  return value_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::KeyValue >*
+ExportLogReply::mutable_snapshotkvs() {
+  // @@protoc_insertion_point(field_mutable_list:raftKVRpcProctoc.ExportLogReply.SnapshotKvs)
+  return &_impl_.snapshotkvs_;
 }
-inline std::string* PutAppendArgs::release_value() {
-  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendArgs.Value)
-  return value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline const ::raftKVRpcProctoc::KeyValue& ExportLogReply::_internal_snapshotkvs(int index) const {
+  return _impl_.snapshotkvs_.Get(index);
 }
-inline void PutAppendArgs::set_allocated_value(std::string* value) {
-  if (value != nullptr) {
-
-  } else {
-
-  }
-  value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendArgs.Value)
+inline const ::raftKVRpcProctoc::KeyValue& ExportLogReply::snapshotkvs(int index) const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ExportLogReply.SnapshotKvs)
+  return _internal_snapshotkvs(index);
 }
-inline std::string* PutAppendArgs::unsafe_arena_release_value() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftKVRpcProctoc.PutAppendArgs.Value)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-
-  return value_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+inline ::raftKVRpcProctoc::KeyValue* ExportLogReply::_internal_add_snapshotkvs() {
+  return _impl_.snapshotkvs_.Add();
 }
-inline void PutAppendArgs::unsafe_arena_set_allocated_value(
-    std::string* value) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (value != nullptr) {
-
-  } else {
-
-  }
-  value_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      value, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftKVRpcProctoc.PutAppendArgs.Value)
+inline ::raftKVRpcProctoc::KeyValue* ExportLogReply::add_snapshotkvs() {
+  ::raftKVRpcProctoc::KeyValue* _add = _internal_add_snapshotkvs();
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.ExportLogReply.SnapshotKvs)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::KeyValue >&
+ExportLogReply::snapshotkvs() const {
+  // @@protoc_insertion_point(field_list:raftKVRpcProctoc.ExportLogReply.SnapshotKvs)
+  return _impl_.snapshotkvs_;
 }
 
-// bytes Op = 3;
-inline void PutAppendArgs::clear_op() {
-  op_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// bytes SnapshotResumeKey = 6;
+inline void ExportLogReply::clear_snapshotresumekey() {
+  _impl_.snapshotresumekey_.ClearToEmpty();
 }
-inline const std::string& PutAppendArgs::op() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.Op)
-  return _internal_op();
+inline const std::string& ExportLogReply::snapshotresumekey() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ExportLogReply.SnapshotResumeKey)
+  return _internal_snapshotresumekey();
 }
-inline void PutAppendArgs::set_op(const std::string& value) {
-  _internal_set_op(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.Op)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ExportLogReply::set_snapshotresumekey(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.snapshotresumekey_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ExportLogReply.SnapshotResumeKey)
 }
-inline std::string* PutAppendArgs::mutable_op() {
-  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendArgs.Op)
-  return _internal_mutable_op();
+inline std::string* ExportLogReply::mutable_snapshotresumekey() {
+  std::string* _s = _internal_mutable_snapshotresumekey();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.ExportLogReply.SnapshotResumeKey)
+  return _s;
 }
-inline const std::string& PutAppendArgs::_internal_op() const {
-  return op_.Get();
+inline const std::string& ExportLogReply::_internal_snapshotresumekey() const {
+  return _impl_.snapshotresumekey_.Get();
 }
-inline void PutAppendArgs::_internal_set_op(const std::string& value) {
-
-  op_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline void ExportLogReply::_internal_set_snapshotresumekey(const std::string& value) {
+  
+  _impl_.snapshotresumekey_.Set(value, GetArenaForAllocation());
 }
-inline void PutAppendArgs::set_op(std::string&& value) {
-
-  op_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.PutAppendArgs.Op)
+inline std::string* ExportLogReply::_internal_mutable_snapshotresumekey() {
+  
+  return _impl_.snapshotresumekey_.Mutable(GetArenaForAllocation());
 }
-inline void PutAppendArgs::set_op(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-
-  op_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.PutAppendArgs.Op)
+inline std::string* ExportLogReply::release_snapshotresumekey() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.ExportLogReply.SnapshotResumeKey)
+  return _impl_.snapshotresumekey_.Release();
 }
-inline void PutAppendArgs::set_op(const void* value,
-    size_t size) {
-
-  op_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.PutAppendArgs.Op)
+inline void ExportLogReply::set_allocated_snapshotresumekey(std::string* snapshotresumekey) {
+  if (snapshotresumekey != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.snapshotresumekey_.SetAllocated(snapshotresumekey, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.snapshotresumekey_.IsDefault()) {
+    _impl_.snapshotresumekey_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.ExportLogReply.SnapshotResumeKey)
 }
-inline std::string* PutAppendArgs::_internal_mutable_op() {
 
-  return op_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline std::string* PutAppendArgs::release_op() {
-  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendArgs.Op)
-  return op_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline void PutAppendArgs::set_allocated_op(std::string* op) {
-  if (op != nullptr) {
+// -------------------------------------------------------------------
 
-  } else {
+// CommitCdcCheckpointArgs
 
-  }
-  op_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), op,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendArgs.Op)
+// bytes ConsumerId = 1;
+inline void CommitCdcCheckpointArgs::clear_consumerid() {
+  _impl_.consumerid_.ClearToEmpty();
 }
-inline std::string* PutAppendArgs::unsafe_arena_release_op() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftKVRpcProctoc.PutAppendArgs.Op)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-
-  return op_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+inline const std::string& CommitCdcCheckpointArgs::consumerid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.CommitCdcCheckpointArgs.ConsumerId)
+  return _internal_consumerid();
 }
-inline void PutAppendArgs::unsafe_arena_set_allocated_op(
-    std::string* op) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (op != nullptr) {
-
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CommitCdcCheckpointArgs::set_consumerid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.consumerid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.CommitCdcCheckpointArgs.ConsumerId)
+}
+inline std::string* CommitCdcCheckpointArgs::mutable_consumerid() {
+  std::string* _s = _internal_mutable_consumerid();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.CommitCdcCheckpointArgs.ConsumerId)
+  return _s;
+}
+inline const std::string& CommitCdcCheckpointArgs::_internal_consumerid() const {
+  return _impl_.consumerid_.Get();
+}
+inline void CommitCdcCheckpointArgs::_internal_set_consumerid(const std::string& value) {
+  
+  _impl_.consumerid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CommitCdcCheckpointArgs::_internal_mutable_consumerid() {
+  
+  return _impl_.consumerid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CommitCdcCheckpointArgs::release_consumerid() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.CommitCdcCheckpointArgs.ConsumerId)
+  return _impl_.consumerid_.Release();
+}
+inline void CommitCdcCheckpointArgs::set_allocated_consumerid(std::string* consumerid) {
+  if (consumerid != nullptr) {
+    
   } else {
-
+    
+  }
+  _impl_.consumerid_.SetAllocated(consumerid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.consumerid_.IsDefault()) {
+    _impl_.consumerid_.Set("", GetArenaForAllocation());
   }
-  op_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      op, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftKVRpcProctoc.PutAppendArgs.Op)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.CommitCdcCheckpointArgs.ConsumerId)
 }
 
-// bytes ClientId = 4;
-inline void PutAppendArgs::clear_clientid() {
-  clientid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// int64 Index = 2;
+inline void CommitCdcCheckpointArgs::clear_index() {
+  _impl_.index_ = int64_t{0};
 }
-inline const std::string& PutAppendArgs::clientid() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.ClientId)
-  return _internal_clientid();
+inline int64_t CommitCdcCheckpointArgs::_internal_index() const {
+  return _impl_.index_;
 }
-inline void PutAppendArgs::set_clientid(const std::string& value) {
-  _internal_set_clientid(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.ClientId)
+inline int64_t CommitCdcCheckpointArgs::index() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.CommitCdcCheckpointArgs.Index)
+  return _internal_index();
 }
-inline std::string* PutAppendArgs::mutable_clientid() {
-  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendArgs.ClientId)
-  return _internal_mutable_clientid();
+inline void CommitCdcCheckpointArgs::_internal_set_index(int64_t value) {
+  
+  _impl_.index_ = value;
 }
-inline const std::string& PutAppendArgs::_internal_clientid() const {
-  return clientid_.Get();
+inline void CommitCdcCheckpointArgs::set_index(int64_t value) {
+  _internal_set_index(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.CommitCdcCheckpointArgs.Index)
 }
-inline void PutAppendArgs::_internal_set_clientid(const std::string& value) {
 
-  clientid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+// bytes ClientId = 3;
+inline void CommitCdcCheckpointArgs::clear_clientid() {
+  _impl_.clientid_.ClearToEmpty();
 }
-inline void PutAppendArgs::set_clientid(std::string&& value) {
-
-  clientid_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.PutAppendArgs.ClientId)
+inline const std::string& CommitCdcCheckpointArgs::clientid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.CommitCdcCheckpointArgs.ClientId)
+  return _internal_clientid();
 }
-inline void PutAppendArgs::set_clientid(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-
-  clientid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.PutAppendArgs.ClientId)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CommitCdcCheckpointArgs::set_clientid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.clientid_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.CommitCdcCheckpointArgs.ClientId)
 }
-inline void PutAppendArgs::set_clientid(const void* value,
-    size_t size) {
-
-  clientid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.PutAppendArgs.ClientId)
+inline std::string* CommitCdcCheckpointArgs::mutable_clientid() {
+  std::string* _s = _internal_mutable_clientid();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.CommitCdcCheckpointArgs.ClientId)
+  return _s;
 }
-inline std::string* PutAppendArgs::_internal_mutable_clientid() {
-
-  return clientid_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline const std::string& CommitCdcCheckpointArgs::_internal_clientid() const {
+  return _impl_.clientid_.Get();
 }
-inline std::string* PutAppendArgs::release_clientid() {
-  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendArgs.ClientId)
-  return clientid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void CommitCdcCheckpointArgs::_internal_set_clientid(const std::string& value) {
+  
+  _impl_.clientid_.Set(value, GetArenaForAllocation());
 }
-inline void PutAppendArgs::set_allocated_clientid(std::string* clientid) {
-  if (clientid != nullptr) {
-
-  } else {
-
-  }
-  clientid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), clientid,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendArgs.ClientId)
+inline std::string* CommitCdcCheckpointArgs::_internal_mutable_clientid() {
+  
+  return _impl_.clientid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* PutAppendArgs::unsafe_arena_release_clientid() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftKVRpcProctoc.PutAppendArgs.ClientId)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-
-  return clientid_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+inline std::string* CommitCdcCheckpointArgs::release_clientid() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.CommitCdcCheckpointArgs.ClientId)
+  return _impl_.clientid_.Release();
 }
-inline void PutAppendArgs::unsafe_arena_set_allocated_clientid(
-    std::string* clientid) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
+inline void CommitCdcCheckpointArgs::set_allocated_clientid(std::string* clientid) {
   if (clientid != nullptr) {
-
+    
   } else {
-
+    
+  }
+  _impl_.clientid_.SetAllocated(clientid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.clientid_.IsDefault()) {
+    _impl_.clientid_.Set("", GetArenaForAllocation());
   }
-  clientid_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      clientid, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftKVRpcProctoc.PutAppendArgs.ClientId)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.CommitCdcCheckpointArgs.ClientId)
 }
 
-// int32 RequestId = 5;
-inline void PutAppendArgs::clear_requestid() {
-  requestid_ = 0;
+// int32 RequestId = 4;
+inline void CommitCdcCheckpointArgs::clear_requestid() {
+  _impl_.requestid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 PutAppendArgs::_internal_requestid() const {
-  return requestid_;
+inline int32_t CommitCdcCheckpointArgs::_internal_requestid() const {
+  return _impl_.requestid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 PutAppendArgs::requestid() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.RequestId)
+inline int32_t CommitCdcCheckpointArgs::requestid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.CommitCdcCheckpointArgs.RequestId)
   return _internal_requestid();
 }
-inline void PutAppendArgs::_internal_set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  requestid_ = value;
+inline void CommitCdcCheckpointArgs::_internal_set_requestid(int32_t value) {
+  
+  _impl_.requestid_ = value;
 }
-inline void PutAppendArgs::set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void CommitCdcCheckpointArgs::set_requestid(int32_t value) {
   _internal_set_requestid(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.RequestId)
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.CommitCdcCheckpointArgs.RequestId)
 }
 
 // -------------------------------------------------------------------
 
-// PutAppendReply
+// CommitCdcCheckpointReply
 
 // bytes Err = 1;
-inline void PutAppendReply::clear_err() {
-  err_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void CommitCdcCheckpointReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
 }
-inline const std::string& PutAppendReply::err() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendReply.Err)
+inline const std::string& CommitCdcCheckpointReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.CommitCdcCheckpointReply.Err)
   return _internal_err();
 }
-inline void PutAppendReply::set_err(const std::string& value) {
-  _internal_set_err(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendReply.Err)
-}
-inline std::string* PutAppendReply::mutable_err() {
-  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendReply.Err)
-  return _internal_mutable_err();
-}
-inline const std::string& PutAppendReply::_internal_err() const {
-  return err_.Get();
-}
-inline void PutAppendReply::_internal_set_err(const std::string& value) {
-
-  err_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CommitCdcCheckpointReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.CommitCdcCheckpointReply.Err)
 }
-inline void PutAppendReply::set_err(std::string&& value) {
-
-  err_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.PutAppendReply.Err)
+inline std::string* CommitCdcCheckpointReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.CommitCdcCheckpointReply.Err)
+  return _s;
 }
-inline void PutAppendReply::set_err(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-
-  err_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.PutAppendReply.Err)
+inline const std::string& CommitCdcCheckpointReply::_internal_err() const {
+  return _impl_.err_.Get();
 }
-inline void PutAppendReply::set_err(const void* value,
-    size_t size) {
-
-  err_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.PutAppendReply.Err)
+inline void CommitCdcCheckpointReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
 }
-inline std::string* PutAppendReply::_internal_mutable_err() {
-
-  return err_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* CommitCdcCheckpointReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
 }
-inline std::string* PutAppendReply::release_err() {
-  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendReply.Err)
-  return err_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* CommitCdcCheckpointReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.CommitCdcCheckpointReply.Err)
+  return _impl_.err_.Release();
 }
-inline void PutAppendReply::set_allocated_err(std::string* err) {
+inline void CommitCdcCheckpointReply::set_allocated_err(std::string* err) {
   if (err != nullptr) {
-
+    
   } else {
-
+    
   }
-  err_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), err,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendReply.Err)
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.CommitCdcCheckpointReply.Err)
 }
-inline std::string* PutAppendReply::unsafe_arena_release_err() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftKVRpcProctoc.PutAppendReply.Err)
-  GOOGLE_DCHECK(GetArena() != nullptr);
 
-  return err_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+// int64 Index = 2;
+inline void CommitCdcCheckpointReply::clear_index() {
+  _impl_.index_ = int64_t{0};
+}
+inline int64_t CommitCdcCheckpointReply::_internal_index() const {
+  return _impl_.index_;
+}
+inline int64_t CommitCdcCheckpointReply::index() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.CommitCdcCheckpointReply.Index)
+  return _internal_index();
+}
+inline void CommitCdcCheckpointReply::_internal_set_index(int64_t value) {
+  
+  _impl_.index_ = value;
+}
+inline void CommitCdcCheckpointReply::set_index(int64_t value) {
+  _internal_set_index(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.CommitCdcCheckpointReply.Index)
 }
-inline void PutAppendReply::unsafe_arena_set_allocated_err(
-    std::string* err) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (err != nullptr) {
-
-  } else {
 
-  }
-  err_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      err, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftKVRpcProctoc.PutAppendReply.Err)
+// int64 RetryAfterMs = 3;
+inline void CommitCdcCheckpointReply::clear_retryafterms() {
+  _impl_.retryafterms_ = int64_t{0};
+}
+inline int64_t CommitCdcCheckpointReply::_internal_retryafterms() const {
+  return _impl_.retryafterms_;
+}
+inline int64_t CommitCdcCheckpointReply::retryafterms() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.CommitCdcCheckpointReply.RetryAfterMs)
+  return _internal_retryafterms();
+}
+inline void CommitCdcCheckpointReply::_internal_set_retryafterms(int64_t value) {
+  
+  _impl_.retryafterms_ = value;
+}
+inline void CommitCdcCheckpointReply::set_retryafterms(int64_t value) {
+  _internal_set_retryafterms(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.CommitCdcCheckpointReply.RetryAfterMs)
 }
 
 #ifdef __GNUC__
@@ -1714,12 +12052,97 @@ inline void PutAppendReply::unsafe_arena_set_allocated_err(
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace raftKVRpcProctoc
 
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::raftKVRpcProctoc::TxnCompare_Target> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::raftKVRpcProctoc::TxnCompare_Target>() {
+  return ::raftKVRpcProctoc::TxnCompare_Target_descriptor();
+}
+template <> struct is_proto_enum< ::raftKVRpcProctoc::TxnCompare_Result> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::raftKVRpcProctoc::TxnCompare_Result>() {
+  return ::raftKVRpcProctoc::TxnCompare_Result_descriptor();
+}
+template <> struct is_proto_enum< ::raftKVRpcProctoc::TxnOp_OpType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::raftKVRpcProctoc::TxnOp_OpType>() {
+  return ::raftKVRpcProctoc::TxnOp_OpType_descriptor();
+}
+template <> struct is_proto_enum< ::raftKVRpcProctoc::WatchEvent_EventType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::raftKVRpcProctoc::WatchEvent_EventType>() {
+  return ::raftKVRpcProctoc::WatchEvent_EventType_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>
-#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_kvServerRPC_2eproto
\ No newline at end of file
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_kvServerRPC_2eproto
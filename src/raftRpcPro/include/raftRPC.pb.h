@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3012000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3012004 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,9 +23,7 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
@@ -44,38 +42,30 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_raftRPC_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[7]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_raftRPC_2eproto;
 namespace raftRpcProctoc {
 class AppendEntriesArgs;
-class AppendEntriesArgsDefaultTypeInternal;
+struct AppendEntriesArgsDefaultTypeInternal;
 extern AppendEntriesArgsDefaultTypeInternal _AppendEntriesArgs_default_instance_;
 class AppendEntriesReply;
-class AppendEntriesReplyDefaultTypeInternal;
+struct AppendEntriesReplyDefaultTypeInternal;
 extern AppendEntriesReplyDefaultTypeInternal _AppendEntriesReply_default_instance_;
 class InstallSnapshotRequest;
-class InstallSnapshotRequestDefaultTypeInternal;
+struct InstallSnapshotRequestDefaultTypeInternal;
 extern InstallSnapshotRequestDefaultTypeInternal _InstallSnapshotRequest_default_instance_;
 class InstallSnapshotResponse;
-class InstallSnapshotResponseDefaultTypeInternal;
+struct InstallSnapshotResponseDefaultTypeInternal;
 extern InstallSnapshotResponseDefaultTypeInternal _InstallSnapshotResponse_default_instance_;
 class LogEntry;
-class LogEntryDefaultTypeInternal;
+struct LogEntryDefaultTypeInternal;
 extern LogEntryDefaultTypeInternal _LogEntry_default_instance_;
 class RequestVoteArgs;
-class RequestVoteArgsDefaultTypeInternal;
+struct RequestVoteArgsDefaultTypeInternal;
 extern RequestVoteArgsDefaultTypeInternal _RequestVoteArgs_default_instance_;
 class RequestVoteReply;
-class RequestVoteReplyDefaultTypeInternal;
+struct RequestVoteReplyDefaultTypeInternal;
 extern RequestVoteReplyDefaultTypeInternal _RequestVoteReply_default_instance_;
 }  // namespace raftRpcProctoc
 PROTOBUF_NAMESPACE_OPEN
@@ -91,11 +81,12 @@ namespace raftRpcProctoc {
 
 // ===================================================================
 
-class LogEntry PROTOBUF_FINAL :
+class LogEntry final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.LogEntry) */ {
  public:
-  inline LogEntry() : LogEntry(nullptr) {};
-  virtual ~LogEntry();
+  inline LogEntry() : LogEntry(nullptr) {}
+  ~LogEntry() override;
+  explicit PROTOBUF_CONSTEXPR LogEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   LogEntry(const LogEntry& from);
   LogEntry(LogEntry&& from) noexcept
@@ -108,8 +99,13 @@ class LogEntry PROTOBUF_FINAL :
     return *this;
   }
   inline LogEntry& operator=(LogEntry&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -120,14 +116,14 @@ class LogEntry PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LogEntry& default_instance() {
+    return *internal_default_instance();
   }
-  static const LogEntry& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const LogEntry* internal_default_instance() {
     return reinterpret_cast<const LogEntry*>(
                &_LogEntry_default_instance_);
@@ -140,7 +136,12 @@ class LogEntry PROTOBUF_FINAL :
   }
   inline void Swap(LogEntry* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -148,56 +149,53 @@ class LogEntry PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(LogEntry* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline LogEntry* New() const final {
-    return CreateMaybeMessage<LogEntry>(nullptr);
-  }
-
-  LogEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  LogEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<LogEntry>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const LogEntry& from);
-  void MergeFrom(const LogEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LogEntry& from) {
+    LogEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(LogEntry* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftRpcProctoc.LogEntry";
   }
   protected:
-  explicit LogEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit LogEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_raftRPC_2eproto);
-    return ::descriptor_table_raftRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -211,44 +209,33 @@ class LogEntry PROTOBUF_FINAL :
   // bytes Command = 1;
   void clear_command();
   const std::string& command() const;
-  void set_command(const std::string& value);
-  void set_command(std::string&& value);
-  void set_command(const char* value);
-  void set_command(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_command(ArgT0&& arg0, ArgT... args);
   std::string* mutable_command();
-  std::string* release_command();
+  PROTOBUF_NODISCARD std::string* release_command();
   void set_allocated_command(std::string* command);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_command();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_command(
-      std::string* command);
   private:
   const std::string& _internal_command() const;
-  void _internal_set_command(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_command(const std::string& value);
   std::string* _internal_mutable_command();
   public:
 
   // int32 LogTerm = 2;
   void clear_logterm();
-  ::PROTOBUF_NAMESPACE_ID::int32 logterm() const;
-  void set_logterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t logterm() const;
+  void set_logterm(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_logterm() const;
-  void _internal_set_logterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_logterm() const;
+  void _internal_set_logterm(int32_t value);
   public:
 
   // int32 LogIndex = 3;
   void clear_logindex();
-  ::PROTOBUF_NAMESPACE_ID::int32 logindex() const;
-  void set_logindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t logindex() const;
+  void set_logindex(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_logindex() const;
-  void _internal_set_logindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_logindex() const;
+  void _internal_set_logindex(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:raftRpcProctoc.LogEntry)
@@ -258,19 +245,23 @@ class LogEntry PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr command_;
-  ::PROTOBUF_NAMESPACE_ID::int32 logterm_;
-  ::PROTOBUF_NAMESPACE_ID::int32 logindex_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr command_;
+    int32_t logterm_;
+    int32_t logindex_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_raftRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class AppendEntriesArgs PROTOBUF_FINAL :
+class AppendEntriesArgs final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.AppendEntriesArgs) */ {
  public:
-  inline AppendEntriesArgs() : AppendEntriesArgs(nullptr) {};
-  virtual ~AppendEntriesArgs();
+  inline AppendEntriesArgs() : AppendEntriesArgs(nullptr) {}
+  ~AppendEntriesArgs() override;
+  explicit PROTOBUF_CONSTEXPR AppendEntriesArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   AppendEntriesArgs(const AppendEntriesArgs& from);
   AppendEntriesArgs(AppendEntriesArgs&& from) noexcept
@@ -283,8 +274,13 @@ class AppendEntriesArgs PROTOBUF_FINAL :
     return *this;
   }
   inline AppendEntriesArgs& operator=(AppendEntriesArgs&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -295,14 +291,14 @@ class AppendEntriesArgs PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AppendEntriesArgs& default_instance() {
+    return *internal_default_instance();
   }
-  static const AppendEntriesArgs& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const AppendEntriesArgs* internal_default_instance() {
     return reinterpret_cast<const AppendEntriesArgs*>(
                &_AppendEntriesArgs_default_instance_);
@@ -315,7 +311,12 @@ class AppendEntriesArgs PROTOBUF_FINAL :
   }
   inline void Swap(AppendEntriesArgs* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -323,56 +324,53 @@ class AppendEntriesArgs PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(AppendEntriesArgs* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline AppendEntriesArgs* New() const final {
-    return CreateMaybeMessage<AppendEntriesArgs>(nullptr);
-  }
-
-  AppendEntriesArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  AppendEntriesArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<AppendEntriesArgs>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const AppendEntriesArgs& from);
-  void MergeFrom(const AppendEntriesArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AppendEntriesArgs& from) {
+    AppendEntriesArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(AppendEntriesArgs* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftRpcProctoc.AppendEntriesArgs";
   }
   protected:
-  explicit AppendEntriesArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit AppendEntriesArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_raftRPC_2eproto);
-    return ::descriptor_table_raftRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -406,47 +404,47 @@ class AppendEntriesArgs PROTOBUF_FINAL :
 
   // int32 Term = 1;
   void clear_term();
-  ::PROTOBUF_NAMESPACE_ID::int32 term() const;
-  void set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t term() const;
+  void set_term(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_term() const;
-  void _internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
   public:
 
   // int32 LeaderId = 2;
   void clear_leaderid();
-  ::PROTOBUF_NAMESPACE_ID::int32 leaderid() const;
-  void set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t leaderid() const;
+  void set_leaderid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_leaderid() const;
-  void _internal_set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_leaderid() const;
+  void _internal_set_leaderid(int32_t value);
   public:
 
   // int32 PrevLogIndex = 3;
   void clear_prevlogindex();
-  ::PROTOBUF_NAMESPACE_ID::int32 prevlogindex() const;
-  void set_prevlogindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t prevlogindex() const;
+  void set_prevlogindex(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_prevlogindex() const;
-  void _internal_set_prevlogindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_prevlogindex() const;
+  void _internal_set_prevlogindex(int32_t value);
   public:
 
   // int32 PrevLogTerm = 4;
   void clear_prevlogterm();
-  ::PROTOBUF_NAMESPACE_ID::int32 prevlogterm() const;
-  void set_prevlogterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t prevlogterm() const;
+  void set_prevlogterm(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_prevlogterm() const;
-  void _internal_set_prevlogterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_prevlogterm() const;
+  void _internal_set_prevlogterm(int32_t value);
   public:
 
   // int32 LeaderCommit = 6;
   void clear_leadercommit();
-  ::PROTOBUF_NAMESPACE_ID::int32 leadercommit() const;
-  void set_leadercommit(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t leadercommit() const;
+  void set_leadercommit(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_leadercommit() const;
-  void _internal_set_leadercommit(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_leadercommit() const;
+  void _internal_set_leadercommit(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:raftRpcProctoc.AppendEntriesArgs)
@@ -456,22 +454,26 @@ class AppendEntriesArgs PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::LogEntry > entries_;
-  ::PROTOBUF_NAMESPACE_ID::int32 term_;
-  ::PROTOBUF_NAMESPACE_ID::int32 leaderid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 prevlogindex_;
-  ::PROTOBUF_NAMESPACE_ID::int32 prevlogterm_;
-  ::PROTOBUF_NAMESPACE_ID::int32 leadercommit_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::LogEntry > entries_;
+    int32_t term_;
+    int32_t leaderid_;
+    int32_t prevlogindex_;
+    int32_t prevlogterm_;
+    int32_t leadercommit_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_raftRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class AppendEntriesReply PROTOBUF_FINAL :
+class AppendEntriesReply final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.AppendEntriesReply) */ {
  public:
-  inline AppendEntriesReply() : AppendEntriesReply(nullptr) {};
-  virtual ~AppendEntriesReply();
+  inline AppendEntriesReply() : AppendEntriesReply(nullptr) {}
+  ~AppendEntriesReply() override;
+  explicit PROTOBUF_CONSTEXPR AppendEntriesReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   AppendEntriesReply(const AppendEntriesReply& from);
   AppendEntriesReply(AppendEntriesReply&& from) noexcept
@@ -484,8 +486,13 @@ class AppendEntriesReply PROTOBUF_FINAL :
     return *this;
   }
   inline AppendEntriesReply& operator=(AppendEntriesReply&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -496,14 +503,14 @@ class AppendEntriesReply PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AppendEntriesReply& default_instance() {
+    return *internal_default_instance();
   }
-  static const AppendEntriesReply& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const AppendEntriesReply* internal_default_instance() {
     return reinterpret_cast<const AppendEntriesReply*>(
                &_AppendEntriesReply_default_instance_);
@@ -516,7 +523,12 @@ class AppendEntriesReply PROTOBUF_FINAL :
   }
   inline void Swap(AppendEntriesReply* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -524,56 +536,53 @@ class AppendEntriesReply PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(AppendEntriesReply* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline AppendEntriesReply* New() const final {
-    return CreateMaybeMessage<AppendEntriesReply>(nullptr);
-  }
-
-  AppendEntriesReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  AppendEntriesReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<AppendEntriesReply>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const AppendEntriesReply& from);
-  void MergeFrom(const AppendEntriesReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AppendEntriesReply& from) {
+    AppendEntriesReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(AppendEntriesReply* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftRpcProctoc.AppendEntriesReply";
   }
   protected:
-  explicit AppendEntriesReply(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit AppendEntriesReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_raftRPC_2eproto);
-    return ::descriptor_table_raftRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -587,11 +596,11 @@ class AppendEntriesReply PROTOBUF_FINAL :
   };
   // int32 Term = 1;
   void clear_term();
-  ::PROTOBUF_NAMESPACE_ID::int32 term() const;
-  void set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t term() const;
+  void set_term(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_term() const;
-  void _internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
   public:
 
   // bool Success = 2;
@@ -605,20 +614,20 @@ class AppendEntriesReply PROTOBUF_FINAL :
 
   // int32 UpdateNextIndex = 3;
   void clear_updatenextindex();
-  ::PROTOBUF_NAMESPACE_ID::int32 updatenextindex() const;
-  void set_updatenextindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t updatenextindex() const;
+  void set_updatenextindex(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_updatenextindex() const;
-  void _internal_set_updatenextindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_updatenextindex() const;
+  void _internal_set_updatenextindex(int32_t value);
   public:
 
   // int32 AppState = 4;
   void clear_appstate();
-  ::PROTOBUF_NAMESPACE_ID::int32 appstate() const;
-  void set_appstate(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t appstate() const;
+  void set_appstate(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_appstate() const;
-  void _internal_set_appstate(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_appstate() const;
+  void _internal_set_appstate(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:raftRpcProctoc.AppendEntriesReply)
@@ -628,20 +637,24 @@ class AppendEntriesReply PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::int32 term_;
-  bool success_;
-  ::PROTOBUF_NAMESPACE_ID::int32 updatenextindex_;
-  ::PROTOBUF_NAMESPACE_ID::int32 appstate_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    int32_t term_;
+    bool success_;
+    int32_t updatenextindex_;
+    int32_t appstate_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_raftRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RequestVoteArgs PROTOBUF_FINAL :
+class RequestVoteArgs final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.RequestVoteArgs) */ {
  public:
-  inline RequestVoteArgs() : RequestVoteArgs(nullptr) {};
-  virtual ~RequestVoteArgs();
+  inline RequestVoteArgs() : RequestVoteArgs(nullptr) {}
+  ~RequestVoteArgs() override;
+  explicit PROTOBUF_CONSTEXPR RequestVoteArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RequestVoteArgs(const RequestVoteArgs& from);
   RequestVoteArgs(RequestVoteArgs&& from) noexcept
@@ -654,8 +667,13 @@ class RequestVoteArgs PROTOBUF_FINAL :
     return *this;
   }
   inline RequestVoteArgs& operator=(RequestVoteArgs&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -666,14 +684,14 @@ class RequestVoteArgs PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RequestVoteArgs& default_instance() {
+    return *internal_default_instance();
   }
-  static const RequestVoteArgs& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const RequestVoteArgs* internal_default_instance() {
     return reinterpret_cast<const RequestVoteArgs*>(
                &_RequestVoteArgs_default_instance_);
@@ -686,7 +704,12 @@ class RequestVoteArgs PROTOBUF_FINAL :
   }
   inline void Swap(RequestVoteArgs* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -694,56 +717,53 @@ class RequestVoteArgs PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(RequestVoteArgs* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline RequestVoteArgs* New() const final {
-    return CreateMaybeMessage<RequestVoteArgs>(nullptr);
-  }
-
-  RequestVoteArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  RequestVoteArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RequestVoteArgs>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RequestVoteArgs& from);
-  void MergeFrom(const RequestVoteArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RequestVoteArgs& from) {
+    RequestVoteArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RequestVoteArgs* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftRpcProctoc.RequestVoteArgs";
   }
   protected:
-  explicit RequestVoteArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit RequestVoteArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_raftRPC_2eproto);
-    return ::descriptor_table_raftRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -757,38 +777,38 @@ class RequestVoteArgs PROTOBUF_FINAL :
   };
   // int32 Term = 1;
   void clear_term();
-  ::PROTOBUF_NAMESPACE_ID::int32 term() const;
-  void set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t term() const;
+  void set_term(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_term() const;
-  void _internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
   public:
 
   // int32 CandidateId = 2;
   void clear_candidateid();
-  ::PROTOBUF_NAMESPACE_ID::int32 candidateid() const;
-  void set_candidateid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t candidateid() const;
+  void set_candidateid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_candidateid() const;
-  void _internal_set_candidateid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_candidateid() const;
+  void _internal_set_candidateid(int32_t value);
   public:
 
   // int32 LastLogIndex = 3;
   void clear_lastlogindex();
-  ::PROTOBUF_NAMESPACE_ID::int32 lastlogindex() const;
-  void set_lastlogindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t lastlogindex() const;
+  void set_lastlogindex(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_lastlogindex() const;
-  void _internal_set_lastlogindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_lastlogindex() const;
+  void _internal_set_lastlogindex(int32_t value);
   public:
 
   // int32 LastLogTerm = 4;
   void clear_lastlogterm();
-  ::PROTOBUF_NAMESPACE_ID::int32 lastlogterm() const;
-  void set_lastlogterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t lastlogterm() const;
+  void set_lastlogterm(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_lastlogterm() const;
-  void _internal_set_lastlogterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_lastlogterm() const;
+  void _internal_set_lastlogterm(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:raftRpcProctoc.RequestVoteArgs)
@@ -798,20 +818,24 @@ class RequestVoteArgs PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::int32 term_;
-  ::PROTOBUF_NAMESPACE_ID::int32 candidateid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 lastlogindex_;
-  ::PROTOBUF_NAMESPACE_ID::int32 lastlogterm_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    int32_t term_;
+    int32_t candidateid_;
+    int32_t lastlogindex_;
+    int32_t lastlogterm_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_raftRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RequestVoteReply PROTOBUF_FINAL :
+class RequestVoteReply final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.RequestVoteReply) */ {
  public:
-  inline RequestVoteReply() : RequestVoteReply(nullptr) {};
-  virtual ~RequestVoteReply();
+  inline RequestVoteReply() : RequestVoteReply(nullptr) {}
+  ~RequestVoteReply() override;
+  explicit PROTOBUF_CONSTEXPR RequestVoteReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RequestVoteReply(const RequestVoteReply& from);
   RequestVoteReply(RequestVoteReply&& from) noexcept
@@ -824,8 +848,13 @@ class RequestVoteReply PROTOBUF_FINAL :
     return *this;
   }
   inline RequestVoteReply& operator=(RequestVoteReply&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -836,14 +865,14 @@ class RequestVoteReply PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RequestVoteReply& default_instance() {
+    return *internal_default_instance();
   }
-  static const RequestVoteReply& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const RequestVoteReply* internal_default_instance() {
     return reinterpret_cast<const RequestVoteReply*>(
                &_RequestVoteReply_default_instance_);
@@ -856,7 +885,12 @@ class RequestVoteReply PROTOBUF_FINAL :
   }
   inline void Swap(RequestVoteReply* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -864,56 +898,53 @@ class RequestVoteReply PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(RequestVoteReply* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline RequestVoteReply* New() const final {
-    return CreateMaybeMessage<RequestVoteReply>(nullptr);
-  }
-
-  RequestVoteReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  RequestVoteReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RequestVoteReply>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RequestVoteReply& from);
-  void MergeFrom(const RequestVoteReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RequestVoteReply& from) {
+    RequestVoteReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RequestVoteReply* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftRpcProctoc.RequestVoteReply";
   }
   protected:
-  explicit RequestVoteReply(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit RequestVoteReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_raftRPC_2eproto);
-    return ::descriptor_table_raftRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -926,11 +957,11 @@ class RequestVoteReply PROTOBUF_FINAL :
   };
   // int32 Term = 1;
   void clear_term();
-  ::PROTOBUF_NAMESPACE_ID::int32 term() const;
-  void set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t term() const;
+  void set_term(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_term() const;
-  void _internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
   public:
 
   // bool VoteGranted = 2;
@@ -944,11 +975,11 @@ class RequestVoteReply PROTOBUF_FINAL :
 
   // int32 VoteState = 3;
   void clear_votestate();
-  ::PROTOBUF_NAMESPACE_ID::int32 votestate() const;
-  void set_votestate(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t votestate() const;
+  void set_votestate(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_votestate() const;
-  void _internal_set_votestate(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_votestate() const;
+  void _internal_set_votestate(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:raftRpcProctoc.RequestVoteReply)
@@ -958,19 +989,23 @@ class RequestVoteReply PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::int32 term_;
-  bool votegranted_;
-  ::PROTOBUF_NAMESPACE_ID::int32 votestate_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    int32_t term_;
+    bool votegranted_;
+    int32_t votestate_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_raftRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class InstallSnapshotRequest PROTOBUF_FINAL :
+class InstallSnapshotRequest final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.InstallSnapshotRequest) */ {
  public:
-  inline InstallSnapshotRequest() : InstallSnapshotRequest(nullptr) {};
-  virtual ~InstallSnapshotRequest();
+  inline InstallSnapshotRequest() : InstallSnapshotRequest(nullptr) {}
+  ~InstallSnapshotRequest() override;
+  explicit PROTOBUF_CONSTEXPR InstallSnapshotRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   InstallSnapshotRequest(const InstallSnapshotRequest& from);
   InstallSnapshotRequest(InstallSnapshotRequest&& from) noexcept
@@ -983,8 +1018,13 @@ class InstallSnapshotRequest PROTOBUF_FINAL :
     return *this;
   }
   inline InstallSnapshotRequest& operator=(InstallSnapshotRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -995,14 +1035,14 @@ class InstallSnapshotRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const InstallSnapshotRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const InstallSnapshotRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const InstallSnapshotRequest* internal_default_instance() {
     return reinterpret_cast<const InstallSnapshotRequest*>(
                &_InstallSnapshotRequest_default_instance_);
@@ -1015,7 +1055,12 @@ class InstallSnapshotRequest PROTOBUF_FINAL :
   }
   inline void Swap(InstallSnapshotRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -1023,56 +1068,53 @@ class InstallSnapshotRequest PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(InstallSnapshotRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline InstallSnapshotRequest* New() const final {
-    return CreateMaybeMessage<InstallSnapshotRequest>(nullptr);
-  }
-
-  InstallSnapshotRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  InstallSnapshotRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<InstallSnapshotRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const InstallSnapshotRequest& from);
-  void MergeFrom(const InstallSnapshotRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const InstallSnapshotRequest& from) {
+    InstallSnapshotRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(InstallSnapshotRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftRpcProctoc.InstallSnapshotRequest";
   }
   protected:
-  explicit InstallSnapshotRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit InstallSnapshotRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_raftRPC_2eproto);
-    return ::descriptor_table_raftRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1088,62 +1130,51 @@ class InstallSnapshotRequest PROTOBUF_FINAL :
   // bytes Data = 5;
   void clear_data();
   const std::string& data() const;
-  void set_data(const std::string& value);
-  void set_data(std::string&& value);
-  void set_data(const char* value);
-  void set_data(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
   std::string* mutable_data();
-  std::string* release_data();
+  PROTOBUF_NODISCARD std::string* release_data();
   void set_allocated_data(std::string* data);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_data();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_data(
-      std::string* data);
   private:
   const std::string& _internal_data() const;
-  void _internal_set_data(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
   std::string* _internal_mutable_data();
   public:
 
   // int32 LeaderId = 1;
   void clear_leaderid();
-  ::PROTOBUF_NAMESPACE_ID::int32 leaderid() const;
-  void set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t leaderid() const;
+  void set_leaderid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_leaderid() const;
-  void _internal_set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_leaderid() const;
+  void _internal_set_leaderid(int32_t value);
   public:
 
   // int32 Term = 2;
   void clear_term();
-  ::PROTOBUF_NAMESPACE_ID::int32 term() const;
-  void set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t term() const;
+  void set_term(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_term() const;
-  void _internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
   public:
 
   // int32 LastSnapShotIncludeIndex = 3;
   void clear_lastsnapshotincludeindex();
-  ::PROTOBUF_NAMESPACE_ID::int32 lastsnapshotincludeindex() const;
-  void set_lastsnapshotincludeindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t lastsnapshotincludeindex() const;
+  void set_lastsnapshotincludeindex(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_lastsnapshotincludeindex() const;
-  void _internal_set_lastsnapshotincludeindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_lastsnapshotincludeindex() const;
+  void _internal_set_lastsnapshotincludeindex(int32_t value);
   public:
 
   // int32 LastSnapShotIncludeTerm = 4;
   void clear_lastsnapshotincludeterm();
-  ::PROTOBUF_NAMESPACE_ID::int32 lastsnapshotincludeterm() const;
-  void set_lastsnapshotincludeterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t lastsnapshotincludeterm() const;
+  void set_lastsnapshotincludeterm(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_lastsnapshotincludeterm() const;
-  void _internal_set_lastsnapshotincludeterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_lastsnapshotincludeterm() const;
+  void _internal_set_lastsnapshotincludeterm(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:raftRpcProctoc.InstallSnapshotRequest)
@@ -1153,21 +1184,25 @@ class InstallSnapshotRequest PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
-  ::PROTOBUF_NAMESPACE_ID::int32 leaderid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 term_;
-  ::PROTOBUF_NAMESPACE_ID::int32 lastsnapshotincludeindex_;
-  ::PROTOBUF_NAMESPACE_ID::int32 lastsnapshotincludeterm_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    int32_t leaderid_;
+    int32_t term_;
+    int32_t lastsnapshotincludeindex_;
+    int32_t lastsnapshotincludeterm_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_raftRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class InstallSnapshotResponse PROTOBUF_FINAL :
+class InstallSnapshotResponse final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.InstallSnapshotResponse) */ {
  public:
-  inline InstallSnapshotResponse() : InstallSnapshotResponse(nullptr) {};
-  virtual ~InstallSnapshotResponse();
+  inline InstallSnapshotResponse() : InstallSnapshotResponse(nullptr) {}
+  ~InstallSnapshotResponse() override;
+  explicit PROTOBUF_CONSTEXPR InstallSnapshotResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   InstallSnapshotResponse(const InstallSnapshotResponse& from);
   InstallSnapshotResponse(InstallSnapshotResponse&& from) noexcept
@@ -1180,8 +1215,13 @@ class InstallSnapshotResponse PROTOBUF_FINAL :
     return *this;
   }
   inline InstallSnapshotResponse& operator=(InstallSnapshotResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1192,14 +1232,14 @@ class InstallSnapshotResponse PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const InstallSnapshotResponse& default_instance() {
+    return *internal_default_instance();
   }
-  static const InstallSnapshotResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const InstallSnapshotResponse* internal_default_instance() {
     return reinterpret_cast<const InstallSnapshotResponse*>(
                &_InstallSnapshotResponse_default_instance_);
@@ -1212,7 +1252,12 @@ class InstallSnapshotResponse PROTOBUF_FINAL :
   }
   inline void Swap(InstallSnapshotResponse* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -1220,56 +1265,53 @@ class InstallSnapshotResponse PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(InstallSnapshotResponse* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline InstallSnapshotResponse* New() const final {
-    return CreateMaybeMessage<InstallSnapshotResponse>(nullptr);
-  }
-
-  InstallSnapshotResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  InstallSnapshotResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<InstallSnapshotResponse>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const InstallSnapshotResponse& from);
-  void MergeFrom(const InstallSnapshotResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const InstallSnapshotResponse& from) {
+    InstallSnapshotResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(InstallSnapshotResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftRpcProctoc.InstallSnapshotResponse";
   }
   protected:
-  explicit InstallSnapshotResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit InstallSnapshotResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_raftRPC_2eproto);
-    return ::descriptor_table_raftRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1280,11 +1322,11 @@ class InstallSnapshotResponse PROTOBUF_FINAL :
   };
   // int32 Term = 1;
   void clear_term();
-  ::PROTOBUF_NAMESPACE_ID::int32 term() const;
-  void set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t term() const;
+  void set_term(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_term() const;
-  void _internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:raftRpcProctoc.InstallSnapshotResponse)
@@ -1294,8 +1336,11 @@ class InstallSnapshotResponse PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::int32 term_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    int32_t term_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_raftRPC_2eproto;
 };
 // ===================================================================
@@ -1386,121 +1431,90 @@ class raftRpc_Stub : public raftRpc {
 
 // bytes Command = 1;
 inline void LogEntry::clear_command() {
-  command_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.command_.ClearToEmpty();
 }
 inline const std::string& LogEntry::command() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.LogEntry.Command)
   return _internal_command();
 }
-inline void LogEntry::set_command(const std::string& value) {
-  _internal_set_command(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LogEntry::set_command(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.command_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:raftRpcProctoc.LogEntry.Command)
 }
 inline std::string* LogEntry::mutable_command() {
+  std::string* _s = _internal_mutable_command();
   // @@protoc_insertion_point(field_mutable:raftRpcProctoc.LogEntry.Command)
-  return _internal_mutable_command();
+  return _s;
 }
 inline const std::string& LogEntry::_internal_command() const {
-  return command_.Get();
+  return _impl_.command_.Get();
 }
 inline void LogEntry::_internal_set_command(const std::string& value) {
-
-  command_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void LogEntry::set_command(std::string&& value) {
-
-  command_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftRpcProctoc.LogEntry.Command)
-}
-inline void LogEntry::set_command(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-
-  command_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftRpcProctoc.LogEntry.Command)
-}
-inline void LogEntry::set_command(const void* value,
-    size_t size) {
-
-  command_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftRpcProctoc.LogEntry.Command)
+  
+  _impl_.command_.Set(value, GetArenaForAllocation());
 }
 inline std::string* LogEntry::_internal_mutable_command() {
-
-  return command_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  
+  return _impl_.command_.Mutable(GetArenaForAllocation());
 }
 inline std::string* LogEntry::release_command() {
   // @@protoc_insertion_point(field_release:raftRpcProctoc.LogEntry.Command)
-  return command_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.command_.Release();
 }
 inline void LogEntry::set_allocated_command(std::string* command) {
   if (command != nullptr) {
-
+    
   } else {
-
+    
   }
-  command_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), command,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftRpcProctoc.LogEntry.Command)
-}
-inline std::string* LogEntry::unsafe_arena_release_command() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftRpcProctoc.LogEntry.Command)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-
-  return command_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void LogEntry::unsafe_arena_set_allocated_command(
-    std::string* command) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (command != nullptr) {
-
-  } else {
-
+  _impl_.command_.SetAllocated(command, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.command_.IsDefault()) {
+    _impl_.command_.Set("", GetArenaForAllocation());
   }
-  command_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      command, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftRpcProctoc.LogEntry.Command)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftRpcProctoc.LogEntry.Command)
 }
 
 // int32 LogTerm = 2;
 inline void LogEntry::clear_logterm() {
-  logterm_ = 0;
+  _impl_.logterm_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 LogEntry::_internal_logterm() const {
-  return logterm_;
+inline int32_t LogEntry::_internal_logterm() const {
+  return _impl_.logterm_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 LogEntry::logterm() const {
+inline int32_t LogEntry::logterm() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.LogEntry.LogTerm)
   return _internal_logterm();
 }
-inline void LogEntry::_internal_set_logterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  logterm_ = value;
+inline void LogEntry::_internal_set_logterm(int32_t value) {
+  
+  _impl_.logterm_ = value;
 }
-inline void LogEntry::set_logterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void LogEntry::set_logterm(int32_t value) {
   _internal_set_logterm(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.LogEntry.LogTerm)
 }
 
 // int32 LogIndex = 3;
 inline void LogEntry::clear_logindex() {
-  logindex_ = 0;
+  _impl_.logindex_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 LogEntry::_internal_logindex() const {
-  return logindex_;
+inline int32_t LogEntry::_internal_logindex() const {
+  return _impl_.logindex_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 LogEntry::logindex() const {
+inline int32_t LogEntry::logindex() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.LogEntry.LogIndex)
   return _internal_logindex();
 }
-inline void LogEntry::_internal_set_logindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  logindex_ = value;
+inline void LogEntry::_internal_set_logindex(int32_t value) {
+  
+  _impl_.logindex_ = value;
 }
-inline void LogEntry::set_logindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void LogEntry::set_logindex(int32_t value) {
   _internal_set_logindex(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.LogEntry.LogIndex)
 }
@@ -1511,139 +1525,140 @@ inline void LogEntry::set_logindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
 
 // int32 Term = 1;
 inline void AppendEntriesArgs::clear_term() {
-  term_ = 0;
+  _impl_.term_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::_internal_term() const {
-  return term_;
+inline int32_t AppendEntriesArgs::_internal_term() const {
+  return _impl_.term_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::term() const {
+inline int32_t AppendEntriesArgs::term() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesArgs.Term)
   return _internal_term();
 }
-inline void AppendEntriesArgs::_internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  term_ = value;
+inline void AppendEntriesArgs::_internal_set_term(int32_t value) {
+  
+  _impl_.term_ = value;
 }
-inline void AppendEntriesArgs::set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesArgs::set_term(int32_t value) {
   _internal_set_term(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesArgs.Term)
 }
 
 // int32 LeaderId = 2;
 inline void AppendEntriesArgs::clear_leaderid() {
-  leaderid_ = 0;
+  _impl_.leaderid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::_internal_leaderid() const {
-  return leaderid_;
+inline int32_t AppendEntriesArgs::_internal_leaderid() const {
+  return _impl_.leaderid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::leaderid() const {
+inline int32_t AppendEntriesArgs::leaderid() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesArgs.LeaderId)
   return _internal_leaderid();
 }
-inline void AppendEntriesArgs::_internal_set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  leaderid_ = value;
+inline void AppendEntriesArgs::_internal_set_leaderid(int32_t value) {
+  
+  _impl_.leaderid_ = value;
 }
-inline void AppendEntriesArgs::set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesArgs::set_leaderid(int32_t value) {
   _internal_set_leaderid(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesArgs.LeaderId)
 }
 
 // int32 PrevLogIndex = 3;
 inline void AppendEntriesArgs::clear_prevlogindex() {
-  prevlogindex_ = 0;
+  _impl_.prevlogindex_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::_internal_prevlogindex() const {
-  return prevlogindex_;
+inline int32_t AppendEntriesArgs::_internal_prevlogindex() const {
+  return _impl_.prevlogindex_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::prevlogindex() const {
+inline int32_t AppendEntriesArgs::prevlogindex() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesArgs.PrevLogIndex)
   return _internal_prevlogindex();
 }
-inline void AppendEntriesArgs::_internal_set_prevlogindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  prevlogindex_ = value;
+inline void AppendEntriesArgs::_internal_set_prevlogindex(int32_t value) {
+  
+  _impl_.prevlogindex_ = value;
 }
-inline void AppendEntriesArgs::set_prevlogindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesArgs::set_prevlogindex(int32_t value) {
   _internal_set_prevlogindex(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesArgs.PrevLogIndex)
 }
 
 // int32 PrevLogTerm = 4;
 inline void AppendEntriesArgs::clear_prevlogterm() {
-  prevlogterm_ = 0;
+  _impl_.prevlogterm_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::_internal_prevlogterm() const {
-  return prevlogterm_;
+inline int32_t AppendEntriesArgs::_internal_prevlogterm() const {
+  return _impl_.prevlogterm_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::prevlogterm() const {
+inline int32_t AppendEntriesArgs::prevlogterm() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesArgs.PrevLogTerm)
   return _internal_prevlogterm();
 }
-inline void AppendEntriesArgs::_internal_set_prevlogterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  prevlogterm_ = value;
+inline void AppendEntriesArgs::_internal_set_prevlogterm(int32_t value) {
+  
+  _impl_.prevlogterm_ = value;
 }
-inline void AppendEntriesArgs::set_prevlogterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesArgs::set_prevlogterm(int32_t value) {
   _internal_set_prevlogterm(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesArgs.PrevLogTerm)
 }
 
 // repeated .raftRpcProctoc.LogEntry Entries = 5;
 inline int AppendEntriesArgs::_internal_entries_size() const {
-  return entries_.size();
+  return _impl_.entries_.size();
 }
 inline int AppendEntriesArgs::entries_size() const {
   return _internal_entries_size();
 }
 inline void AppendEntriesArgs::clear_entries() {
-  entries_.Clear();
+  _impl_.entries_.Clear();
 }
 inline ::raftRpcProctoc::LogEntry* AppendEntriesArgs::mutable_entries(int index) {
   // @@protoc_insertion_point(field_mutable:raftRpcProctoc.AppendEntriesArgs.Entries)
-  return entries_.Mutable(index);
+  return _impl_.entries_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::LogEntry >*
 AppendEntriesArgs::mutable_entries() {
   // @@protoc_insertion_point(field_mutable_list:raftRpcProctoc.AppendEntriesArgs.Entries)
-  return &entries_;
+  return &_impl_.entries_;
 }
 inline const ::raftRpcProctoc::LogEntry& AppendEntriesArgs::_internal_entries(int index) const {
-  return entries_.Get(index);
+  return _impl_.entries_.Get(index);
 }
 inline const ::raftRpcProctoc::LogEntry& AppendEntriesArgs::entries(int index) const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesArgs.Entries)
   return _internal_entries(index);
 }
 inline ::raftRpcProctoc::LogEntry* AppendEntriesArgs::_internal_add_entries() {
-  return entries_.Add();
+  return _impl_.entries_.Add();
 }
 inline ::raftRpcProctoc::LogEntry* AppendEntriesArgs::add_entries() {
+  ::raftRpcProctoc::LogEntry* _add = _internal_add_entries();
   // @@protoc_insertion_point(field_add:raftRpcProctoc.AppendEntriesArgs.Entries)
-  return _internal_add_entries();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::LogEntry >&
 AppendEntriesArgs::entries() const {
   // @@protoc_insertion_point(field_list:raftRpcProctoc.AppendEntriesArgs.Entries)
-  return entries_;
+  return _impl_.entries_;
 }
 
 // int32 LeaderCommit = 6;
 inline void AppendEntriesArgs::clear_leadercommit() {
-  leadercommit_ = 0;
+  _impl_.leadercommit_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::_internal_leadercommit() const {
-  return leadercommit_;
+inline int32_t AppendEntriesArgs::_internal_leadercommit() const {
+  return _impl_.leadercommit_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::leadercommit() const {
+inline int32_t AppendEntriesArgs::leadercommit() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesArgs.LeaderCommit)
   return _internal_leadercommit();
 }
-inline void AppendEntriesArgs::_internal_set_leadercommit(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  leadercommit_ = value;
+inline void AppendEntriesArgs::_internal_set_leadercommit(int32_t value) {
+  
+  _impl_.leadercommit_ = value;
 }
-inline void AppendEntriesArgs::set_leadercommit(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesArgs::set_leadercommit(int32_t value) {
   _internal_set_leadercommit(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesArgs.LeaderCommit)
 }
@@ -1654,38 +1669,38 @@ inline void AppendEntriesArgs::set_leadercommit(::PROTOBUF_NAMESPACE_ID::int32 v
 
 // int32 Term = 1;
 inline void AppendEntriesReply::clear_term() {
-  term_ = 0;
+  _impl_.term_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesReply::_internal_term() const {
-  return term_;
+inline int32_t AppendEntriesReply::_internal_term() const {
+  return _impl_.term_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesReply::term() const {
+inline int32_t AppendEntriesReply::term() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesReply.Term)
   return _internal_term();
 }
-inline void AppendEntriesReply::_internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  term_ = value;
+inline void AppendEntriesReply::_internal_set_term(int32_t value) {
+  
+  _impl_.term_ = value;
 }
-inline void AppendEntriesReply::set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesReply::set_term(int32_t value) {
   _internal_set_term(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesReply.Term)
 }
 
 // bool Success = 2;
 inline void AppendEntriesReply::clear_success() {
-  success_ = false;
+  _impl_.success_ = false;
 }
 inline bool AppendEntriesReply::_internal_success() const {
-  return success_;
+  return _impl_.success_;
 }
 inline bool AppendEntriesReply::success() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesReply.Success)
   return _internal_success();
 }
 inline void AppendEntriesReply::_internal_set_success(bool value) {
-
-  success_ = value;
+  
+  _impl_.success_ = value;
 }
 inline void AppendEntriesReply::set_success(bool value) {
   _internal_set_success(value);
@@ -1694,40 +1709,40 @@ inline void AppendEntriesReply::set_success(bool value) {
 
 // int32 UpdateNextIndex = 3;
 inline void AppendEntriesReply::clear_updatenextindex() {
-  updatenextindex_ = 0;
+  _impl_.updatenextindex_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesReply::_internal_updatenextindex() const {
-  return updatenextindex_;
+inline int32_t AppendEntriesReply::_internal_updatenextindex() const {
+  return _impl_.updatenextindex_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesReply::updatenextindex() const {
+inline int32_t AppendEntriesReply::updatenextindex() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesReply.UpdateNextIndex)
   return _internal_updatenextindex();
 }
-inline void AppendEntriesReply::_internal_set_updatenextindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  updatenextindex_ = value;
+inline void AppendEntriesReply::_internal_set_updatenextindex(int32_t value) {
+  
+  _impl_.updatenextindex_ = value;
 }
-inline void AppendEntriesReply::set_updatenextindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesReply::set_updatenextindex(int32_t value) {
   _internal_set_updatenextindex(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesReply.UpdateNextIndex)
 }
 
 // int32 AppState = 4;
 inline void AppendEntriesReply::clear_appstate() {
-  appstate_ = 0;
+  _impl_.appstate_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesReply::_internal_appstate() const {
-  return appstate_;
+inline int32_t AppendEntriesReply::_internal_appstate() const {
+  return _impl_.appstate_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesReply::appstate() const {
+inline int32_t AppendEntriesReply::appstate() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesReply.AppState)
   return _internal_appstate();
 }
-inline void AppendEntriesReply::_internal_set_appstate(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  appstate_ = value;
+inline void AppendEntriesReply::_internal_set_appstate(int32_t value) {
+  
+  _impl_.appstate_ = value;
 }
-inline void AppendEntriesReply::set_appstate(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesReply::set_appstate(int32_t value) {
   _internal_set_appstate(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesReply.AppState)
 }
@@ -1738,80 +1753,80 @@ inline void AppendEntriesReply::set_appstate(::PROTOBUF_NAMESPACE_ID::int32 valu
 
 // int32 Term = 1;
 inline void RequestVoteArgs::clear_term() {
-  term_ = 0;
+  _impl_.term_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::_internal_term() const {
-  return term_;
+inline int32_t RequestVoteArgs::_internal_term() const {
+  return _impl_.term_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::term() const {
+inline int32_t RequestVoteArgs::term() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteArgs.Term)
   return _internal_term();
 }
-inline void RequestVoteArgs::_internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  term_ = value;
+inline void RequestVoteArgs::_internal_set_term(int32_t value) {
+  
+  _impl_.term_ = value;
 }
-inline void RequestVoteArgs::set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RequestVoteArgs::set_term(int32_t value) {
   _internal_set_term(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.RequestVoteArgs.Term)
 }
 
 // int32 CandidateId = 2;
 inline void RequestVoteArgs::clear_candidateid() {
-  candidateid_ = 0;
+  _impl_.candidateid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::_internal_candidateid() const {
-  return candidateid_;
+inline int32_t RequestVoteArgs::_internal_candidateid() const {
+  return _impl_.candidateid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::candidateid() const {
+inline int32_t RequestVoteArgs::candidateid() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteArgs.CandidateId)
   return _internal_candidateid();
 }
-inline void RequestVoteArgs::_internal_set_candidateid(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  candidateid_ = value;
+inline void RequestVoteArgs::_internal_set_candidateid(int32_t value) {
+  
+  _impl_.candidateid_ = value;
 }
-inline void RequestVoteArgs::set_candidateid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RequestVoteArgs::set_candidateid(int32_t value) {
   _internal_set_candidateid(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.RequestVoteArgs.CandidateId)
 }
 
 // int32 LastLogIndex = 3;
 inline void RequestVoteArgs::clear_lastlogindex() {
-  lastlogindex_ = 0;
+  _impl_.lastlogindex_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::_internal_lastlogindex() const {
-  return lastlogindex_;
+inline int32_t RequestVoteArgs::_internal_lastlogindex() const {
+  return _impl_.lastlogindex_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::lastlogindex() const {
+inline int32_t RequestVoteArgs::lastlogindex() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteArgs.LastLogIndex)
   return _internal_lastlogindex();
 }
-inline void RequestVoteArgs::_internal_set_lastlogindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  lastlogindex_ = value;
+inline void RequestVoteArgs::_internal_set_lastlogindex(int32_t value) {
+  
+  _impl_.lastlogindex_ = value;
 }
-inline void RequestVoteArgs::set_lastlogindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RequestVoteArgs::set_lastlogindex(int32_t value) {
   _internal_set_lastlogindex(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.RequestVoteArgs.LastLogIndex)
 }
 
 // int32 LastLogTerm = 4;
 inline void RequestVoteArgs::clear_lastlogterm() {
-  lastlogterm_ = 0;
+  _impl_.lastlogterm_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::_internal_lastlogterm() const {
-  return lastlogterm_;
+inline int32_t RequestVoteArgs::_internal_lastlogterm() const {
+  return _impl_.lastlogterm_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::lastlogterm() const {
+inline int32_t RequestVoteArgs::lastlogterm() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteArgs.LastLogTerm)
   return _internal_lastlogterm();
 }
-inline void RequestVoteArgs::_internal_set_lastlogterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  lastlogterm_ = value;
+inline void RequestVoteArgs::_internal_set_lastlogterm(int32_t value) {
+  
+  _impl_.lastlogterm_ = value;
 }
-inline void RequestVoteArgs::set_lastlogterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RequestVoteArgs::set_lastlogterm(int32_t value) {
   _internal_set_lastlogterm(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.RequestVoteArgs.LastLogTerm)
 }
@@ -1822,38 +1837,38 @@ inline void RequestVoteArgs::set_lastlogterm(::PROTOBUF_NAMESPACE_ID::int32 valu
 
 // int32 Term = 1;
 inline void RequestVoteReply::clear_term() {
-  term_ = 0;
+  _impl_.term_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteReply::_internal_term() const {
-  return term_;
+inline int32_t RequestVoteReply::_internal_term() const {
+  return _impl_.term_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteReply::term() const {
+inline int32_t RequestVoteReply::term() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteReply.Term)
   return _internal_term();
 }
-inline void RequestVoteReply::_internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  term_ = value;
+inline void RequestVoteReply::_internal_set_term(int32_t value) {
+  
+  _impl_.term_ = value;
 }
-inline void RequestVoteReply::set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RequestVoteReply::set_term(int32_t value) {
   _internal_set_term(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.RequestVoteReply.Term)
 }
 
 // bool VoteGranted = 2;
 inline void RequestVoteReply::clear_votegranted() {
-  votegranted_ = false;
+  _impl_.votegranted_ = false;
 }
 inline bool RequestVoteReply::_internal_votegranted() const {
-  return votegranted_;
+  return _impl_.votegranted_;
 }
 inline bool RequestVoteReply::votegranted() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteReply.VoteGranted)
   return _internal_votegranted();
 }
 inline void RequestVoteReply::_internal_set_votegranted(bool value) {
-
-  votegranted_ = value;
+  
+  _impl_.votegranted_ = value;
 }
 inline void RequestVoteReply::set_votegranted(bool value) {
   _internal_set_votegranted(value);
@@ -1862,20 +1877,20 @@ inline void RequestVoteReply::set_votegranted(bool value) {
 
 // int32 VoteState = 3;
 inline void RequestVoteReply::clear_votestate() {
-  votestate_ = 0;
+  _impl_.votestate_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteReply::_internal_votestate() const {
-  return votestate_;
+inline int32_t RequestVoteReply::_internal_votestate() const {
+  return _impl_.votestate_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteReply::votestate() const {
+inline int32_t RequestVoteReply::votestate() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteReply.VoteState)
   return _internal_votestate();
 }
-inline void RequestVoteReply::_internal_set_votestate(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  votestate_ = value;
+inline void RequestVoteReply::_internal_set_votestate(int32_t value) {
+  
+  _impl_.votestate_ = value;
 }
-inline void RequestVoteReply::set_votestate(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RequestVoteReply::set_votestate(int32_t value) {
   _internal_set_votestate(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.RequestVoteReply.VoteState)
 }
@@ -1886,163 +1901,132 @@ inline void RequestVoteReply::set_votestate(::PROTOBUF_NAMESPACE_ID::int32 value
 
 // int32 LeaderId = 1;
 inline void InstallSnapshotRequest::clear_leaderid() {
-  leaderid_ = 0;
+  _impl_.leaderid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::_internal_leaderid() const {
-  return leaderid_;
+inline int32_t InstallSnapshotRequest::_internal_leaderid() const {
+  return _impl_.leaderid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::leaderid() const {
+inline int32_t InstallSnapshotRequest::leaderid() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.InstallSnapshotRequest.LeaderId)
   return _internal_leaderid();
 }
-inline void InstallSnapshotRequest::_internal_set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  leaderid_ = value;
+inline void InstallSnapshotRequest::_internal_set_leaderid(int32_t value) {
+  
+  _impl_.leaderid_ = value;
 }
-inline void InstallSnapshotRequest::set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void InstallSnapshotRequest::set_leaderid(int32_t value) {
   _internal_set_leaderid(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.InstallSnapshotRequest.LeaderId)
 }
 
 // int32 Term = 2;
 inline void InstallSnapshotRequest::clear_term() {
-  term_ = 0;
+  _impl_.term_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::_internal_term() const {
-  return term_;
+inline int32_t InstallSnapshotRequest::_internal_term() const {
+  return _impl_.term_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::term() const {
+inline int32_t InstallSnapshotRequest::term() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.InstallSnapshotRequest.Term)
   return _internal_term();
 }
-inline void InstallSnapshotRequest::_internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  term_ = value;
+inline void InstallSnapshotRequest::_internal_set_term(int32_t value) {
+  
+  _impl_.term_ = value;
 }
-inline void InstallSnapshotRequest::set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void InstallSnapshotRequest::set_term(int32_t value) {
   _internal_set_term(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.InstallSnapshotRequest.Term)
 }
 
 // int32 LastSnapShotIncludeIndex = 3;
 inline void InstallSnapshotRequest::clear_lastsnapshotincludeindex() {
-  lastsnapshotincludeindex_ = 0;
+  _impl_.lastsnapshotincludeindex_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::_internal_lastsnapshotincludeindex() const {
-  return lastsnapshotincludeindex_;
+inline int32_t InstallSnapshotRequest::_internal_lastsnapshotincludeindex() const {
+  return _impl_.lastsnapshotincludeindex_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::lastsnapshotincludeindex() const {
+inline int32_t InstallSnapshotRequest::lastsnapshotincludeindex() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.InstallSnapshotRequest.LastSnapShotIncludeIndex)
   return _internal_lastsnapshotincludeindex();
 }
-inline void InstallSnapshotRequest::_internal_set_lastsnapshotincludeindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  lastsnapshotincludeindex_ = value;
+inline void InstallSnapshotRequest::_internal_set_lastsnapshotincludeindex(int32_t value) {
+  
+  _impl_.lastsnapshotincludeindex_ = value;
 }
-inline void InstallSnapshotRequest::set_lastsnapshotincludeindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void InstallSnapshotRequest::set_lastsnapshotincludeindex(int32_t value) {
   _internal_set_lastsnapshotincludeindex(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.InstallSnapshotRequest.LastSnapShotIncludeIndex)
 }
 
 // int32 LastSnapShotIncludeTerm = 4;
 inline void InstallSnapshotRequest::clear_lastsnapshotincludeterm() {
-  lastsnapshotincludeterm_ = 0;
+  _impl_.lastsnapshotincludeterm_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::_internal_lastsnapshotincludeterm() const {
-  return lastsnapshotincludeterm_;
+inline int32_t InstallSnapshotRequest::_internal_lastsnapshotincludeterm() const {
+  return _impl_.lastsnapshotincludeterm_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::lastsnapshotincludeterm() const {
+inline int32_t InstallSnapshotRequest::lastsnapshotincludeterm() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.InstallSnapshotRequest.LastSnapShotIncludeTerm)
   return _internal_lastsnapshotincludeterm();
 }
-inline void InstallSnapshotRequest::_internal_set_lastsnapshotincludeterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  lastsnapshotincludeterm_ = value;
+inline void InstallSnapshotRequest::_internal_set_lastsnapshotincludeterm(int32_t value) {
+  
+  _impl_.lastsnapshotincludeterm_ = value;
 }
-inline void InstallSnapshotRequest::set_lastsnapshotincludeterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void InstallSnapshotRequest::set_lastsnapshotincludeterm(int32_t value) {
   _internal_set_lastsnapshotincludeterm(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.InstallSnapshotRequest.LastSnapShotIncludeTerm)
 }
 
 // bytes Data = 5;
 inline void InstallSnapshotRequest::clear_data() {
-  data_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.data_.ClearToEmpty();
 }
 inline const std::string& InstallSnapshotRequest::data() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.InstallSnapshotRequest.Data)
   return _internal_data();
 }
-inline void InstallSnapshotRequest::set_data(const std::string& value) {
-  _internal_set_data(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void InstallSnapshotRequest::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:raftRpcProctoc.InstallSnapshotRequest.Data)
 }
 inline std::string* InstallSnapshotRequest::mutable_data() {
+  std::string* _s = _internal_mutable_data();
   // @@protoc_insertion_point(field_mutable:raftRpcProctoc.InstallSnapshotRequest.Data)
-  return _internal_mutable_data();
+  return _s;
 }
 inline const std::string& InstallSnapshotRequest::_internal_data() const {
-  return data_.Get();
+  return _impl_.data_.Get();
 }
 inline void InstallSnapshotRequest::_internal_set_data(const std::string& value) {
-
-  data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void InstallSnapshotRequest::set_data(std::string&& value) {
-
-  data_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftRpcProctoc.InstallSnapshotRequest.Data)
-}
-inline void InstallSnapshotRequest::set_data(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-
-  data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftRpcProctoc.InstallSnapshotRequest.Data)
-}
-inline void InstallSnapshotRequest::set_data(const void* value,
-    size_t size) {
-
-  data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftRpcProctoc.InstallSnapshotRequest.Data)
+  
+  _impl_.data_.Set(value, GetArenaForAllocation());
 }
 inline std::string* InstallSnapshotRequest::_internal_mutable_data() {
-
-  return data_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  
+  return _impl_.data_.Mutable(GetArenaForAllocation());
 }
 inline std::string* InstallSnapshotRequest::release_data() {
   // @@protoc_insertion_point(field_release:raftRpcProctoc.InstallSnapshotRequest.Data)
-  return data_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.data_.Release();
 }
 inline void InstallSnapshotRequest::set_allocated_data(std::string* data) {
   if (data != nullptr) {
-
+    
   } else {
-
+    
   }
-  data_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), data,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftRpcProctoc.InstallSnapshotRequest.Data)
-}
-inline std::string* InstallSnapshotRequest::unsafe_arena_release_data() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftRpcProctoc.InstallSnapshotRequest.Data)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-
-  return data_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void InstallSnapshotRequest::unsafe_arena_set_allocated_data(
-    std::string* data) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (data != nullptr) {
-
-  } else {
-
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
   }
-  data_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      data, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftRpcProctoc.InstallSnapshotRequest.Data)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftRpcProctoc.InstallSnapshotRequest.Data)
 }
 
 // -------------------------------------------------------------------
@@ -2051,20 +2035,20 @@ inline void InstallSnapshotRequest::unsafe_arena_set_allocated_data(
 
 // int32 Term = 1;
 inline void InstallSnapshotResponse::clear_term() {
-  term_ = 0;
+  _impl_.term_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotResponse::_internal_term() const {
-  return term_;
+inline int32_t InstallSnapshotResponse::_internal_term() const {
+  return _impl_.term_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotResponse::term() const {
+inline int32_t InstallSnapshotResponse::term() const {
   // @@protoc_insertion_point(field_get:raftRpcProctoc.InstallSnapshotResponse.Term)
   return _internal_term();
 }
-inline void InstallSnapshotResponse::_internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  term_ = value;
+inline void InstallSnapshotResponse::_internal_set_term(int32_t value) {
+  
+  _impl_.term_ = value;
 }
-inline void InstallSnapshotResponse::set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void InstallSnapshotResponse::set_term(int32_t value) {
   _internal_set_term(value);
   // @@protoc_insertion_point(field_set:raftRpcProctoc.InstallSnapshotResponse.Term)
 }
@@ -2092,4 +2076,4 @@ inline void InstallSnapshotResponse::set_term(::PROTOBUF_NAMESPACE_ID::int32 val
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>
-#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_raftRPC_2eproto
\ No newline at end of file
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_raftRPC_2eproto
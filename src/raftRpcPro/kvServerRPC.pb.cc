@@ -14,320 +14,1382 @@
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
-namespace raftKVRpcProctoc {
-class GetArgsDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GetArgs> _instance;
-} _GetArgs_default_instance_;
-class GetReplyDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GetReply> _instance;
-} _GetReply_default_instance_;
-class PutAppendArgsDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<PutAppendArgs> _instance;
-} _PutAppendArgs_default_instance_;
-class PutAppendReplyDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<PutAppendReply> _instance;
-} _PutAppendReply_default_instance_;
-}  // namespace raftKVRpcProctoc
-static void InitDefaultsscc_info_GetArgs_kvServerRPC_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::raftKVRpcProctoc::_GetArgs_default_instance_;
-    new (ptr) ::raftKVRpcProctoc::GetArgs();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::raftKVRpcProctoc::GetArgs::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_GetArgs_kvServerRPC_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_GetArgs_kvServerRPC_2eproto}, {}};
-
-static void InitDefaultsscc_info_GetReply_kvServerRPC_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::raftKVRpcProctoc::_GetReply_default_instance_;
-    new (ptr) ::raftKVRpcProctoc::GetReply();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::raftKVRpcProctoc::GetReply::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_GetReply_kvServerRPC_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_GetReply_kvServerRPC_2eproto}, {}};
-
-static void InitDefaultsscc_info_PutAppendArgs_kvServerRPC_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
 
-  {
-    void* ptr = &::raftKVRpcProctoc::_PutAppendArgs_default_instance_;
-    new (ptr) ::raftKVRpcProctoc::PutAppendArgs();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::raftKVRpcProctoc::PutAppendArgs::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_PutAppendArgs_kvServerRPC_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_PutAppendArgs_kvServerRPC_2eproto}, {}};
-
-static void InitDefaultsscc_info_PutAppendReply_kvServerRPC_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
+PROTOBUF_PRAGMA_INIT_SEG
 
-  {
-    void* ptr = &::raftKVRpcProctoc::_PutAppendReply_default_instance_;
-    new (ptr) ::raftKVRpcProctoc::PutAppendReply();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::raftKVRpcProctoc::PutAppendReply::InitAsDefaultInstance();
-}
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_PutAppendReply_kvServerRPC_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_PutAppendReply_kvServerRPC_2eproto}, {}};
-
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_kvServerRPC_2eproto[4];
-static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_kvServerRPC_2eproto = nullptr;
-static const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* file_level_service_descriptors_kvServerRPC_2eproto[1];
+namespace raftKVRpcProctoc {
+PROTOBUF_CONSTEXPR GetArgs::GetArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.clientid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.requestid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GetArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetArgsDefaultTypeInternal() {}
+  union {
+    GetArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetArgsDefaultTypeInternal _GetArgs_default_instance_;
+PROTOBUF_CONSTEXPR GetReply::GetReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.err_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.retryafterms_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GetReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetReplyDefaultTypeInternal() {}
+  union {
+    GetReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetReplyDefaultTypeInternal _GetReply_default_instance_;
+PROTOBUF_CONSTEXPR PutAppendArgs::PutAppendArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.op_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.clientid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.ttlms_)*/int64_t{0}
+  , /*decltype(_impl_.requestid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PutAppendArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PutAppendArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PutAppendArgsDefaultTypeInternal() {}
+  union {
+    PutAppendArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PutAppendArgsDefaultTypeInternal _PutAppendArgs_default_instance_;
+PROTOBUF_CONSTEXPR PutAppendReply::PutAppendReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.err_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.retryafterms_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PutAppendReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PutAppendReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PutAppendReplyDefaultTypeInternal() {}
+  union {
+    PutAppendReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PutAppendReplyDefaultTypeInternal _PutAppendReply_default_instance_;
+PROTOBUF_CONSTEXPR ScanArgs::ScanArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.startkey_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.endkey_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.pagetoken_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.clientid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.limit_)*/0
+  , /*decltype(_impl_.requestid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ScanArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ScanArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ScanArgsDefaultTypeInternal() {}
+  union {
+    ScanArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ScanArgsDefaultTypeInternal _ScanArgs_default_instance_;
+PROTOBUF_CONSTEXPR PrefixScanArgs::PrefixScanArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.prefix_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.pagetoken_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.clientid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.limit_)*/0
+  , /*decltype(_impl_.requestid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PrefixScanArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PrefixScanArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PrefixScanArgsDefaultTypeInternal() {}
+  union {
+    PrefixScanArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PrefixScanArgsDefaultTypeInternal _PrefixScanArgs_default_instance_;
+PROTOBUF_CONSTEXPR KeyValue::KeyValue(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct KeyValueDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR KeyValueDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~KeyValueDefaultTypeInternal() {}
+  union {
+    KeyValue _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 KeyValueDefaultTypeInternal _KeyValue_default_instance_;
+PROTOBUF_CONSTEXPR ScanReply::ScanReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.kvs_)*/{}
+  , /*decltype(_impl_.err_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.nextpagetoken_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.readindex_)*/int64_t{0}
+  , /*decltype(_impl_.retryafterms_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ScanReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ScanReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ScanReplyDefaultTypeInternal() {}
+  union {
+    ScanReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ScanReplyDefaultTypeInternal _ScanReply_default_instance_;
+PROTOBUF_CONSTEXPR MultiGetArgs::MultiGetArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.keys_)*/{}
+  , /*decltype(_impl_.clientid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.requestid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MultiGetArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MultiGetArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MultiGetArgsDefaultTypeInternal() {}
+  union {
+    MultiGetArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MultiGetArgsDefaultTypeInternal _MultiGetArgs_default_instance_;
+PROTOBUF_CONSTEXPR GetResult::GetResult(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.exist_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GetResultDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetResultDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetResultDefaultTypeInternal() {}
+  union {
+    GetResult _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetResultDefaultTypeInternal _GetResult_default_instance_;
+PROTOBUF_CONSTEXPR MultiGetReply::MultiGetReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.results_)*/{}
+  , /*decltype(_impl_.err_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.retryafterms_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MultiGetReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MultiGetReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MultiGetReplyDefaultTypeInternal() {}
+  union {
+    MultiGetReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MultiGetReplyDefaultTypeInternal _MultiGetReply_default_instance_;
+PROTOBUF_CONSTEXPR WriteOp::WriteOp(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.op_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.ttlms_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WriteOpDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WriteOpDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WriteOpDefaultTypeInternal() {}
+  union {
+    WriteOp _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WriteOpDefaultTypeInternal _WriteOp_default_instance_;
+PROTOBUF_CONSTEXPR BatchWriteArgs::BatchWriteArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ops_)*/{}
+  , /*decltype(_impl_.clientid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.requestid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BatchWriteArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchWriteArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BatchWriteArgsDefaultTypeInternal() {}
+  union {
+    BatchWriteArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchWriteArgsDefaultTypeInternal _BatchWriteArgs_default_instance_;
+PROTOBUF_CONSTEXPR BatchWriteReply::BatchWriteReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.err_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.retryafterms_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BatchWriteReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchWriteReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BatchWriteReplyDefaultTypeInternal() {}
+  union {
+    BatchWriteReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchWriteReplyDefaultTypeInternal _BatchWriteReply_default_instance_;
+PROTOBUF_CONSTEXPR TxnCompare::TxnCompare(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.target_)*/0
+  , /*decltype(_impl_.result_)*/0
+  , /*decltype(_impl_.version_)*/int64_t{0}
+  , /*decltype(_impl_.exists_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TxnCompareDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TxnCompareDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TxnCompareDefaultTypeInternal() {}
+  union {
+    TxnCompare _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TxnCompareDefaultTypeInternal _TxnCompare_default_instance_;
+PROTOBUF_CONSTEXPR TxnOp::TxnOp(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.delta_)*/int64_t{0}
+  , /*decltype(_impl_.op_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TxnOpDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TxnOpDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TxnOpDefaultTypeInternal() {}
+  union {
+    TxnOp _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TxnOpDefaultTypeInternal _TxnOp_default_instance_;
+PROTOBUF_CONSTEXPR TxnArgs::TxnArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.compares_)*/{}
+  , /*decltype(_impl_.success_)*/{}
+  , /*decltype(_impl_.failure_)*/{}
+  , /*decltype(_impl_.clientid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.requestid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TxnArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TxnArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TxnArgsDefaultTypeInternal() {}
+  union {
+    TxnArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TxnArgsDefaultTypeInternal _TxnArgs_default_instance_;
+PROTOBUF_CONSTEXPR TxnOpResult::TxnOpResult(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.exist_)*/false
+  , /*decltype(_impl_.applied_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TxnOpResultDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TxnOpResultDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TxnOpResultDefaultTypeInternal() {}
+  union {
+    TxnOpResult _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TxnOpResultDefaultTypeInternal _TxnOpResult_default_instance_;
+PROTOBUF_CONSTEXPR TxnReply::TxnReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.results_)*/{}
+  , /*decltype(_impl_.err_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.txnerror_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.retryafterms_)*/int64_t{0}
+  , /*decltype(_impl_.succeeded_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TxnReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TxnReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TxnReplyDefaultTypeInternal() {}
+  union {
+    TxnReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TxnReplyDefaultTypeInternal _TxnReply_default_instance_;
+PROTOBUF_CONSTEXPR DeleteArgs::DeleteArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.clientid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.requestid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DeleteArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DeleteArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DeleteArgsDefaultTypeInternal() {}
+  union {
+    DeleteArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DeleteArgsDefaultTypeInternal _DeleteArgs_default_instance_;
+PROTOBUF_CONSTEXPR DeleteRangeArgs::DeleteRangeArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.startkey_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.endkey_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.clientid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.requestid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DeleteRangeArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DeleteRangeArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DeleteRangeArgsDefaultTypeInternal() {}
+  union {
+    DeleteRangeArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DeleteRangeArgsDefaultTypeInternal _DeleteRangeArgs_default_instance_;
+PROTOBUF_CONSTEXPR DeleteReply::DeleteReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.err_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.retryafterms_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DeleteReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DeleteReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DeleteReplyDefaultTypeInternal() {}
+  union {
+    DeleteReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DeleteReplyDefaultTypeInternal _DeleteReply_default_instance_;
+PROTOBUF_CONSTEXPR WatchEvent::WatchEvent(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.index_)*/int64_t{0}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WatchEventDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WatchEventDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WatchEventDefaultTypeInternal() {}
+  union {
+    WatchEvent _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WatchEventDefaultTypeInternal _WatchEvent_default_instance_;
+PROTOBUF_CONSTEXPR WatchArgs::WatchArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.startindex_)*/int64_t{0}
+  , /*decltype(_impl_.prefix_)*/false
+  , /*decltype(_impl_.maxevents_)*/0
+  , /*decltype(_impl_.watchid_)*/int64_t{0}
+  , /*decltype(_impl_.timeoutms_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WatchArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WatchArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WatchArgsDefaultTypeInternal() {}
+  union {
+    WatchArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WatchArgsDefaultTypeInternal _WatchArgs_default_instance_;
+PROTOBUF_CONSTEXPR WatchReply::WatchReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.events_)*/{}
+  , /*decltype(_impl_.err_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.watchid_)*/int64_t{0}
+  , /*decltype(_impl_.nextindex_)*/int64_t{0}
+  , /*decltype(_impl_.retryafterms_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WatchReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WatchReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WatchReplyDefaultTypeInternal() {}
+  union {
+    WatchReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WatchReplyDefaultTypeInternal _WatchReply_default_instance_;
+PROTOBUF_CONSTEXPR CancelWatchArgs::CancelWatchArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.watchid_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CancelWatchArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CancelWatchArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CancelWatchArgsDefaultTypeInternal() {}
+  union {
+    CancelWatchArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CancelWatchArgsDefaultTypeInternal _CancelWatchArgs_default_instance_;
+PROTOBUF_CONSTEXPR CancelWatchReply::CancelWatchReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.err_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CancelWatchReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CancelWatchReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CancelWatchReplyDefaultTypeInternal() {}
+  union {
+    CancelWatchReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CancelWatchReplyDefaultTypeInternal _CancelWatchReply_default_instance_;
+PROTOBUF_CONSTEXPR RegisterSessionArgs::RegisterSessionArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.nonce_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RegisterSessionArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RegisterSessionArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RegisterSessionArgsDefaultTypeInternal() {}
+  union {
+    RegisterSessionArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RegisterSessionArgsDefaultTypeInternal _RegisterSessionArgs_default_instance_;
+PROTOBUF_CONSTEXPR RegisterSessionReply::RegisterSessionReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.err_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.clientid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.sessionid_)*/uint64_t{0u}
+  , /*decltype(_impl_.retryafterms_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RegisterSessionReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RegisterSessionReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RegisterSessionReplyDefaultTypeInternal() {}
+  union {
+    RegisterSessionReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RegisterSessionReplyDefaultTypeInternal _RegisterSessionReply_default_instance_;
+PROTOBUF_CONSTEXPR CdcEntry::CdcEntry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.batch_)*/{}
+  , /*decltype(_impl_.operation_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.clientid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.command_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.index_)*/int64_t{0}
+  , /*decltype(_impl_.term_)*/int64_t{0}
+  , /*decltype(_impl_.timestampms_)*/int64_t{0}
+  , /*decltype(_impl_.ttlms_)*/int64_t{0}
+  , /*decltype(_impl_.requestid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CdcEntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CdcEntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CdcEntryDefaultTypeInternal() {}
+  union {
+    CdcEntry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CdcEntryDefaultTypeInternal _CdcEntry_default_instance_;
+PROTOBUF_CONSTEXPR ExportLogArgs::ExportLogArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.consumerid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.snapshotresumekey_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.fromindex_)*/int64_t{0}
+  , /*decltype(_impl_.maxentries_)*/0
+  , /*decltype(_impl_.includereads_)*/false
+  , /*decltype(_impl_.snapshotindex_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ExportLogArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ExportLogArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ExportLogArgsDefaultTypeInternal() {}
+  union {
+    ExportLogArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ExportLogArgsDefaultTypeInternal _ExportLogArgs_default_instance_;
+PROTOBUF_CONSTEXPR ExportLogReply::ExportLogReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_.snapshotkvs_)*/{}
+  , /*decltype(_impl_.err_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.snapshotresumekey_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.nextindex_)*/int64_t{0}
+  , /*decltype(_impl_.snapshotindex_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ExportLogReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ExportLogReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ExportLogReplyDefaultTypeInternal() {}
+  union {
+    ExportLogReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ExportLogReplyDefaultTypeInternal _ExportLogReply_default_instance_;
+PROTOBUF_CONSTEXPR CommitCdcCheckpointArgs::CommitCdcCheckpointArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.consumerid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.clientid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.index_)*/int64_t{0}
+  , /*decltype(_impl_.requestid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CommitCdcCheckpointArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CommitCdcCheckpointArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CommitCdcCheckpointArgsDefaultTypeInternal() {}
+  union {
+    CommitCdcCheckpointArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CommitCdcCheckpointArgsDefaultTypeInternal _CommitCdcCheckpointArgs_default_instance_;
+PROTOBUF_CONSTEXPR CommitCdcCheckpointReply::CommitCdcCheckpointReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.err_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.index_)*/int64_t{0}
+  , /*decltype(_impl_.retryafterms_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CommitCdcCheckpointReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CommitCdcCheckpointReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CommitCdcCheckpointReplyDefaultTypeInternal() {}
+  union {
+    CommitCdcCheckpointReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CommitCdcCheckpointReplyDefaultTypeInternal _CommitCdcCheckpointReply_default_instance_;
+}  // namespace raftKVRpcProctoc
+static ::_pb::Metadata file_level_metadata_kvServerRPC_2eproto[34];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_kvServerRPC_2eproto[4];
+static const ::_pb::ServiceDescriptor* file_level_service_descriptors_kvServerRPC_2eproto[1];
 
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_kvServerRPC_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_kvServerRPC_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetArgs, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetArgs, key_),
-  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetArgs, clientid_),
-  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetArgs, requestid_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetArgs, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetArgs, _impl_.clientid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetArgs, _impl_.requestid_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetReply, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetReply, err_),
-  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetReply, value_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetReply, _impl_.err_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetReply, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetReply, _impl_.retryafterms_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendArgs, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendArgs, key_),
-  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendArgs, value_),
-  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendArgs, op_),
-  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendArgs, clientid_),
-  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendArgs, requestid_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendArgs, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendArgs, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendArgs, _impl_.op_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendArgs, _impl_.clientid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendArgs, _impl_.requestid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendArgs, _impl_.ttlms_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendReply, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendReply, err_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendReply, _impl_.err_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendReply, _impl_.retryafterms_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ScanArgs, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ScanArgs, _impl_.startkey_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ScanArgs, _impl_.endkey_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ScanArgs, _impl_.limit_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ScanArgs, _impl_.pagetoken_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ScanArgs, _impl_.clientid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ScanArgs, _impl_.requestid_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PrefixScanArgs, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PrefixScanArgs, _impl_.prefix_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PrefixScanArgs, _impl_.limit_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PrefixScanArgs, _impl_.pagetoken_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PrefixScanArgs, _impl_.clientid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PrefixScanArgs, _impl_.requestid_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::KeyValue, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::KeyValue, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::KeyValue, _impl_.value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ScanReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ScanReply, _impl_.err_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ScanReply, _impl_.kvs_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ScanReply, _impl_.nextpagetoken_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ScanReply, _impl_.readindex_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ScanReply, _impl_.retryafterms_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::MultiGetArgs, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::MultiGetArgs, _impl_.keys_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::MultiGetArgs, _impl_.clientid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::MultiGetArgs, _impl_.requestid_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetResult, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetResult, _impl_.exist_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetResult, _impl_.value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::MultiGetReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::MultiGetReply, _impl_.err_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::MultiGetReply, _impl_.results_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::MultiGetReply, _impl_.retryafterms_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::WriteOp, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::WriteOp, _impl_.op_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::WriteOp, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::WriteOp, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::WriteOp, _impl_.ttlms_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::BatchWriteArgs, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::BatchWriteArgs, _impl_.ops_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::BatchWriteArgs, _impl_.clientid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::BatchWriteArgs, _impl_.requestid_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::BatchWriteReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::BatchWriteReply, _impl_.err_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::BatchWriteReply, _impl_.retryafterms_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TxnCompare, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TxnCompare, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TxnCompare, _impl_.target_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TxnCompare, _impl_.result_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TxnCompare, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TxnCompare, _impl_.exists_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TxnCompare, _impl_.version_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TxnOp, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TxnOp, _impl_.op_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TxnOp, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TxnOp, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TxnOp, _impl_.delta_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TxnArgs, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TxnArgs, _impl_.compares_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TxnArgs, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TxnArgs, _impl_.failure_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TxnArgs, _impl_.clientid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TxnArgs, _impl_.requestid_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TxnOpResult, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TxnOpResult, _impl_.exist_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TxnOpResult, _impl_.applied_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TxnOpResult, _impl_.value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TxnReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TxnReply, _impl_.err_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TxnReply, _impl_.succeeded_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TxnReply, _impl_.results_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TxnReply, _impl_.txnerror_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TxnReply, _impl_.retryafterms_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::DeleteArgs, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::DeleteArgs, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::DeleteArgs, _impl_.clientid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::DeleteArgs, _impl_.requestid_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::DeleteRangeArgs, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::DeleteRangeArgs, _impl_.startkey_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::DeleteRangeArgs, _impl_.endkey_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::DeleteRangeArgs, _impl_.clientid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::DeleteRangeArgs, _impl_.requestid_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::DeleteReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::DeleteReply, _impl_.err_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::DeleteReply, _impl_.retryafterms_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::WatchEvent, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::WatchEvent, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::WatchEvent, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::WatchEvent, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::WatchEvent, _impl_.index_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::WatchArgs, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::WatchArgs, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::WatchArgs, _impl_.prefix_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::WatchArgs, _impl_.startindex_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::WatchArgs, _impl_.watchid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::WatchArgs, _impl_.maxevents_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::WatchArgs, _impl_.timeoutms_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::WatchReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::WatchReply, _impl_.err_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::WatchReply, _impl_.watchid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::WatchReply, _impl_.events_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::WatchReply, _impl_.nextindex_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::WatchReply, _impl_.retryafterms_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::CancelWatchArgs, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::CancelWatchArgs, _impl_.watchid_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::CancelWatchReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::CancelWatchReply, _impl_.err_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::RegisterSessionArgs, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::RegisterSessionArgs, _impl_.nonce_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::RegisterSessionReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::RegisterSessionReply, _impl_.err_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::RegisterSessionReply, _impl_.sessionid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::RegisterSessionReply, _impl_.clientid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::RegisterSessionReply, _impl_.retryafterms_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::CdcEntry, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::CdcEntry, _impl_.index_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::CdcEntry, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::CdcEntry, _impl_.operation_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::CdcEntry, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::CdcEntry, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::CdcEntry, _impl_.clientid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::CdcEntry, _impl_.requestid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::CdcEntry, _impl_.timestampms_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::CdcEntry, _impl_.ttlms_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::CdcEntry, _impl_.batch_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::CdcEntry, _impl_.command_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ExportLogArgs, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ExportLogArgs, _impl_.consumerid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ExportLogArgs, _impl_.fromindex_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ExportLogArgs, _impl_.maxentries_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ExportLogArgs, _impl_.includereads_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ExportLogArgs, _impl_.snapshotindex_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ExportLogArgs, _impl_.snapshotresumekey_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ExportLogReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ExportLogReply, _impl_.err_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ExportLogReply, _impl_.entries_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ExportLogReply, _impl_.nextindex_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ExportLogReply, _impl_.snapshotindex_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ExportLogReply, _impl_.snapshotkvs_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ExportLogReply, _impl_.snapshotresumekey_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::CommitCdcCheckpointArgs, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::CommitCdcCheckpointArgs, _impl_.consumerid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::CommitCdcCheckpointArgs, _impl_.index_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::CommitCdcCheckpointArgs, _impl_.clientid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::CommitCdcCheckpointArgs, _impl_.requestid_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::CommitCdcCheckpointReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::CommitCdcCheckpointReply, _impl_.err_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::CommitCdcCheckpointReply, _impl_.index_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::CommitCdcCheckpointReply, _impl_.retryafterms_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::raftKVRpcProctoc::GetArgs)},
-  { 8, -1, sizeof(::raftKVRpcProctoc::GetReply)},
-  { 15, -1, sizeof(::raftKVRpcProctoc::PutAppendArgs)},
-  { 25, -1, sizeof(::raftKVRpcProctoc::PutAppendReply)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::raftKVRpcProctoc::GetArgs)},
+  { 9, -1, -1, sizeof(::raftKVRpcProctoc::GetReply)},
+  { 18, -1, -1, sizeof(::raftKVRpcProctoc::PutAppendArgs)},
+  { 30, -1, -1, sizeof(::raftKVRpcProctoc::PutAppendReply)},
+  { 38, -1, -1, sizeof(::raftKVRpcProctoc::ScanArgs)},
+  { 50, -1, -1, sizeof(::raftKVRpcProctoc::PrefixScanArgs)},
+  { 61, -1, -1, sizeof(::raftKVRpcProctoc::KeyValue)},
+  { 69, -1, -1, sizeof(::raftKVRpcProctoc::ScanReply)},
+  { 80, -1, -1, sizeof(::raftKVRpcProctoc::MultiGetArgs)},
+  { 89, -1, -1, sizeof(::raftKVRpcProctoc::GetResult)},
+  { 97, -1, -1, sizeof(::raftKVRpcProctoc::MultiGetReply)},
+  { 106, -1, -1, sizeof(::raftKVRpcProctoc::WriteOp)},
+  { 116, -1, -1, sizeof(::raftKVRpcProctoc::BatchWriteArgs)},
+  { 125, -1, -1, sizeof(::raftKVRpcProctoc::BatchWriteReply)},
+  { 133, -1, -1, sizeof(::raftKVRpcProctoc::TxnCompare)},
+  { 145, -1, -1, sizeof(::raftKVRpcProctoc::TxnOp)},
+  { 155, -1, -1, sizeof(::raftKVRpcProctoc::TxnArgs)},
+  { 166, -1, -1, sizeof(::raftKVRpcProctoc::TxnOpResult)},
+  { 175, -1, -1, sizeof(::raftKVRpcProctoc::TxnReply)},
+  { 186, -1, -1, sizeof(::raftKVRpcProctoc::DeleteArgs)},
+  { 195, -1, -1, sizeof(::raftKVRpcProctoc::DeleteRangeArgs)},
+  { 205, -1, -1, sizeof(::raftKVRpcProctoc::DeleteReply)},
+  { 213, -1, -1, sizeof(::raftKVRpcProctoc::WatchEvent)},
+  { 223, -1, -1, sizeof(::raftKVRpcProctoc::WatchArgs)},
+  { 235, -1, -1, sizeof(::raftKVRpcProctoc::WatchReply)},
+  { 246, -1, -1, sizeof(::raftKVRpcProctoc::CancelWatchArgs)},
+  { 253, -1, -1, sizeof(::raftKVRpcProctoc::CancelWatchReply)},
+  { 260, -1, -1, sizeof(::raftKVRpcProctoc::RegisterSessionArgs)},
+  { 267, -1, -1, sizeof(::raftKVRpcProctoc::RegisterSessionReply)},
+  { 277, -1, -1, sizeof(::raftKVRpcProctoc::CdcEntry)},
+  { 294, -1, -1, sizeof(::raftKVRpcProctoc::ExportLogArgs)},
+  { 306, -1, -1, sizeof(::raftKVRpcProctoc::ExportLogReply)},
+  { 318, -1, -1, sizeof(::raftKVRpcProctoc::CommitCdcCheckpointArgs)},
+  { 328, -1, -1, sizeof(::raftKVRpcProctoc::CommitCdcCheckpointReply)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::raftKVRpcProctoc::_GetArgs_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::raftKVRpcProctoc::_GetReply_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::raftKVRpcProctoc::_PutAppendArgs_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::raftKVRpcProctoc::_PutAppendReply_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::raftKVRpcProctoc::_GetArgs_default_instance_._instance,
+  &::raftKVRpcProctoc::_GetReply_default_instance_._instance,
+  &::raftKVRpcProctoc::_PutAppendArgs_default_instance_._instance,
+  &::raftKVRpcProctoc::_PutAppendReply_default_instance_._instance,
+  &::raftKVRpcProctoc::_ScanArgs_default_instance_._instance,
+  &::raftKVRpcProctoc::_PrefixScanArgs_default_instance_._instance,
+  &::raftKVRpcProctoc::_KeyValue_default_instance_._instance,
+  &::raftKVRpcProctoc::_ScanReply_default_instance_._instance,
+  &::raftKVRpcProctoc::_MultiGetArgs_default_instance_._instance,
+  &::raftKVRpcProctoc::_GetResult_default_instance_._instance,
+  &::raftKVRpcProctoc::_MultiGetReply_default_instance_._instance,
+  &::raftKVRpcProctoc::_WriteOp_default_instance_._instance,
+  &::raftKVRpcProctoc::_BatchWriteArgs_default_instance_._instance,
+  &::raftKVRpcProctoc::_BatchWriteReply_default_instance_._instance,
+  &::raftKVRpcProctoc::_TxnCompare_default_instance_._instance,
+  &::raftKVRpcProctoc::_TxnOp_default_instance_._instance,
+  &::raftKVRpcProctoc::_TxnArgs_default_instance_._instance,
+  &::raftKVRpcProctoc::_TxnOpResult_default_instance_._instance,
+  &::raftKVRpcProctoc::_TxnReply_default_instance_._instance,
+  &::raftKVRpcProctoc::_DeleteArgs_default_instance_._instance,
+  &::raftKVRpcProctoc::_DeleteRangeArgs_default_instance_._instance,
+  &::raftKVRpcProctoc::_DeleteReply_default_instance_._instance,
+  &::raftKVRpcProctoc::_WatchEvent_default_instance_._instance,
+  &::raftKVRpcProctoc::_WatchArgs_default_instance_._instance,
+  &::raftKVRpcProctoc::_WatchReply_default_instance_._instance,
+  &::raftKVRpcProctoc::_CancelWatchArgs_default_instance_._instance,
+  &::raftKVRpcProctoc::_CancelWatchReply_default_instance_._instance,
+  &::raftKVRpcProctoc::_RegisterSessionArgs_default_instance_._instance,
+  &::raftKVRpcProctoc::_RegisterSessionReply_default_instance_._instance,
+  &::raftKVRpcProctoc::_CdcEntry_default_instance_._instance,
+  &::raftKVRpcProctoc::_ExportLogArgs_default_instance_._instance,
+  &::raftKVRpcProctoc::_ExportLogReply_default_instance_._instance,
+  &::raftKVRpcProctoc::_CommitCdcCheckpointArgs_default_instance_._instance,
+  &::raftKVRpcProctoc::_CommitCdcCheckpointReply_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_kvServerRPC_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
   "\n\021kvServerRPC.proto\022\020raftKVRpcProctoc\";\n"
   "\007GetArgs\022\013\n\003Key\030\001 \001(\014\022\020\n\010ClientId\030\002 \001(\014\022"
-  "\021\n\tRequestId\030\003 \001(\005\"&\n\010GetReply\022\013\n\003Err\030\001 "
-  "\001(\014\022\r\n\005Value\030\002 \001(\014\"\\\n\rPutAppendArgs\022\013\n\003K"
-  "ey\030\001 \001(\014\022\r\n\005Value\030\002 \001(\014\022\n\n\002Op\030\003 \001(\014\022\020\n\010C"
-  "lientId\030\004 \001(\014\022\021\n\tRequestId\030\005 \001(\005\"\035\n\016PutA"
-  "ppendReply\022\013\n\003Err\030\001 \001(\0142\233\001\n\013kvServerRpc\022"
-  "N\n\tPutAppend\022\037.raftKVRpcProctoc.PutAppen"
-  "dArgs\032 .raftKVRpcProctoc.PutAppendReply\022"
-  "<\n\003Get\022\031.raftKVRpcProctoc.GetArgs\032\032.raft"
-  "KVRpcProctoc.GetReplyB\003\200\001\001b\006proto3"
+  "\021\n\tRequestId\030\003 \001(\005\"<\n\010GetReply\022\013\n\003Err\030\001 "
+  "\001(\014\022\r\n\005Value\030\002 \001(\014\022\024\n\014RetryAfterMs\030\003 \001(\003"
+  "\"k\n\rPutAppendArgs\022\013\n\003Key\030\001 \001(\014\022\r\n\005Value\030"
+  "\002 \001(\014\022\n\n\002Op\030\003 \001(\014\022\020\n\010ClientId\030\004 \001(\014\022\021\n\tR"
+  "equestId\030\005 \001(\005\022\r\n\005TtlMs\030\006 \001(\003\"3\n\016PutAppe"
+  "ndReply\022\013\n\003Err\030\001 \001(\014\022\024\n\014RetryAfterMs\030\002 \001"
+  "(\003\"s\n\010ScanArgs\022\020\n\010StartKey\030\001 \001(\014\022\016\n\006EndK"
+  "ey\030\002 \001(\014\022\r\n\005Limit\030\003 \001(\005\022\021\n\tPageToken\030\004 \001"
+  "(\014\022\020\n\010ClientId\030\005 \001(\014\022\021\n\tRequestId\030\006 \001(\005\""
+  "g\n\016PrefixScanArgs\022\016\n\006Prefix\030\001 \001(\014\022\r\n\005Lim"
+  "it\030\002 \001(\005\022\021\n\tPageToken\030\003 \001(\014\022\020\n\010ClientId\030"
+  "\004 \001(\014\022\021\n\tRequestId\030\005 \001(\005\"&\n\010KeyValue\022\013\n\003"
+  "Key\030\001 \001(\014\022\r\n\005Value\030\002 \001(\014\"\201\001\n\tScanReply\022\013"
+  "\n\003Err\030\001 \001(\014\022\'\n\003Kvs\030\002 \003(\0132\032.raftKVRpcProc"
+  "toc.KeyValue\022\025\n\rNextPageToken\030\003 \001(\014\022\021\n\tR"
+  "eadIndex\030\004 \001(\003\022\024\n\014RetryAfterMs\030\005 \001(\003\"A\n\014"
+  "MultiGetArgs\022\014\n\004Keys\030\001 \003(\014\022\020\n\010ClientId\030\002"
+  " \001(\014\022\021\n\tRequestId\030\003 \001(\005\")\n\tGetResult\022\r\n\005"
+  "Exist\030\001 \001(\010\022\r\n\005Value\030\002 \001(\014\"`\n\rMultiGetRe"
+  "ply\022\013\n\003Err\030\001 \001(\014\022,\n\007Results\030\002 \003(\0132\033.raft"
+  "KVRpcProctoc.GetResult\022\024\n\014RetryAfterMs\030\003"
+  " \001(\003\"@\n\007WriteOp\022\n\n\002Op\030\001 \001(\014\022\013\n\003Key\030\002 \001(\014"
+  "\022\r\n\005Value\030\003 \001(\014\022\r\n\005TtlMs\030\004 \001(\003\"]\n\016BatchW"
+  "riteArgs\022&\n\003Ops\030\001 \003(\0132\031.raftKVRpcProctoc"
+  ".WriteOp\022\020\n\010ClientId\030\002 \001(\014\022\021\n\tRequestId\030"
+  "\003 \001(\005\"4\n\017BatchWriteReply\022\013\n\003Err\030\001 \001(\014\022\024\n"
+  "\014RetryAfterMs\030\002 \001(\003\"\234\002\n\nTxnCompare\022\013\n\003Ke"
+  "y\030\001 \001(\014\0223\n\006target\030\002 \001(\0162#.raftKVRpcProct"
+  "oc.TxnCompare.Target\0223\n\006result\030\003 \001(\0162#.r"
+  "aftKVRpcProctoc.TxnCompare.Result\022\r\n\005Val"
+  "ue\030\004 \001(\014\022\016\n\006Exists\030\005 \001(\010\022\017\n\007Version\030\006 \001("
+  "\003\",\n\006Target\022\t\n\005VALUE\020\000\022\n\n\006EXISTS\020\001\022\013\n\007VE"
+  "RSION\020\002\"9\n\006Result\022\t\n\005EQUAL\020\000\022\r\n\tNOT_EQUA"
+  "L\020\001\022\013\n\007GREATER\020\002\022\010\n\004LESS\020\003\"\267\001\n\005TxnOp\022*\n\002"
+  "Op\030\001 \001(\0162\036.raftKVRpcProctoc.TxnOp.OpType"
+  "\022\013\n\003Key\030\002 \001(\014\022\r\n\005Value\030\003 \001(\014\022\r\n\005Delta\030\004 "
+  "\001(\003\"W\n\006OpType\022\007\n\003GET\020\000\022\007\n\003PUT\020\001\022\n\n\006APPEN"
+  "D\020\002\022\n\n\006DELETE\020\003\022\r\n\tINCREMENT\020\004\022\024\n\020APPEND"
+  "_IF_ABSENT\020\005\"\262\001\n\007TxnArgs\022.\n\010Compares\030\001 \003"
+  "(\0132\034.raftKVRpcProctoc.TxnCompare\022(\n\007Succ"
+  "ess\030\002 \003(\0132\027.raftKVRpcProctoc.TxnOp\022(\n\007Fa"
+  "ilure\030\003 \003(\0132\027.raftKVRpcProctoc.TxnOp\022\020\n\010"
+  "ClientId\030\004 \001(\014\022\021\n\tRequestId\030\005 \001(\005\"<\n\013Txn"
+  "OpResult\022\r\n\005Exist\030\001 \001(\010\022\017\n\007Applied\030\002 \001(\010"
+  "\022\r\n\005Value\030\003 \001(\014\"\202\001\n\010TxnReply\022\013\n\003Err\030\001 \001("
+  "\014\022\021\n\tSucceeded\030\002 \001(\010\022.\n\007Results\030\003 \003(\0132\035."
+  "raftKVRpcProctoc.TxnOpResult\022\020\n\010TxnError"
+  "\030\004 \001(\014\022\024\n\014RetryAfterMs\030\005 \001(\003\">\n\nDeleteAr"
+  "gs\022\013\n\003Key\030\001 \001(\014\022\020\n\010ClientId\030\002 \001(\014\022\021\n\tReq"
+  "uestId\030\003 \001(\005\"X\n\017DeleteRangeArgs\022\020\n\010Start"
+  "Key\030\001 \001(\014\022\016\n\006EndKey\030\002 \001(\014\022\020\n\010ClientId\030\003 "
+  "\001(\014\022\021\n\tRequestId\030\004 \001(\005\"0\n\013DeleteReply\022\013\n"
+  "\003Err\030\001 \001(\014\022\024\n\014RetryAfterMs\030\002 \001(\003\"\233\001\n\nWat"
+  "chEvent\0224\n\004Type\030\001 \001(\0162&.raftKVRpcProctoc"
+  ".WatchEvent.EventType\022\013\n\003Key\030\002 \001(\014\022\r\n\005Va"
+  "lue\030\003 \001(\014\022\r\n\005Index\030\004 \001(\003\",\n\tEventType\022\007\n"
+  "\003PUT\020\000\022\n\n\006APPEND\020\001\022\n\n\006DELETE\020\002\"s\n\tWatchA"
+  "rgs\022\013\n\003Key\030\001 \001(\014\022\016\n\006Prefix\030\002 \001(\010\022\022\n\nStar"
+  "tIndex\030\003 \001(\003\022\017\n\007WatchId\030\004 \001(\003\022\021\n\tMaxEven"
+  "ts\030\005 \001(\005\022\021\n\tTimeoutMs\030\006 \001(\005\"\201\001\n\nWatchRep"
+  "ly\022\013\n\003Err\030\001 \001(\014\022\017\n\007WatchId\030\002 \001(\003\022,\n\006Even"
+  "ts\030\003 \003(\0132\034.raftKVRpcProctoc.WatchEvent\022\021"
+  "\n\tNextIndex\030\004 \001(\003\022\024\n\014RetryAfterMs\030\005 \001(\003\""
+  "\"\n\017CancelWatchArgs\022\017\n\007WatchId\030\001 \001(\003\"\037\n\020C"
+  "ancelWatchReply\022\013\n\003Err\030\001 \001(\014\"$\n\023Register"
+  "SessionArgs\022\r\n\005Nonce\030\001 \001(\004\"^\n\024RegisterSe"
+  "ssionReply\022\013\n\003Err\030\001 \001(\014\022\021\n\tSessionId\030\002 \001"
+  "(\004\022\020\n\010ClientId\030\003 \001(\014\022\024\n\014RetryAfterMs\030\004 \001"
+  "(\003\"\332\001\n\010CdcEntry\022\r\n\005Index\030\001 \001(\003\022\014\n\004Term\030\002"
+  " \001(\003\022\021\n\tOperation\030\003 \001(\014\022\013\n\003Key\030\004 \001(\014\022\r\n\005"
+  "Value\030\005 \001(\014\022\020\n\010ClientId\030\006 \001(\014\022\021\n\tRequest"
+  "Id\030\007 \001(\005\022\023\n\013TimestampMs\030\010 \001(\003\022\r\n\005TtlMs\030\t"
+  " \001(\003\022(\n\005Batch\030\n \003(\0132\031.raftKVRpcProctoc.W"
+  "riteOp\022\017\n\007Command\030\013 \001(\014\"\222\001\n\rExportLogArg"
+  "s\022\022\n\nConsumerId\030\001 \001(\014\022\021\n\tFromIndex\030\002 \001(\003"
+  "\022\022\n\nMaxEntries\030\003 \001(\005\022\024\n\014IncludeReads\030\004 \001"
+  "(\010\022\025\n\rSnapshotIndex\030\005 \001(\003\022\031\n\021SnapshotRes"
+  "umeKey\030\006 \001(\014\"\300\001\n\016ExportLogReply\022\013\n\003Err\030\001"
+  " \001(\014\022+\n\007Entries\030\002 \003(\0132\032.raftKVRpcProctoc"
+  ".CdcEntry\022\021\n\tNextIndex\030\003 \001(\003\022\025\n\rSnapshot"
+  "Index\030\004 \001(\003\022/\n\013SnapshotKvs\030\005 \003(\0132\032.raftK"
+  "VRpcProctoc.KeyValue\022\031\n\021SnapshotResumeKe"
+  "y\030\006 \001(\014\"a\n\027CommitCdcCheckpointArgs\022\022\n\nCo"
+  "nsumerId\030\001 \001(\014\022\r\n\005Index\030\002 \001(\003\022\020\n\010ClientI"
+  "d\030\003 \001(\014\022\021\n\tRequestId\030\004 \001(\005\"L\n\030CommitCdcC"
+  "heckpointReply\022\013\n\003Err\030\001 \001(\014\022\r\n\005Index\030\002 \001"
+  "(\003\022\024\n\014RetryAfterMs\030\003 \001(\0032\331\010\n\013kvServerRpc"
+  "\022N\n\tPutAppend\022\037.raftKVRpcProctoc.PutAppe"
+  "ndArgs\032 .raftKVRpcProctoc.PutAppendReply"
+  "\022<\n\003Get\022\031.raftKVRpcProctoc.GetArgs\032\032.raf"
+  "tKVRpcProctoc.GetReply\022\?\n\004Scan\022\032.raftKVR"
+  "pcProctoc.ScanArgs\032\033.raftKVRpcProctoc.Sc"
+  "anReply\022K\n\nPrefixScan\022 .raftKVRpcProctoc"
+  ".PrefixScanArgs\032\033.raftKVRpcProctoc.ScanR"
+  "eply\022K\n\010MultiGet\022\036.raftKVRpcProctoc.Mult"
+  "iGetArgs\032\037.raftKVRpcProctoc.MultiGetRepl"
+  "y\022Q\n\nBatchWrite\022 .raftKVRpcProctoc.Batch"
+  "WriteArgs\032!.raftKVRpcProctoc.BatchWriteR"
+  "eply\022<\n\003Txn\022\031.raftKVRpcProctoc.TxnArgs\032\032"
+  ".raftKVRpcProctoc.TxnReply\022E\n\006Delete\022\034.r"
+  "aftKVRpcProctoc.DeleteArgs\032\035.raftKVRpcPr"
+  "octoc.DeleteReply\022O\n\013DeleteRange\022!.raftK"
+  "VRpcProctoc.DeleteRangeArgs\032\035.raftKVRpcP"
+  "roctoc.DeleteReply\022B\n\005Watch\022\033.raftKVRpcP"
+  "roctoc.WatchArgs\032\034.raftKVRpcProctoc.Watc"
+  "hReply\022T\n\013CancelWatch\022!.raftKVRpcProctoc"
+  ".CancelWatchArgs\032\".raftKVRpcProctoc.Canc"
+  "elWatchReply\022`\n\017RegisterSession\022%.raftKV"
+  "RpcProctoc.RegisterSessionArgs\032&.raftKVR"
+  "pcProctoc.RegisterSessionReply\022N\n\tExport"
+  "Log\022\037.raftKVRpcProctoc.ExportLogArgs\032 .r"
+  "aftKVRpcProctoc.ExportLogReply\022l\n\023Commit"
+  "CdcCheckpoint\022).raftKVRpcProctoc.CommitC"
+  "dcCheckpointArgs\032*.raftKVRpcProctoc.Comm"
+  "itCdcCheckpointReplyB\003\200\001\001b\006proto3"
   ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_kvServerRPC_2eproto_deps[1] = {
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_kvServerRPC_2eproto_sccs[4] = {
-  &scc_info_GetArgs_kvServerRPC_2eproto.base,
-  &scc_info_GetReply_kvServerRPC_2eproto.base,
-  &scc_info_PutAppendArgs_kvServerRPC_2eproto.base,
-  &scc_info_PutAppendReply_kvServerRPC_2eproto.base,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_kvServerRPC_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_kvServerRPC_2eproto = {
-  false, false, descriptor_table_protodef_kvServerRPC_2eproto, "kvServerRPC.proto", 434,
-  &descriptor_table_kvServerRPC_2eproto_once, descriptor_table_kvServerRPC_2eproto_sccs, descriptor_table_kvServerRPC_2eproto_deps, 4, 0,
-  schemas, file_default_instances, TableStruct_kvServerRPC_2eproto::offsets,
-  file_level_metadata_kvServerRPC_2eproto, 4, file_level_enum_descriptors_kvServerRPC_2eproto, file_level_service_descriptors_kvServerRPC_2eproto,
+static ::_pbi::once_flag descriptor_table_kvServerRPC_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_kvServerRPC_2eproto = {
+    false, false, 4673, descriptor_table_protodef_kvServerRPC_2eproto,
+    "kvServerRPC.proto",
+    &descriptor_table_kvServerRPC_2eproto_once, nullptr, 0, 34,
+    schemas, file_default_instances, TableStruct_kvServerRPC_2eproto::offsets,
+    file_level_metadata_kvServerRPC_2eproto, file_level_enum_descriptors_kvServerRPC_2eproto,
+    file_level_service_descriptors_kvServerRPC_2eproto,
 };
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_kvServerRPC_2eproto_getter() {
+  return &descriptor_table_kvServerRPC_2eproto;
+}
 
 // Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_kvServerRPC_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_kvServerRPC_2eproto)), true);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_kvServerRPC_2eproto(&descriptor_table_kvServerRPC_2eproto);
 namespace raftKVRpcProctoc {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TxnCompare_Target_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_kvServerRPC_2eproto);
+  return file_level_enum_descriptors_kvServerRPC_2eproto[0];
+}
+bool TxnCompare_Target_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
 
-// ===================================================================
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr TxnCompare_Target TxnCompare::VALUE;
+constexpr TxnCompare_Target TxnCompare::EXISTS;
+constexpr TxnCompare_Target TxnCompare::VERSION;
+constexpr TxnCompare_Target TxnCompare::Target_MIN;
+constexpr TxnCompare_Target TxnCompare::Target_MAX;
+constexpr int TxnCompare::Target_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TxnCompare_Result_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_kvServerRPC_2eproto);
+  return file_level_enum_descriptors_kvServerRPC_2eproto[1];
+}
+bool TxnCompare_Result_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr TxnCompare_Result TxnCompare::EQUAL;
+constexpr TxnCompare_Result TxnCompare::NOT_EQUAL;
+constexpr TxnCompare_Result TxnCompare::GREATER;
+constexpr TxnCompare_Result TxnCompare::LESS;
+constexpr TxnCompare_Result TxnCompare::Result_MIN;
+constexpr TxnCompare_Result TxnCompare::Result_MAX;
+constexpr int TxnCompare::Result_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TxnOp_OpType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_kvServerRPC_2eproto);
+  return file_level_enum_descriptors_kvServerRPC_2eproto[2];
+}
+bool TxnOp_OpType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+      return true;
+    default:
+      return false;
+  }
+}
 
-void GetArgs::InitAsDefaultInstance() {
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr TxnOp_OpType TxnOp::GET;
+constexpr TxnOp_OpType TxnOp::PUT;
+constexpr TxnOp_OpType TxnOp::APPEND;
+constexpr TxnOp_OpType TxnOp::DELETE;
+constexpr TxnOp_OpType TxnOp::INCREMENT;
+constexpr TxnOp_OpType TxnOp::APPEND_IF_ABSENT;
+constexpr TxnOp_OpType TxnOp::OpType_MIN;
+constexpr TxnOp_OpType TxnOp::OpType_MAX;
+constexpr int TxnOp::OpType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* WatchEvent_EventType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_kvServerRPC_2eproto);
+  return file_level_enum_descriptors_kvServerRPC_2eproto[3];
+}
+bool WatchEvent_EventType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
 }
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr WatchEvent_EventType WatchEvent::PUT;
+constexpr WatchEvent_EventType WatchEvent::APPEND;
+constexpr WatchEvent_EventType WatchEvent::DELETE;
+constexpr WatchEvent_EventType WatchEvent::EventType_MIN;
+constexpr WatchEvent_EventType WatchEvent::EventType_MAX;
+constexpr int WatchEvent::EventType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
 class GetArgs::_Internal {
  public:
 };
 
-GetArgs::GetArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+GetArgs::GetArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.GetArgs)
 }
 GetArgs::GetArgs(const GetArgs& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.requestid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  key_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_key().empty()) {
-    key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_key(),
-      GetArena());
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
   }
-  clientid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.clientid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_clientid().empty()) {
-    clientid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_clientid(),
-      GetArena());
+    _this->_impl_.clientid_.Set(from._internal_clientid(), 
+      _this->GetArenaForAllocation());
   }
-  requestid_ = from.requestid_;
+  _this->_impl_.requestid_ = from._impl_.requestid_;
   // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.GetArgs)
 }
 
-void GetArgs::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GetArgs_kvServerRPC_2eproto.base);
-  key_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  clientid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  requestid_ = 0;
+inline void GetArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.requestid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.clientid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 GetArgs::~GetArgs() {
   // @@protoc_insertion_point(destructor:raftKVRpcProctoc.GetArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void GetArgs::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  key_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  clientid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void GetArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.clientid_.Destroy();
 }
 
-void GetArgs::ArenaDtor(void* object) {
-  GetArgs* _this = reinterpret_cast< GetArgs* >(object);
-  (void)_this;
-}
-void GetArgs::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void GetArgs::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const GetArgs& GetArgs::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GetArgs_kvServerRPC_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void GetArgs::Clear() {
 // @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.GetArgs)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  key_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  clientid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  requestid_ = 0;
+  _impl_.key_.ClearToEmpty();
+  _impl_.clientid_.ClearToEmpty();
+  _impl_.requestid_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GetArgs::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GetArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // bytes Key = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_key();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // bytes ClientId = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_clientid();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 RequestId = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          requestid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.requestid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* GetArgs::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* GetArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.GetArgs)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bytes Key = 1;
-  if (this->key().size() > 0) {
+  if (!this->_internal_key().empty()) {
     target = stream->WriteBytesMaybeAliased(
         1, this->_internal_key(), target);
   }
 
   // bytes ClientId = 2;
-  if (this->clientid().size() > 0) {
+  if (!this->_internal_clientid().empty()) {
     target = stream->WriteBytesMaybeAliased(
         2, this->_internal_clientid(), target);
   }
 
   // int32 RequestId = 3;
-  if (this->requestid() != 0) {
+  if (this->_internal_requestid() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_requestid(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_requestid(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.GetArgs)
@@ -338,78 +1400,57 @@ size_t GetArgs::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.GetArgs)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // bytes Key = 1;
-  if (this->key().size() > 0) {
+  if (!this->_internal_key().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
         this->_internal_key());
   }
 
   // bytes ClientId = 2;
-  if (this->clientid().size() > 0) {
+  if (!this->_internal_clientid().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
         this->_internal_clientid());
   }
 
   // int32 RequestId = 3;
-  if (this->requestid() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_requestid());
+  if (this->_internal_requestid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_requestid());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GetArgs::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:raftKVRpcProctoc.GetArgs)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GetArgs* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GetArgs>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raftKVRpcProctoc.GetArgs)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:raftKVRpcProctoc.GetArgs)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetArgs::GetClassData() const { return &_class_data_; }
 
-void GetArgs::MergeFrom(const GetArgs& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.GetArgs)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void GetArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetArgs*>(&to_msg);
+  auto& from = static_cast<const GetArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.GetArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.key().size() > 0) {
-    _internal_set_key(from._internal_key());
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
   }
-  if (from.clientid().size() > 0) {
-    _internal_set_clientid(from._internal_clientid());
+  if (!from._internal_clientid().empty()) {
+    _this->_internal_set_clientid(from._internal_clientid());
   }
-  if (from.requestid() != 0) {
-    _internal_set_requestid(from._internal_requestid());
+  if (from._internal_requestid() != 0) {
+    _this->_internal_set_requestid(from._internal_requestid());
   }
-}
-
-void GetArgs::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:raftKVRpcProctoc.GetArgs)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GetArgs::CopyFrom(const GetArgs& from) {
@@ -425,157 +1466,200 @@ bool GetArgs::IsInitialized() const {
 
 void GetArgs::InternalSwap(GetArgs* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  key_.Swap(&other->key_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  clientid_.Swap(&other->clientid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  swap(requestid_, other->requestid_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.clientid_, lhs_arena,
+      &other->_impl_.clientid_, rhs_arena
+  );
+  swap(_impl_.requestid_, other->_impl_.requestid_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GetArgs::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[0]);
 }
 
-
 // ===================================================================
 
-void GetReply::InitAsDefaultInstance() {
-}
 class GetReply::_Internal {
  public:
 };
 
-GetReply::GetReply(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+GetReply::GetReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.GetReply)
 }
 GetReply::GetReply(const GetReply& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.err_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.retryafterms_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  err_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_err().empty()) {
-    err_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_err(),
-      GetArena());
+    _this->_impl_.err_.Set(from._internal_err(), 
+      _this->GetArenaForAllocation());
   }
-  value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_value().empty()) {
-    value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_value(),
-      GetArena());
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
   }
+  _this->_impl_.retryafterms_ = from._impl_.retryafterms_;
   // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.GetReply)
 }
 
-void GetReply::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GetReply_kvServerRPC_2eproto.base);
-  err_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void GetReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.err_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.retryafterms_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 GetReply::~GetReply() {
   // @@protoc_insertion_point(destructor:raftKVRpcProctoc.GetReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void GetReply::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  err_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  value_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void GetReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.err_.Destroy();
+  _impl_.value_.Destroy();
 }
 
-void GetReply::ArenaDtor(void* object) {
-  GetReply* _this = reinterpret_cast< GetReply* >(object);
-  (void)_this;
-}
-void GetReply::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void GetReply::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const GetReply& GetReply::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GetReply_kvServerRPC_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void GetReply::Clear() {
 // @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.GetReply)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  err_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.err_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
+  _impl_.retryafterms_ = int64_t{0};
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GetReply::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GetReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // bytes Err = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_err();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // bytes Value = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_value();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 RetryAfterMs = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.retryafterms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* GetReply::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* GetReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.GetReply)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bytes Err = 1;
-  if (this->err().size() > 0) {
+  if (!this->_internal_err().empty()) {
     target = stream->WriteBytesMaybeAliased(
         1, this->_internal_err(), target);
   }
 
   // bytes Value = 2;
-  if (this->value().size() > 0) {
+  if (!this->_internal_value().empty()) {
     target = stream->WriteBytesMaybeAliased(
         2, this->_internal_value(), target);
   }
 
+  // int64 RetryAfterMs = 3;
+  if (this->_internal_retryafterms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_retryafterms(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.GetReply)
@@ -586,68 +1670,57 @@ size_t GetReply::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.GetReply)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // bytes Err = 1;
-  if (this->err().size() > 0) {
+  if (!this->_internal_err().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
         this->_internal_err());
   }
 
   // bytes Value = 2;
-  if (this->value().size() > 0) {
+  if (!this->_internal_value().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
         this->_internal_value());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // int64 RetryAfterMs = 3;
+  if (this->_internal_retryafterms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_retryafterms());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GetReply::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:raftKVRpcProctoc.GetReply)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GetReply* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GetReply>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raftKVRpcProctoc.GetReply)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:raftKVRpcProctoc.GetReply)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetReply::GetClassData() const { return &_class_data_; }
 
-void GetReply::MergeFrom(const GetReply& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.GetReply)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void GetReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetReply*>(&to_msg);
+  auto& from = static_cast<const GetReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.GetReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.err().size() > 0) {
-    _internal_set_err(from._internal_err());
+  if (!from._internal_err().empty()) {
+    _this->_internal_set_err(from._internal_err());
   }
-  if (from.value().size() > 0) {
-    _internal_set_value(from._internal_value());
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
   }
-}
-
-void GetReply::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:raftKVRpcProctoc.GetReply)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_retryafterms() != 0) {
+    _this->_internal_set_retryafterms(from._internal_retryafterms());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GetReply::CopyFrom(const GetReply& from) {
@@ -663,216 +1736,282 @@ bool GetReply::IsInitialized() const {
 
 void GetReply::InternalSwap(GetReply* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  err_.Swap(&other->err_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  value_.Swap(&other->value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.err_, lhs_arena,
+      &other->_impl_.err_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  swap(_impl_.retryafterms_, other->_impl_.retryafterms_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GetReply::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[1]);
 }
 
-
 // ===================================================================
 
-void PutAppendArgs::InitAsDefaultInstance() {
-}
 class PutAppendArgs::_Internal {
  public:
 };
 
-PutAppendArgs::PutAppendArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+PutAppendArgs::PutAppendArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.PutAppendArgs)
 }
 PutAppendArgs::PutAppendArgs(const PutAppendArgs& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PutAppendArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.op_){}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.ttlms_){}
+    , decltype(_impl_.requestid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  key_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_key().empty()) {
-    key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_key(),
-      GetArena());
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
   }
-  value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_value().empty()) {
-    value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_value(),
-      GetArena());
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
   }
-  op_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.op_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.op_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_op().empty()) {
-    op_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_op(),
-      GetArena());
+    _this->_impl_.op_.Set(from._internal_op(), 
+      _this->GetArenaForAllocation());
   }
-  clientid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.clientid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_clientid().empty()) {
-    clientid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_clientid(),
-      GetArena());
+    _this->_impl_.clientid_.Set(from._internal_clientid(), 
+      _this->GetArenaForAllocation());
   }
-  requestid_ = from.requestid_;
+  ::memcpy(&_impl_.ttlms_, &from._impl_.ttlms_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.requestid_) -
+    reinterpret_cast<char*>(&_impl_.ttlms_)) + sizeof(_impl_.requestid_));
   // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.PutAppendArgs)
 }
 
-void PutAppendArgs::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_PutAppendArgs_kvServerRPC_2eproto.base);
-  key_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  op_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  clientid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  requestid_ = 0;
+inline void PutAppendArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.op_){}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.ttlms_){int64_t{0}}
+    , decltype(_impl_.requestid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.op_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.op_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.clientid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PutAppendArgs::~PutAppendArgs() {
   // @@protoc_insertion_point(destructor:raftKVRpcProctoc.PutAppendArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void PutAppendArgs::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  key_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  value_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  op_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  clientid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void PutAppendArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
+  _impl_.op_.Destroy();
+  _impl_.clientid_.Destroy();
 }
 
-void PutAppendArgs::ArenaDtor(void* object) {
-  PutAppendArgs* _this = reinterpret_cast< PutAppendArgs* >(object);
-  (void)_this;
-}
-void PutAppendArgs::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void PutAppendArgs::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const PutAppendArgs& PutAppendArgs::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_PutAppendArgs_kvServerRPC_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void PutAppendArgs::Clear() {
 // @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.PutAppendArgs)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  key_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  op_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  clientid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  requestid_ = 0;
+  _impl_.key_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
+  _impl_.op_.ClearToEmpty();
+  _impl_.clientid_.ClearToEmpty();
+  ::memset(&_impl_.ttlms_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.requestid_) -
+      reinterpret_cast<char*>(&_impl_.ttlms_)) + sizeof(_impl_.requestid_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* PutAppendArgs::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* PutAppendArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // bytes Key = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_key();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // bytes Value = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_value();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // bytes Op = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           auto str = _internal_mutable_op();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // bytes ClientId = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
           auto str = _internal_mutable_clientid();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 RequestId = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
-          requestid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.requestid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 TtlMs = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.ttlms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* PutAppendArgs::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* PutAppendArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.PutAppendArgs)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bytes Key = 1;
-  if (this->key().size() > 0) {
+  if (!this->_internal_key().empty()) {
     target = stream->WriteBytesMaybeAliased(
         1, this->_internal_key(), target);
   }
 
   // bytes Value = 2;
-  if (this->value().size() > 0) {
+  if (!this->_internal_value().empty()) {
     target = stream->WriteBytesMaybeAliased(
         2, this->_internal_value(), target);
   }
 
   // bytes Op = 3;
-  if (this->op().size() > 0) {
+  if (!this->_internal_op().empty()) {
     target = stream->WriteBytesMaybeAliased(
         3, this->_internal_op(), target);
   }
 
   // bytes ClientId = 4;
-  if (this->clientid().size() > 0) {
+  if (!this->_internal_clientid().empty()) {
     target = stream->WriteBytesMaybeAliased(
         4, this->_internal_clientid(), target);
   }
 
   // int32 RequestId = 5;
-  if (this->requestid() != 0) {
+  if (this->_internal_requestid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_requestid(), target);
+  }
+
+  // int64 TtlMs = 6;
+  if (this->_internal_ttlms() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(5, this->_internal_requestid(), target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(6, this->_internal_ttlms(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.PutAppendArgs)
@@ -883,98 +2022,85 @@ size_t PutAppendArgs::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.PutAppendArgs)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // bytes Key = 1;
-  if (this->key().size() > 0) {
+  if (!this->_internal_key().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
         this->_internal_key());
   }
 
   // bytes Value = 2;
-  if (this->value().size() > 0) {
+  if (!this->_internal_value().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
         this->_internal_value());
   }
 
   // bytes Op = 3;
-  if (this->op().size() > 0) {
+  if (!this->_internal_op().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
         this->_internal_op());
   }
 
   // bytes ClientId = 4;
-  if (this->clientid().size() > 0) {
+  if (!this->_internal_clientid().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
         this->_internal_clientid());
   }
 
-  // int32 RequestId = 5;
-  if (this->requestid() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_requestid());
+  // int64 TtlMs = 6;
+  if (this->_internal_ttlms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_ttlms());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // int32 RequestId = 5;
+  if (this->_internal_requestid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_requestid());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void PutAppendArgs::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:raftKVRpcProctoc.PutAppendArgs)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PutAppendArgs* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<PutAppendArgs>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raftKVRpcProctoc.PutAppendArgs)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:raftKVRpcProctoc.PutAppendArgs)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PutAppendArgs::MergeFrom(const PutAppendArgs& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.PutAppendArgs)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PutAppendArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PutAppendArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PutAppendArgs::GetClassData() const { return &_class_data_; }
+
+
+void PutAppendArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PutAppendArgs*>(&to_msg);
+  auto& from = static_cast<const PutAppendArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.PutAppendArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.key().size() > 0) {
-    _internal_set_key(from._internal_key());
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
   }
-  if (from.value().size() > 0) {
-    _internal_set_value(from._internal_value());
+  if (!from._internal_op().empty()) {
+    _this->_internal_set_op(from._internal_op());
   }
-  if (from.op().size() > 0) {
-    _internal_set_op(from._internal_op());
+  if (!from._internal_clientid().empty()) {
+    _this->_internal_set_clientid(from._internal_clientid());
   }
-  if (from.clientid().size() > 0) {
-    _internal_set_clientid(from._internal_clientid());
+  if (from._internal_ttlms() != 0) {
+    _this->_internal_set_ttlms(from._internal_ttlms());
   }
-  if (from.requestid() != 0) {
-    _internal_set_requestid(from._internal_requestid());
+  if (from._internal_requestid() != 0) {
+    _this->_internal_set_requestid(from._internal_requestid());
   }
-}
-
-void PutAppendArgs::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:raftKVRpcProctoc.PutAppendArgs)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PutAppendArgs::CopyFrom(const PutAppendArgs& from) {
@@ -990,137 +2116,182 @@ bool PutAppendArgs::IsInitialized() const {
 
 void PutAppendArgs::InternalSwap(PutAppendArgs* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  key_.Swap(&other->key_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  value_.Swap(&other->value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  op_.Swap(&other->op_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  clientid_.Swap(&other->clientid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  swap(requestid_, other->requestid_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.op_, lhs_arena,
+      &other->_impl_.op_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.clientid_, lhs_arena,
+      &other->_impl_.clientid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PutAppendArgs, _impl_.requestid_)
+      + sizeof(PutAppendArgs::_impl_.requestid_)
+      - PROTOBUF_FIELD_OFFSET(PutAppendArgs, _impl_.ttlms_)>(
+          reinterpret_cast<char*>(&_impl_.ttlms_),
+          reinterpret_cast<char*>(&other->_impl_.ttlms_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata PutAppendArgs::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[2]);
 }
 
-
 // ===================================================================
 
-void PutAppendReply::InitAsDefaultInstance() {
-}
 class PutAppendReply::_Internal {
  public:
 };
 
-PutAppendReply::PutAppendReply(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+PutAppendReply::PutAppendReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.PutAppendReply)
 }
 PutAppendReply::PutAppendReply(const PutAppendReply& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PutAppendReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.err_){}
+    , decltype(_impl_.retryafterms_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  err_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_err().empty()) {
-    err_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_err(),
-      GetArena());
+    _this->_impl_.err_.Set(from._internal_err(), 
+      _this->GetArenaForAllocation());
   }
+  _this->_impl_.retryafterms_ = from._impl_.retryafterms_;
   // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.PutAppendReply)
 }
 
-void PutAppendReply::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_PutAppendReply_kvServerRPC_2eproto.base);
-  err_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void PutAppendReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.err_){}
+    , decltype(_impl_.retryafterms_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PutAppendReply::~PutAppendReply() {
   // @@protoc_insertion_point(destructor:raftKVRpcProctoc.PutAppendReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void PutAppendReply::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  err_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void PutAppendReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.err_.Destroy();
 }
 
-void PutAppendReply::ArenaDtor(void* object) {
-  PutAppendReply* _this = reinterpret_cast< PutAppendReply* >(object);
-  (void)_this;
-}
-void PutAppendReply::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void PutAppendReply::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const PutAppendReply& PutAppendReply::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_PutAppendReply_kvServerRPC_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void PutAppendReply::Clear() {
 // @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.PutAppendReply)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  err_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.err_.ClearToEmpty();
+  _impl_.retryafterms_ = int64_t{0};
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* PutAppendReply::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* PutAppendReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // bytes Err = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_err();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 RetryAfterMs = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.retryafterms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* PutAppendReply::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* PutAppendReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.PutAppendReply)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bytes Err = 1;
-  if (this->err().size() > 0) {
+  if (!this->_internal_err().empty()) {
     target = stream->WriteBytesMaybeAliased(
         1, this->_internal_err(), target);
   }
 
+  // int64 RetryAfterMs = 2;
+  if (this->_internal_retryafterms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_retryafterms(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.PutAppendReply)
@@ -1131,58 +2302,47 @@ size_t PutAppendReply::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.PutAppendReply)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // bytes Err = 1;
-  if (this->err().size() > 0) {
+  if (!this->_internal_err().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
         this->_internal_err());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // int64 RetryAfterMs = 2;
+  if (this->_internal_retryafterms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_retryafterms());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void PutAppendReply::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:raftKVRpcProctoc.PutAppendReply)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PutAppendReply* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<PutAppendReply>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raftKVRpcProctoc.PutAppendReply)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:raftKVRpcProctoc.PutAppendReply)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PutAppendReply::MergeFrom(const PutAppendReply& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.PutAppendReply)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PutAppendReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PutAppendReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PutAppendReply::GetClassData() const { return &_class_data_; }
+
+
+void PutAppendReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PutAppendReply*>(&to_msg);
+  auto& from = static_cast<const PutAppendReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.PutAppendReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.err().size() > 0) {
-    _internal_set_err(from._internal_err());
+  if (!from._internal_err().empty()) {
+    _this->_internal_set_err(from._internal_err());
   }
-}
-
-void PutAppendReply::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:raftKVRpcProctoc.PutAppendReply)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_retryafterms() != 0) {
+    _this->_internal_set_retryafterms(from._internal_retryafterms());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PutAppendReply::CopyFrom(const PutAppendReply& from) {
@@ -1198,145 +2358,9494 @@ bool PutAppendReply::IsInitialized() const {
 
 void PutAppendReply::InternalSwap(PutAppendReply* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  err_.Swap(&other->err_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.err_, lhs_arena,
+      &other->_impl_.err_, rhs_arena
+  );
+  swap(_impl_.retryafterms_, other->_impl_.retryafterms_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata PutAppendReply::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[3]);
 }
 
-
 // ===================================================================
 
-kvServerRpc::~kvServerRpc() {}
-
-const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* kvServerRpc::descriptor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_kvServerRPC_2eproto);
-  return file_level_service_descriptors_kvServerRPC_2eproto[0];
-}
+class ScanArgs::_Internal {
+ public:
+};
 
-const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* kvServerRpc::GetDescriptor() {
-  return descriptor();
+ScanArgs::ScanArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.ScanArgs)
 }
+ScanArgs::ScanArgs(const ScanArgs& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ScanArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.startkey_){}
+    , decltype(_impl_.endkey_){}
+    , decltype(_impl_.pagetoken_){}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.limit_){}
+    , decltype(_impl_.requestid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
-void kvServerRpc::PutAppend(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                         const ::raftKVRpcProctoc::PutAppendArgs*,
-                         ::raftKVRpcProctoc::PutAppendReply*,
-                         ::google::protobuf::Closure* done) {
-  controller->SetFailed("Method PutAppend() not implemented.");
-  done->Run();
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.startkey_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.startkey_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_startkey().empty()) {
+    _this->_impl_.startkey_.Set(from._internal_startkey(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.endkey_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.endkey_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_endkey().empty()) {
+    _this->_impl_.endkey_.Set(from._internal_endkey(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.pagetoken_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.pagetoken_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_pagetoken().empty()) {
+    _this->_impl_.pagetoken_.Set(from._internal_pagetoken(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.clientid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_clientid().empty()) {
+    _this->_impl_.clientid_.Set(from._internal_clientid(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.limit_, &from._impl_.limit_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.requestid_) -
+    reinterpret_cast<char*>(&_impl_.limit_)) + sizeof(_impl_.requestid_));
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.ScanArgs)
 }
 
-void kvServerRpc::Get(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                         const ::raftKVRpcProctoc::GetArgs*,
-                         ::raftKVRpcProctoc::GetReply*,
-                         ::google::protobuf::Closure* done) {
-  controller->SetFailed("Method Get() not implemented.");
-  done->Run();
+inline void ScanArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.startkey_){}
+    , decltype(_impl_.endkey_){}
+    , decltype(_impl_.pagetoken_){}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.limit_){0}
+    , decltype(_impl_.requestid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.startkey_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.startkey_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.endkey_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.endkey_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.pagetoken_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.pagetoken_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.clientid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-void kvServerRpc::CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
-                             ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                             const ::PROTOBUF_NAMESPACE_ID::Message* request,
-                             ::PROTOBUF_NAMESPACE_ID::Message* response,
-                             ::google::protobuf::Closure* done) {
-  GOOGLE_DCHECK_EQ(method->service(), file_level_service_descriptors_kvServerRPC_2eproto[0]);
-  switch(method->index()) {
-    case 0:
-      PutAppend(controller,
-             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftKVRpcProctoc::PutAppendArgs*>(
-                 request),
-             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftKVRpcProctoc::PutAppendReply*>(
-                 response),
-             done);
-      break;
-    case 1:
-      Get(controller,
-             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftKVRpcProctoc::GetArgs*>(
-                 request),
-             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftKVRpcProctoc::GetReply*>(
-                 response),
-             done);
-      break;
-    default:
-      GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
-      break;
+ScanArgs::~ScanArgs() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.ScanArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message& kvServerRpc::GetRequestPrototype(
-    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const {
-  GOOGLE_DCHECK_EQ(method->service(), descriptor());
-  switch(method->index()) {
-    case 0:
-      return ::raftKVRpcProctoc::PutAppendArgs::default_instance();
-    case 1:
-      return ::raftKVRpcProctoc::GetArgs::default_instance();
-    default:
-      GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
-      return *::PROTOBUF_NAMESPACE_ID::MessageFactory::generated_factory()
-          ->GetPrototype(method->input_type());
-  }
+inline void ScanArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.startkey_.Destroy();
+  _impl_.endkey_.Destroy();
+  _impl_.pagetoken_.Destroy();
+  _impl_.clientid_.Destroy();
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message& kvServerRpc::GetResponsePrototype(
-    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const {
-  GOOGLE_DCHECK_EQ(method->service(), descriptor());
-  switch(method->index()) {
-    case 0:
-      return ::raftKVRpcProctoc::PutAppendReply::default_instance();
-    case 1:
-      return ::raftKVRpcProctoc::GetReply::default_instance();
-    default:
-      GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
-      return *::PROTOBUF_NAMESPACE_ID::MessageFactory::generated_factory()
-          ->GetPrototype(method->output_type());
-  }
+void ScanArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-kvServerRpc_Stub::kvServerRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel)
-  : channel_(channel), owns_channel_(false) {}
-kvServerRpc_Stub::kvServerRpc_Stub(
-    ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel,
-    ::PROTOBUF_NAMESPACE_ID::Service::ChannelOwnership ownership)
-  : channel_(channel),
-    owns_channel_(ownership == ::PROTOBUF_NAMESPACE_ID::Service::STUB_OWNS_CHANNEL) {}
-kvServerRpc_Stub::~kvServerRpc_Stub() {
-  if (owns_channel_) delete channel_;
-}
+void ScanArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.ScanArgs)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-void kvServerRpc_Stub::PutAppend(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                              const ::raftKVRpcProctoc::PutAppendArgs* request,
-                              ::raftKVRpcProctoc::PutAppendReply* response,
-                              ::google::protobuf::Closure* done) {
-  channel_->CallMethod(descriptor()->method(0),
-                       controller, request, response, done);
-}
-void kvServerRpc_Stub::Get(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                              const ::raftKVRpcProctoc::GetArgs* request,
-                              ::raftKVRpcProctoc::GetReply* response,
-                              ::google::protobuf::Closure* done) {
-  channel_->CallMethod(descriptor()->method(1),
-                       controller, request, response, done);
+  _impl_.startkey_.ClearToEmpty();
+  _impl_.endkey_.ClearToEmpty();
+  _impl_.pagetoken_.ClearToEmpty();
+  _impl_.clientid_.ClearToEmpty();
+  ::memset(&_impl_.limit_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.requestid_) -
+      reinterpret_cast<char*>(&_impl_.limit_)) + sizeof(_impl_.requestid_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace raftKVRpcProctoc
-PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::GetArgs* Arena::CreateMaybeMessage< ::raftKVRpcProctoc::GetArgs >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::GetArgs >(arena);
-}
-template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::GetReply* Arena::CreateMaybeMessage< ::raftKVRpcProctoc::GetReply >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::GetReply >(arena);
+const char* ScanArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes StartKey = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_startkey();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes EndKey = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_endkey();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 Limit = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.limit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes PageToken = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_pagetoken();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes ClientId = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_clientid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 RequestId = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.requestid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
-template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::PutAppendArgs* Arena::CreateMaybeMessage< ::raftKVRpcProctoc::PutAppendArgs >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::PutAppendArgs >(arena);
+
+uint8_t* ScanArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.ScanArgs)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes StartKey = 1;
+  if (!this->_internal_startkey().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_startkey(), target);
+  }
+
+  // bytes EndKey = 2;
+  if (!this->_internal_endkey().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_endkey(), target);
+  }
+
+  // int32 Limit = 3;
+  if (this->_internal_limit() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_limit(), target);
+  }
+
+  // bytes PageToken = 4;
+  if (!this->_internal_pagetoken().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_pagetoken(), target);
+  }
+
+  // bytes ClientId = 5;
+  if (!this->_internal_clientid().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_clientid(), target);
+  }
+
+  // int32 RequestId = 6;
+  if (this->_internal_requestid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_requestid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.ScanArgs)
+  return target;
 }
-template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::PutAppendReply* Arena::CreateMaybeMessage< ::raftKVRpcProctoc::PutAppendReply >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::PutAppendReply >(arena);
+
+size_t ScanArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.ScanArgs)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes StartKey = 1;
+  if (!this->_internal_startkey().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_startkey());
+  }
+
+  // bytes EndKey = 2;
+  if (!this->_internal_endkey().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_endkey());
+  }
+
+  // bytes PageToken = 4;
+  if (!this->_internal_pagetoken().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_pagetoken());
+  }
+
+  // bytes ClientId = 5;
+  if (!this->_internal_clientid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_clientid());
+  }
+
+  // int32 Limit = 3;
+  if (this->_internal_limit() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_limit());
+  }
+
+  // int32 RequestId = 6;
+  if (this->_internal_requestid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_requestid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ScanArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ScanArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ScanArgs::GetClassData() const { return &_class_data_; }
+
+
+void ScanArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ScanArgs*>(&to_msg);
+  auto& from = static_cast<const ScanArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.ScanArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_startkey().empty()) {
+    _this->_internal_set_startkey(from._internal_startkey());
+  }
+  if (!from._internal_endkey().empty()) {
+    _this->_internal_set_endkey(from._internal_endkey());
+  }
+  if (!from._internal_pagetoken().empty()) {
+    _this->_internal_set_pagetoken(from._internal_pagetoken());
+  }
+  if (!from._internal_clientid().empty()) {
+    _this->_internal_set_clientid(from._internal_clientid());
+  }
+  if (from._internal_limit() != 0) {
+    _this->_internal_set_limit(from._internal_limit());
+  }
+  if (from._internal_requestid() != 0) {
+    _this->_internal_set_requestid(from._internal_requestid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ScanArgs::CopyFrom(const ScanArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.ScanArgs)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ScanArgs::IsInitialized() const {
+  return true;
+}
+
+void ScanArgs::InternalSwap(ScanArgs* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.startkey_, lhs_arena,
+      &other->_impl_.startkey_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.endkey_, lhs_arena,
+      &other->_impl_.endkey_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.pagetoken_, lhs_arena,
+      &other->_impl_.pagetoken_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.clientid_, lhs_arena,
+      &other->_impl_.clientid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ScanArgs, _impl_.requestid_)
+      + sizeof(ScanArgs::_impl_.requestid_)
+      - PROTOBUF_FIELD_OFFSET(ScanArgs, _impl_.limit_)>(
+          reinterpret_cast<char*>(&_impl_.limit_),
+          reinterpret_cast<char*>(&other->_impl_.limit_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ScanArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[4]);
+}
+
+// ===================================================================
+
+class PrefixScanArgs::_Internal {
+ public:
+};
+
+PrefixScanArgs::PrefixScanArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.PrefixScanArgs)
+}
+PrefixScanArgs::PrefixScanArgs(const PrefixScanArgs& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PrefixScanArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.prefix_){}
+    , decltype(_impl_.pagetoken_){}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.limit_){}
+    , decltype(_impl_.requestid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_prefix().empty()) {
+    _this->_impl_.prefix_.Set(from._internal_prefix(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.pagetoken_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.pagetoken_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_pagetoken().empty()) {
+    _this->_impl_.pagetoken_.Set(from._internal_pagetoken(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.clientid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_clientid().empty()) {
+    _this->_impl_.clientid_.Set(from._internal_clientid(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.limit_, &from._impl_.limit_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.requestid_) -
+    reinterpret_cast<char*>(&_impl_.limit_)) + sizeof(_impl_.requestid_));
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.PrefixScanArgs)
+}
+
+inline void PrefixScanArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.prefix_){}
+    , decltype(_impl_.pagetoken_){}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.limit_){0}
+    , decltype(_impl_.requestid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.pagetoken_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.pagetoken_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.clientid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PrefixScanArgs::~PrefixScanArgs() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.PrefixScanArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PrefixScanArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.prefix_.Destroy();
+  _impl_.pagetoken_.Destroy();
+  _impl_.clientid_.Destroy();
+}
+
+void PrefixScanArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PrefixScanArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.PrefixScanArgs)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.prefix_.ClearToEmpty();
+  _impl_.pagetoken_.ClearToEmpty();
+  _impl_.clientid_.ClearToEmpty();
+  ::memset(&_impl_.limit_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.requestid_) -
+      reinterpret_cast<char*>(&_impl_.limit_)) + sizeof(_impl_.requestid_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PrefixScanArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes Prefix = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_prefix();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 Limit = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.limit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes PageToken = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_pagetoken();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes ClientId = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_clientid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 RequestId = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.requestid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PrefixScanArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.PrefixScanArgs)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes Prefix = 1;
+  if (!this->_internal_prefix().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_prefix(), target);
+  }
+
+  // int32 Limit = 2;
+  if (this->_internal_limit() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_limit(), target);
+  }
+
+  // bytes PageToken = 3;
+  if (!this->_internal_pagetoken().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_pagetoken(), target);
+  }
+
+  // bytes ClientId = 4;
+  if (!this->_internal_clientid().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_clientid(), target);
+  }
+
+  // int32 RequestId = 5;
+  if (this->_internal_requestid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_requestid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.PrefixScanArgs)
+  return target;
+}
+
+size_t PrefixScanArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.PrefixScanArgs)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes Prefix = 1;
+  if (!this->_internal_prefix().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_prefix());
+  }
+
+  // bytes PageToken = 3;
+  if (!this->_internal_pagetoken().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_pagetoken());
+  }
+
+  // bytes ClientId = 4;
+  if (!this->_internal_clientid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_clientid());
+  }
+
+  // int32 Limit = 2;
+  if (this->_internal_limit() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_limit());
+  }
+
+  // int32 RequestId = 5;
+  if (this->_internal_requestid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_requestid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PrefixScanArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PrefixScanArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PrefixScanArgs::GetClassData() const { return &_class_data_; }
+
+
+void PrefixScanArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PrefixScanArgs*>(&to_msg);
+  auto& from = static_cast<const PrefixScanArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.PrefixScanArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_prefix().empty()) {
+    _this->_internal_set_prefix(from._internal_prefix());
+  }
+  if (!from._internal_pagetoken().empty()) {
+    _this->_internal_set_pagetoken(from._internal_pagetoken());
+  }
+  if (!from._internal_clientid().empty()) {
+    _this->_internal_set_clientid(from._internal_clientid());
+  }
+  if (from._internal_limit() != 0) {
+    _this->_internal_set_limit(from._internal_limit());
+  }
+  if (from._internal_requestid() != 0) {
+    _this->_internal_set_requestid(from._internal_requestid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PrefixScanArgs::CopyFrom(const PrefixScanArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.PrefixScanArgs)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PrefixScanArgs::IsInitialized() const {
+  return true;
+}
+
+void PrefixScanArgs::InternalSwap(PrefixScanArgs* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.prefix_, lhs_arena,
+      &other->_impl_.prefix_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.pagetoken_, lhs_arena,
+      &other->_impl_.pagetoken_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.clientid_, lhs_arena,
+      &other->_impl_.clientid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PrefixScanArgs, _impl_.requestid_)
+      + sizeof(PrefixScanArgs::_impl_.requestid_)
+      - PROTOBUF_FIELD_OFFSET(PrefixScanArgs, _impl_.limit_)>(
+          reinterpret_cast<char*>(&_impl_.limit_),
+          reinterpret_cast<char*>(&other->_impl_.limit_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PrefixScanArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[5]);
+}
+
+// ===================================================================
+
+class KeyValue::_Internal {
+ public:
+};
+
+KeyValue::KeyValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.KeyValue)
+}
+KeyValue::KeyValue(const KeyValue& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  KeyValue* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.KeyValue)
+}
+
+inline void KeyValue::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+KeyValue::~KeyValue() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.KeyValue)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void KeyValue::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
+}
+
+void KeyValue::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void KeyValue::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.KeyValue)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* KeyValue::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes Key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes Value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* KeyValue::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.KeyValue)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes Key = 1;
+  if (!this->_internal_key().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_key(), target);
+  }
+
+  // bytes Value = 2;
+  if (!this->_internal_value().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.KeyValue)
+  return target;
+}
+
+size_t KeyValue::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.KeyValue)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes Key = 1;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_key());
+  }
+
+  // bytes Value = 2;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData KeyValue::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    KeyValue::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*KeyValue::GetClassData() const { return &_class_data_; }
+
+
+void KeyValue::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<KeyValue*>(&to_msg);
+  auto& from = static_cast<const KeyValue&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.KeyValue)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void KeyValue::CopyFrom(const KeyValue& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.KeyValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool KeyValue::IsInitialized() const {
+  return true;
+}
+
+void KeyValue::InternalSwap(KeyValue* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata KeyValue::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[6]);
+}
+
+// ===================================================================
+
+class ScanReply::_Internal {
+ public:
+};
+
+ScanReply::ScanReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.ScanReply)
+}
+ScanReply::ScanReply(const ScanReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ScanReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.kvs_){from._impl_.kvs_}
+    , decltype(_impl_.err_){}
+    , decltype(_impl_.nextpagetoken_){}
+    , decltype(_impl_.readindex_){}
+    , decltype(_impl_.retryafterms_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_err().empty()) {
+    _this->_impl_.err_.Set(from._internal_err(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.nextpagetoken_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.nextpagetoken_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_nextpagetoken().empty()) {
+    _this->_impl_.nextpagetoken_.Set(from._internal_nextpagetoken(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.readindex_, &from._impl_.readindex_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.retryafterms_) -
+    reinterpret_cast<char*>(&_impl_.readindex_)) + sizeof(_impl_.retryafterms_));
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.ScanReply)
+}
+
+inline void ScanReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.kvs_){arena}
+    , decltype(_impl_.err_){}
+    , decltype(_impl_.nextpagetoken_){}
+    , decltype(_impl_.readindex_){int64_t{0}}
+    , decltype(_impl_.retryafterms_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.nextpagetoken_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.nextpagetoken_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ScanReply::~ScanReply() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.ScanReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ScanReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.kvs_.~RepeatedPtrField();
+  _impl_.err_.Destroy();
+  _impl_.nextpagetoken_.Destroy();
+}
+
+void ScanReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ScanReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.ScanReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.kvs_.Clear();
+  _impl_.err_.ClearToEmpty();
+  _impl_.nextpagetoken_.ClearToEmpty();
+  ::memset(&_impl_.readindex_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.retryafterms_) -
+      reinterpret_cast<char*>(&_impl_.readindex_)) + sizeof(_impl_.retryafterms_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ScanReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes Err = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_err();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .raftKVRpcProctoc.KeyValue Kvs = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_kvs(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes NextPageToken = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_nextpagetoken();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 ReadIndex = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.readindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 RetryAfterMs = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.retryafterms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ScanReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.ScanReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_err(), target);
+  }
+
+  // repeated .raftKVRpcProctoc.KeyValue Kvs = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_kvs_size()); i < n; i++) {
+    const auto& repfield = this->_internal_kvs(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // bytes NextPageToken = 3;
+  if (!this->_internal_nextpagetoken().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_nextpagetoken(), target);
+  }
+
+  // int64 ReadIndex = 4;
+  if (this->_internal_readindex() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_readindex(), target);
+  }
+
+  // int64 RetryAfterMs = 5;
+  if (this->_internal_retryafterms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_retryafterms(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.ScanReply)
+  return target;
+}
+
+size_t ScanReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.ScanReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .raftKVRpcProctoc.KeyValue Kvs = 2;
+  total_size += 1UL * this->_internal_kvs_size();
+  for (const auto& msg : this->_impl_.kvs_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_err());
+  }
+
+  // bytes NextPageToken = 3;
+  if (!this->_internal_nextpagetoken().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_nextpagetoken());
+  }
+
+  // int64 ReadIndex = 4;
+  if (this->_internal_readindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_readindex());
+  }
+
+  // int64 RetryAfterMs = 5;
+  if (this->_internal_retryafterms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_retryafterms());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ScanReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ScanReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ScanReply::GetClassData() const { return &_class_data_; }
+
+
+void ScanReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ScanReply*>(&to_msg);
+  auto& from = static_cast<const ScanReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.ScanReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.kvs_.MergeFrom(from._impl_.kvs_);
+  if (!from._internal_err().empty()) {
+    _this->_internal_set_err(from._internal_err());
+  }
+  if (!from._internal_nextpagetoken().empty()) {
+    _this->_internal_set_nextpagetoken(from._internal_nextpagetoken());
+  }
+  if (from._internal_readindex() != 0) {
+    _this->_internal_set_readindex(from._internal_readindex());
+  }
+  if (from._internal_retryafterms() != 0) {
+    _this->_internal_set_retryafterms(from._internal_retryafterms());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ScanReply::CopyFrom(const ScanReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.ScanReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ScanReply::IsInitialized() const {
+  return true;
+}
+
+void ScanReply::InternalSwap(ScanReply* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.kvs_.InternalSwap(&other->_impl_.kvs_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.err_, lhs_arena,
+      &other->_impl_.err_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.nextpagetoken_, lhs_arena,
+      &other->_impl_.nextpagetoken_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ScanReply, _impl_.retryafterms_)
+      + sizeof(ScanReply::_impl_.retryafterms_)
+      - PROTOBUF_FIELD_OFFSET(ScanReply, _impl_.readindex_)>(
+          reinterpret_cast<char*>(&_impl_.readindex_),
+          reinterpret_cast<char*>(&other->_impl_.readindex_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ScanReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[7]);
+}
+
+// ===================================================================
+
+class MultiGetArgs::_Internal {
+ public:
+};
+
+MultiGetArgs::MultiGetArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.MultiGetArgs)
+}
+MultiGetArgs::MultiGetArgs(const MultiGetArgs& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MultiGetArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.keys_){from._impl_.keys_}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.requestid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.clientid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_clientid().empty()) {
+    _this->_impl_.clientid_.Set(from._internal_clientid(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.requestid_ = from._impl_.requestid_;
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.MultiGetArgs)
+}
+
+inline void MultiGetArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.keys_){arena}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.requestid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.clientid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MultiGetArgs::~MultiGetArgs() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.MultiGetArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MultiGetArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.keys_.~RepeatedPtrField();
+  _impl_.clientid_.Destroy();
+}
+
+void MultiGetArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MultiGetArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.MultiGetArgs)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.keys_.Clear();
+  _impl_.clientid_.ClearToEmpty();
+  _impl_.requestid_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MultiGetArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated bytes Keys = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_keys();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes ClientId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_clientid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 RequestId = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.requestid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MultiGetArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.MultiGetArgs)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated bytes Keys = 1;
+  for (int i = 0, n = this->_internal_keys_size(); i < n; i++) {
+    const auto& s = this->_internal_keys(i);
+    target = stream->WriteBytes(1, s, target);
+  }
+
+  // bytes ClientId = 2;
+  if (!this->_internal_clientid().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_clientid(), target);
+  }
+
+  // int32 RequestId = 3;
+  if (this->_internal_requestid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_requestid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.MultiGetArgs)
+  return target;
+}
+
+size_t MultiGetArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.MultiGetArgs)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes Keys = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.keys_.size());
+  for (int i = 0, n = _impl_.keys_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.keys_.Get(i));
+  }
+
+  // bytes ClientId = 2;
+  if (!this->_internal_clientid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_clientid());
+  }
+
+  // int32 RequestId = 3;
+  if (this->_internal_requestid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_requestid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MultiGetArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MultiGetArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MultiGetArgs::GetClassData() const { return &_class_data_; }
+
+
+void MultiGetArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MultiGetArgs*>(&to_msg);
+  auto& from = static_cast<const MultiGetArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.MultiGetArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.keys_.MergeFrom(from._impl_.keys_);
+  if (!from._internal_clientid().empty()) {
+    _this->_internal_set_clientid(from._internal_clientid());
+  }
+  if (from._internal_requestid() != 0) {
+    _this->_internal_set_requestid(from._internal_requestid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MultiGetArgs::CopyFrom(const MultiGetArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.MultiGetArgs)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MultiGetArgs::IsInitialized() const {
+  return true;
+}
+
+void MultiGetArgs::InternalSwap(MultiGetArgs* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.keys_.InternalSwap(&other->_impl_.keys_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.clientid_, lhs_arena,
+      &other->_impl_.clientid_, rhs_arena
+  );
+  swap(_impl_.requestid_, other->_impl_.requestid_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MultiGetArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[8]);
+}
+
+// ===================================================================
+
+class GetResult::_Internal {
+ public:
+};
+
+GetResult::GetResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.GetResult)
+}
+GetResult::GetResult(const GetResult& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetResult* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){}
+    , decltype(_impl_.exist_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.exist_ = from._impl_.exist_;
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.GetResult)
+}
+
+inline void GetResult::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){}
+    , decltype(_impl_.exist_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+GetResult::~GetResult() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.GetResult)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetResult::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.value_.Destroy();
+}
+
+void GetResult::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetResult::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.GetResult)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.value_.ClearToEmpty();
+  _impl_.exist_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetResult::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool Exist = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.exist_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes Value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetResult::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.GetResult)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool Exist = 1;
+  if (this->_internal_exist() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_exist(), target);
+  }
+
+  // bytes Value = 2;
+  if (!this->_internal_value().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.GetResult)
+  return target;
+}
+
+size_t GetResult::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.GetResult)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes Value = 2;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
+  }
+
+  // bool Exist = 1;
+  if (this->_internal_exist() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetResult::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetResult::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetResult::GetClassData() const { return &_class_data_; }
+
+
+void GetResult::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetResult*>(&to_msg);
+  auto& from = static_cast<const GetResult&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.GetResult)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  if (from._internal_exist() != 0) {
+    _this->_internal_set_exist(from._internal_exist());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetResult::CopyFrom(const GetResult& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.GetResult)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetResult::IsInitialized() const {
+  return true;
+}
+
+void GetResult::InternalSwap(GetResult* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  swap(_impl_.exist_, other->_impl_.exist_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetResult::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[9]);
+}
+
+// ===================================================================
+
+class MultiGetReply::_Internal {
+ public:
+};
+
+MultiGetReply::MultiGetReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.MultiGetReply)
+}
+MultiGetReply::MultiGetReply(const MultiGetReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MultiGetReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.results_){from._impl_.results_}
+    , decltype(_impl_.err_){}
+    , decltype(_impl_.retryafterms_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_err().empty()) {
+    _this->_impl_.err_.Set(from._internal_err(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.retryafterms_ = from._impl_.retryafterms_;
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.MultiGetReply)
+}
+
+inline void MultiGetReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.results_){arena}
+    , decltype(_impl_.err_){}
+    , decltype(_impl_.retryafterms_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MultiGetReply::~MultiGetReply() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.MultiGetReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MultiGetReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.results_.~RepeatedPtrField();
+  _impl_.err_.Destroy();
+}
+
+void MultiGetReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MultiGetReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.MultiGetReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.results_.Clear();
+  _impl_.err_.ClearToEmpty();
+  _impl_.retryafterms_ = int64_t{0};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MultiGetReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes Err = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_err();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .raftKVRpcProctoc.GetResult Results = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_results(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 RetryAfterMs = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.retryafterms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MultiGetReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.MultiGetReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_err(), target);
+  }
+
+  // repeated .raftKVRpcProctoc.GetResult Results = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_results_size()); i < n; i++) {
+    const auto& repfield = this->_internal_results(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // int64 RetryAfterMs = 3;
+  if (this->_internal_retryafterms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_retryafterms(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.MultiGetReply)
+  return target;
+}
+
+size_t MultiGetReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.MultiGetReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .raftKVRpcProctoc.GetResult Results = 2;
+  total_size += 1UL * this->_internal_results_size();
+  for (const auto& msg : this->_impl_.results_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_err());
+  }
+
+  // int64 RetryAfterMs = 3;
+  if (this->_internal_retryafterms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_retryafterms());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MultiGetReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MultiGetReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MultiGetReply::GetClassData() const { return &_class_data_; }
+
+
+void MultiGetReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MultiGetReply*>(&to_msg);
+  auto& from = static_cast<const MultiGetReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.MultiGetReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.results_.MergeFrom(from._impl_.results_);
+  if (!from._internal_err().empty()) {
+    _this->_internal_set_err(from._internal_err());
+  }
+  if (from._internal_retryafterms() != 0) {
+    _this->_internal_set_retryafterms(from._internal_retryafterms());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MultiGetReply::CopyFrom(const MultiGetReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.MultiGetReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MultiGetReply::IsInitialized() const {
+  return true;
+}
+
+void MultiGetReply::InternalSwap(MultiGetReply* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.results_.InternalSwap(&other->_impl_.results_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.err_, lhs_arena,
+      &other->_impl_.err_, rhs_arena
+  );
+  swap(_impl_.retryafterms_, other->_impl_.retryafterms_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MultiGetReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[10]);
+}
+
+// ===================================================================
+
+class WriteOp::_Internal {
+ public:
+};
+
+WriteOp::WriteOp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.WriteOp)
+}
+WriteOp::WriteOp(const WriteOp& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WriteOp* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.op_){}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.ttlms_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.op_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.op_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_op().empty()) {
+    _this->_impl_.op_.Set(from._internal_op(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.ttlms_ = from._impl_.ttlms_;
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.WriteOp)
+}
+
+inline void WriteOp::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.op_){}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.ttlms_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.op_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.op_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+WriteOp::~WriteOp() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.WriteOp)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WriteOp::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.op_.Destroy();
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
+}
+
+void WriteOp::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WriteOp::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.WriteOp)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.op_.ClearToEmpty();
+  _impl_.key_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
+  _impl_.ttlms_ = int64_t{0};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WriteOp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes Op = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_op();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes Key = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes Value = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 TtlMs = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.ttlms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WriteOp::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.WriteOp)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes Op = 1;
+  if (!this->_internal_op().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_op(), target);
+  }
+
+  // bytes Key = 2;
+  if (!this->_internal_key().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_key(), target);
+  }
+
+  // bytes Value = 3;
+  if (!this->_internal_value().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_value(), target);
+  }
+
+  // int64 TtlMs = 4;
+  if (this->_internal_ttlms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_ttlms(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.WriteOp)
+  return target;
+}
+
+size_t WriteOp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.WriteOp)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes Op = 1;
+  if (!this->_internal_op().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_op());
+  }
+
+  // bytes Key = 2;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_key());
+  }
+
+  // bytes Value = 3;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
+  }
+
+  // int64 TtlMs = 4;
+  if (this->_internal_ttlms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_ttlms());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WriteOp::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WriteOp::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WriteOp::GetClassData() const { return &_class_data_; }
+
+
+void WriteOp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WriteOp*>(&to_msg);
+  auto& from = static_cast<const WriteOp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.WriteOp)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_op().empty()) {
+    _this->_internal_set_op(from._internal_op());
+  }
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  if (from._internal_ttlms() != 0) {
+    _this->_internal_set_ttlms(from._internal_ttlms());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WriteOp::CopyFrom(const WriteOp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.WriteOp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WriteOp::IsInitialized() const {
+  return true;
+}
+
+void WriteOp::InternalSwap(WriteOp* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.op_, lhs_arena,
+      &other->_impl_.op_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  swap(_impl_.ttlms_, other->_impl_.ttlms_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WriteOp::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[11]);
+}
+
+// ===================================================================
+
+class BatchWriteArgs::_Internal {
+ public:
+};
+
+BatchWriteArgs::BatchWriteArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.BatchWriteArgs)
+}
+BatchWriteArgs::BatchWriteArgs(const BatchWriteArgs& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BatchWriteArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ops_){from._impl_.ops_}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.requestid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.clientid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_clientid().empty()) {
+    _this->_impl_.clientid_.Set(from._internal_clientid(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.requestid_ = from._impl_.requestid_;
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.BatchWriteArgs)
+}
+
+inline void BatchWriteArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ops_){arena}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.requestid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.clientid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BatchWriteArgs::~BatchWriteArgs() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.BatchWriteArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BatchWriteArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ops_.~RepeatedPtrField();
+  _impl_.clientid_.Destroy();
+}
+
+void BatchWriteArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BatchWriteArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.BatchWriteArgs)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.ops_.Clear();
+  _impl_.clientid_.ClearToEmpty();
+  _impl_.requestid_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BatchWriteArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .raftKVRpcProctoc.WriteOp Ops = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_ops(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes ClientId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_clientid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 RequestId = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.requestid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BatchWriteArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.BatchWriteArgs)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .raftKVRpcProctoc.WriteOp Ops = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_ops_size()); i < n; i++) {
+    const auto& repfield = this->_internal_ops(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // bytes ClientId = 2;
+  if (!this->_internal_clientid().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_clientid(), target);
+  }
+
+  // int32 RequestId = 3;
+  if (this->_internal_requestid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_requestid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.BatchWriteArgs)
+  return target;
+}
+
+size_t BatchWriteArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.BatchWriteArgs)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .raftKVRpcProctoc.WriteOp Ops = 1;
+  total_size += 1UL * this->_internal_ops_size();
+  for (const auto& msg : this->_impl_.ops_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // bytes ClientId = 2;
+  if (!this->_internal_clientid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_clientid());
+  }
+
+  // int32 RequestId = 3;
+  if (this->_internal_requestid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_requestid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchWriteArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BatchWriteArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchWriteArgs::GetClassData() const { return &_class_data_; }
+
+
+void BatchWriteArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BatchWriteArgs*>(&to_msg);
+  auto& from = static_cast<const BatchWriteArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.BatchWriteArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.ops_.MergeFrom(from._impl_.ops_);
+  if (!from._internal_clientid().empty()) {
+    _this->_internal_set_clientid(from._internal_clientid());
+  }
+  if (from._internal_requestid() != 0) {
+    _this->_internal_set_requestid(from._internal_requestid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BatchWriteArgs::CopyFrom(const BatchWriteArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.BatchWriteArgs)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BatchWriteArgs::IsInitialized() const {
+  return true;
+}
+
+void BatchWriteArgs::InternalSwap(BatchWriteArgs* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.ops_.InternalSwap(&other->_impl_.ops_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.clientid_, lhs_arena,
+      &other->_impl_.clientid_, rhs_arena
+  );
+  swap(_impl_.requestid_, other->_impl_.requestid_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BatchWriteArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[12]);
+}
+
+// ===================================================================
+
+class BatchWriteReply::_Internal {
+ public:
+};
+
+BatchWriteReply::BatchWriteReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.BatchWriteReply)
+}
+BatchWriteReply::BatchWriteReply(const BatchWriteReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BatchWriteReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.err_){}
+    , decltype(_impl_.retryafterms_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_err().empty()) {
+    _this->_impl_.err_.Set(from._internal_err(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.retryafterms_ = from._impl_.retryafterms_;
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.BatchWriteReply)
+}
+
+inline void BatchWriteReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.err_){}
+    , decltype(_impl_.retryafterms_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BatchWriteReply::~BatchWriteReply() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.BatchWriteReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BatchWriteReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.err_.Destroy();
+}
+
+void BatchWriteReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BatchWriteReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.BatchWriteReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.err_.ClearToEmpty();
+  _impl_.retryafterms_ = int64_t{0};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BatchWriteReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes Err = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_err();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 RetryAfterMs = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.retryafterms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BatchWriteReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.BatchWriteReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_err(), target);
+  }
+
+  // int64 RetryAfterMs = 2;
+  if (this->_internal_retryafterms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_retryafterms(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.BatchWriteReply)
+  return target;
+}
+
+size_t BatchWriteReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.BatchWriteReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_err());
+  }
+
+  // int64 RetryAfterMs = 2;
+  if (this->_internal_retryafterms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_retryafterms());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchWriteReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BatchWriteReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchWriteReply::GetClassData() const { return &_class_data_; }
+
+
+void BatchWriteReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BatchWriteReply*>(&to_msg);
+  auto& from = static_cast<const BatchWriteReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.BatchWriteReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_err().empty()) {
+    _this->_internal_set_err(from._internal_err());
+  }
+  if (from._internal_retryafterms() != 0) {
+    _this->_internal_set_retryafterms(from._internal_retryafterms());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BatchWriteReply::CopyFrom(const BatchWriteReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.BatchWriteReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BatchWriteReply::IsInitialized() const {
+  return true;
+}
+
+void BatchWriteReply::InternalSwap(BatchWriteReply* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.err_, lhs_arena,
+      &other->_impl_.err_, rhs_arena
+  );
+  swap(_impl_.retryafterms_, other->_impl_.retryafterms_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BatchWriteReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[13]);
+}
+
+// ===================================================================
+
+class TxnCompare::_Internal {
+ public:
+};
+
+TxnCompare::TxnCompare(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.TxnCompare)
+}
+TxnCompare::TxnCompare(const TxnCompare& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TxnCompare* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.target_){}
+    , decltype(_impl_.result_){}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.exists_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.target_, &from._impl_.target_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.exists_) -
+    reinterpret_cast<char*>(&_impl_.target_)) + sizeof(_impl_.exists_));
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.TxnCompare)
+}
+
+inline void TxnCompare::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.target_){0}
+    , decltype(_impl_.result_){0}
+    , decltype(_impl_.version_){int64_t{0}}
+    , decltype(_impl_.exists_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+TxnCompare::~TxnCompare() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.TxnCompare)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TxnCompare::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
+}
+
+void TxnCompare::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TxnCompare::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.TxnCompare)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
+  ::memset(&_impl_.target_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.exists_) -
+      reinterpret_cast<char*>(&_impl_.target_)) + sizeof(_impl_.exists_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TxnCompare::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes Key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .raftKVRpcProctoc.TxnCompare.Target target = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_target(static_cast<::raftKVRpcProctoc::TxnCompare_Target>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .raftKVRpcProctoc.TxnCompare.Result result = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_result(static_cast<::raftKVRpcProctoc::TxnCompare_Result>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes Value = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool Exists = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.exists_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 Version = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TxnCompare::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.TxnCompare)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes Key = 1;
+  if (!this->_internal_key().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_key(), target);
+  }
+
+  // .raftKVRpcProctoc.TxnCompare.Target target = 2;
+  if (this->_internal_target() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_target(), target);
+  }
+
+  // .raftKVRpcProctoc.TxnCompare.Result result = 3;
+  if (this->_internal_result() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_result(), target);
+  }
+
+  // bytes Value = 4;
+  if (!this->_internal_value().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_value(), target);
+  }
+
+  // bool Exists = 5;
+  if (this->_internal_exists() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_exists(), target);
+  }
+
+  // int64 Version = 6;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(6, this->_internal_version(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.TxnCompare)
+  return target;
+}
+
+size_t TxnCompare::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.TxnCompare)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes Key = 1;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_key());
+  }
+
+  // bytes Value = 4;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
+  }
+
+  // .raftKVRpcProctoc.TxnCompare.Target target = 2;
+  if (this->_internal_target() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_target());
+  }
+
+  // .raftKVRpcProctoc.TxnCompare.Result result = 3;
+  if (this->_internal_result() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_result());
+  }
+
+  // int64 Version = 6;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_version());
+  }
+
+  // bool Exists = 5;
+  if (this->_internal_exists() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TxnCompare::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TxnCompare::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TxnCompare::GetClassData() const { return &_class_data_; }
+
+
+void TxnCompare::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TxnCompare*>(&to_msg);
+  auto& from = static_cast<const TxnCompare&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.TxnCompare)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  if (from._internal_target() != 0) {
+    _this->_internal_set_target(from._internal_target());
+  }
+  if (from._internal_result() != 0) {
+    _this->_internal_set_result(from._internal_result());
+  }
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  if (from._internal_exists() != 0) {
+    _this->_internal_set_exists(from._internal_exists());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TxnCompare::CopyFrom(const TxnCompare& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.TxnCompare)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TxnCompare::IsInitialized() const {
+  return true;
+}
+
+void TxnCompare::InternalSwap(TxnCompare* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TxnCompare, _impl_.exists_)
+      + sizeof(TxnCompare::_impl_.exists_)
+      - PROTOBUF_FIELD_OFFSET(TxnCompare, _impl_.target_)>(
+          reinterpret_cast<char*>(&_impl_.target_),
+          reinterpret_cast<char*>(&other->_impl_.target_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TxnCompare::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[14]);
+}
+
+// ===================================================================
+
+class TxnOp::_Internal {
+ public:
+};
+
+TxnOp::TxnOp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.TxnOp)
+}
+TxnOp::TxnOp(const TxnOp& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TxnOp* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.delta_){}
+    , decltype(_impl_.op_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.delta_, &from._impl_.delta_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.op_) -
+    reinterpret_cast<char*>(&_impl_.delta_)) + sizeof(_impl_.op_));
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.TxnOp)
+}
+
+inline void TxnOp::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.delta_){int64_t{0}}
+    , decltype(_impl_.op_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+TxnOp::~TxnOp() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.TxnOp)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TxnOp::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
+}
+
+void TxnOp::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TxnOp::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.TxnOp)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
+  ::memset(&_impl_.delta_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.op_) -
+      reinterpret_cast<char*>(&_impl_.delta_)) + sizeof(_impl_.op_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TxnOp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .raftKVRpcProctoc.TxnOp.OpType Op = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_op(static_cast<::raftKVRpcProctoc::TxnOp_OpType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes Key = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes Value = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 Delta = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.delta_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TxnOp::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.TxnOp)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .raftKVRpcProctoc.TxnOp.OpType Op = 1;
+  if (this->_internal_op() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_op(), target);
+  }
+
+  // bytes Key = 2;
+  if (!this->_internal_key().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_key(), target);
+  }
+
+  // bytes Value = 3;
+  if (!this->_internal_value().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_value(), target);
+  }
+
+  // int64 Delta = 4;
+  if (this->_internal_delta() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_delta(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.TxnOp)
+  return target;
+}
+
+size_t TxnOp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.TxnOp)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes Key = 2;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_key());
+  }
+
+  // bytes Value = 3;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
+  }
+
+  // int64 Delta = 4;
+  if (this->_internal_delta() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_delta());
+  }
+
+  // .raftKVRpcProctoc.TxnOp.OpType Op = 1;
+  if (this->_internal_op() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_op());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TxnOp::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TxnOp::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TxnOp::GetClassData() const { return &_class_data_; }
+
+
+void TxnOp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TxnOp*>(&to_msg);
+  auto& from = static_cast<const TxnOp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.TxnOp)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  if (from._internal_delta() != 0) {
+    _this->_internal_set_delta(from._internal_delta());
+  }
+  if (from._internal_op() != 0) {
+    _this->_internal_set_op(from._internal_op());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TxnOp::CopyFrom(const TxnOp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.TxnOp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TxnOp::IsInitialized() const {
+  return true;
+}
+
+void TxnOp::InternalSwap(TxnOp* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TxnOp, _impl_.op_)
+      + sizeof(TxnOp::_impl_.op_)
+      - PROTOBUF_FIELD_OFFSET(TxnOp, _impl_.delta_)>(
+          reinterpret_cast<char*>(&_impl_.delta_),
+          reinterpret_cast<char*>(&other->_impl_.delta_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TxnOp::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[15]);
+}
+
+// ===================================================================
+
+class TxnArgs::_Internal {
+ public:
+};
+
+TxnArgs::TxnArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.TxnArgs)
+}
+TxnArgs::TxnArgs(const TxnArgs& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TxnArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.compares_){from._impl_.compares_}
+    , decltype(_impl_.success_){from._impl_.success_}
+    , decltype(_impl_.failure_){from._impl_.failure_}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.requestid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.clientid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_clientid().empty()) {
+    _this->_impl_.clientid_.Set(from._internal_clientid(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.requestid_ = from._impl_.requestid_;
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.TxnArgs)
+}
+
+inline void TxnArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.compares_){arena}
+    , decltype(_impl_.success_){arena}
+    , decltype(_impl_.failure_){arena}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.requestid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.clientid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+TxnArgs::~TxnArgs() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.TxnArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TxnArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.compares_.~RepeatedPtrField();
+  _impl_.success_.~RepeatedPtrField();
+  _impl_.failure_.~RepeatedPtrField();
+  _impl_.clientid_.Destroy();
+}
+
+void TxnArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TxnArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.TxnArgs)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.compares_.Clear();
+  _impl_.success_.Clear();
+  _impl_.failure_.Clear();
+  _impl_.clientid_.ClearToEmpty();
+  _impl_.requestid_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TxnArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .raftKVRpcProctoc.TxnCompare Compares = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_compares(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .raftKVRpcProctoc.TxnOp Success = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_success(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .raftKVRpcProctoc.TxnOp Failure = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_failure(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes ClientId = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_clientid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 RequestId = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.requestid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TxnArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.TxnArgs)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .raftKVRpcProctoc.TxnCompare Compares = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_compares_size()); i < n; i++) {
+    const auto& repfield = this->_internal_compares(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .raftKVRpcProctoc.TxnOp Success = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_success_size()); i < n; i++) {
+    const auto& repfield = this->_internal_success(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .raftKVRpcProctoc.TxnOp Failure = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_failure_size()); i < n; i++) {
+    const auto& repfield = this->_internal_failure(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // bytes ClientId = 4;
+  if (!this->_internal_clientid().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_clientid(), target);
+  }
+
+  // int32 RequestId = 5;
+  if (this->_internal_requestid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_requestid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.TxnArgs)
+  return target;
+}
+
+size_t TxnArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.TxnArgs)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .raftKVRpcProctoc.TxnCompare Compares = 1;
+  total_size += 1UL * this->_internal_compares_size();
+  for (const auto& msg : this->_impl_.compares_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .raftKVRpcProctoc.TxnOp Success = 2;
+  total_size += 1UL * this->_internal_success_size();
+  for (const auto& msg : this->_impl_.success_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .raftKVRpcProctoc.TxnOp Failure = 3;
+  total_size += 1UL * this->_internal_failure_size();
+  for (const auto& msg : this->_impl_.failure_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // bytes ClientId = 4;
+  if (!this->_internal_clientid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_clientid());
+  }
+
+  // int32 RequestId = 5;
+  if (this->_internal_requestid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_requestid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TxnArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TxnArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TxnArgs::GetClassData() const { return &_class_data_; }
+
+
+void TxnArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TxnArgs*>(&to_msg);
+  auto& from = static_cast<const TxnArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.TxnArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.compares_.MergeFrom(from._impl_.compares_);
+  _this->_impl_.success_.MergeFrom(from._impl_.success_);
+  _this->_impl_.failure_.MergeFrom(from._impl_.failure_);
+  if (!from._internal_clientid().empty()) {
+    _this->_internal_set_clientid(from._internal_clientid());
+  }
+  if (from._internal_requestid() != 0) {
+    _this->_internal_set_requestid(from._internal_requestid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TxnArgs::CopyFrom(const TxnArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.TxnArgs)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TxnArgs::IsInitialized() const {
+  return true;
+}
+
+void TxnArgs::InternalSwap(TxnArgs* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.compares_.InternalSwap(&other->_impl_.compares_);
+  _impl_.success_.InternalSwap(&other->_impl_.success_);
+  _impl_.failure_.InternalSwap(&other->_impl_.failure_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.clientid_, lhs_arena,
+      &other->_impl_.clientid_, rhs_arena
+  );
+  swap(_impl_.requestid_, other->_impl_.requestid_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TxnArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[16]);
+}
+
+// ===================================================================
+
+class TxnOpResult::_Internal {
+ public:
+};
+
+TxnOpResult::TxnOpResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.TxnOpResult)
+}
+TxnOpResult::TxnOpResult(const TxnOpResult& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TxnOpResult* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){}
+    , decltype(_impl_.exist_){}
+    , decltype(_impl_.applied_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.exist_, &from._impl_.exist_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.applied_) -
+    reinterpret_cast<char*>(&_impl_.exist_)) + sizeof(_impl_.applied_));
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.TxnOpResult)
+}
+
+inline void TxnOpResult::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){}
+    , decltype(_impl_.exist_){false}
+    , decltype(_impl_.applied_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+TxnOpResult::~TxnOpResult() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.TxnOpResult)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TxnOpResult::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.value_.Destroy();
+}
+
+void TxnOpResult::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TxnOpResult::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.TxnOpResult)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.value_.ClearToEmpty();
+  ::memset(&_impl_.exist_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.applied_) -
+      reinterpret_cast<char*>(&_impl_.exist_)) + sizeof(_impl_.applied_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TxnOpResult::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool Exist = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.exist_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool Applied = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.applied_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes Value = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TxnOpResult::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.TxnOpResult)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool Exist = 1;
+  if (this->_internal_exist() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_exist(), target);
+  }
+
+  // bool Applied = 2;
+  if (this->_internal_applied() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_applied(), target);
+  }
+
+  // bytes Value = 3;
+  if (!this->_internal_value().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.TxnOpResult)
+  return target;
+}
+
+size_t TxnOpResult::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.TxnOpResult)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes Value = 3;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
+  }
+
+  // bool Exist = 1;
+  if (this->_internal_exist() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool Applied = 2;
+  if (this->_internal_applied() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TxnOpResult::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TxnOpResult::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TxnOpResult::GetClassData() const { return &_class_data_; }
+
+
+void TxnOpResult::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TxnOpResult*>(&to_msg);
+  auto& from = static_cast<const TxnOpResult&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.TxnOpResult)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  if (from._internal_exist() != 0) {
+    _this->_internal_set_exist(from._internal_exist());
+  }
+  if (from._internal_applied() != 0) {
+    _this->_internal_set_applied(from._internal_applied());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TxnOpResult::CopyFrom(const TxnOpResult& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.TxnOpResult)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TxnOpResult::IsInitialized() const {
+  return true;
+}
+
+void TxnOpResult::InternalSwap(TxnOpResult* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TxnOpResult, _impl_.applied_)
+      + sizeof(TxnOpResult::_impl_.applied_)
+      - PROTOBUF_FIELD_OFFSET(TxnOpResult, _impl_.exist_)>(
+          reinterpret_cast<char*>(&_impl_.exist_),
+          reinterpret_cast<char*>(&other->_impl_.exist_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TxnOpResult::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[17]);
+}
+
+// ===================================================================
+
+class TxnReply::_Internal {
+ public:
+};
+
+TxnReply::TxnReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.TxnReply)
+}
+TxnReply::TxnReply(const TxnReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TxnReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.results_){from._impl_.results_}
+    , decltype(_impl_.err_){}
+    , decltype(_impl_.txnerror_){}
+    , decltype(_impl_.retryafterms_){}
+    , decltype(_impl_.succeeded_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_err().empty()) {
+    _this->_impl_.err_.Set(from._internal_err(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.txnerror_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.txnerror_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_txnerror().empty()) {
+    _this->_impl_.txnerror_.Set(from._internal_txnerror(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.retryafterms_, &from._impl_.retryafterms_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.succeeded_) -
+    reinterpret_cast<char*>(&_impl_.retryafterms_)) + sizeof(_impl_.succeeded_));
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.TxnReply)
+}
+
+inline void TxnReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.results_){arena}
+    , decltype(_impl_.err_){}
+    , decltype(_impl_.txnerror_){}
+    , decltype(_impl_.retryafterms_){int64_t{0}}
+    , decltype(_impl_.succeeded_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.txnerror_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.txnerror_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+TxnReply::~TxnReply() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.TxnReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TxnReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.results_.~RepeatedPtrField();
+  _impl_.err_.Destroy();
+  _impl_.txnerror_.Destroy();
+}
+
+void TxnReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TxnReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.TxnReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.results_.Clear();
+  _impl_.err_.ClearToEmpty();
+  _impl_.txnerror_.ClearToEmpty();
+  ::memset(&_impl_.retryafterms_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.succeeded_) -
+      reinterpret_cast<char*>(&_impl_.retryafterms_)) + sizeof(_impl_.succeeded_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TxnReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes Err = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_err();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool Succeeded = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.succeeded_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .raftKVRpcProctoc.TxnOpResult Results = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_results(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes TxnError = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_txnerror();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 RetryAfterMs = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.retryafterms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TxnReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.TxnReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_err(), target);
+  }
+
+  // bool Succeeded = 2;
+  if (this->_internal_succeeded() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_succeeded(), target);
+  }
+
+  // repeated .raftKVRpcProctoc.TxnOpResult Results = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_results_size()); i < n; i++) {
+    const auto& repfield = this->_internal_results(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // bytes TxnError = 4;
+  if (!this->_internal_txnerror().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_txnerror(), target);
+  }
+
+  // int64 RetryAfterMs = 5;
+  if (this->_internal_retryafterms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_retryafterms(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.TxnReply)
+  return target;
+}
+
+size_t TxnReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.TxnReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .raftKVRpcProctoc.TxnOpResult Results = 3;
+  total_size += 1UL * this->_internal_results_size();
+  for (const auto& msg : this->_impl_.results_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_err());
+  }
+
+  // bytes TxnError = 4;
+  if (!this->_internal_txnerror().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_txnerror());
+  }
+
+  // int64 RetryAfterMs = 5;
+  if (this->_internal_retryafterms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_retryafterms());
+  }
+
+  // bool Succeeded = 2;
+  if (this->_internal_succeeded() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TxnReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TxnReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TxnReply::GetClassData() const { return &_class_data_; }
+
+
+void TxnReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TxnReply*>(&to_msg);
+  auto& from = static_cast<const TxnReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.TxnReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.results_.MergeFrom(from._impl_.results_);
+  if (!from._internal_err().empty()) {
+    _this->_internal_set_err(from._internal_err());
+  }
+  if (!from._internal_txnerror().empty()) {
+    _this->_internal_set_txnerror(from._internal_txnerror());
+  }
+  if (from._internal_retryafterms() != 0) {
+    _this->_internal_set_retryafterms(from._internal_retryafterms());
+  }
+  if (from._internal_succeeded() != 0) {
+    _this->_internal_set_succeeded(from._internal_succeeded());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TxnReply::CopyFrom(const TxnReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.TxnReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TxnReply::IsInitialized() const {
+  return true;
+}
+
+void TxnReply::InternalSwap(TxnReply* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.results_.InternalSwap(&other->_impl_.results_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.err_, lhs_arena,
+      &other->_impl_.err_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.txnerror_, lhs_arena,
+      &other->_impl_.txnerror_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TxnReply, _impl_.succeeded_)
+      + sizeof(TxnReply::_impl_.succeeded_)
+      - PROTOBUF_FIELD_OFFSET(TxnReply, _impl_.retryafterms_)>(
+          reinterpret_cast<char*>(&_impl_.retryafterms_),
+          reinterpret_cast<char*>(&other->_impl_.retryafterms_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TxnReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[18]);
+}
+
+// ===================================================================
+
+class DeleteArgs::_Internal {
+ public:
+};
+
+DeleteArgs::DeleteArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.DeleteArgs)
+}
+DeleteArgs::DeleteArgs(const DeleteArgs& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DeleteArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.requestid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.clientid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_clientid().empty()) {
+    _this->_impl_.clientid_.Set(from._internal_clientid(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.requestid_ = from._impl_.requestid_;
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.DeleteArgs)
+}
+
+inline void DeleteArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.requestid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.clientid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+DeleteArgs::~DeleteArgs() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.DeleteArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DeleteArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.clientid_.Destroy();
+}
+
+void DeleteArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DeleteArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.DeleteArgs)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  _impl_.clientid_.ClearToEmpty();
+  _impl_.requestid_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DeleteArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes Key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes ClientId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_clientid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 RequestId = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.requestid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DeleteArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.DeleteArgs)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes Key = 1;
+  if (!this->_internal_key().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_key(), target);
+  }
+
+  // bytes ClientId = 2;
+  if (!this->_internal_clientid().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_clientid(), target);
+  }
+
+  // int32 RequestId = 3;
+  if (this->_internal_requestid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_requestid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.DeleteArgs)
+  return target;
+}
+
+size_t DeleteArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.DeleteArgs)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes Key = 1;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_key());
+  }
+
+  // bytes ClientId = 2;
+  if (!this->_internal_clientid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_clientid());
+  }
+
+  // int32 RequestId = 3;
+  if (this->_internal_requestid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_requestid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DeleteArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DeleteArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DeleteArgs::GetClassData() const { return &_class_data_; }
+
+
+void DeleteArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DeleteArgs*>(&to_msg);
+  auto& from = static_cast<const DeleteArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.DeleteArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (!from._internal_clientid().empty()) {
+    _this->_internal_set_clientid(from._internal_clientid());
+  }
+  if (from._internal_requestid() != 0) {
+    _this->_internal_set_requestid(from._internal_requestid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DeleteArgs::CopyFrom(const DeleteArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.DeleteArgs)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DeleteArgs::IsInitialized() const {
+  return true;
+}
+
+void DeleteArgs::InternalSwap(DeleteArgs* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.clientid_, lhs_arena,
+      &other->_impl_.clientid_, rhs_arena
+  );
+  swap(_impl_.requestid_, other->_impl_.requestid_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DeleteArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[19]);
+}
+
+// ===================================================================
+
+class DeleteRangeArgs::_Internal {
+ public:
+};
+
+DeleteRangeArgs::DeleteRangeArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.DeleteRangeArgs)
+}
+DeleteRangeArgs::DeleteRangeArgs(const DeleteRangeArgs& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DeleteRangeArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.startkey_){}
+    , decltype(_impl_.endkey_){}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.requestid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.startkey_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.startkey_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_startkey().empty()) {
+    _this->_impl_.startkey_.Set(from._internal_startkey(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.endkey_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.endkey_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_endkey().empty()) {
+    _this->_impl_.endkey_.Set(from._internal_endkey(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.clientid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_clientid().empty()) {
+    _this->_impl_.clientid_.Set(from._internal_clientid(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.requestid_ = from._impl_.requestid_;
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.DeleteRangeArgs)
+}
+
+inline void DeleteRangeArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.startkey_){}
+    , decltype(_impl_.endkey_){}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.requestid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.startkey_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.startkey_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.endkey_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.endkey_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.clientid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+DeleteRangeArgs::~DeleteRangeArgs() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.DeleteRangeArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DeleteRangeArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.startkey_.Destroy();
+  _impl_.endkey_.Destroy();
+  _impl_.clientid_.Destroy();
+}
+
+void DeleteRangeArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DeleteRangeArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.DeleteRangeArgs)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.startkey_.ClearToEmpty();
+  _impl_.endkey_.ClearToEmpty();
+  _impl_.clientid_.ClearToEmpty();
+  _impl_.requestid_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DeleteRangeArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes StartKey = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_startkey();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes EndKey = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_endkey();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes ClientId = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_clientid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 RequestId = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.requestid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DeleteRangeArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.DeleteRangeArgs)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes StartKey = 1;
+  if (!this->_internal_startkey().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_startkey(), target);
+  }
+
+  // bytes EndKey = 2;
+  if (!this->_internal_endkey().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_endkey(), target);
+  }
+
+  // bytes ClientId = 3;
+  if (!this->_internal_clientid().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_clientid(), target);
+  }
+
+  // int32 RequestId = 4;
+  if (this->_internal_requestid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_requestid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.DeleteRangeArgs)
+  return target;
+}
+
+size_t DeleteRangeArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.DeleteRangeArgs)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes StartKey = 1;
+  if (!this->_internal_startkey().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_startkey());
+  }
+
+  // bytes EndKey = 2;
+  if (!this->_internal_endkey().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_endkey());
+  }
+
+  // bytes ClientId = 3;
+  if (!this->_internal_clientid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_clientid());
+  }
+
+  // int32 RequestId = 4;
+  if (this->_internal_requestid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_requestid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DeleteRangeArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DeleteRangeArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DeleteRangeArgs::GetClassData() const { return &_class_data_; }
+
+
+void DeleteRangeArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DeleteRangeArgs*>(&to_msg);
+  auto& from = static_cast<const DeleteRangeArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.DeleteRangeArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_startkey().empty()) {
+    _this->_internal_set_startkey(from._internal_startkey());
+  }
+  if (!from._internal_endkey().empty()) {
+    _this->_internal_set_endkey(from._internal_endkey());
+  }
+  if (!from._internal_clientid().empty()) {
+    _this->_internal_set_clientid(from._internal_clientid());
+  }
+  if (from._internal_requestid() != 0) {
+    _this->_internal_set_requestid(from._internal_requestid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DeleteRangeArgs::CopyFrom(const DeleteRangeArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.DeleteRangeArgs)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DeleteRangeArgs::IsInitialized() const {
+  return true;
+}
+
+void DeleteRangeArgs::InternalSwap(DeleteRangeArgs* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.startkey_, lhs_arena,
+      &other->_impl_.startkey_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.endkey_, lhs_arena,
+      &other->_impl_.endkey_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.clientid_, lhs_arena,
+      &other->_impl_.clientid_, rhs_arena
+  );
+  swap(_impl_.requestid_, other->_impl_.requestid_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DeleteRangeArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[20]);
+}
+
+// ===================================================================
+
+class DeleteReply::_Internal {
+ public:
+};
+
+DeleteReply::DeleteReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.DeleteReply)
+}
+DeleteReply::DeleteReply(const DeleteReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DeleteReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.err_){}
+    , decltype(_impl_.retryafterms_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_err().empty()) {
+    _this->_impl_.err_.Set(from._internal_err(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.retryafterms_ = from._impl_.retryafterms_;
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.DeleteReply)
+}
+
+inline void DeleteReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.err_){}
+    , decltype(_impl_.retryafterms_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+DeleteReply::~DeleteReply() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.DeleteReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DeleteReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.err_.Destroy();
+}
+
+void DeleteReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DeleteReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.DeleteReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.err_.ClearToEmpty();
+  _impl_.retryafterms_ = int64_t{0};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DeleteReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes Err = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_err();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 RetryAfterMs = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.retryafterms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DeleteReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.DeleteReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_err(), target);
+  }
+
+  // int64 RetryAfterMs = 2;
+  if (this->_internal_retryafterms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_retryafterms(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.DeleteReply)
+  return target;
+}
+
+size_t DeleteReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.DeleteReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_err());
+  }
+
+  // int64 RetryAfterMs = 2;
+  if (this->_internal_retryafterms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_retryafterms());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DeleteReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DeleteReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DeleteReply::GetClassData() const { return &_class_data_; }
+
+
+void DeleteReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DeleteReply*>(&to_msg);
+  auto& from = static_cast<const DeleteReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.DeleteReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_err().empty()) {
+    _this->_internal_set_err(from._internal_err());
+  }
+  if (from._internal_retryafterms() != 0) {
+    _this->_internal_set_retryafterms(from._internal_retryafterms());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DeleteReply::CopyFrom(const DeleteReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.DeleteReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DeleteReply::IsInitialized() const {
+  return true;
+}
+
+void DeleteReply::InternalSwap(DeleteReply* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.err_, lhs_arena,
+      &other->_impl_.err_, rhs_arena
+  );
+  swap(_impl_.retryafterms_, other->_impl_.retryafterms_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DeleteReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[21]);
+}
+
+// ===================================================================
+
+class WatchEvent::_Internal {
+ public:
+};
+
+WatchEvent::WatchEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.WatchEvent)
+}
+WatchEvent::WatchEvent(const WatchEvent& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WatchEvent* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.index_){}
+    , decltype(_impl_.type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.index_, &from._impl_.index_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.type_) -
+    reinterpret_cast<char*>(&_impl_.index_)) + sizeof(_impl_.type_));
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.WatchEvent)
+}
+
+inline void WatchEvent::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.index_){int64_t{0}}
+    , decltype(_impl_.type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+WatchEvent::~WatchEvent() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.WatchEvent)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WatchEvent::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
+}
+
+void WatchEvent::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WatchEvent::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.WatchEvent)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
+  ::memset(&_impl_.index_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.type_) -
+      reinterpret_cast<char*>(&_impl_.index_)) + sizeof(_impl_.type_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WatchEvent::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .raftKVRpcProctoc.WatchEvent.EventType Type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::raftKVRpcProctoc::WatchEvent_EventType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes Key = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes Value = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 Index = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WatchEvent::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.WatchEvent)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .raftKVRpcProctoc.WatchEvent.EventType Type = 1;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
+  }
+
+  // bytes Key = 2;
+  if (!this->_internal_key().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_key(), target);
+  }
+
+  // bytes Value = 3;
+  if (!this->_internal_value().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_value(), target);
+  }
+
+  // int64 Index = 4;
+  if (this->_internal_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_index(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.WatchEvent)
+  return target;
+}
+
+size_t WatchEvent::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.WatchEvent)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes Key = 2;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_key());
+  }
+
+  // bytes Value = 3;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
+  }
+
+  // int64 Index = 4;
+  if (this->_internal_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_index());
+  }
+
+  // .raftKVRpcProctoc.WatchEvent.EventType Type = 1;
+  if (this->_internal_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WatchEvent::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WatchEvent::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WatchEvent::GetClassData() const { return &_class_data_; }
+
+
+void WatchEvent::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WatchEvent*>(&to_msg);
+  auto& from = static_cast<const WatchEvent&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.WatchEvent)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  if (from._internal_index() != 0) {
+    _this->_internal_set_index(from._internal_index());
+  }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WatchEvent::CopyFrom(const WatchEvent& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.WatchEvent)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WatchEvent::IsInitialized() const {
+  return true;
+}
+
+void WatchEvent::InternalSwap(WatchEvent* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(WatchEvent, _impl_.type_)
+      + sizeof(WatchEvent::_impl_.type_)
+      - PROTOBUF_FIELD_OFFSET(WatchEvent, _impl_.index_)>(
+          reinterpret_cast<char*>(&_impl_.index_),
+          reinterpret_cast<char*>(&other->_impl_.index_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WatchEvent::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[22]);
+}
+
+// ===================================================================
+
+class WatchArgs::_Internal {
+ public:
+};
+
+WatchArgs::WatchArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.WatchArgs)
+}
+WatchArgs::WatchArgs(const WatchArgs& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WatchArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.startindex_){}
+    , decltype(_impl_.prefix_){}
+    , decltype(_impl_.maxevents_){}
+    , decltype(_impl_.watchid_){}
+    , decltype(_impl_.timeoutms_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.startindex_, &from._impl_.startindex_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.timeoutms_) -
+    reinterpret_cast<char*>(&_impl_.startindex_)) + sizeof(_impl_.timeoutms_));
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.WatchArgs)
+}
+
+inline void WatchArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.startindex_){int64_t{0}}
+    , decltype(_impl_.prefix_){false}
+    , decltype(_impl_.maxevents_){0}
+    , decltype(_impl_.watchid_){int64_t{0}}
+    , decltype(_impl_.timeoutms_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+WatchArgs::~WatchArgs() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.WatchArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WatchArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+}
+
+void WatchArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WatchArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.WatchArgs)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  ::memset(&_impl_.startindex_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.timeoutms_) -
+      reinterpret_cast<char*>(&_impl_.startindex_)) + sizeof(_impl_.timeoutms_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WatchArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes Key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool Prefix = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.prefix_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 StartIndex = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.startindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 WatchId = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.watchid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 MaxEvents = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.maxevents_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 TimeoutMs = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.timeoutms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WatchArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.WatchArgs)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes Key = 1;
+  if (!this->_internal_key().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_key(), target);
+  }
+
+  // bool Prefix = 2;
+  if (this->_internal_prefix() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_prefix(), target);
+  }
+
+  // int64 StartIndex = 3;
+  if (this->_internal_startindex() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_startindex(), target);
+  }
+
+  // int64 WatchId = 4;
+  if (this->_internal_watchid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_watchid(), target);
+  }
+
+  // int32 MaxEvents = 5;
+  if (this->_internal_maxevents() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_maxevents(), target);
+  }
+
+  // int32 TimeoutMs = 6;
+  if (this->_internal_timeoutms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_timeoutms(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.WatchArgs)
+  return target;
+}
+
+size_t WatchArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.WatchArgs)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes Key = 1;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_key());
+  }
+
+  // int64 StartIndex = 3;
+  if (this->_internal_startindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_startindex());
+  }
+
+  // bool Prefix = 2;
+  if (this->_internal_prefix() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // int32 MaxEvents = 5;
+  if (this->_internal_maxevents() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_maxevents());
+  }
+
+  // int64 WatchId = 4;
+  if (this->_internal_watchid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_watchid());
+  }
+
+  // int32 TimeoutMs = 6;
+  if (this->_internal_timeoutms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_timeoutms());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WatchArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WatchArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WatchArgs::GetClassData() const { return &_class_data_; }
+
+
+void WatchArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WatchArgs*>(&to_msg);
+  auto& from = static_cast<const WatchArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.WatchArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (from._internal_startindex() != 0) {
+    _this->_internal_set_startindex(from._internal_startindex());
+  }
+  if (from._internal_prefix() != 0) {
+    _this->_internal_set_prefix(from._internal_prefix());
+  }
+  if (from._internal_maxevents() != 0) {
+    _this->_internal_set_maxevents(from._internal_maxevents());
+  }
+  if (from._internal_watchid() != 0) {
+    _this->_internal_set_watchid(from._internal_watchid());
+  }
+  if (from._internal_timeoutms() != 0) {
+    _this->_internal_set_timeoutms(from._internal_timeoutms());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WatchArgs::CopyFrom(const WatchArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.WatchArgs)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WatchArgs::IsInitialized() const {
+  return true;
+}
+
+void WatchArgs::InternalSwap(WatchArgs* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(WatchArgs, _impl_.timeoutms_)
+      + sizeof(WatchArgs::_impl_.timeoutms_)
+      - PROTOBUF_FIELD_OFFSET(WatchArgs, _impl_.startindex_)>(
+          reinterpret_cast<char*>(&_impl_.startindex_),
+          reinterpret_cast<char*>(&other->_impl_.startindex_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WatchArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[23]);
+}
+
+// ===================================================================
+
+class WatchReply::_Internal {
+ public:
+};
+
+WatchReply::WatchReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.WatchReply)
+}
+WatchReply::WatchReply(const WatchReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WatchReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.events_){from._impl_.events_}
+    , decltype(_impl_.err_){}
+    , decltype(_impl_.watchid_){}
+    , decltype(_impl_.nextindex_){}
+    , decltype(_impl_.retryafterms_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_err().empty()) {
+    _this->_impl_.err_.Set(from._internal_err(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.watchid_, &from._impl_.watchid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.retryafterms_) -
+    reinterpret_cast<char*>(&_impl_.watchid_)) + sizeof(_impl_.retryafterms_));
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.WatchReply)
+}
+
+inline void WatchReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.events_){arena}
+    , decltype(_impl_.err_){}
+    , decltype(_impl_.watchid_){int64_t{0}}
+    , decltype(_impl_.nextindex_){int64_t{0}}
+    , decltype(_impl_.retryafterms_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+WatchReply::~WatchReply() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.WatchReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WatchReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.events_.~RepeatedPtrField();
+  _impl_.err_.Destroy();
+}
+
+void WatchReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WatchReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.WatchReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.events_.Clear();
+  _impl_.err_.ClearToEmpty();
+  ::memset(&_impl_.watchid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.retryafterms_) -
+      reinterpret_cast<char*>(&_impl_.watchid_)) + sizeof(_impl_.retryafterms_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WatchReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes Err = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_err();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 WatchId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.watchid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .raftKVRpcProctoc.WatchEvent Events = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_events(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 NextIndex = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.nextindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 RetryAfterMs = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.retryafterms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WatchReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.WatchReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_err(), target);
+  }
+
+  // int64 WatchId = 2;
+  if (this->_internal_watchid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_watchid(), target);
+  }
+
+  // repeated .raftKVRpcProctoc.WatchEvent Events = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_events_size()); i < n; i++) {
+    const auto& repfield = this->_internal_events(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // int64 NextIndex = 4;
+  if (this->_internal_nextindex() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_nextindex(), target);
+  }
+
+  // int64 RetryAfterMs = 5;
+  if (this->_internal_retryafterms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_retryafterms(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.WatchReply)
+  return target;
+}
+
+size_t WatchReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.WatchReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .raftKVRpcProctoc.WatchEvent Events = 3;
+  total_size += 1UL * this->_internal_events_size();
+  for (const auto& msg : this->_impl_.events_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_err());
+  }
+
+  // int64 WatchId = 2;
+  if (this->_internal_watchid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_watchid());
+  }
+
+  // int64 NextIndex = 4;
+  if (this->_internal_nextindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_nextindex());
+  }
+
+  // int64 RetryAfterMs = 5;
+  if (this->_internal_retryafterms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_retryafterms());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WatchReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WatchReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WatchReply::GetClassData() const { return &_class_data_; }
+
+
+void WatchReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WatchReply*>(&to_msg);
+  auto& from = static_cast<const WatchReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.WatchReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.events_.MergeFrom(from._impl_.events_);
+  if (!from._internal_err().empty()) {
+    _this->_internal_set_err(from._internal_err());
+  }
+  if (from._internal_watchid() != 0) {
+    _this->_internal_set_watchid(from._internal_watchid());
+  }
+  if (from._internal_nextindex() != 0) {
+    _this->_internal_set_nextindex(from._internal_nextindex());
+  }
+  if (from._internal_retryafterms() != 0) {
+    _this->_internal_set_retryafterms(from._internal_retryafterms());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WatchReply::CopyFrom(const WatchReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.WatchReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WatchReply::IsInitialized() const {
+  return true;
+}
+
+void WatchReply::InternalSwap(WatchReply* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.events_.InternalSwap(&other->_impl_.events_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.err_, lhs_arena,
+      &other->_impl_.err_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(WatchReply, _impl_.retryafterms_)
+      + sizeof(WatchReply::_impl_.retryafterms_)
+      - PROTOBUF_FIELD_OFFSET(WatchReply, _impl_.watchid_)>(
+          reinterpret_cast<char*>(&_impl_.watchid_),
+          reinterpret_cast<char*>(&other->_impl_.watchid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WatchReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[24]);
+}
+
+// ===================================================================
+
+class CancelWatchArgs::_Internal {
+ public:
+};
+
+CancelWatchArgs::CancelWatchArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.CancelWatchArgs)
+}
+CancelWatchArgs::CancelWatchArgs(const CancelWatchArgs& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CancelWatchArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.watchid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.watchid_ = from._impl_.watchid_;
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.CancelWatchArgs)
+}
+
+inline void CancelWatchArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.watchid_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CancelWatchArgs::~CancelWatchArgs() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.CancelWatchArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CancelWatchArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CancelWatchArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CancelWatchArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.CancelWatchArgs)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.watchid_ = int64_t{0};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CancelWatchArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int64 WatchId = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.watchid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CancelWatchArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.CancelWatchArgs)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int64 WatchId = 1;
+  if (this->_internal_watchid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_watchid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.CancelWatchArgs)
+  return target;
+}
+
+size_t CancelWatchArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.CancelWatchArgs)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int64 WatchId = 1;
+  if (this->_internal_watchid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_watchid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CancelWatchArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CancelWatchArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CancelWatchArgs::GetClassData() const { return &_class_data_; }
+
+
+void CancelWatchArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CancelWatchArgs*>(&to_msg);
+  auto& from = static_cast<const CancelWatchArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.CancelWatchArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_watchid() != 0) {
+    _this->_internal_set_watchid(from._internal_watchid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CancelWatchArgs::CopyFrom(const CancelWatchArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.CancelWatchArgs)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CancelWatchArgs::IsInitialized() const {
+  return true;
+}
+
+void CancelWatchArgs::InternalSwap(CancelWatchArgs* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.watchid_, other->_impl_.watchid_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CancelWatchArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[25]);
+}
+
+// ===================================================================
+
+class CancelWatchReply::_Internal {
+ public:
+};
+
+CancelWatchReply::CancelWatchReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.CancelWatchReply)
+}
+CancelWatchReply::CancelWatchReply(const CancelWatchReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CancelWatchReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.err_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_err().empty()) {
+    _this->_impl_.err_.Set(from._internal_err(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.CancelWatchReply)
+}
+
+inline void CancelWatchReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.err_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CancelWatchReply::~CancelWatchReply() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.CancelWatchReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CancelWatchReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.err_.Destroy();
+}
+
+void CancelWatchReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CancelWatchReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.CancelWatchReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.err_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CancelWatchReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes Err = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_err();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CancelWatchReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.CancelWatchReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_err(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.CancelWatchReply)
+  return target;
+}
+
+size_t CancelWatchReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.CancelWatchReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_err());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CancelWatchReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CancelWatchReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CancelWatchReply::GetClassData() const { return &_class_data_; }
+
+
+void CancelWatchReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CancelWatchReply*>(&to_msg);
+  auto& from = static_cast<const CancelWatchReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.CancelWatchReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_err().empty()) {
+    _this->_internal_set_err(from._internal_err());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CancelWatchReply::CopyFrom(const CancelWatchReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.CancelWatchReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CancelWatchReply::IsInitialized() const {
+  return true;
+}
+
+void CancelWatchReply::InternalSwap(CancelWatchReply* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.err_, lhs_arena,
+      &other->_impl_.err_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CancelWatchReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[26]);
+}
+
+// ===================================================================
+
+class RegisterSessionArgs::_Internal {
+ public:
+};
+
+RegisterSessionArgs::RegisterSessionArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.RegisterSessionArgs)
+}
+RegisterSessionArgs::RegisterSessionArgs(const RegisterSessionArgs& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RegisterSessionArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.nonce_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.nonce_ = from._impl_.nonce_;
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.RegisterSessionArgs)
+}
+
+inline void RegisterSessionArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.nonce_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RegisterSessionArgs::~RegisterSessionArgs() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.RegisterSessionArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RegisterSessionArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void RegisterSessionArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RegisterSessionArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.RegisterSessionArgs)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.nonce_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RegisterSessionArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 Nonce = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.nonce_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RegisterSessionArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.RegisterSessionArgs)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 Nonce = 1;
+  if (this->_internal_nonce() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_nonce(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.RegisterSessionArgs)
+  return target;
+}
+
+size_t RegisterSessionArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.RegisterSessionArgs)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 Nonce = 1;
+  if (this->_internal_nonce() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_nonce());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RegisterSessionArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RegisterSessionArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RegisterSessionArgs::GetClassData() const { return &_class_data_; }
+
+
+void RegisterSessionArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RegisterSessionArgs*>(&to_msg);
+  auto& from = static_cast<const RegisterSessionArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.RegisterSessionArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_nonce() != 0) {
+    _this->_internal_set_nonce(from._internal_nonce());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RegisterSessionArgs::CopyFrom(const RegisterSessionArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.RegisterSessionArgs)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RegisterSessionArgs::IsInitialized() const {
+  return true;
+}
+
+void RegisterSessionArgs::InternalSwap(RegisterSessionArgs* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.nonce_, other->_impl_.nonce_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RegisterSessionArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[27]);
+}
+
+// ===================================================================
+
+class RegisterSessionReply::_Internal {
+ public:
+};
+
+RegisterSessionReply::RegisterSessionReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.RegisterSessionReply)
+}
+RegisterSessionReply::RegisterSessionReply(const RegisterSessionReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RegisterSessionReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.err_){}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.sessionid_){}
+    , decltype(_impl_.retryafterms_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_err().empty()) {
+    _this->_impl_.err_.Set(from._internal_err(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.clientid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_clientid().empty()) {
+    _this->_impl_.clientid_.Set(from._internal_clientid(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.sessionid_, &from._impl_.sessionid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.retryafterms_) -
+    reinterpret_cast<char*>(&_impl_.sessionid_)) + sizeof(_impl_.retryafterms_));
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.RegisterSessionReply)
+}
+
+inline void RegisterSessionReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.err_){}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.sessionid_){uint64_t{0u}}
+    , decltype(_impl_.retryafterms_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.clientid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+RegisterSessionReply::~RegisterSessionReply() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.RegisterSessionReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RegisterSessionReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.err_.Destroy();
+  _impl_.clientid_.Destroy();
+}
+
+void RegisterSessionReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RegisterSessionReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.RegisterSessionReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.err_.ClearToEmpty();
+  _impl_.clientid_.ClearToEmpty();
+  ::memset(&_impl_.sessionid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.retryafterms_) -
+      reinterpret_cast<char*>(&_impl_.sessionid_)) + sizeof(_impl_.retryafterms_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RegisterSessionReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes Err = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_err();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 SessionId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.sessionid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes ClientId = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_clientid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 RetryAfterMs = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.retryafterms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RegisterSessionReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.RegisterSessionReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_err(), target);
+  }
+
+  // uint64 SessionId = 2;
+  if (this->_internal_sessionid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_sessionid(), target);
+  }
+
+  // bytes ClientId = 3;
+  if (!this->_internal_clientid().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_clientid(), target);
+  }
+
+  // int64 RetryAfterMs = 4;
+  if (this->_internal_retryafterms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_retryafterms(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.RegisterSessionReply)
+  return target;
+}
+
+size_t RegisterSessionReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.RegisterSessionReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_err());
+  }
+
+  // bytes ClientId = 3;
+  if (!this->_internal_clientid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_clientid());
+  }
+
+  // uint64 SessionId = 2;
+  if (this->_internal_sessionid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sessionid());
+  }
+
+  // int64 RetryAfterMs = 4;
+  if (this->_internal_retryafterms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_retryafterms());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RegisterSessionReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RegisterSessionReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RegisterSessionReply::GetClassData() const { return &_class_data_; }
+
+
+void RegisterSessionReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RegisterSessionReply*>(&to_msg);
+  auto& from = static_cast<const RegisterSessionReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.RegisterSessionReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_err().empty()) {
+    _this->_internal_set_err(from._internal_err());
+  }
+  if (!from._internal_clientid().empty()) {
+    _this->_internal_set_clientid(from._internal_clientid());
+  }
+  if (from._internal_sessionid() != 0) {
+    _this->_internal_set_sessionid(from._internal_sessionid());
+  }
+  if (from._internal_retryafterms() != 0) {
+    _this->_internal_set_retryafterms(from._internal_retryafterms());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RegisterSessionReply::CopyFrom(const RegisterSessionReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.RegisterSessionReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RegisterSessionReply::IsInitialized() const {
+  return true;
+}
+
+void RegisterSessionReply::InternalSwap(RegisterSessionReply* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.err_, lhs_arena,
+      &other->_impl_.err_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.clientid_, lhs_arena,
+      &other->_impl_.clientid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RegisterSessionReply, _impl_.retryafterms_)
+      + sizeof(RegisterSessionReply::_impl_.retryafterms_)
+      - PROTOBUF_FIELD_OFFSET(RegisterSessionReply, _impl_.sessionid_)>(
+          reinterpret_cast<char*>(&_impl_.sessionid_),
+          reinterpret_cast<char*>(&other->_impl_.sessionid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RegisterSessionReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[28]);
+}
+
+// ===================================================================
+
+class CdcEntry::_Internal {
+ public:
+};
+
+CdcEntry::CdcEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.CdcEntry)
+}
+CdcEntry::CdcEntry(const CdcEntry& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CdcEntry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.batch_){from._impl_.batch_}
+    , decltype(_impl_.operation_){}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.command_){}
+    , decltype(_impl_.index_){}
+    , decltype(_impl_.term_){}
+    , decltype(_impl_.timestampms_){}
+    , decltype(_impl_.ttlms_){}
+    , decltype(_impl_.requestid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.operation_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.operation_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_operation().empty()) {
+    _this->_impl_.operation_.Set(from._internal_operation(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.clientid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_clientid().empty()) {
+    _this->_impl_.clientid_.Set(from._internal_clientid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.command_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.command_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_command().empty()) {
+    _this->_impl_.command_.Set(from._internal_command(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.index_, &from._impl_.index_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.requestid_) -
+    reinterpret_cast<char*>(&_impl_.index_)) + sizeof(_impl_.requestid_));
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.CdcEntry)
+}
+
+inline void CdcEntry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.batch_){arena}
+    , decltype(_impl_.operation_){}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.command_){}
+    , decltype(_impl_.index_){int64_t{0}}
+    , decltype(_impl_.term_){int64_t{0}}
+    , decltype(_impl_.timestampms_){int64_t{0}}
+    , decltype(_impl_.ttlms_){int64_t{0}}
+    , decltype(_impl_.requestid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.operation_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.operation_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.clientid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.command_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.command_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CdcEntry::~CdcEntry() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.CdcEntry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CdcEntry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.batch_.~RepeatedPtrField();
+  _impl_.operation_.Destroy();
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
+  _impl_.clientid_.Destroy();
+  _impl_.command_.Destroy();
+}
+
+void CdcEntry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CdcEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.CdcEntry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.batch_.Clear();
+  _impl_.operation_.ClearToEmpty();
+  _impl_.key_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
+  _impl_.clientid_.ClearToEmpty();
+  _impl_.command_.ClearToEmpty();
+  ::memset(&_impl_.index_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.requestid_) -
+      reinterpret_cast<char*>(&_impl_.index_)) + sizeof(_impl_.requestid_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CdcEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int64 Index = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 Term = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes Operation = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_operation();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes Key = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes Value = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes ClientId = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_clientid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 RequestId = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.requestid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 TimestampMs = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.timestampms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 TtlMs = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.ttlms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .raftKVRpcProctoc.WriteOp Batch = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_batch(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<82>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes Command = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          auto str = _internal_mutable_command();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CdcEntry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.CdcEntry)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int64 Index = 1;
+  if (this->_internal_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_index(), target);
+  }
+
+  // int64 Term = 2;
+  if (this->_internal_term() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_term(), target);
+  }
+
+  // bytes Operation = 3;
+  if (!this->_internal_operation().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_operation(), target);
+  }
+
+  // bytes Key = 4;
+  if (!this->_internal_key().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_key(), target);
+  }
+
+  // bytes Value = 5;
+  if (!this->_internal_value().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_value(), target);
+  }
+
+  // bytes ClientId = 6;
+  if (!this->_internal_clientid().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        6, this->_internal_clientid(), target);
+  }
+
+  // int32 RequestId = 7;
+  if (this->_internal_requestid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_requestid(), target);
+  }
+
+  // int64 TimestampMs = 8;
+  if (this->_internal_timestampms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(8, this->_internal_timestampms(), target);
+  }
+
+  // int64 TtlMs = 9;
+  if (this->_internal_ttlms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(9, this->_internal_ttlms(), target);
+  }
+
+  // repeated .raftKVRpcProctoc.WriteOp Batch = 10;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_batch_size()); i < n; i++) {
+    const auto& repfield = this->_internal_batch(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(10, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // bytes Command = 11;
+  if (!this->_internal_command().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        11, this->_internal_command(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.CdcEntry)
+  return target;
+}
+
+size_t CdcEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.CdcEntry)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .raftKVRpcProctoc.WriteOp Batch = 10;
+  total_size += 1UL * this->_internal_batch_size();
+  for (const auto& msg : this->_impl_.batch_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // bytes Operation = 3;
+  if (!this->_internal_operation().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_operation());
+  }
+
+  // bytes Key = 4;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_key());
+  }
+
+  // bytes Value = 5;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
+  }
+
+  // bytes ClientId = 6;
+  if (!this->_internal_clientid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_clientid());
+  }
+
+  // bytes Command = 11;
+  if (!this->_internal_command().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_command());
+  }
+
+  // int64 Index = 1;
+  if (this->_internal_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_index());
+  }
+
+  // int64 Term = 2;
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_term());
+  }
+
+  // int64 TimestampMs = 8;
+  if (this->_internal_timestampms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_timestampms());
+  }
+
+  // int64 TtlMs = 9;
+  if (this->_internal_ttlms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_ttlms());
+  }
+
+  // int32 RequestId = 7;
+  if (this->_internal_requestid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_requestid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CdcEntry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CdcEntry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CdcEntry::GetClassData() const { return &_class_data_; }
+
+
+void CdcEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CdcEntry*>(&to_msg);
+  auto& from = static_cast<const CdcEntry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.CdcEntry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.batch_.MergeFrom(from._impl_.batch_);
+  if (!from._internal_operation().empty()) {
+    _this->_internal_set_operation(from._internal_operation());
+  }
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  if (!from._internal_clientid().empty()) {
+    _this->_internal_set_clientid(from._internal_clientid());
+  }
+  if (!from._internal_command().empty()) {
+    _this->_internal_set_command(from._internal_command());
+  }
+  if (from._internal_index() != 0) {
+    _this->_internal_set_index(from._internal_index());
+  }
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
+  }
+  if (from._internal_timestampms() != 0) {
+    _this->_internal_set_timestampms(from._internal_timestampms());
+  }
+  if (from._internal_ttlms() != 0) {
+    _this->_internal_set_ttlms(from._internal_ttlms());
+  }
+  if (from._internal_requestid() != 0) {
+    _this->_internal_set_requestid(from._internal_requestid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CdcEntry::CopyFrom(const CdcEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.CdcEntry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CdcEntry::IsInitialized() const {
+  return true;
+}
+
+void CdcEntry::InternalSwap(CdcEntry* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.batch_.InternalSwap(&other->_impl_.batch_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.operation_, lhs_arena,
+      &other->_impl_.operation_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.clientid_, lhs_arena,
+      &other->_impl_.clientid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.command_, lhs_arena,
+      &other->_impl_.command_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CdcEntry, _impl_.requestid_)
+      + sizeof(CdcEntry::_impl_.requestid_)
+      - PROTOBUF_FIELD_OFFSET(CdcEntry, _impl_.index_)>(
+          reinterpret_cast<char*>(&_impl_.index_),
+          reinterpret_cast<char*>(&other->_impl_.index_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CdcEntry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[29]);
+}
+
+// ===================================================================
+
+class ExportLogArgs::_Internal {
+ public:
+};
+
+ExportLogArgs::ExportLogArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.ExportLogArgs)
+}
+ExportLogArgs::ExportLogArgs(const ExportLogArgs& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ExportLogArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.consumerid_){}
+    , decltype(_impl_.snapshotresumekey_){}
+    , decltype(_impl_.fromindex_){}
+    , decltype(_impl_.maxentries_){}
+    , decltype(_impl_.includereads_){}
+    , decltype(_impl_.snapshotindex_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.consumerid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.consumerid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_consumerid().empty()) {
+    _this->_impl_.consumerid_.Set(from._internal_consumerid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.snapshotresumekey_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.snapshotresumekey_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_snapshotresumekey().empty()) {
+    _this->_impl_.snapshotresumekey_.Set(from._internal_snapshotresumekey(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.fromindex_, &from._impl_.fromindex_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.snapshotindex_) -
+    reinterpret_cast<char*>(&_impl_.fromindex_)) + sizeof(_impl_.snapshotindex_));
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.ExportLogArgs)
+}
+
+inline void ExportLogArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.consumerid_){}
+    , decltype(_impl_.snapshotresumekey_){}
+    , decltype(_impl_.fromindex_){int64_t{0}}
+    , decltype(_impl_.maxentries_){0}
+    , decltype(_impl_.includereads_){false}
+    , decltype(_impl_.snapshotindex_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.consumerid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.consumerid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.snapshotresumekey_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.snapshotresumekey_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ExportLogArgs::~ExportLogArgs() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.ExportLogArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ExportLogArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.consumerid_.Destroy();
+  _impl_.snapshotresumekey_.Destroy();
+}
+
+void ExportLogArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ExportLogArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.ExportLogArgs)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.consumerid_.ClearToEmpty();
+  _impl_.snapshotresumekey_.ClearToEmpty();
+  ::memset(&_impl_.fromindex_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.snapshotindex_) -
+      reinterpret_cast<char*>(&_impl_.fromindex_)) + sizeof(_impl_.snapshotindex_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ExportLogArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes ConsumerId = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_consumerid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 FromIndex = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.fromindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 MaxEntries = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.maxentries_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool IncludeReads = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.includereads_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 SnapshotIndex = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.snapshotindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes SnapshotResumeKey = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_snapshotresumekey();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ExportLogArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.ExportLogArgs)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes ConsumerId = 1;
+  if (!this->_internal_consumerid().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_consumerid(), target);
+  }
+
+  // int64 FromIndex = 2;
+  if (this->_internal_fromindex() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_fromindex(), target);
+  }
+
+  // int32 MaxEntries = 3;
+  if (this->_internal_maxentries() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_maxentries(), target);
+  }
+
+  // bool IncludeReads = 4;
+  if (this->_internal_includereads() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_includereads(), target);
+  }
+
+  // int64 SnapshotIndex = 5;
+  if (this->_internal_snapshotindex() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_snapshotindex(), target);
+  }
+
+  // bytes SnapshotResumeKey = 6;
+  if (!this->_internal_snapshotresumekey().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        6, this->_internal_snapshotresumekey(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.ExportLogArgs)
+  return target;
+}
+
+size_t ExportLogArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.ExportLogArgs)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes ConsumerId = 1;
+  if (!this->_internal_consumerid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_consumerid());
+  }
+
+  // bytes SnapshotResumeKey = 6;
+  if (!this->_internal_snapshotresumekey().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_snapshotresumekey());
+  }
+
+  // int64 FromIndex = 2;
+  if (this->_internal_fromindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_fromindex());
+  }
+
+  // int32 MaxEntries = 3;
+  if (this->_internal_maxentries() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_maxentries());
+  }
+
+  // bool IncludeReads = 4;
+  if (this->_internal_includereads() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // int64 SnapshotIndex = 5;
+  if (this->_internal_snapshotindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_snapshotindex());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ExportLogArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ExportLogArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ExportLogArgs::GetClassData() const { return &_class_data_; }
+
+
+void ExportLogArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ExportLogArgs*>(&to_msg);
+  auto& from = static_cast<const ExportLogArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.ExportLogArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_consumerid().empty()) {
+    _this->_internal_set_consumerid(from._internal_consumerid());
+  }
+  if (!from._internal_snapshotresumekey().empty()) {
+    _this->_internal_set_snapshotresumekey(from._internal_snapshotresumekey());
+  }
+  if (from._internal_fromindex() != 0) {
+    _this->_internal_set_fromindex(from._internal_fromindex());
+  }
+  if (from._internal_maxentries() != 0) {
+    _this->_internal_set_maxentries(from._internal_maxentries());
+  }
+  if (from._internal_includereads() != 0) {
+    _this->_internal_set_includereads(from._internal_includereads());
+  }
+  if (from._internal_snapshotindex() != 0) {
+    _this->_internal_set_snapshotindex(from._internal_snapshotindex());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ExportLogArgs::CopyFrom(const ExportLogArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.ExportLogArgs)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ExportLogArgs::IsInitialized() const {
+  return true;
+}
+
+void ExportLogArgs::InternalSwap(ExportLogArgs* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.consumerid_, lhs_arena,
+      &other->_impl_.consumerid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.snapshotresumekey_, lhs_arena,
+      &other->_impl_.snapshotresumekey_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ExportLogArgs, _impl_.snapshotindex_)
+      + sizeof(ExportLogArgs::_impl_.snapshotindex_)
+      - PROTOBUF_FIELD_OFFSET(ExportLogArgs, _impl_.fromindex_)>(
+          reinterpret_cast<char*>(&_impl_.fromindex_),
+          reinterpret_cast<char*>(&other->_impl_.fromindex_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ExportLogArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[30]);
+}
+
+// ===================================================================
+
+class ExportLogReply::_Internal {
+ public:
+};
+
+ExportLogReply::ExportLogReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.ExportLogReply)
+}
+ExportLogReply::ExportLogReply(const ExportLogReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ExportLogReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){from._impl_.entries_}
+    , decltype(_impl_.snapshotkvs_){from._impl_.snapshotkvs_}
+    , decltype(_impl_.err_){}
+    , decltype(_impl_.snapshotresumekey_){}
+    , decltype(_impl_.nextindex_){}
+    , decltype(_impl_.snapshotindex_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_err().empty()) {
+    _this->_impl_.err_.Set(from._internal_err(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.snapshotresumekey_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.snapshotresumekey_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_snapshotresumekey().empty()) {
+    _this->_impl_.snapshotresumekey_.Set(from._internal_snapshotresumekey(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.nextindex_, &from._impl_.nextindex_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.snapshotindex_) -
+    reinterpret_cast<char*>(&_impl_.nextindex_)) + sizeof(_impl_.snapshotindex_));
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.ExportLogReply)
+}
+
+inline void ExportLogReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){arena}
+    , decltype(_impl_.snapshotkvs_){arena}
+    , decltype(_impl_.err_){}
+    , decltype(_impl_.snapshotresumekey_){}
+    , decltype(_impl_.nextindex_){int64_t{0}}
+    , decltype(_impl_.snapshotindex_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.snapshotresumekey_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.snapshotresumekey_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ExportLogReply::~ExportLogReply() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.ExportLogReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ExportLogReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entries_.~RepeatedPtrField();
+  _impl_.snapshotkvs_.~RepeatedPtrField();
+  _impl_.err_.Destroy();
+  _impl_.snapshotresumekey_.Destroy();
+}
+
+void ExportLogReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ExportLogReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.ExportLogReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.entries_.Clear();
+  _impl_.snapshotkvs_.Clear();
+  _impl_.err_.ClearToEmpty();
+  _impl_.snapshotresumekey_.ClearToEmpty();
+  ::memset(&_impl_.nextindex_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.snapshotindex_) -
+      reinterpret_cast<char*>(&_impl_.nextindex_)) + sizeof(_impl_.snapshotindex_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ExportLogReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes Err = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_err();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .raftKVRpcProctoc.CdcEntry Entries = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 NextIndex = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.nextindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 SnapshotIndex = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.snapshotindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .raftKVRpcProctoc.KeyValue SnapshotKvs = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_snapshotkvs(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes SnapshotResumeKey = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_snapshotresumekey();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ExportLogReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.ExportLogReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_err(), target);
+  }
+
+  // repeated .raftKVRpcProctoc.CdcEntry Entries = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_entries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // int64 NextIndex = 3;
+  if (this->_internal_nextindex() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_nextindex(), target);
+  }
+
+  // int64 SnapshotIndex = 4;
+  if (this->_internal_snapshotindex() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_snapshotindex(), target);
+  }
+
+  // repeated .raftKVRpcProctoc.KeyValue SnapshotKvs = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_snapshotkvs_size()); i < n; i++) {
+    const auto& repfield = this->_internal_snapshotkvs(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // bytes SnapshotResumeKey = 6;
+  if (!this->_internal_snapshotresumekey().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        6, this->_internal_snapshotresumekey(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.ExportLogReply)
+  return target;
+}
+
+size_t ExportLogReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.ExportLogReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .raftKVRpcProctoc.CdcEntry Entries = 2;
+  total_size += 1UL * this->_internal_entries_size();
+  for (const auto& msg : this->_impl_.entries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .raftKVRpcProctoc.KeyValue SnapshotKvs = 5;
+  total_size += 1UL * this->_internal_snapshotkvs_size();
+  for (const auto& msg : this->_impl_.snapshotkvs_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_err());
+  }
+
+  // bytes SnapshotResumeKey = 6;
+  if (!this->_internal_snapshotresumekey().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_snapshotresumekey());
+  }
+
+  // int64 NextIndex = 3;
+  if (this->_internal_nextindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_nextindex());
+  }
+
+  // int64 SnapshotIndex = 4;
+  if (this->_internal_snapshotindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_snapshotindex());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ExportLogReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ExportLogReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ExportLogReply::GetClassData() const { return &_class_data_; }
+
+
+void ExportLogReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ExportLogReply*>(&to_msg);
+  auto& from = static_cast<const ExportLogReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.ExportLogReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  _this->_impl_.snapshotkvs_.MergeFrom(from._impl_.snapshotkvs_);
+  if (!from._internal_err().empty()) {
+    _this->_internal_set_err(from._internal_err());
+  }
+  if (!from._internal_snapshotresumekey().empty()) {
+    _this->_internal_set_snapshotresumekey(from._internal_snapshotresumekey());
+  }
+  if (from._internal_nextindex() != 0) {
+    _this->_internal_set_nextindex(from._internal_nextindex());
+  }
+  if (from._internal_snapshotindex() != 0) {
+    _this->_internal_set_snapshotindex(from._internal_snapshotindex());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ExportLogReply::CopyFrom(const ExportLogReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.ExportLogReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ExportLogReply::IsInitialized() const {
+  return true;
+}
+
+void ExportLogReply::InternalSwap(ExportLogReply* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
+  _impl_.snapshotkvs_.InternalSwap(&other->_impl_.snapshotkvs_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.err_, lhs_arena,
+      &other->_impl_.err_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.snapshotresumekey_, lhs_arena,
+      &other->_impl_.snapshotresumekey_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ExportLogReply, _impl_.snapshotindex_)
+      + sizeof(ExportLogReply::_impl_.snapshotindex_)
+      - PROTOBUF_FIELD_OFFSET(ExportLogReply, _impl_.nextindex_)>(
+          reinterpret_cast<char*>(&_impl_.nextindex_),
+          reinterpret_cast<char*>(&other->_impl_.nextindex_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ExportLogReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[31]);
+}
+
+// ===================================================================
+
+class CommitCdcCheckpointArgs::_Internal {
+ public:
+};
+
+CommitCdcCheckpointArgs::CommitCdcCheckpointArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.CommitCdcCheckpointArgs)
+}
+CommitCdcCheckpointArgs::CommitCdcCheckpointArgs(const CommitCdcCheckpointArgs& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CommitCdcCheckpointArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.consumerid_){}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.index_){}
+    , decltype(_impl_.requestid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.consumerid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.consumerid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_consumerid().empty()) {
+    _this->_impl_.consumerid_.Set(from._internal_consumerid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.clientid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_clientid().empty()) {
+    _this->_impl_.clientid_.Set(from._internal_clientid(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.index_, &from._impl_.index_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.requestid_) -
+    reinterpret_cast<char*>(&_impl_.index_)) + sizeof(_impl_.requestid_));
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.CommitCdcCheckpointArgs)
+}
+
+inline void CommitCdcCheckpointArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.consumerid_){}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.index_){int64_t{0}}
+    , decltype(_impl_.requestid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.consumerid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.consumerid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.clientid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clientid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CommitCdcCheckpointArgs::~CommitCdcCheckpointArgs() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.CommitCdcCheckpointArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CommitCdcCheckpointArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.consumerid_.Destroy();
+  _impl_.clientid_.Destroy();
+}
+
+void CommitCdcCheckpointArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CommitCdcCheckpointArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.CommitCdcCheckpointArgs)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.consumerid_.ClearToEmpty();
+  _impl_.clientid_.ClearToEmpty();
+  ::memset(&_impl_.index_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.requestid_) -
+      reinterpret_cast<char*>(&_impl_.index_)) + sizeof(_impl_.requestid_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CommitCdcCheckpointArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes ConsumerId = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_consumerid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 Index = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes ClientId = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_clientid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 RequestId = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.requestid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CommitCdcCheckpointArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.CommitCdcCheckpointArgs)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes ConsumerId = 1;
+  if (!this->_internal_consumerid().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_consumerid(), target);
+  }
+
+  // int64 Index = 2;
+  if (this->_internal_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_index(), target);
+  }
+
+  // bytes ClientId = 3;
+  if (!this->_internal_clientid().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_clientid(), target);
+  }
+
+  // int32 RequestId = 4;
+  if (this->_internal_requestid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_requestid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.CommitCdcCheckpointArgs)
+  return target;
+}
+
+size_t CommitCdcCheckpointArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.CommitCdcCheckpointArgs)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes ConsumerId = 1;
+  if (!this->_internal_consumerid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_consumerid());
+  }
+
+  // bytes ClientId = 3;
+  if (!this->_internal_clientid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_clientid());
+  }
+
+  // int64 Index = 2;
+  if (this->_internal_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_index());
+  }
+
+  // int32 RequestId = 4;
+  if (this->_internal_requestid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_requestid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CommitCdcCheckpointArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CommitCdcCheckpointArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CommitCdcCheckpointArgs::GetClassData() const { return &_class_data_; }
+
+
+void CommitCdcCheckpointArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CommitCdcCheckpointArgs*>(&to_msg);
+  auto& from = static_cast<const CommitCdcCheckpointArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.CommitCdcCheckpointArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_consumerid().empty()) {
+    _this->_internal_set_consumerid(from._internal_consumerid());
+  }
+  if (!from._internal_clientid().empty()) {
+    _this->_internal_set_clientid(from._internal_clientid());
+  }
+  if (from._internal_index() != 0) {
+    _this->_internal_set_index(from._internal_index());
+  }
+  if (from._internal_requestid() != 0) {
+    _this->_internal_set_requestid(from._internal_requestid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CommitCdcCheckpointArgs::CopyFrom(const CommitCdcCheckpointArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.CommitCdcCheckpointArgs)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CommitCdcCheckpointArgs::IsInitialized() const {
+  return true;
+}
+
+void CommitCdcCheckpointArgs::InternalSwap(CommitCdcCheckpointArgs* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.consumerid_, lhs_arena,
+      &other->_impl_.consumerid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.clientid_, lhs_arena,
+      &other->_impl_.clientid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CommitCdcCheckpointArgs, _impl_.requestid_)
+      + sizeof(CommitCdcCheckpointArgs::_impl_.requestid_)
+      - PROTOBUF_FIELD_OFFSET(CommitCdcCheckpointArgs, _impl_.index_)>(
+          reinterpret_cast<char*>(&_impl_.index_),
+          reinterpret_cast<char*>(&other->_impl_.index_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CommitCdcCheckpointArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[32]);
+}
+
+// ===================================================================
+
+class CommitCdcCheckpointReply::_Internal {
+ public:
+};
+
+CommitCdcCheckpointReply::CommitCdcCheckpointReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.CommitCdcCheckpointReply)
+}
+CommitCdcCheckpointReply::CommitCdcCheckpointReply(const CommitCdcCheckpointReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CommitCdcCheckpointReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.err_){}
+    , decltype(_impl_.index_){}
+    , decltype(_impl_.retryafterms_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_err().empty()) {
+    _this->_impl_.err_.Set(from._internal_err(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.index_, &from._impl_.index_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.retryafterms_) -
+    reinterpret_cast<char*>(&_impl_.index_)) + sizeof(_impl_.retryafterms_));
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.CommitCdcCheckpointReply)
+}
+
+inline void CommitCdcCheckpointReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.err_){}
+    , decltype(_impl_.index_){int64_t{0}}
+    , decltype(_impl_.retryafterms_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CommitCdcCheckpointReply::~CommitCdcCheckpointReply() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.CommitCdcCheckpointReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CommitCdcCheckpointReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.err_.Destroy();
+}
+
+void CommitCdcCheckpointReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CommitCdcCheckpointReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.CommitCdcCheckpointReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.err_.ClearToEmpty();
+  ::memset(&_impl_.index_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.retryafterms_) -
+      reinterpret_cast<char*>(&_impl_.index_)) + sizeof(_impl_.retryafterms_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CommitCdcCheckpointReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes Err = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_err();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 Index = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 RetryAfterMs = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.retryafterms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CommitCdcCheckpointReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.CommitCdcCheckpointReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_err(), target);
+  }
+
+  // int64 Index = 2;
+  if (this->_internal_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_index(), target);
+  }
+
+  // int64 RetryAfterMs = 3;
+  if (this->_internal_retryafterms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_retryafterms(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.CommitCdcCheckpointReply)
+  return target;
+}
+
+size_t CommitCdcCheckpointReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.CommitCdcCheckpointReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_err());
+  }
+
+  // int64 Index = 2;
+  if (this->_internal_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_index());
+  }
+
+  // int64 RetryAfterMs = 3;
+  if (this->_internal_retryafterms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_retryafterms());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CommitCdcCheckpointReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CommitCdcCheckpointReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CommitCdcCheckpointReply::GetClassData() const { return &_class_data_; }
+
+
+void CommitCdcCheckpointReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CommitCdcCheckpointReply*>(&to_msg);
+  auto& from = static_cast<const CommitCdcCheckpointReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.CommitCdcCheckpointReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_err().empty()) {
+    _this->_internal_set_err(from._internal_err());
+  }
+  if (from._internal_index() != 0) {
+    _this->_internal_set_index(from._internal_index());
+  }
+  if (from._internal_retryafterms() != 0) {
+    _this->_internal_set_retryafterms(from._internal_retryafterms());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CommitCdcCheckpointReply::CopyFrom(const CommitCdcCheckpointReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.CommitCdcCheckpointReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CommitCdcCheckpointReply::IsInitialized() const {
+  return true;
+}
+
+void CommitCdcCheckpointReply::InternalSwap(CommitCdcCheckpointReply* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.err_, lhs_arena,
+      &other->_impl_.err_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CommitCdcCheckpointReply, _impl_.retryafterms_)
+      + sizeof(CommitCdcCheckpointReply::_impl_.retryafterms_)
+      - PROTOBUF_FIELD_OFFSET(CommitCdcCheckpointReply, _impl_.index_)>(
+          reinterpret_cast<char*>(&_impl_.index_),
+          reinterpret_cast<char*>(&other->_impl_.index_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CommitCdcCheckpointReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[33]);
+}
+
+// ===================================================================
+
+kvServerRpc::~kvServerRpc() {}
+
+const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* kvServerRpc::descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_kvServerRPC_2eproto);
+  return file_level_service_descriptors_kvServerRPC_2eproto[0];
+}
+
+const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* kvServerRpc::GetDescriptor() {
+  return descriptor();
+}
+
+void kvServerRpc::PutAppend(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::raftKVRpcProctoc::PutAppendArgs*,
+                         ::raftKVRpcProctoc::PutAppendReply*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method PutAppend() not implemented.");
+  done->Run();
+}
+
+void kvServerRpc::Get(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::raftKVRpcProctoc::GetArgs*,
+                         ::raftKVRpcProctoc::GetReply*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method Get() not implemented.");
+  done->Run();
+}
+
+void kvServerRpc::Scan(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::raftKVRpcProctoc::ScanArgs*,
+                         ::raftKVRpcProctoc::ScanReply*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method Scan() not implemented.");
+  done->Run();
+}
+
+void kvServerRpc::PrefixScan(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::raftKVRpcProctoc::PrefixScanArgs*,
+                         ::raftKVRpcProctoc::ScanReply*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method PrefixScan() not implemented.");
+  done->Run();
+}
+
+void kvServerRpc::MultiGet(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::raftKVRpcProctoc::MultiGetArgs*,
+                         ::raftKVRpcProctoc::MultiGetReply*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method MultiGet() not implemented.");
+  done->Run();
+}
+
+void kvServerRpc::BatchWrite(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::raftKVRpcProctoc::BatchWriteArgs*,
+                         ::raftKVRpcProctoc::BatchWriteReply*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method BatchWrite() not implemented.");
+  done->Run();
+}
+
+void kvServerRpc::Txn(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::raftKVRpcProctoc::TxnArgs*,
+                         ::raftKVRpcProctoc::TxnReply*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method Txn() not implemented.");
+  done->Run();
+}
+
+void kvServerRpc::Delete(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::raftKVRpcProctoc::DeleteArgs*,
+                         ::raftKVRpcProctoc::DeleteReply*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method Delete() not implemented.");
+  done->Run();
+}
+
+void kvServerRpc::DeleteRange(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::raftKVRpcProctoc::DeleteRangeArgs*,
+                         ::raftKVRpcProctoc::DeleteReply*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method DeleteRange() not implemented.");
+  done->Run();
+}
+
+void kvServerRpc::Watch(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::raftKVRpcProctoc::WatchArgs*,
+                         ::raftKVRpcProctoc::WatchReply*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method Watch() not implemented.");
+  done->Run();
+}
+
+void kvServerRpc::CancelWatch(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::raftKVRpcProctoc::CancelWatchArgs*,
+                         ::raftKVRpcProctoc::CancelWatchReply*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method CancelWatch() not implemented.");
+  done->Run();
+}
+
+void kvServerRpc::RegisterSession(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::raftKVRpcProctoc::RegisterSessionArgs*,
+                         ::raftKVRpcProctoc::RegisterSessionReply*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method RegisterSession() not implemented.");
+  done->Run();
+}
+
+void kvServerRpc::ExportLog(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::raftKVRpcProctoc::ExportLogArgs*,
+                         ::raftKVRpcProctoc::ExportLogReply*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method ExportLog() not implemented.");
+  done->Run();
+}
+
+void kvServerRpc::CommitCdcCheckpoint(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::raftKVRpcProctoc::CommitCdcCheckpointArgs*,
+                         ::raftKVRpcProctoc::CommitCdcCheckpointReply*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method CommitCdcCheckpoint() not implemented.");
+  done->Run();
+}
+
+void kvServerRpc::CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
+                             ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                             const ::PROTOBUF_NAMESPACE_ID::Message* request,
+                             ::PROTOBUF_NAMESPACE_ID::Message* response,
+                             ::google::protobuf::Closure* done) {
+  GOOGLE_DCHECK_EQ(method->service(), file_level_service_descriptors_kvServerRPC_2eproto[0]);
+  switch(method->index()) {
+    case 0:
+      PutAppend(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftKVRpcProctoc::PutAppendArgs*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftKVRpcProctoc::PutAppendReply*>(
+                 response),
+             done);
+      break;
+    case 1:
+      Get(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftKVRpcProctoc::GetArgs*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftKVRpcProctoc::GetReply*>(
+                 response),
+             done);
+      break;
+    case 2:
+      Scan(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftKVRpcProctoc::ScanArgs*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftKVRpcProctoc::ScanReply*>(
+                 response),
+             done);
+      break;
+    case 3:
+      PrefixScan(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftKVRpcProctoc::PrefixScanArgs*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftKVRpcProctoc::ScanReply*>(
+                 response),
+             done);
+      break;
+    case 4:
+      MultiGet(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftKVRpcProctoc::MultiGetArgs*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftKVRpcProctoc::MultiGetReply*>(
+                 response),
+             done);
+      break;
+    case 5:
+      BatchWrite(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftKVRpcProctoc::BatchWriteArgs*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftKVRpcProctoc::BatchWriteReply*>(
+                 response),
+             done);
+      break;
+    case 6:
+      Txn(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftKVRpcProctoc::TxnArgs*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftKVRpcProctoc::TxnReply*>(
+                 response),
+             done);
+      break;
+    case 7:
+      Delete(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftKVRpcProctoc::DeleteArgs*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftKVRpcProctoc::DeleteReply*>(
+                 response),
+             done);
+      break;
+    case 8:
+      DeleteRange(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftKVRpcProctoc::DeleteRangeArgs*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftKVRpcProctoc::DeleteReply*>(
+                 response),
+             done);
+      break;
+    case 9:
+      Watch(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftKVRpcProctoc::WatchArgs*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftKVRpcProctoc::WatchReply*>(
+                 response),
+             done);
+      break;
+    case 10:
+      CancelWatch(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftKVRpcProctoc::CancelWatchArgs*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftKVRpcProctoc::CancelWatchReply*>(
+                 response),
+             done);
+      break;
+    case 11:
+      RegisterSession(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftKVRpcProctoc::RegisterSessionArgs*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftKVRpcProctoc::RegisterSessionReply*>(
+                 response),
+             done);
+      break;
+    case 12:
+      ExportLog(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftKVRpcProctoc::ExportLogArgs*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftKVRpcProctoc::ExportLogReply*>(
+                 response),
+             done);
+      break;
+    case 13:
+      CommitCdcCheckpoint(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftKVRpcProctoc::CommitCdcCheckpointArgs*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftKVRpcProctoc::CommitCdcCheckpointReply*>(
+                 response),
+             done);
+      break;
+    default:
+      GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
+      break;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message& kvServerRpc::GetRequestPrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const {
+  GOOGLE_DCHECK_EQ(method->service(), descriptor());
+  switch(method->index()) {
+    case 0:
+      return ::raftKVRpcProctoc::PutAppendArgs::default_instance();
+    case 1:
+      return ::raftKVRpcProctoc::GetArgs::default_instance();
+    case 2:
+      return ::raftKVRpcProctoc::ScanArgs::default_instance();
+    case 3:
+      return ::raftKVRpcProctoc::PrefixScanArgs::default_instance();
+    case 4:
+      return ::raftKVRpcProctoc::MultiGetArgs::default_instance();
+    case 5:
+      return ::raftKVRpcProctoc::BatchWriteArgs::default_instance();
+    case 6:
+      return ::raftKVRpcProctoc::TxnArgs::default_instance();
+    case 7:
+      return ::raftKVRpcProctoc::DeleteArgs::default_instance();
+    case 8:
+      return ::raftKVRpcProctoc::DeleteRangeArgs::default_instance();
+    case 9:
+      return ::raftKVRpcProctoc::WatchArgs::default_instance();
+    case 10:
+      return ::raftKVRpcProctoc::CancelWatchArgs::default_instance();
+    case 11:
+      return ::raftKVRpcProctoc::RegisterSessionArgs::default_instance();
+    case 12:
+      return ::raftKVRpcProctoc::ExportLogArgs::default_instance();
+    case 13:
+      return ::raftKVRpcProctoc::CommitCdcCheckpointArgs::default_instance();
+    default:
+      GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
+      return *::PROTOBUF_NAMESPACE_ID::MessageFactory::generated_factory()
+          ->GetPrototype(method->input_type());
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message& kvServerRpc::GetResponsePrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const {
+  GOOGLE_DCHECK_EQ(method->service(), descriptor());
+  switch(method->index()) {
+    case 0:
+      return ::raftKVRpcProctoc::PutAppendReply::default_instance();
+    case 1:
+      return ::raftKVRpcProctoc::GetReply::default_instance();
+    case 2:
+      return ::raftKVRpcProctoc::ScanReply::default_instance();
+    case 3:
+      return ::raftKVRpcProctoc::ScanReply::default_instance();
+    case 4:
+      return ::raftKVRpcProctoc::MultiGetReply::default_instance();
+    case 5:
+      return ::raftKVRpcProctoc::BatchWriteReply::default_instance();
+    case 6:
+      return ::raftKVRpcProctoc::TxnReply::default_instance();
+    case 7:
+      return ::raftKVRpcProctoc::DeleteReply::default_instance();
+    case 8:
+      return ::raftKVRpcProctoc::DeleteReply::default_instance();
+    case 9:
+      return ::raftKVRpcProctoc::WatchReply::default_instance();
+    case 10:
+      return ::raftKVRpcProctoc::CancelWatchReply::default_instance();
+    case 11:
+      return ::raftKVRpcProctoc::RegisterSessionReply::default_instance();
+    case 12:
+      return ::raftKVRpcProctoc::ExportLogReply::default_instance();
+    case 13:
+      return ::raftKVRpcProctoc::CommitCdcCheckpointReply::default_instance();
+    default:
+      GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
+      return *::PROTOBUF_NAMESPACE_ID::MessageFactory::generated_factory()
+          ->GetPrototype(method->output_type());
+  }
+}
+
+kvServerRpc_Stub::kvServerRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel)
+  : channel_(channel), owns_channel_(false) {}
+kvServerRpc_Stub::kvServerRpc_Stub(
+    ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel,
+    ::PROTOBUF_NAMESPACE_ID::Service::ChannelOwnership ownership)
+  : channel_(channel),
+    owns_channel_(ownership == ::PROTOBUF_NAMESPACE_ID::Service::STUB_OWNS_CHANNEL) {}
+kvServerRpc_Stub::~kvServerRpc_Stub() {
+  if (owns_channel_) delete channel_;
+}
+
+void kvServerRpc_Stub::PutAppend(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::raftKVRpcProctoc::PutAppendArgs* request,
+                              ::raftKVRpcProctoc::PutAppendReply* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(0),
+                       controller, request, response, done);
+}
+void kvServerRpc_Stub::Get(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::raftKVRpcProctoc::GetArgs* request,
+                              ::raftKVRpcProctoc::GetReply* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(1),
+                       controller, request, response, done);
+}
+void kvServerRpc_Stub::Scan(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::raftKVRpcProctoc::ScanArgs* request,
+                              ::raftKVRpcProctoc::ScanReply* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(2),
+                       controller, request, response, done);
+}
+void kvServerRpc_Stub::PrefixScan(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::raftKVRpcProctoc::PrefixScanArgs* request,
+                              ::raftKVRpcProctoc::ScanReply* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(3),
+                       controller, request, response, done);
+}
+void kvServerRpc_Stub::MultiGet(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::raftKVRpcProctoc::MultiGetArgs* request,
+                              ::raftKVRpcProctoc::MultiGetReply* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(4),
+                       controller, request, response, done);
+}
+void kvServerRpc_Stub::BatchWrite(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::raftKVRpcProctoc::BatchWriteArgs* request,
+                              ::raftKVRpcProctoc::BatchWriteReply* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(5),
+                       controller, request, response, done);
+}
+void kvServerRpc_Stub::Txn(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::raftKVRpcProctoc::TxnArgs* request,
+                              ::raftKVRpcProctoc::TxnReply* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(6),
+                       controller, request, response, done);
+}
+void kvServerRpc_Stub::Delete(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::raftKVRpcProctoc::DeleteArgs* request,
+                              ::raftKVRpcProctoc::DeleteReply* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(7),
+                       controller, request, response, done);
+}
+void kvServerRpc_Stub::DeleteRange(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::raftKVRpcProctoc::DeleteRangeArgs* request,
+                              ::raftKVRpcProctoc::DeleteReply* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(8),
+                       controller, request, response, done);
+}
+void kvServerRpc_Stub::Watch(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::raftKVRpcProctoc::WatchArgs* request,
+                              ::raftKVRpcProctoc::WatchReply* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(9),
+                       controller, request, response, done);
+}
+void kvServerRpc_Stub::CancelWatch(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::raftKVRpcProctoc::CancelWatchArgs* request,
+                              ::raftKVRpcProctoc::CancelWatchReply* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(10),
+                       controller, request, response, done);
+}
+void kvServerRpc_Stub::RegisterSession(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::raftKVRpcProctoc::RegisterSessionArgs* request,
+                              ::raftKVRpcProctoc::RegisterSessionReply* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(11),
+                       controller, request, response, done);
+}
+void kvServerRpc_Stub::ExportLog(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::raftKVRpcProctoc::ExportLogArgs* request,
+                              ::raftKVRpcProctoc::ExportLogReply* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(12),
+                       controller, request, response, done);
+}
+void kvServerRpc_Stub::CommitCdcCheckpoint(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::raftKVRpcProctoc::CommitCdcCheckpointArgs* request,
+                              ::raftKVRpcProctoc::CommitCdcCheckpointReply* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(13),
+                       controller, request, response, done);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace raftKVRpcProctoc
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::GetArgs*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::GetArgs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::GetArgs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::GetReply*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::GetReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::GetReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::PutAppendArgs*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::PutAppendArgs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::PutAppendArgs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::PutAppendReply*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::PutAppendReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::PutAppendReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::ScanArgs*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::ScanArgs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::ScanArgs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::PrefixScanArgs*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::PrefixScanArgs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::PrefixScanArgs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::KeyValue*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::KeyValue >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::KeyValue >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::ScanReply*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::ScanReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::ScanReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::MultiGetArgs*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::MultiGetArgs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::MultiGetArgs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::GetResult*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::GetResult >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::GetResult >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::MultiGetReply*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::MultiGetReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::MultiGetReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::WriteOp*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::WriteOp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::WriteOp >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::BatchWriteArgs*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::BatchWriteArgs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::BatchWriteArgs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::BatchWriteReply*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::BatchWriteReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::BatchWriteReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::TxnCompare*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::TxnCompare >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::TxnCompare >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::TxnOp*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::TxnOp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::TxnOp >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::TxnArgs*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::TxnArgs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::TxnArgs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::TxnOpResult*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::TxnOpResult >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::TxnOpResult >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::TxnReply*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::TxnReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::TxnReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::DeleteArgs*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::DeleteArgs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::DeleteArgs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::DeleteRangeArgs*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::DeleteRangeArgs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::DeleteRangeArgs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::DeleteReply*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::DeleteReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::DeleteReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::WatchEvent*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::WatchEvent >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::WatchEvent >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::WatchArgs*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::WatchArgs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::WatchArgs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::WatchReply*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::WatchReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::WatchReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::CancelWatchArgs*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::CancelWatchArgs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::CancelWatchArgs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::CancelWatchReply*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::CancelWatchReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::CancelWatchReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::RegisterSessionArgs*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::RegisterSessionArgs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::RegisterSessionArgs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::RegisterSessionReply*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::RegisterSessionReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::RegisterSessionReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::CdcEntry*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::CdcEntry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::CdcEntry >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::ExportLogArgs*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::ExportLogArgs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::ExportLogArgs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::ExportLogReply*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::ExportLogReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::ExportLogReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::CommitCdcCheckpointArgs*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::CommitCdcCheckpointArgs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::CommitCdcCheckpointArgs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::CommitCdcCheckpointReply*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::CommitCdcCheckpointReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::CommitCdcCheckpointReply >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
-#include <google/protobuf/port_undef.inc>
\ No newline at end of file
+#include <google/protobuf/port_undef.inc>
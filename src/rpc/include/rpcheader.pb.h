@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3012000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3012004 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,9 +23,7 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
@@ -43,20 +41,12 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_rpcheader_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[1]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_rpcheader_2eproto;
 namespace RPC {
 class RpcHeader;
-class RpcHeaderDefaultTypeInternal;
+struct RpcHeaderDefaultTypeInternal;
 extern RpcHeaderDefaultTypeInternal _RpcHeader_default_instance_;
 }  // namespace RPC
 PROTOBUF_NAMESPACE_OPEN
@@ -66,11 +56,12 @@ namespace RPC {
 
 // ===================================================================
 
-class RpcHeader PROTOBUF_FINAL :
+class RpcHeader final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RPC.RpcHeader) */ {
  public:
-  inline RpcHeader() : RpcHeader(nullptr) {};
-  virtual ~RpcHeader();
+  inline RpcHeader() : RpcHeader(nullptr) {}
+  ~RpcHeader() override;
+  explicit PROTOBUF_CONSTEXPR RpcHeader(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RpcHeader(const RpcHeader& from);
   RpcHeader(RpcHeader&& from) noexcept
@@ -83,8 +74,13 @@ class RpcHeader PROTOBUF_FINAL :
     return *this;
   }
   inline RpcHeader& operator=(RpcHeader&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -95,14 +91,14 @@ class RpcHeader PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RpcHeader& default_instance() {
+    return *internal_default_instance();
   }
-  static const RpcHeader& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const RpcHeader* internal_default_instance() {
     return reinterpret_cast<const RpcHeader*>(
                &_RpcHeader_default_instance_);
@@ -115,7 +111,12 @@ class RpcHeader PROTOBUF_FINAL :
   }
   inline void Swap(RpcHeader* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -123,56 +124,53 @@ class RpcHeader PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(RpcHeader* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline RpcHeader* New() const final {
-    return CreateMaybeMessage<RpcHeader>(nullptr);
-  }
-
-  RpcHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  RpcHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RpcHeader>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RpcHeader& from);
-  void MergeFrom(const RpcHeader& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RpcHeader& from) {
+    RpcHeader::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RpcHeader* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "RPC.RpcHeader";
   }
   protected:
-  explicit RpcHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit RpcHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_rpcheader_2eproto);
-    return ::descriptor_table_rpcheader_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -182,64 +180,72 @@ class RpcHeader PROTOBUF_FINAL :
     kServiceNameFieldNumber = 1,
     kMethodNameFieldNumber = 2,
     kArgsSizeFieldNumber = 3,
+    kCompressedFieldNumber = 4,
+    kOriginalSizeFieldNumber = 5,
+    kCompressionTypeFieldNumber = 6,
   };
   // bytes service_name = 1;
   void clear_service_name();
   const std::string& service_name() const;
-  void set_service_name(const std::string& value);
-  void set_service_name(std::string&& value);
-  void set_service_name(const char* value);
-  void set_service_name(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_service_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_service_name();
-  std::string* release_service_name();
+  PROTOBUF_NODISCARD std::string* release_service_name();
   void set_allocated_service_name(std::string* service_name);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_service_name();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_service_name(
-      std::string* service_name);
   private:
   const std::string& _internal_service_name() const;
-  void _internal_set_service_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_service_name(const std::string& value);
   std::string* _internal_mutable_service_name();
   public:
 
   // bytes method_name = 2;
   void clear_method_name();
   const std::string& method_name() const;
-  void set_method_name(const std::string& value);
-  void set_method_name(std::string&& value);
-  void set_method_name(const char* value);
-  void set_method_name(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_method_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_method_name();
-  std::string* release_method_name();
+  PROTOBUF_NODISCARD std::string* release_method_name();
   void set_allocated_method_name(std::string* method_name);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_method_name();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_method_name(
-      std::string* method_name);
   private:
   const std::string& _internal_method_name() const;
-  void _internal_set_method_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_method_name(const std::string& value);
   std::string* _internal_mutable_method_name();
   public:
 
   // uint32 args_size = 3;
   void clear_args_size();
-  ::PROTOBUF_NAMESPACE_ID::uint32 args_size() const;
-  void set_args_size(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t args_size() const;
+  void set_args_size(uint32_t value);
+  private:
+  uint32_t _internal_args_size() const;
+  void _internal_set_args_size(uint32_t value);
+  public:
+
+  // bool compressed = 4;
+  void clear_compressed();
+  bool compressed() const;
+  void set_compressed(bool value);
+  private:
+  bool _internal_compressed() const;
+  void _internal_set_compressed(bool value);
+  public:
+
+  // uint32 original_size = 5;
+  void clear_original_size();
+  uint32_t original_size() const;
+  void set_original_size(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_args_size() const;
-  void _internal_set_args_size(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_original_size() const;
+  void _internal_set_original_size(uint32_t value);
+  public:
+
+  // uint32 compression_type = 6;
+  void clear_compression_type();
+  uint32_t compression_type() const;
+  void set_compression_type(uint32_t value);
+  private:
+  uint32_t _internal_compression_type() const;
+  void _internal_set_compression_type(uint32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:RPC.RpcHeader)
@@ -249,10 +255,16 @@ class RpcHeader PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr method_name_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 args_size_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr method_name_;
+    uint32_t args_size_;
+    bool compressed_;
+    uint32_t original_size_;
+    uint32_t compression_type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_rpcheader_2eproto;
 };
 // ===================================================================
@@ -268,186 +280,184 @@ class RpcHeader PROTOBUF_FINAL :
 
 // bytes service_name = 1;
 inline void RpcHeader::clear_service_name() {
-  service_name_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.service_name_.ClearToEmpty();
 }
 inline const std::string& RpcHeader::service_name() const {
   // @@protoc_insertion_point(field_get:RPC.RpcHeader.service_name)
   return _internal_service_name();
 }
-inline void RpcHeader::set_service_name(const std::string& value) {
-  _internal_set_service_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RpcHeader::set_service_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.service_name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:RPC.RpcHeader.service_name)
 }
 inline std::string* RpcHeader::mutable_service_name() {
+  std::string* _s = _internal_mutable_service_name();
   // @@protoc_insertion_point(field_mutable:RPC.RpcHeader.service_name)
-  return _internal_mutable_service_name();
+  return _s;
 }
 inline const std::string& RpcHeader::_internal_service_name() const {
-  return service_name_.Get();
+  return _impl_.service_name_.Get();
 }
 inline void RpcHeader::_internal_set_service_name(const std::string& value) {
-
-  service_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void RpcHeader::set_service_name(std::string&& value) {
-
-  service_name_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:RPC.RpcHeader.service_name)
-}
-inline void RpcHeader::set_service_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-
-  service_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:RPC.RpcHeader.service_name)
-}
-inline void RpcHeader::set_service_name(const void* value,
-    size_t size) {
-
-  service_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:RPC.RpcHeader.service_name)
+  
+  _impl_.service_name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* RpcHeader::_internal_mutable_service_name() {
-
-  return service_name_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  
+  return _impl_.service_name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* RpcHeader::release_service_name() {
   // @@protoc_insertion_point(field_release:RPC.RpcHeader.service_name)
-  return service_name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.service_name_.Release();
 }
 inline void RpcHeader::set_allocated_service_name(std::string* service_name) {
   if (service_name != nullptr) {
-
+    
   } else {
-
+    
   }
-  service_name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), service_name,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:RPC.RpcHeader.service_name)
-}
-inline std::string* RpcHeader::unsafe_arena_release_service_name() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:RPC.RpcHeader.service_name)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-
-  return service_name_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void RpcHeader::unsafe_arena_set_allocated_service_name(
-    std::string* service_name) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (service_name != nullptr) {
-
-  } else {
-
+  _impl_.service_name_.SetAllocated(service_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_name_.IsDefault()) {
+    _impl_.service_name_.Set("", GetArenaForAllocation());
   }
-  service_name_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      service_name, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RPC.RpcHeader.service_name)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RPC.RpcHeader.service_name)
 }
 
 // bytes method_name = 2;
 inline void RpcHeader::clear_method_name() {
-  method_name_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.method_name_.ClearToEmpty();
 }
 inline const std::string& RpcHeader::method_name() const {
   // @@protoc_insertion_point(field_get:RPC.RpcHeader.method_name)
   return _internal_method_name();
 }
-inline void RpcHeader::set_method_name(const std::string& value) {
-  _internal_set_method_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RpcHeader::set_method_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.method_name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:RPC.RpcHeader.method_name)
 }
 inline std::string* RpcHeader::mutable_method_name() {
+  std::string* _s = _internal_mutable_method_name();
   // @@protoc_insertion_point(field_mutable:RPC.RpcHeader.method_name)
-  return _internal_mutable_method_name();
+  return _s;
 }
 inline const std::string& RpcHeader::_internal_method_name() const {
-  return method_name_.Get();
+  return _impl_.method_name_.Get();
 }
 inline void RpcHeader::_internal_set_method_name(const std::string& value) {
-
-  method_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void RpcHeader::set_method_name(std::string&& value) {
-
-  method_name_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:RPC.RpcHeader.method_name)
-}
-inline void RpcHeader::set_method_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-
-  method_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:RPC.RpcHeader.method_name)
-}
-inline void RpcHeader::set_method_name(const void* value,
-    size_t size) {
-
-  method_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:RPC.RpcHeader.method_name)
+  
+  _impl_.method_name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* RpcHeader::_internal_mutable_method_name() {
-
-  return method_name_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  
+  return _impl_.method_name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* RpcHeader::release_method_name() {
   // @@protoc_insertion_point(field_release:RPC.RpcHeader.method_name)
-  return method_name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.method_name_.Release();
 }
 inline void RpcHeader::set_allocated_method_name(std::string* method_name) {
   if (method_name != nullptr) {
-
+    
   } else {
-
+    
   }
-  method_name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), method_name,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:RPC.RpcHeader.method_name)
-}
-inline std::string* RpcHeader::unsafe_arena_release_method_name() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:RPC.RpcHeader.method_name)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-
-  return method_name_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void RpcHeader::unsafe_arena_set_allocated_method_name(
-    std::string* method_name) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (method_name != nullptr) {
-
-  } else {
-
+  _impl_.method_name_.SetAllocated(method_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.method_name_.IsDefault()) {
+    _impl_.method_name_.Set("", GetArenaForAllocation());
   }
-  method_name_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      method_name, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RPC.RpcHeader.method_name)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RPC.RpcHeader.method_name)
 }
 
 // uint32 args_size = 3;
 inline void RpcHeader::clear_args_size() {
-  args_size_ = 0u;
+  _impl_.args_size_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 RpcHeader::_internal_args_size() const {
-  return args_size_;
+inline uint32_t RpcHeader::_internal_args_size() const {
+  return _impl_.args_size_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 RpcHeader::args_size() const {
+inline uint32_t RpcHeader::args_size() const {
   // @@protoc_insertion_point(field_get:RPC.RpcHeader.args_size)
   return _internal_args_size();
 }
-inline void RpcHeader::_internal_set_args_size(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-
-  args_size_ = value;
+inline void RpcHeader::_internal_set_args_size(uint32_t value) {
+  
+  _impl_.args_size_ = value;
 }
-inline void RpcHeader::set_args_size(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void RpcHeader::set_args_size(uint32_t value) {
   _internal_set_args_size(value);
   // @@protoc_insertion_point(field_set:RPC.RpcHeader.args_size)
 }
 
+// bool compressed = 4;
+inline void RpcHeader::clear_compressed() {
+  _impl_.compressed_ = false;
+}
+inline bool RpcHeader::_internal_compressed() const {
+  return _impl_.compressed_;
+}
+inline bool RpcHeader::compressed() const {
+  // @@protoc_insertion_point(field_get:RPC.RpcHeader.compressed)
+  return _internal_compressed();
+}
+inline void RpcHeader::_internal_set_compressed(bool value) {
+  
+  _impl_.compressed_ = value;
+}
+inline void RpcHeader::set_compressed(bool value) {
+  _internal_set_compressed(value);
+  // @@protoc_insertion_point(field_set:RPC.RpcHeader.compressed)
+}
+
+// uint32 original_size = 5;
+inline void RpcHeader::clear_original_size() {
+  _impl_.original_size_ = 0u;
+}
+inline uint32_t RpcHeader::_internal_original_size() const {
+  return _impl_.original_size_;
+}
+inline uint32_t RpcHeader::original_size() const {
+  // @@protoc_insertion_point(field_get:RPC.RpcHeader.original_size)
+  return _internal_original_size();
+}
+inline void RpcHeader::_internal_set_original_size(uint32_t value) {
+  
+  _impl_.original_size_ = value;
+}
+inline void RpcHeader::set_original_size(uint32_t value) {
+  _internal_set_original_size(value);
+  // @@protoc_insertion_point(field_set:RPC.RpcHeader.original_size)
+}
+
+// uint32 compression_type = 6;
+inline void RpcHeader::clear_compression_type() {
+  _impl_.compression_type_ = 0u;
+}
+inline uint32_t RpcHeader::_internal_compression_type() const {
+  return _impl_.compression_type_;
+}
+inline uint32_t RpcHeader::compression_type() const {
+  // @@protoc_insertion_point(field_get:RPC.RpcHeader.compression_type)
+  return _internal_compression_type();
+}
+inline void RpcHeader::_internal_set_compression_type(uint32_t value) {
+  
+  _impl_.compression_type_ = value;
+}
+inline void RpcHeader::set_compression_type(uint32_t value) {
+  _internal_set_compression_type(value);
+  // @@protoc_insertion_point(field_set:RPC.RpcHeader.compression_type)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -459,4 +469,4 @@ inline void RpcHeader::set_args_size(::PROTOBUF_NAMESPACE_ID::uint32 value) {
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>
-#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_rpcheader_2eproto
\ No newline at end of file
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_rpcheader_2eproto
@@ -0,0 +1,121 @@
+#ifndef CHUNKED_VALUE_H
+#define CHUNKED_VALUE_H
+
+#include <boost/serialization/level.hpp>
+#include <boost/serialization/split_member.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/tracking.hpp>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief 分块存储的 value（简化的 rope）
+ *
+ * value 由若干块组成，Append 只分配/写入新增的字节，不再复制整个旧值：
+ * - 小段追加先填进最后一块（不超过 kChunkBytes 时；该块被其他副本共享时先复制这一块），
+ *   否则新开一块；大段追加直接成为独立的一块。
+ * - 块通过 shared_ptr 共享，拷贝一个 ChunkedValue 只复制块指针，
+ *   读请求可以在锁内拿一份拷贝，锁外再把各块拼到回复里。
+ *
+ * 序列化格式与 std::string 完全相同，快照和按 std::string 存储的引擎互通。
+ */
+class ChunkedValue {
+ public:
+  static constexpr size_t kChunkBytes = 4096;
+
+  ChunkedValue() = default;
+  ChunkedValue(std::string value) { Assign(std::move(value)); }  // NOLINT: 允许从 std::string 隐式构造
+
+  void Assign(std::string value) {
+    m_chunks.clear();
+    m_size = value.size();
+    if (!value.empty()) {
+      m_chunks.push_back(std::make_shared<std::string>(std::move(value)));
+    }
+  }
+
+  void Append(const std::string &tail) {
+    if (tail.empty()) {
+      return;
+    }
+    m_size += tail.size();
+    if (!m_chunks.empty() && m_chunks.back()->size() + tail.size() <= kChunkBytes) {
+      // use_count()==1 说明最后一块只属于自己，原地写不会影响已经拿走拷贝的读者；
+      // 否则复制这一块（不超过 kChunkBytes）再写，避免小追加堆出大量碎块
+      if (m_chunks.back().use_count() != 1) {
+        auto copy = std::make_shared<std::string>();
+        copy->reserve(kChunkBytes);
+        copy->append(*m_chunks.back());
+        m_chunks.back() = std::move(copy);
+      }
+      m_chunks.back()->append(tail);
+      return;
+    }
+    auto chunk = std::make_shared<std::string>();
+    if (tail.size() < kChunkBytes) {
+      chunk->reserve(kChunkBytes);
+    }
+    chunk->append(tail);
+    m_chunks.push_back(std::move(chunk));
+  }
+
+  size_t size() const { return m_size; }
+  bool empty() const { return m_size == 0; }
+  size_t ChunkCount() const { return m_chunks.size(); }
+
+  /**
+   * @brief 把所有块依次追加到 out 末尾，只分配一次
+   */
+  void AppendTo(std::string *out) const {
+    out->reserve(out->size() + m_size);
+    for (const auto &chunk : m_chunks) {
+      out->append(*chunk);
+    }
+  }
+
+  std::string ToString() const {
+    std::string out;
+    AppendTo(&out);
+    return out;
+  }
+
+  friend std::ostream &operator<<(std::ostream &os, const ChunkedValue &value) {
+    for (const auto &chunk : value.m_chunks) {
+      os << *chunk;
+    }
+    return os;
+  }
+
+ private:
+  friend class boost::serialization::access;
+
+  template <class Archive>
+  void save(Archive &ar, const unsigned int version) const {
+    std::string flat = ToString();
+    ar << flat;
+  }
+
+  template <class Archive>
+  void load(Archive &ar, const unsigned int version) {
+    std::string flat;
+    ar >> flat;
+    Assign(std::move(flat));
+  }
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER()
+
+  std::vector<std::shared_ptr<std::string>> m_chunks;
+  size_t m_size = 0;
+};
+
+// 不写类型/版本信息，保证归档内容和 std::string 一样；
+// vector<ChunkedValue> 同理，使 SkipListDump<std::string, ChunkedValue> 与 <std::string, std::string> 格式一致
+BOOST_CLASS_IMPLEMENTATION(ChunkedValue, boost::serialization::object_serializable)
+BOOST_CLASS_TRACKING(ChunkedValue, boost::serialization::track_never)
+BOOST_CLASS_IMPLEMENTATION(std::vector<ChunkedValue>, boost::serialization::object_serializable)
+BOOST_CLASS_TRACKING(std::vector<ChunkedValue>, boost::serialization::track_never)
+
+#endif  // CHUNKED_VALUE_H
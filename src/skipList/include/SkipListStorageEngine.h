@@ -2,6 +2,8 @@
 #define SKIPLIST_STORAGE_ENGINE_H
 
 #include <mutex>
+#include <shared_mutex>
+#include "ChunkedValue.h"
 #include "IStorageEngine.h"
 #include "skipList.h"
 
@@ -10,70 +12,85 @@
  * 
  * 将现有的SkipList包装为IStorageEngine接口，
  * 使其可以与新架构无缝集成。
+ * value以ChunkedValue分块存储，Append不复制旧值。
+ * 查找和遍历不修改跳表，读之间共享锁、只和写互斥。
  */
 class SkipListStorageEngine : public IStorageEngine {
 private:
-    SkipList<std::string, std::string> m_skipList;
-    mutable std::mutex m_mtx;
+    SkipList<std::string, ChunkedValue> m_skipList;
+    mutable std::shared_mutex m_mtx;
     
 public:
     explicit SkipListStorageEngine(int maxLevel = 18) : m_skipList(maxLevel) {}
     
     bool Get(const std::string& key, std::string* value) override {
-        std::lock_guard<std::mutex> lock(m_mtx);
-        return m_skipList.search_element(const_cast<std::string&>(key), *value);
+        ChunkedValue chunks;
+        {
+            std::shared_lock<std::shared_mutex> lock(m_mtx);
+            const ChunkedValue* found = m_skipList.find(key);
+            if (found == nullptr) {
+                return false;
+            }
+            chunks = *found;
+        }
+        // 拷贝只复制了块指针，拼接放到锁外
+        value->clear();
+        chunks.AppendTo(value);
+        return true;
     }
     
     void Put(const std::string& key, const std::string& value) override {
-        std::lock_guard<std::mutex> lock(m_mtx);
-        std::string k = key;
-        std::string v = value;
-        m_skipList.insert_set_element(k, v);
+        std::lock_guard<std::shared_mutex> lock(m_mtx);
+        m_skipList.upsert(key, ChunkedValue(value));
     }
     
     void Append(const std::string& key, const std::string& value) override {
-        std::lock_guard<std::mutex> lock(m_mtx);
-        std::string existingValue;
-        std::string k = key;
-        
-        if (m_skipList.search_element(k, existingValue)) {
-            // 键存在，追加值
-            std::string newValue = existingValue + value;
-            m_skipList.delete_element(k);
-            m_skipList.insert_element(k, newValue);
-        } else {
-            // 键不存在，直接插入
-            std::string v = value;
-            m_skipList.insert_element(k, v);
+        std::lock_guard<std::shared_mutex> lock(m_mtx);
+        // 键存在时只在节点上追加新的块，代价与追加长度成正比
+        if (!m_skipList.update_element(key, [&](ChunkedValue& v) { v.Append(value); })) {
+            m_skipList.upsert(key, ChunkedValue(value));
         }
     }
     
     void Delete(const std::string& key) override {
-        std::lock_guard<std::mutex> lock(m_mtx);
+        std::lock_guard<std::shared_mutex> lock(m_mtx);
         std::string k = key;
         m_skipList.delete_element(k);
     }
     
+    void Scan(const std::string& start,
+              const std::function<bool(const std::string&, const std::string&)>& visitor) override {
+        std::shared_lock<std::shared_mutex> lock(m_mtx);
+        auto it = m_skipList.new_iterator();
+        it.seek(start);
+        for (; it.valid(); it.next()) {
+            if (!visitor(it.key(), it.value().ToString())) {
+                break;
+            }
+        }
+    }
+    
     std::string Serialize() override {
-        std::lock_guard<std::mutex> lock(m_mtx);
+        std::shared_lock<std::shared_mutex> lock(m_mtx);
         return m_skipList.dump_file();
     }
     
     void Deserialize(const std::string& data) override {
-        std::lock_guard<std::mutex> lock(m_mtx);
+        std::lock_guard<std::shared_mutex> lock(m_mtx);
+        // 安装快照替换全部数据，快照里没有的key不能留下
+        m_skipList.clear_all();
         m_skipList.load_file(data);
     }
     
     size_t Size() const override {
         // 注意：SkipList::size()不是const方法，这里需要const_cast
         // 或者考虑不加锁直接返回（size()本身是线程安全的）
-        return const_cast<SkipList<std::string, std::string>&>(m_skipList).size();
+        return const_cast<SkipList<std::string, ChunkedValue>&>(m_skipList).size();
     }
     
     void Clear() override {
-        std::lock_guard<std::mutex> lock(m_mtx);
-        // SkipList没有clear方法，需要重新构造
-        // 这里暂时不实现，因为原项目中没有用到
+        std::lock_guard<std::shared_mutex> lock(m_mtx);
+        m_skipList.clear_all();
     }
 };
 
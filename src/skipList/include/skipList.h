@@ -12,6 +12,9 @@
 > Description:
  ************************************************************************/
 
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/serialization/vector.hpp>
 #include <cmath>
 #include <cstdlib>
 #include <cstring>
@@ -39,6 +42,9 @@ class Node {
 
   void set_value(V);
 
+  // 直接访问节点里的value，用于原地修改
+  V *mutable_value();
+
   // Linear array to hold pointers to next node of different level
   Node<K, V> **forward;
 
@@ -80,6 +86,10 @@ template <typename K, typename V>
 void Node<K, V>::set_value(V value) {
   this->value = value;
 };
+template <typename K, typename V>
+V *Node<K, V>::mutable_value() {
+  return &value;
+};
 // Class template to implement node
 template <typename K, typename V>
 class SkipListDump {
@@ -110,15 +120,47 @@ class SkipList {
   bool search_element(K, V &value);
   void delete_element(K);
   void insert_set_element(K &, V &);
+  // 插入或覆盖value：一次查找定位，key已存在时原地赋值，不打印日志。返回true表示新插入了节点；
+  // 覆盖时旧值移入old（不为nullptr时）
+  bool upsert(const K &key, V value, V *old = nullptr);
+  // 查找key，不打印日志；不存在时返回nullptr。返回的指针在下一次写操作之前有效，调用方负责与写操作互斥
+  const V *find(const K &key) const;
+  // 在已有节点上原地修改value（不删除重建节点），key不存在时返回false
+  template <typename F>
+  bool update_element(const K &key, F &&updater);
   std::string dump_file();
   void load_file(const std::string &dumpStr);
   //递归删除节点
   void clear(Node<K, V> *);
+  // 删除所有元素，回到刚构造时的状态
+  void clear_all();
   int size();
+  // 按key升序遍历所有元素，调用方负责与写操作互斥
+  template <typename F>
+  void for_each_element(F &&visitor);
+
+  // 有序迭代器（沿第0层链表前进），使用期间调用方负责与写操作互斥
+  class Iterator {
+   public:
+    explicit Iterator(SkipList *list) : _list(list), _node(nullptr) {}
+    bool valid() const { return _node != nullptr; }
+    K key() const { return _node->get_key(); }
+    const V &value() const { return *_node->mutable_value(); }
+    void next() { _node = _node->forward[0]; }
+    void seek_to_first() { _node = _list->_header->forward[0]; }
+    // 定位到第一个不小于target的元素
+    void seek(const K &target) { _node = _list->find_greater_or_equal(target); }
+
+   private:
+    SkipList *_list;
+    Node<K, V> *_node;
+  };
+  Iterator new_iterator() { return Iterator(this); }
 
  private:
   void get_key_value_from_string(const std::string &str, std::string *key, std::string *value);
   bool is_valid_string(const std::string &str);
+  Node<K, V> *find_greater_or_equal(const K &key) const;
 
  private:
   // Maximum level of the skip list
@@ -296,7 +338,7 @@ void SkipList<K, V>::load_file(const std::string &dumpStr) {
   boost::archive::text_iarchive ia(iss);
   ia >> dumper;
   for (int i = 0; i < dumper.keyDumpVt_.size(); ++i) {
-    insert_element(dumper.keyDumpVt_[i], dumper.keyDumpVt_[i]);
+    insert_element(dumper.keyDumpVt_[i], dumper.valDumpVt_[i]);
   }
 }
 
@@ -306,6 +348,28 @@ int SkipList<K, V>::size() {
   return _element_count;
 }
 
+// Visit every element in key order (level 0 is a sorted linked list)
+template <typename K, typename V>
+template <typename F>
+void SkipList<K, V>::for_each_element(F &&visitor) {
+  Node<K, V> *node = this->_header->forward[0];
+  while (node != nullptr) {
+    visitor(node->get_key(), node->get_value());
+    node = node->forward[0];
+  }
+}
+
+template <typename K, typename V>
+Node<K, V> *SkipList<K, V>::find_greater_or_equal(const K &key) const {
+  Node<K, V> *current = _header;
+  for (int i = _skip_list_level; i >= 0; i--) {
+    while (current->forward[i] != nullptr && current->forward[i]->get_key() < key) {
+      current = current->forward[i];
+    }
+  }
+  return current->forward[0];
+}
+
 template <typename K, typename V>
 void SkipList<K, V>::get_key_value_from_string(const std::string &str, std::string *key, std::string *value) {
   if (!is_valid_string(str)) {
@@ -379,6 +443,69 @@ void SkipList<K, V>::insert_set_element(K &key, V &value) {
   insert_element(key, value);
 }
 
+template <typename K, typename V>
+bool SkipList<K, V>::upsert(const K &key, V value, V *old) {
+  std::lock_guard<std::mutex> lock(_mtx);
+  Node<K, V> *current = _header;
+  Node<K, V> *update[_max_level + 1];
+  memset(update, 0, sizeof(Node<K, V> *) * (_max_level + 1));
+  for (int i = _skip_list_level; i >= 0; i--) {
+    while (current->forward[i] != nullptr && current->forward[i]->get_key() < key) {
+      current = current->forward[i];
+    }
+    update[i] = current;
+  }
+  current = current->forward[0];
+  if (current != nullptr && current->get_key() == key) {
+    if (old != nullptr) {
+      *old = std::move(*current->mutable_value());
+    }
+    *current->mutable_value() = std::move(value);
+    return false;
+  }
+  int random_level = get_random_level();
+  if (random_level > _skip_list_level) {
+    for (int i = _skip_list_level + 1; i <= random_level; i++) {
+      update[i] = _header;
+    }
+    _skip_list_level = random_level;
+  }
+  Node<K, V> *inserted_node = create_node(key, std::move(value), random_level);
+  for (int i = 0; i <= random_level; i++) {
+    inserted_node->forward[i] = update[i]->forward[i];
+    update[i]->forward[i] = inserted_node;
+  }
+  _element_count++;
+  return true;
+}
+
+template <typename K, typename V>
+const V *SkipList<K, V>::find(const K &key) const {
+  Node<K, V> *node = find_greater_or_equal(key);
+  if (node == nullptr || !(node->get_key() == key)) {
+    return nullptr;
+  }
+  return node->mutable_value();
+}
+
+template <typename K, typename V>
+template <typename F>
+bool SkipList<K, V>::update_element(const K &key, F &&updater) {
+  std::lock_guard<std::mutex> lock(_mtx);
+  Node<K, V> *current = _header;
+  for (int i = _skip_list_level; i >= 0; i--) {
+    while (current->forward[i] && current->forward[i]->get_key() < key) {
+      current = current->forward[i];
+    }
+  }
+  current = current->forward[0];
+  if (current == nullptr || !(current->get_key() == key)) {
+    return false;
+  }
+  updater(*current->mutable_value());
+  return true;
+}
+
 // Search for element in skip list
 /*
                            +------------+
@@ -466,6 +593,20 @@ void SkipList<K, V>::clear(Node<K, V> *cur) {
   delete (cur);
 }
 
+template <typename K, typename V>
+void SkipList<K, V>::clear_all() {
+  // 沿第0层逐个删除，不用递归，元素很多时不会栈溢出
+  Node<K, V> *cur = _header->forward[0];
+  while (cur != nullptr) {
+    Node<K, V> *next = cur->forward[0];
+    delete cur;
+    cur = next;
+  }
+  memset(_header->forward, 0, sizeof(Node<K, V> *) * (_max_level + 1));
+  _skip_list_level = 0;
+  _element_count = 0;
+}
+
 template <typename K, typename V>
 int SkipList<K, V>::get_random_level() {
   int k = 1;
@@ -0,0 +1,723 @@
+#include "ArtTree.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+constexpr uint32_t kMaxStoredPrefix = 8;
+
+enum class NodeType : uint8_t { kLeaf, kNode4, kNode16, kNode48, kNode256 };
+
+}  // namespace
+
+struct ArtNode {
+  explicit ArtNode(NodeType t) : type(t) {}
+  NodeType type;
+};
+
+namespace {
+
+struct Leaf : ArtNode {
+  explicit Leaf(const std::string &k) : ArtNode(NodeType::kLeaf), key(k) {}
+  std::string key;
+  std::string value;
+};
+
+struct Inner : ArtNode {
+  explicit Inner(NodeType t) : ArtNode(t) {}
+  uint16_t numChildren = 0;
+  uint32_t prefixLen = 0;  // 压缩路径的完整长度
+  uint8_t prefix[kMaxStoredPrefix];
+  Leaf *terminal = nullptr;  // 恰好在本节点（prefix 之后）结束的 key
+};
+
+struct Node4 : Inner {
+  Node4() : Inner(NodeType::kNode4) {}
+  uint8_t keys[4];
+  ArtNode *children[4];
+};
+
+struct Node16 : Inner {
+  Node16() : Inner(NodeType::kNode16) {}
+  uint8_t keys[16];
+  ArtNode *children[16];
+};
+
+struct Node48 : Inner {
+  Node48() : Inner(NodeType::kNode48) {
+    std::memset(childIndex, 0, sizeof(childIndex));
+    std::memset(children, 0, sizeof(children));
+  }
+  uint8_t childIndex[256];  // 0 表示空，否则为 children 下标 + 1
+  ArtNode *children[48];
+};
+
+struct Node256 : Inner {
+  Node256() : Inner(NodeType::kNode256) { std::memset(children, 0, sizeof(children)); }
+  ArtNode *children[256];
+};
+
+inline bool isLeaf(const ArtNode *n) { return n->type == NodeType::kLeaf; }
+inline Leaf *asLeaf(ArtNode *n) { return static_cast<Leaf *>(n); }
+inline Inner *asInner(ArtNode *n) { return static_cast<Inner *>(n); }
+inline uint8_t byteAt(const std::string &key, size_t i) { return static_cast<uint8_t>(key[i]); }
+
+void copyHeader(Inner *dst, const Inner *src) {
+  dst->prefixLen = src->prefixLen;
+  std::memcpy(dst->prefix, src->prefix, std::min(src->prefixLen, kMaxStoredPrefix));
+  dst->terminal = src->terminal;
+}
+
+// 按实际类型释放内部节点（不含子节点和 terminal）
+void freeInner(Inner *n) {
+  switch (n->type) {
+    case NodeType::kNode4:
+      delete static_cast<Node4 *>(n);
+      break;
+    case NodeType::kNode16:
+      delete static_cast<Node16 *>(n);
+      break;
+    case NodeType::kNode48:
+      delete static_cast<Node48 *>(n);
+      break;
+    case NodeType::kNode256:
+      delete static_cast<Node256 *>(n);
+      break;
+    default:
+      break;
+  }
+}
+
+// Node16 中查找 byte 对应的槽位，未找到返回 -1
+int node16Find(const Node16 *n, uint8_t byte) {
+#if defined(__SSE2__)
+  __m128i cmp = _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(byte)),
+                               _mm_loadu_si128(reinterpret_cast<const __m128i *>(n->keys)));
+  int mask = _mm_movemask_epi8(cmp) & ((1 << n->numChildren) - 1);
+  return mask ? __builtin_ctz(mask) : -1;
+#else
+  for (int i = 0; i < n->numChildren; i++) {
+    if (n->keys[i] == byte) return i;
+  }
+  return -1;
+#endif
+}
+
+// Node16 中第一个大于 byte 的位置（插入点）
+int node16LowerBound(const Node16 *n, uint8_t byte) {
+#if defined(__SSE2__)
+  // SSE2 只有有符号比较，两边同时翻转最高位得到无符号序
+  const __m128i flip = _mm_set1_epi8(static_cast<char>(0x80));
+  __m128i keys = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(n->keys)), flip);
+  __m128i target = _mm_xor_si128(_mm_set1_epi8(static_cast<char>(byte)), flip);
+  int mask = _mm_movemask_epi8(_mm_cmplt_epi8(target, keys)) & ((1 << n->numChildren) - 1);
+  return mask ? __builtin_ctz(mask) : n->numChildren;
+#else
+  int i = 0;
+  while (i < n->numChildren && n->keys[i] < byte) i++;
+  return i;
+#endif
+}
+
+ArtNode **findChild(Inner *n, uint8_t byte) {
+  switch (n->type) {
+    case NodeType::kNode4: {
+      auto *node = static_cast<Node4 *>(n);
+      for (int i = 0; i < node->numChildren; i++) {
+        if (node->keys[i] == byte) return &node->children[i];
+      }
+      return nullptr;
+    }
+    case NodeType::kNode16: {
+      auto *node = static_cast<Node16 *>(n);
+      int i = node16Find(node, byte);
+      return i >= 0 ? &node->children[i] : nullptr;
+    }
+    case NodeType::kNode48: {
+      auto *node = static_cast<Node48 *>(n);
+      return node->childIndex[byte] ? &node->children[node->childIndex[byte] - 1] : nullptr;
+    }
+    case NodeType::kNode256: {
+      auto *node = static_cast<Node256 *>(n);
+      return node->children[byte] ? &node->children[byte] : nullptr;
+    }
+    default:
+      return nullptr;
+  }
+}
+
+// 子树中 key 最小的叶子：terminal 总是比子节点里的 key 短，因此最小
+Leaf *minimum(ArtNode *n) {
+  while (!isLeaf(n)) {
+    Inner *in = asInner(n);
+    if (in->terminal) return in->terminal;
+    switch (n->type) {
+      case NodeType::kNode4:
+        n = static_cast<Node4 *>(n)->children[0];
+        break;
+      case NodeType::kNode16:
+        n = static_cast<Node16 *>(n)->children[0];
+        break;
+      case NodeType::kNode48: {
+        auto *node = static_cast<Node48 *>(n);
+        int i = 0;
+        while (!node->childIndex[i]) i++;
+        n = node->children[node->childIndex[i] - 1];
+        break;
+      }
+      case NodeType::kNode256: {
+        auto *node = static_cast<Node256 *>(n);
+        int i = 0;
+        while (!node->children[i]) i++;
+        n = node->children[i];
+        break;
+      }
+      default:
+        break;
+    }
+  }
+  return asLeaf(n);
+}
+
+// 子树中 key 最大的叶子：沿最后一个子节点下降，没有子节点时才是 terminal
+Leaf *maximum(ArtNode *n) {
+  while (!isLeaf(n)) {
+    Inner *in = asInner(n);
+    ArtNode *last = nullptr;
+    switch (n->type) {
+      case NodeType::kNode4: {
+        auto *node = static_cast<Node4 *>(n);
+        if (node->numChildren) last = node->children[node->numChildren - 1];
+        break;
+      }
+      case NodeType::kNode16: {
+        auto *node = static_cast<Node16 *>(n);
+        if (node->numChildren) last = node->children[node->numChildren - 1];
+        break;
+      }
+      case NodeType::kNode48: {
+        auto *node = static_cast<Node48 *>(n);
+        for (int i = 255; i >= 0 && last == nullptr; i--) {
+          if (node->childIndex[i]) last = node->children[node->childIndex[i] - 1];
+        }
+        break;
+      }
+      case NodeType::kNode256: {
+        auto *node = static_cast<Node256 *>(n);
+        for (int i = 255; i >= 0 && last == nullptr; i--) last = node->children[i];
+        break;
+      }
+      default:
+        break;
+    }
+    if (last == nullptr) return in->terminal;
+    n = last;
+  }
+  return asLeaf(n);
+}
+
+/**
+ * key 从 depth 开始与节点 prefix 匹配的字节数，结果不超过 prefixLen，也不超过 key 剩余长度。
+ * 超出 kMaxStoredPrefix 的部分用子树最小叶子的完整 key 比较。
+ */
+uint32_t prefixMatch(Inner *n, const std::string &key, size_t depth) {
+  const size_t remain = key.size() - depth;
+  const uint32_t stored = std::min(n->prefixLen, kMaxStoredPrefix);
+  uint32_t i = 0;
+  for (; i < stored && i < remain; i++) {
+    if (n->prefix[i] != byteAt(key, depth + i)) return i;
+  }
+  if (i < stored || n->prefixLen <= kMaxStoredPrefix) {
+    return i;
+  }
+  const std::string &full = minimum(n)->key;
+  for (; i < n->prefixLen && i < remain; i++) {
+    if (byteAt(full, depth + i) != byteAt(key, depth + i)) return i;
+  }
+  return i;
+}
+
+void addChild(ArtNode **ref, Inner *n, uint8_t byte, ArtNode *child);
+
+void addChild4(ArtNode **ref, Node4 *n, uint8_t byte, ArtNode *child) {
+  if (n->numChildren < 4) {
+    int pos = 0;
+    while (pos < n->numChildren && n->keys[pos] < byte) pos++;
+    std::memmove(n->keys + pos + 1, n->keys + pos, n->numChildren - pos);
+    std::memmove(n->children + pos + 1, n->children + pos, (n->numChildren - pos) * sizeof(ArtNode *));
+    n->keys[pos] = byte;
+    n->children[pos] = child;
+    n->numChildren++;
+    return;
+  }
+  auto *grown = new Node16();
+  copyHeader(grown, n);
+  std::memcpy(grown->keys, n->keys, 4);
+  std::memcpy(grown->children, n->children, 4 * sizeof(ArtNode *));
+  grown->numChildren = 4;
+  *ref = grown;
+  delete n;
+  addChild(ref, grown, byte, child);
+}
+
+void addChild16(ArtNode **ref, Node16 *n, uint8_t byte, ArtNode *child) {
+  if (n->numChildren < 16) {
+    int pos = node16LowerBound(n, byte);
+    std::memmove(n->keys + pos + 1, n->keys + pos, n->numChildren - pos);
+    std::memmove(n->children + pos + 1, n->children + pos, (n->numChildren - pos) * sizeof(ArtNode *));
+    n->keys[pos] = byte;
+    n->children[pos] = child;
+    n->numChildren++;
+    return;
+  }
+  auto *grown = new Node48();
+  copyHeader(grown, n);
+  for (int i = 0; i < 16; i++) {
+    grown->children[i] = n->children[i];
+    grown->childIndex[n->keys[i]] = static_cast<uint8_t>(i + 1);
+  }
+  grown->numChildren = 16;
+  *ref = grown;
+  delete n;
+  addChild(ref, grown, byte, child);
+}
+
+void addChild48(ArtNode **ref, Node48 *n, uint8_t byte, ArtNode *child) {
+  if (n->numChildren < 48) {
+    // 删除会在 children 中留下空洞，找第一个空位
+    int pos = 0;
+    while (n->children[pos] != nullptr) pos++;
+    n->children[pos] = child;
+    n->childIndex[byte] = static_cast<uint8_t>(pos + 1);
+    n->numChildren++;
+    return;
+  }
+  auto *grown = new Node256();
+  copyHeader(grown, n);
+  for (int b = 0; b < 256; b++) {
+    if (n->childIndex[b]) grown->children[b] = n->children[n->childIndex[b] - 1];
+  }
+  grown->numChildren = 48;
+  *ref = grown;
+  delete n;
+  addChild(ref, grown, byte, child);
+}
+
+void addChild(ArtNode **ref, Inner *n, uint8_t byte, ArtNode *child) {
+  switch (n->type) {
+    case NodeType::kNode4:
+      addChild4(ref, static_cast<Node4 *>(n), byte, child);
+      break;
+    case NodeType::kNode16:
+      addChild16(ref, static_cast<Node16 *>(n), byte, child);
+      break;
+    case NodeType::kNode48:
+      addChild48(ref, static_cast<Node48 *>(n), byte, child);
+      break;
+    case NodeType::kNode256: {
+      auto *node = static_cast<Node256 *>(n);
+      node->children[byte] = child;
+      node->numChildren++;
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+void removeChild(Inner *n, uint8_t byte) {
+  switch (n->type) {
+    case NodeType::kNode4: {
+      auto *node = static_cast<Node4 *>(n);
+      int pos = 0;
+      while (node->keys[pos] != byte) pos++;
+      std::memmove(node->keys + pos, node->keys + pos + 1, node->numChildren - pos - 1);
+      std::memmove(node->children + pos, node->children + pos + 1, (node->numChildren - pos - 1) * sizeof(ArtNode *));
+      break;
+    }
+    case NodeType::kNode16: {
+      auto *node = static_cast<Node16 *>(n);
+      int pos = node16Find(node, byte);
+      std::memmove(node->keys + pos, node->keys + pos + 1, node->numChildren - pos - 1);
+      std::memmove(node->children + pos, node->children + pos + 1, (node->numChildren - pos - 1) * sizeof(ArtNode *));
+      break;
+    }
+    case NodeType::kNode48: {
+      auto *node = static_cast<Node48 *>(n);
+      node->children[node->childIndex[byte] - 1] = nullptr;
+      node->childIndex[byte] = 0;
+      break;
+    }
+    case NodeType::kNode256:
+      static_cast<Node256 *>(n)->children[byte] = nullptr;
+      break;
+    default:
+      break;
+  }
+  n->numChildren--;
+}
+
+// 内部节点只剩一个子节点且没有 terminal 时，把它和子节点的 prefix 拼起来
+void collapse(ArtNode **ref, Inner *n) {
+  ArtNode *child = nullptr;
+  uint8_t byte = 0;
+  switch (n->type) {
+    case NodeType::kNode4:
+      child = static_cast<Node4 *>(n)->children[0];
+      byte = static_cast<Node4 *>(n)->keys[0];
+      break;
+    case NodeType::kNode16:
+      child = static_cast<Node16 *>(n)->children[0];
+      byte = static_cast<Node16 *>(n)->keys[0];
+      break;
+    default:
+      return;
+  }
+  if (!isLeaf(child)) {
+    Inner *c = asInner(child);
+    uint8_t merged[kMaxStoredPrefix];
+    uint32_t len = std::min(n->prefixLen, kMaxStoredPrefix);
+    std::memcpy(merged, n->prefix, len);
+    if (len < kMaxStoredPrefix) merged[len++] = byte;
+    uint32_t take = std::min(std::min(c->prefixLen, kMaxStoredPrefix), kMaxStoredPrefix - len);
+    std::memcpy(merged + len, c->prefix, take);
+    len += take;
+    c->prefixLen += n->prefixLen + 1;
+    std::memcpy(c->prefix, merged, len);
+  }
+  *ref = child;
+  freeInner(n);
+}
+
+// 删除后按需降级或折叠
+void shrink(ArtNode **ref, Inner *n) {
+  const int entries = n->numChildren + (n->terminal ? 1 : 0);
+  if (entries == 1 && n->terminal) {
+    *ref = n->terminal;
+    freeInner(n);
+    return;
+  }
+  if (entries == 1 && (n->type == NodeType::kNode4 || n->type == NodeType::kNode16)) {
+    collapse(ref, n);
+    return;
+  }
+  if (n->type == NodeType::kNode256 && n->numChildren <= 37) {
+    auto *node = static_cast<Node256 *>(n);
+    auto *shrunk = new Node48();
+    copyHeader(shrunk, n);
+    for (int b = 0; b < 256; b++) {
+      if (node->children[b]) {
+        shrunk->children[shrunk->numChildren] = node->children[b];
+        shrunk->childIndex[b] = static_cast<uint8_t>(++shrunk->numChildren);
+      }
+    }
+    *ref = shrunk;
+    delete node;
+  } else if (n->type == NodeType::kNode48 && n->numChildren <= 12) {
+    auto *node = static_cast<Node48 *>(n);
+    auto *shrunk = new Node16();
+    copyHeader(shrunk, n);
+    for (int b = 0; b < 256; b++) {
+      if (node->childIndex[b]) {
+        shrunk->keys[shrunk->numChildren] = static_cast<uint8_t>(b);
+        shrunk->children[shrunk->numChildren++] = node->children[node->childIndex[b] - 1];
+      }
+    }
+    *ref = shrunk;
+    delete node;
+  } else if (n->type == NodeType::kNode16 && n->numChildren <= 3) {
+    auto *node = static_cast<Node16 *>(n);
+    auto *shrunk = new Node4();
+    copyHeader(shrunk, n);
+    std::memcpy(shrunk->keys, node->keys, node->numChildren);
+    std::memcpy(shrunk->children, node->children, node->numChildren * sizeof(ArtNode *));
+    shrunk->numChildren = node->numChildren;
+    *ref = shrunk;
+    delete node;
+  }
+}
+
+template <typename F>
+void forEachChild(ArtNode *n, F &&f) {
+  switch (n->type) {
+    case NodeType::kNode4: {
+      auto *node = static_cast<Node4 *>(n);
+      for (int i = 0; i < node->numChildren; i++) f(node->children[i]);
+      break;
+    }
+    case NodeType::kNode16: {
+      auto *node = static_cast<Node16 *>(n);
+      for (int i = 0; i < node->numChildren; i++) f(node->children[i]);
+      break;
+    }
+    case NodeType::kNode48: {
+      auto *node = static_cast<Node48 *>(n);
+      for (int b = 0; b < 256; b++) {
+        if (node->childIndex[b]) f(node->children[node->childIndex[b] - 1]);
+      }
+      break;
+    }
+    case NodeType::kNode256: {
+      auto *node = static_cast<Node256 *>(n);
+      for (int b = 0; b < 256; b++) {
+        if (node->children[b]) f(node->children[b]);
+      }
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+void destroy(ArtNode *n) {
+  if (n == nullptr) return;
+  if (isLeaf(n)) {
+    delete asLeaf(n);
+    return;
+  }
+  forEachChild(n, [](ArtNode *c) { destroy(c); });
+  Inner *in = asInner(n);
+  delete in->terminal;
+  freeInner(in);
+}
+
+void visitInOrder(ArtNode *n, const std::function<void(const std::string &, const std::string &)> &visitor) {
+  if (isLeaf(n)) {
+    visitor(asLeaf(n)->key, asLeaf(n)->value);
+    return;
+  }
+  Inner *in = asInner(n);
+  if (in->terminal) {
+    visitor(in->terminal->key, in->terminal->value);
+  }
+  forEachChild(n, [&visitor](ArtNode *c) { visitInOrder(c, visitor); });
+}
+
+// 与 forEachChild 相同，f 返回 false 时停止
+template <typename F>
+bool forEachChildUntil(ArtNode *n, F &&f) {
+  bool go = true;
+  forEachChild(n, [&](ArtNode *c) {
+    if (go) go = f(c);
+  });
+  return go;
+}
+
+/**
+ * 从 start 开始的有序遍历。bounded 表示子树里可能有小于 start 的 key：
+ * 整棵子树都小于 start（最大叶子 < start）时直接跳过；
+ * 第一个不被跳过的子节点之后，其余子节点的 key 都更大，不再需要比较。
+ * 返回 false 表示 visitor 要求停止
+ */
+bool visitFrom(ArtNode *n, const std::string &start, bool bounded,
+               const std::function<bool(const std::string &, const std::string &)> &visitor) {
+  if (isLeaf(n)) {
+    if (bounded && asLeaf(n)->key < start) return true;
+    return visitor(asLeaf(n)->key, asLeaf(n)->value);
+  }
+  if (bounded && maximum(n)->key < start) return true;
+  Inner *in = asInner(n);
+  if (in->terminal && !(bounded && in->terminal->key < start)) {
+    if (!visitor(in->terminal->key, in->terminal->value)) return false;
+  }
+  return forEachChildUntil(n, [&](ArtNode *c) {
+    if (bounded && maximum(c)->key < start) return true;
+    bool go = visitFrom(c, start, bounded, visitor);
+    bounded = false;
+    return go;
+  });
+}
+
+// 返回 key 对应的叶子（已存在或新建）
+Leaf *insertAt(ArtNode **ref, const std::string &key, size_t depth, bool *inserted) {
+  ArtNode *n = *ref;
+  if (n == nullptr) {
+    auto *leaf = new Leaf(key);
+    *ref = leaf;
+    *inserted = true;
+    return leaf;
+  }
+
+  if (isLeaf(n)) {
+    Leaf *existing = asLeaf(n);
+    if (existing->key == key) {
+      return existing;
+    }
+    // 两个叶子从 depth 开始的公共部分成为新节点的 prefix
+    size_t i = depth;
+    while (i < key.size() && i < existing->key.size() && key[i] == existing->key[i]) i++;
+    auto *node = new Node4();
+    node->prefixLen = static_cast<uint32_t>(i - depth);
+    std::memcpy(node->prefix, key.data() + depth, std::min(node->prefixLen, kMaxStoredPrefix));
+    auto *leaf = new Leaf(key);
+    ArtNode *slot = node;
+    for (Leaf *l : {existing, leaf}) {
+      if (l->key.size() == i) {
+        node->terminal = l;
+      } else {
+        addChild(&slot, node, byteAt(l->key, i), l);
+      }
+    }
+    *ref = node;
+    *inserted = true;
+    return leaf;
+  }
+
+  Inner *in = asInner(n);
+  if (in->prefixLen > 0) {
+    uint32_t matched = prefixMatch(in, key, depth);
+    if (matched < in->prefixLen) {
+      // key 在压缩路径中间分叉：拆出一个新的 Node4
+      auto *node = new Node4();
+      node->prefixLen = matched;
+      std::memcpy(node->prefix, in->prefix, std::min(matched, kMaxStoredPrefix));
+      uint8_t splitByte;
+      if (in->prefixLen <= kMaxStoredPrefix) {
+        splitByte = in->prefix[matched];
+        in->prefixLen -= matched + 1;
+        std::memmove(in->prefix, in->prefix + matched + 1, in->prefixLen);
+      } else {
+        const std::string &full = minimum(in)->key;
+        splitByte = byteAt(full, depth + matched);
+        in->prefixLen -= matched + 1;
+        std::memcpy(in->prefix, full.data() + depth + matched + 1, std::min(in->prefixLen, kMaxStoredPrefix));
+      }
+      ArtNode *slot = node;
+      addChild(&slot, node, splitByte, in);
+      auto *leaf = new Leaf(key);
+      if (key.size() == depth + matched) {
+        node->terminal = leaf;
+      } else {
+        addChild(&slot, node, byteAt(key, depth + matched), leaf);
+      }
+      *ref = node;
+      *inserted = true;
+      return leaf;
+    }
+    depth += in->prefixLen;
+  }
+
+  if (depth == key.size()) {
+    if (in->terminal == nullptr) {
+      in->terminal = new Leaf(key);
+      *inserted = true;
+    }
+    return in->terminal;
+  }
+  ArtNode **child = findChild(in, byteAt(key, depth));
+  if (child != nullptr) {
+    return insertAt(child, key, depth + 1, inserted);
+  }
+  auto *leaf = new Leaf(key);
+  addChild(ref, in, byteAt(key, depth), leaf);
+  *inserted = true;
+  return leaf;
+}
+
+bool eraseAt(ArtNode **ref, const std::string &key, size_t depth) {
+  ArtNode *n = *ref;
+  if (n == nullptr) {
+    return false;
+  }
+  if (isLeaf(n)) {
+    if (asLeaf(n)->key != key) return false;
+    delete asLeaf(n);
+    *ref = nullptr;
+    return true;
+  }
+
+  Inner *in = asInner(n);
+  if (in->prefixLen > 0) {
+    if (prefixMatch(in, key, depth) != in->prefixLen) return false;
+    depth += in->prefixLen;
+  }
+  if (depth == key.size()) {
+    if (in->terminal == nullptr || in->terminal->key != key) return false;
+    delete in->terminal;
+    in->terminal = nullptr;
+    shrink(ref, in);
+    return true;
+  }
+  ArtNode **child = findChild(in, byteAt(key, depth));
+  if (child == nullptr) {
+    return false;
+  }
+  if (isLeaf(*child)) {
+    if (asLeaf(*child)->key != key) return false;
+    delete asLeaf(*child);
+    removeChild(in, byteAt(key, depth));
+    shrink(ref, in);
+    return true;
+  }
+  return eraseAt(child, key, depth + 1);
+}
+
+}  // namespace
+
+ArtTree::~ArtTree() { destroy(m_root); }
+
+std::string *ArtTree::Find(const std::string &key) const {
+  ArtNode *n = m_root;
+  size_t depth = 0;
+  while (n != nullptr) {
+    if (isLeaf(n)) {
+      return asLeaf(n)->key == key ? &asLeaf(n)->value : nullptr;
+    }
+    Inner *in = asInner(n);
+    if (in->prefixLen > 0) {
+      // 乐观比较：只比存下来的字节，跳过剩余部分，最后在叶子上做完整比较
+      if (depth + in->prefixLen > key.size()) return nullptr;
+      const uint32_t stored = std::min(in->prefixLen, kMaxStoredPrefix);
+      for (uint32_t i = 0; i < stored; i++) {
+        if (in->prefix[i] != byteAt(key, depth + i)) return nullptr;
+      }
+      depth += in->prefixLen;
+    }
+    if (depth == key.size()) {
+      return (in->terminal != nullptr && in->terminal->key == key) ? &in->terminal->value : nullptr;
+    }
+    ArtNode **child = findChild(in, byteAt(key, depth));
+    n = child ? *child : nullptr;
+    depth++;
+  }
+  return nullptr;
+}
+
+std::string *ArtTree::Upsert(const std::string &key) {
+  bool inserted = false;
+  Leaf *leaf = insertAt(&m_root, key, 0, &inserted);
+  if (inserted) m_size++;
+  return &leaf->value;
+}
+
+bool ArtTree::Erase(const std::string &key) {
+  if (eraseAt(&m_root, key, 0)) {
+    m_size--;
+    return true;
+  }
+  return false;
+}
+
+void ArtTree::ForEach(const std::function<void(const std::string &, const std::string &)> &visitor) const {
+  if (m_root != nullptr) {
+    visitInOrder(m_root, visitor);
+  }
+}
+
+void ArtTree::ForEachFrom(const std::string &start,
+                          const std::function<bool(const std::string &, const std::string &)> &visitor) const {
+  if (m_root != nullptr) {
+    visitFrom(m_root, start, !start.empty(), visitor);
+  }
+}
+
+void ArtTree::Clear() {
+  destroy(m_root);
+  m_root = nullptr;
+  m_size = 0;
+}
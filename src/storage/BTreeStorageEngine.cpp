@@ -0,0 +1,764 @@
+#include "BTreeStorageEngine.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+
+#include "Coding.h"
+
+namespace {
+
+constexpr uint64_t kMetaMagic = 0x4254524545303031ULL;      // "BTREE001"
+constexpr uint64_t kSnapshotMagic = 0x4254534e41503031ULL;  // "BTSNAP01"
+constexpr uint16_t kLeafPage = 1;
+constexpr uint16_t kBranchPage = 2;
+constexpr size_t kHeaderSize = 8;  // u16 type, u16 count, u32 leftmost child
+constexpr size_t kLeafEntryFixed = 7;    // u16 klen, u8 flags, u32 vlen
+constexpr size_t kBranchEntryFixed = 6;  // u16 klen, u32 child
+constexpr uint8_t kOverflowFlag = 1;
+constexpr size_t kMaxInlineValue = 1000;  // 更大的 value 放到溢出页，保证一页至少能放两条记录
+constexpr size_t kInitialMapSize = size_t(1) << 30;
+constexpr uint32_t kGrowPages = 256;
+
+inline uint16_t load16(const char *p) {
+  uint16_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return v;
+}
+inline uint32_t load32(const char *p) {
+  uint32_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return v;
+}
+inline void store16(char *p, uint16_t v) { std::memcpy(p, &v, sizeof(v)); }
+inline void store32(char *p, uint32_t v) { std::memcpy(p, &v, sizeof(v)); }
+
+int compareKey(const char *a, size_t alen, const std::string &b) {
+  int r = std::memcmp(a, b.data(), std::min(alen, b.size()));
+  if (r != 0) return r;
+  return alen < b.size() ? -1 : (alen > b.size() ? 1 : 0);
+}
+
+struct MetaPage {
+  uint64_t magic;
+  uint32_t pageSize;
+  uint32_t root;
+  uint64_t dbId;
+  uint64_t txnId;
+  uint64_t entryCount;
+  uint32_t pageCount;
+  uint32_t checksum;  // 前面所有字段的哈希，检测写了一半的 meta
+};
+
+uint32_t metaChecksum(const MetaPage &m) {
+  return coding::Hash32(reinterpret_cast<const char *>(&m), offsetof(MetaPage, checksum));
+}
+
+}  // namespace
+
+struct BTreeStorageEngine::ValueSlot {
+  std::string inlineValue;
+  uint32_t overflow = 0;  // 溢出页起始页号，0 表示内联
+  uint32_t len = 0;
+};
+
+struct BTreeStorageEngine::Node {
+  bool leaf = true;
+  std::vector<std::string> keys;
+  std::vector<ValueSlot> values;    // 叶子节点
+  std::vector<uint32_t> children;   // 内部节点，children.size() == keys.size() + 1
+
+  size_t EncodedSize() const {
+    size_t size = kHeaderSize + 2 * keys.size();
+    for (size_t i = 0; i < keys.size(); i++) {
+      size += keys[i].size();
+      if (leaf) {
+        size += kLeafEntryFixed + (values[i].overflow ? 4 : values[i].len);
+      } else {
+        size += kBranchEntryFixed;
+      }
+    }
+    return size;
+  }
+};
+
+struct BTreeStorageEngine::Split {
+  bool happened = false;
+  std::string separator;  // 右半部分的最小 key
+  uint32_t right = 0;
+};
+
+// ==================== 构造/析构 ====================
+
+BTreeStorageEngine::BTreeStorageEngine(const std::string &path)
+    : m_path(path),
+      m_fd(-1),
+      m_map(nullptr),
+      m_mapSize(0),
+      m_pageCount(0),
+      m_dbId(0),
+      m_txnId(0),
+      m_committedRoot(0),
+      m_committedCount(0),
+      m_root(0),
+      m_count(0),
+      m_snapshotReading(false) {
+  m_fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+  if (m_fd < 0) {
+    throw std::runtime_error("[BTree] open " + path + ": " + std::strerror(errno));
+  }
+  struct stat st;
+  ::fstat(m_fd, &st);
+  uint32_t pages = static_cast<uint32_t>(st.st_size / kPageSize);
+  if (pages < 2) {
+    pages = 2;
+    if (::ftruncate(m_fd, static_cast<off_t>(pages) * kPageSize) != 0) {
+      throw std::runtime_error("[BTree] ftruncate " + path + ": " + std::strerror(errno));
+    }
+  }
+  m_pageCount = pages;
+  m_mapSize = std::max(kInitialMapSize, static_cast<size_t>(pages) * kPageSize * 2);
+  void *addr = ::mmap(nullptr, m_mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+  if (addr == MAP_FAILED) {
+    throw std::runtime_error("[BTree] mmap " + path + ": " + std::strerror(errno));
+  }
+  m_map = static_cast<char *>(addr);
+
+  if (!loadMeta()) {
+    std::random_device rd;
+    m_dbId = (static_cast<uint64_t>(rd()) << 32) | rd();
+  }
+
+  // 空闲页不落盘，按可达性重建：上一次提交的树引用的页先保留，
+  // 等到确定是否采用这棵树（安装同一个快照）或下一次提交之后再释放
+  std::vector<bool> reachable(m_pageCount, false);
+  markReachable(m_committedRoot, &reachable);
+  for (uint32_t p = m_pageCount; p-- > 2;) {
+    if (reachable[p]) {
+      m_pendingFree.push_back(p);
+    } else {
+      m_free.push_back(p);
+    }
+  }
+}
+
+BTreeStorageEngine::~BTreeStorageEngine() {
+  for (const auto &retired : m_retiredMaps) {
+    ::munmap(retired.first, retired.second);
+  }
+  if (m_map != nullptr) {
+    ::munmap(m_map, m_mapSize);
+  }
+  if (m_fd >= 0) {
+    ::close(m_fd);
+  }
+}
+
+bool BTreeStorageEngine::loadMeta() {
+  const MetaPage *best = nullptr;
+  for (uint32_t slot = 0; slot < 2; slot++) {
+    const auto *m = reinterpret_cast<const MetaPage *>(page(slot));
+    if (m->magic != kMetaMagic || m->pageSize != kPageSize || m->checksum != metaChecksum(*m) ||
+        m->pageCount > m_pageCount) {
+      continue;
+    }
+    if (best == nullptr || m->txnId > best->txnId) {
+      best = m;
+    }
+  }
+  if (best == nullptr) {
+    return false;
+  }
+  m_dbId = best->dbId;
+  m_txnId = best->txnId;
+  m_committedRoot = best->root;
+  m_committedCount = best->entryCount;
+  return true;
+}
+
+// ==================== 页管理 ====================
+
+void BTreeStorageEngine::growFile(uint32_t pageCount) {
+  if (::ftruncate(m_fd, static_cast<off_t>(pageCount) * kPageSize) != 0) {
+    throw std::runtime_error("[BTree] ftruncate " + m_path + ": " + std::strerror(errno));
+  }
+  const size_t needed = static_cast<size_t>(pageCount) * kPageSize;
+  if (needed > m_mapSize) {
+    // 预留的地址空间用完了，重新映射；调用方不能跨分配持有页指针。
+    // 快照还在用旧映射读已提交的树时先保留它，快照结束后再解除
+    if (m_snapshotReading) {
+      m_retiredMaps.emplace_back(m_map, m_mapSize);
+    } else {
+      ::munmap(m_map, m_mapSize);
+    }
+    while (m_mapSize < needed) m_mapSize *= 2;
+    void *addr = ::mmap(nullptr, m_mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+    if (addr == MAP_FAILED) {
+      throw std::runtime_error("[BTree] mmap " + m_path + ": " + std::strerror(errno));
+    }
+    m_map = static_cast<char *>(addr);
+  }
+  m_pageCount = pageCount;
+}
+
+uint32_t BTreeStorageEngine::allocPage() {
+  if (m_free.empty()) {
+    const uint32_t oldCount = m_pageCount;
+    growFile(oldCount + std::max(kGrowPages, oldCount / 4));
+    for (uint32_t p = m_pageCount; p-- > oldCount;) {
+      m_free.push_back(p);
+    }
+  }
+  uint32_t pgno = m_free.back();
+  m_free.pop_back();
+  m_dirty.insert(pgno);
+  return pgno;
+}
+
+uint32_t BTreeStorageEngine::allocRun(uint32_t pages) {
+  // 溢出页需要连续，直接从文件末尾分配
+  const uint32_t start = m_pageCount;
+  growFile(start + pages);
+  for (uint32_t p = start; p < start + pages; p++) {
+    m_dirty.insert(p);
+  }
+  return start;
+}
+
+void BTreeStorageEngine::freePage(uint32_t pgno) {
+  if (m_dirty.erase(pgno) > 0) {
+    m_free.push_back(pgno);
+  } else {
+    m_pendingFree.push_back(pgno);
+  }
+}
+
+void BTreeStorageEngine::freeValue(const ValueSlot &v) {
+  if (v.overflow == 0) return;
+  const uint32_t pages = (v.len + kPageSize - 1) / kPageSize;
+  for (uint32_t p = v.overflow; p < v.overflow + pages; p++) {
+    freePage(p);
+  }
+}
+
+void BTreeStorageEngine::freeTree(uint32_t pgno) {
+  if (pgno == 0) return;
+  Node n = readNode(pgno);
+  if (n.leaf) {
+    for (const auto &v : n.values) freeValue(v);
+  } else {
+    for (uint32_t c : n.children) freeTree(c);
+  }
+  freePage(pgno);
+}
+
+void BTreeStorageEngine::markReachable(uint32_t pgno, std::vector<bool> *reachable) const {
+  if (pgno == 0 || pgno >= m_pageCount) return;
+  (*reachable)[pgno] = true;
+  Node n = readNode(pgno);
+  if (n.leaf) {
+    for (const auto &v : n.values) {
+      if (v.overflow == 0) continue;
+      const uint32_t pages = (v.len + kPageSize - 1) / kPageSize;
+      for (uint32_t p = v.overflow; p < v.overflow + pages && p < m_pageCount; p++) {
+        (*reachable)[p] = true;
+      }
+    }
+  } else {
+    for (uint32_t c : n.children) markReachable(c, reachable);
+  }
+}
+
+// ==================== 节点编解码 ====================
+
+BTreeStorageEngine::Node BTreeStorageEngine::readNode(uint32_t pgno) const { return decodeNode(page(pgno)); }
+
+BTreeStorageEngine::Node BTreeStorageEngine::decodeNode(const char *pg) {
+  Node n;
+  n.leaf = load16(pg) == kLeafPage;
+  const uint16_t count = load16(pg + 2);
+  n.keys.reserve(count);
+  if (n.leaf) {
+    n.values.reserve(count);
+  } else {
+    n.children.reserve(count + 1);
+    n.children.push_back(load32(pg + 4));
+  }
+  for (uint16_t i = 0; i < count; i++) {
+    const char *e = pg + load16(pg + kHeaderSize + 2 * i);
+    const uint16_t klen = load16(e);
+    if (n.leaf) {
+      const uint8_t flags = static_cast<uint8_t>(e[2]);
+      ValueSlot v;
+      v.len = load32(e + 3);
+      n.keys.emplace_back(e + kLeafEntryFixed, klen);
+      const char *val = e + kLeafEntryFixed + klen;
+      if (flags & kOverflowFlag) {
+        v.overflow = load32(val);
+      } else {
+        v.inlineValue.assign(val, v.len);
+      }
+      n.values.push_back(std::move(v));
+    } else {
+      n.children.push_back(load32(e + 2));
+      n.keys.emplace_back(e + kBranchEntryFixed, klen);
+    }
+  }
+  return n;
+}
+
+uint32_t BTreeStorageEngine::writeNode(const Node &n, uint32_t oldPgno) {
+  uint32_t pgno = oldPgno;
+  if (oldPgno == 0 || m_dirty.count(oldPgno) == 0) {
+    // 已提交的页不能原地改，复制到新页
+    pgno = allocPage();
+    if (oldPgno != 0) freePage(oldPgno);
+  }
+  char *pg = page(pgno);
+  store16(pg, n.leaf ? kLeafPage : kBranchPage);
+  store16(pg + 2, static_cast<uint16_t>(n.keys.size()));
+  store32(pg + 4, n.leaf ? 0 : n.children[0]);
+  size_t off = kHeaderSize + 2 * n.keys.size();
+  for (size_t i = 0; i < n.keys.size(); i++) {
+    store16(pg + kHeaderSize + 2 * i, static_cast<uint16_t>(off));
+    char *e = pg + off;
+    const std::string &k = n.keys[i];
+    store16(e, static_cast<uint16_t>(k.size()));
+    if (n.leaf) {
+      const ValueSlot &v = n.values[i];
+      e[2] = static_cast<char>(v.overflow ? kOverflowFlag : 0);
+      store32(e + 3, v.len);
+      std::memcpy(e + kLeafEntryFixed, k.data(), k.size());
+      char *val = e + kLeafEntryFixed + k.size();
+      if (v.overflow) {
+        store32(val, v.overflow);
+        off += kLeafEntryFixed + k.size() + 4;
+      } else {
+        std::memcpy(val, v.inlineValue.data(), v.len);
+        off += kLeafEntryFixed + k.size() + v.len;
+      }
+    } else {
+      store32(e + 2, n.children[i + 1]);
+      std::memcpy(e + kBranchEntryFixed, k.data(), k.size());
+      off += kBranchEntryFixed + k.size();
+    }
+  }
+  return pgno;
+}
+
+// 写回节点，放不下时一分为二
+uint32_t BTreeStorageEngine::store(Node &n, uint32_t pgno, Split *split) {
+  if (n.EncodedSize() <= kPageSize) {
+    return writeNode(n, pgno);
+  }
+
+  // 选择让两边字节数最接近的分裂点
+  std::vector<size_t> entrySize(n.keys.size());
+  size_t total = 0;
+  for (size_t i = 0; i < n.keys.size(); i++) {
+    entrySize[i] = 2 + n.keys[i].size() +
+                   (n.leaf ? kLeafEntryFixed + (n.values[i].overflow ? 4 : n.values[i].len) : kBranchEntryFixed);
+    total += entrySize[i];
+  }
+  size_t best = 1, bestDiff = SIZE_MAX, left = 0;
+  for (size_t m = 1; m < n.keys.size(); m++) {
+    left += entrySize[m - 1];
+    size_t right = total - left;
+    size_t diff = left > right ? left - right : right - left;
+    if (diff < bestDiff) {
+      bestDiff = diff;
+      best = m;
+    }
+  }
+
+  Node right;
+  right.leaf = n.leaf;
+  if (n.leaf) {
+    right.keys.assign(n.keys.begin() + best, n.keys.end());
+    right.values.assign(std::make_move_iterator(n.values.begin() + best), std::make_move_iterator(n.values.end()));
+    n.keys.resize(best);
+    n.values.resize(best);
+    split->separator = right.keys.front();
+  } else {
+    // 内部节点的分隔 key 上移到父节点，不留在任何一边
+    split->separator = n.keys[best];
+    right.keys.assign(n.keys.begin() + best + 1, n.keys.end());
+    right.children.assign(n.children.begin() + best + 1, n.children.end());
+    n.keys.resize(best);
+    n.children.resize(best + 1);
+  }
+  const uint32_t leftPgno = writeNode(n, pgno);
+  split->right = writeNode(right, 0);
+  split->happened = true;
+  return leftPgno;
+}
+
+std::string BTreeStorageEngine::readValue(const char *entryValue, bool overflow, uint32_t len) const {
+  if (!overflow) {
+    return std::string(entryValue, len);
+  }
+  return std::string(page(load32(entryValue)), len);
+}
+
+// ==================== 树操作 ====================
+
+bool BTreeStorageEngine::findValue(const std::string &key, std::string *value) const {
+  uint32_t pgno = m_root;
+  while (pgno != 0) {
+    // 直接在映射的页上二分，不解码整个节点
+    const char *pg = page(pgno);
+    const bool leaf = load16(pg) == kLeafPage;
+    const uint16_t count = load16(pg + 2);
+    const size_t fixed = leaf ? kLeafEntryFixed : kBranchEntryFixed;
+    auto entryAt = [&](uint16_t i) { return pg + load16(pg + kHeaderSize + 2 * i); };
+    // lo = 第一个 key > 目标 的位置（upper bound）
+    uint16_t lo = 0, hi = count;
+    while (lo < hi) {
+      uint16_t mid = static_cast<uint16_t>((lo + hi) / 2);
+      const char *e = entryAt(mid);
+      if (compareKey(e + fixed, load16(e), key) <= 0) {
+        lo = static_cast<uint16_t>(mid + 1);
+      } else {
+        hi = mid;
+      }
+    }
+    if (!leaf) {
+      pgno = lo == 0 ? load32(pg + 4) : load32(entryAt(static_cast<uint16_t>(lo - 1)) + 2);
+      continue;
+    }
+    if (lo == 0) return false;
+    const char *e = entryAt(static_cast<uint16_t>(lo - 1));
+    const uint16_t klen = load16(e);
+    if (compareKey(e + kLeafEntryFixed, klen, key) != 0) return false;
+    *value = readValue(e + kLeafEntryFixed + klen, (static_cast<uint8_t>(e[2]) & kOverflowFlag) != 0, load32(e + 3));
+    return true;
+  }
+  return false;
+}
+
+uint32_t BTreeStorageEngine::insertRec(uint32_t pgno, const std::string &key, const ValueSlot &v, Split *split,
+                                       bool *added) {
+  Node n = readNode(pgno);
+  if (n.leaf) {
+    auto it = std::lower_bound(n.keys.begin(), n.keys.end(), key);
+    size_t pos = it - n.keys.begin();
+    if (it != n.keys.end() && *it == key) {
+      freeValue(n.values[pos]);
+      n.values[pos] = v;
+    } else {
+      n.keys.insert(it, key);
+      n.values.insert(n.values.begin() + pos, v);
+      *added = true;
+    }
+    return store(n, pgno, split);
+  }
+
+  size_t idx = std::upper_bound(n.keys.begin(), n.keys.end(), key) - n.keys.begin();
+  Split childSplit;
+  n.children[idx] = insertRec(n.children[idx], key, v, &childSplit, added);
+  if (childSplit.happened) {
+    n.keys.insert(n.keys.begin() + idx, childSplit.separator);
+    n.children.insert(n.children.begin() + idx + 1, childSplit.right);
+  }
+  return store(n, pgno, split);
+}
+
+void BTreeStorageEngine::putLocked(const std::string &key, const std::string &value) {
+  if (key.size() > kMaxKeySize) {
+    throw std::invalid_argument("[BTree] key too long: " + std::to_string(key.size()));
+  }
+  ValueSlot v;
+  v.len = static_cast<uint32_t>(value.size());
+  if (value.size() > kMaxInlineValue) {
+    v.overflow = allocRun(static_cast<uint32_t>((value.size() + kPageSize - 1) / kPageSize));
+    std::memcpy(page(v.overflow), value.data(), value.size());
+  } else {
+    v.inlineValue = value;
+  }
+
+  if (m_root == 0) {
+    Node leaf;
+    leaf.keys.push_back(key);
+    leaf.values.push_back(std::move(v));
+    m_root = writeNode(leaf, 0);
+    m_count = 1;
+    return;
+  }
+  Split split;
+  bool added = false;
+  uint32_t root = insertRec(m_root, key, v, &split, &added);
+  if (split.happened) {
+    Node newRoot;
+    newRoot.leaf = false;
+    newRoot.keys.push_back(split.separator);
+    newRoot.children = {root, split.right};
+    root = writeNode(newRoot, 0);
+  }
+  m_root = root;
+  if (added) m_count++;
+}
+
+bool BTreeStorageEngine::eraseRec(uint32_t pgno, const std::string &key, uint32_t *newPgno) {
+  Node n = readNode(pgno);
+  if (n.leaf) {
+    auto it = std::lower_bound(n.keys.begin(), n.keys.end(), key);
+    if (it == n.keys.end() || *it != key) return false;
+    size_t pos = it - n.keys.begin();
+    freeValue(n.values[pos]);
+    n.keys.erase(it);
+    n.values.erase(n.values.begin() + pos);
+  } else {
+    size_t idx = std::upper_bound(n.keys.begin(), n.keys.end(), key) - n.keys.begin();
+    uint32_t child = 0;
+    if (!eraseRec(n.children[idx], key, &child)) return false;
+    if (child != 0) {
+      n.children[idx] = child;
+    } else {
+      // 子节点删空了，连同一个分隔 key 一起去掉
+      n.children.erase(n.children.begin() + idx);
+      if (!n.keys.empty()) n.keys.erase(n.keys.begin() + (idx > 0 ? idx - 1 : 0));
+    }
+  }
+  if ((n.leaf && n.keys.empty()) || (!n.leaf && n.children.empty())) {
+    freePage(pgno);
+    *newPgno = 0;
+  } else {
+    *newPgno = writeNode(n, pgno);
+  }
+  return true;
+}
+
+template <typename F>
+void BTreeStorageEngine::forEachRec(char *base, uint32_t pgno, F &&visitor) {
+  if (pgno == 0) return;
+  Node n = decodeNode(pageAt(base, pgno));
+  if (n.leaf) {
+    for (size_t i = 0; i < n.keys.size(); i++) {
+      const ValueSlot &v = n.values[i];
+      if (v.overflow) {
+        visitor(n.keys[i], std::string(pageAt(base, v.overflow), v.len));
+      } else {
+        visitor(n.keys[i], v.inlineValue);
+      }
+    }
+  } else {
+    for (uint32_t c : n.children) forEachRec(base, c, visitor);
+  }
+}
+
+// 只有 bounded 的那条路径需要定位 start：内部节点跳过分隔键不大于 start 左边的子树，
+// 叶子从 lower_bound 开始；右侧的子树整棵都不小于 start
+bool BTreeStorageEngine::scanRec(uint32_t pgno, const std::string &start, bool bounded,
+                                 const std::function<bool(const std::string &, const std::string &)> &visitor) const {
+  if (pgno == 0) return true;
+  Node n = readNode(pgno);
+  if (n.leaf) {
+    size_t i = bounded ? std::lower_bound(n.keys.begin(), n.keys.end(), start) - n.keys.begin() : 0;
+    for (; i < n.keys.size(); i++) {
+      const ValueSlot &v = n.values[i];
+      bool go = v.overflow ? visitor(n.keys[i], std::string(page(v.overflow), v.len))
+                           : visitor(n.keys[i], v.inlineValue);
+      if (!go) return false;
+    }
+    return true;
+  }
+  size_t idx = bounded ? std::upper_bound(n.keys.begin(), n.keys.end(), start) - n.keys.begin() : 0;
+  for (size_t i = idx; i < n.children.size(); i++) {
+    if (!scanRec(n.children[i], start, bounded && i == idx, visitor)) return false;
+  }
+  return true;
+}
+
+// ==================== IStorageEngine ====================
+
+bool BTreeStorageEngine::Get(const std::string &key, std::string *value) {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  return findValue(key, value);
+}
+
+void BTreeStorageEngine::Put(const std::string &key, const std::string &value) {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  putLocked(key, value);
+}
+
+void BTreeStorageEngine::Append(const std::string &key, const std::string &value) {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  std::string existing;
+  findValue(key, &existing);
+  existing.append(value);
+  putLocked(key, existing);
+}
+
+void BTreeStorageEngine::Delete(const std::string &key) {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  if (m_root == 0) return;
+  uint32_t root = 0;
+  if (!eraseRec(m_root, key, &root)) return;
+  m_count--;
+  // 根节点只剩一个孩子时降低树高
+  while (root != 0 && load16(page(root)) == kBranchPage && load16(page(root) + 2) == 0) {
+    uint32_t child = load32(page(root) + 4);
+    freePage(root);
+    root = child;
+  }
+  m_root = root;
+}
+
+void BTreeStorageEngine::Scan(const std::string &start,
+                              const std::function<bool(const std::string &, const std::string &)> &visitor) {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  scanRec(m_root, start, true, visitor);
+}
+
+void BTreeStorageEngine::commit() {
+  if (::msync(m_map, static_cast<size_t>(m_pageCount) * kPageSize, MS_SYNC) != 0) {
+    throw std::runtime_error("[BTree] msync " + m_path + ": " + std::strerror(errno));
+  }
+  MetaPage meta{};
+  meta.magic = kMetaMagic;
+  meta.pageSize = kPageSize;
+  meta.root = m_root;
+  meta.dbId = m_dbId;
+  meta.txnId = m_txnId + 1;
+  meta.entryCount = m_count;
+  meta.pageCount = m_pageCount;
+  meta.checksum = metaChecksum(meta);
+  // 两个 meta 页轮流写，写坏的那一页校验失败，打开时回退到另一页
+  char *slot = page(static_cast<uint32_t>(meta.txnId % 2));
+  std::memcpy(slot, &meta, sizeof(meta));
+  if (::msync(slot, kPageSize, MS_SYNC) != 0) {
+    throw std::runtime_error("[BTree] msync meta " + m_path + ": " + std::strerror(errno));
+  }
+
+  m_txnId = meta.txnId;
+  m_committedRoot = m_root;
+  m_committedCount = m_count;
+  m_free.insert(m_free.end(), m_pendingFree.begin(), m_pendingFree.end());
+  m_pendingFree.clear();
+  m_dirty.clear();
+}
+
+void BTreeStorageEngine::SerializeTo(std::ostream &os) {
+  std::lock_guard<std::mutex> snapshotLock(m_snapshotMtx);
+  char *base;
+  uint32_t root;
+  std::string buf;
+  {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    commit();
+    coding::PutFixed64(&buf, kSnapshotMagic);
+    coding::PutFixed64(&buf, m_dbId);
+    coding::PutFixed64(&buf, m_txnId);
+    coding::PutFixed64(&buf, m_committedCount);
+    base = m_map;
+    root = m_committedRoot;
+    m_snapshotReading = true;
+  }
+  auto unpin = [this] {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_snapshotReading = false;
+    for (const auto &retired : m_retiredMaps) {
+      ::munmap(retired.first, retired.second);
+    }
+    m_retiredMaps.clear();
+  };
+
+  // 已提交的页只读不写，写者可以同时修改当前树
+  try {
+    os.write(buf.data(), static_cast<std::streamsize>(buf.size()));
+    forEachRec(base, root, [&os, &buf](const std::string &key, const std::string &value) {
+      buf.clear();
+      coding::PutVarint32(&buf, static_cast<uint32_t>(key.size()));
+      buf.append(key);
+      coding::PutVarint32(&buf, static_cast<uint32_t>(value.size()));
+      os.write(buf.data(), static_cast<std::streamsize>(buf.size()));
+      os.write(value.data(), static_cast<std::streamsize>(value.size()));
+    });
+  } catch (...) {
+    unpin();
+    throw;
+  }
+  unpin();
+}
+
+std::string BTreeStorageEngine::Serialize() {
+  std::ostringstream os;
+  SerializeTo(os);
+  return os.str();
+}
+
+void BTreeStorageEngine::Deserialize(const std::string &data) {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  freeTree(m_root);
+  m_root = 0;
+  m_count = 0;
+  if (data.empty()) {
+    return;
+  }
+
+  const char *p = data.data();
+  const char *limit = p + data.size();
+  uint64_t magic = 0, dbId = 0, txnId = 0, count = 0;
+  if (!coding::GetFixed64(&p, limit, &magic) || magic != kSnapshotMagic || !coding::GetFixed64(&p, limit, &dbId) ||
+      !coding::GetFixed64(&p, limit, &txnId) || !coding::GetFixed64(&p, limit, &count)) {
+    throw std::runtime_error("[BTree] bad snapshot header");
+  }
+
+  if (dbId == m_dbId && txnId == m_txnId) {
+    // 快照就是本文件最近一次提交：磁盘上的树原样可用，丢弃提交之后的修改即可
+    m_free.insert(m_free.end(), m_dirty.begin(), m_dirty.end());
+    m_dirty.clear();
+    m_pendingFree.clear();
+    m_root = m_committedRoot;
+    m_count = m_committedCount;
+    return;
+  }
+
+  for (uint64_t i = 0; i < count; i++) {
+    uint32_t klen = 0, vlen = 0;
+    if (!coding::GetVarint32(&p, limit, &klen) || static_cast<size_t>(limit - p) < klen) {
+      throw std::runtime_error("[BTree] bad snapshot entry");
+    }
+    std::string key(p, klen);
+    p += klen;
+    if (!coding::GetVarint32(&p, limit, &vlen) || static_cast<size_t>(limit - p) < vlen) {
+      throw std::runtime_error("[BTree] bad snapshot entry");
+    }
+    putLocked(key, std::string(p, vlen));
+    p += vlen;
+  }
+}
+
+size_t BTreeStorageEngine::Size() const {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  return m_count;
+}
+
+void BTreeStorageEngine::Clear() {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  freeTree(m_root);
+  m_root = 0;
+  m_count = 0;
+}
+
+uint64_t BTreeStorageEngine::CommittedTxnId() const {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  return m_txnId;
+}
+
+uint32_t BTreeStorageEngine::PageCount() const {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  return m_pageCount;
+}
+
+size_t BTreeStorageEngine::FreePageCount() const {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  return m_free.size();
+}
@@ -0,0 +1,859 @@
+#include "LsmStorageEngine.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "Coding.h"
+#include "logger.h"
+
+namespace {
+
+constexpr uint64_t kSnapshotMagic = 0x4c534d534e415031ULL;  // "LSMSNAP1"
+constexpr size_t kSnapshotChunkBytes = 64 << 10;  // 快照拷贝 SSTable 时每次读写的块大小
+constexpr int kMemTableMaxLevel = 12;
+constexpr size_t kMemEntryOverhead = 32;  // 估算每条 memtable 记录的节点开销
+
+bool parseTableFileName(const std::string& name, uint64_t* number) {
+  const std::string suffix = ".sst";
+  if (name.size() <= suffix.size() || name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0) {
+    return false;
+  }
+  uint64_t n = 0;
+  for (size_t i = 0; i < name.size() - suffix.size(); i++) {
+    if (name[i] < '0' || name[i] > '9') return false;
+    n = n * 10 + static_cast<uint64_t>(name[i] - '0');
+  }
+  *number = n;
+  return true;
+}
+
+std::vector<std::string> listDir(const std::string& dir) {
+  std::vector<std::string> names;
+  DIR* d = ::opendir(dir.c_str());
+  if (d == nullptr) {
+    return names;
+  }
+  while (struct dirent* ent = ::readdir(d)) {
+    names.emplace_back(ent->d_name);
+  }
+  ::closedir(d);
+  return names;
+}
+
+void writeFileSync(const std::string& path, const char* data, size_t size) {
+  int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    throw std::runtime_error("[LSM] open " + path + ": " + std::strerror(errno));
+  }
+  while (size > 0) {
+    ssize_t n = ::write(fd, data, size);
+    if (n < 0 && errno == EINTR) continue;
+    if (n < 0) {
+      ::close(fd);
+      throw std::runtime_error("[LSM] write " + path + ": " + std::strerror(errno));
+    }
+    data += n;
+    size -= static_cast<size_t>(n);
+  }
+  ::fsync(fd);
+  ::close(fd);
+}
+
+// memtable 编码：1字节类型 + 值
+std::string encodeMemValue(LsmValueType type, const std::string& value) {
+  std::string enc;
+  enc.reserve(value.size() + 1);
+  enc.push_back(static_cast<char>(type));
+  enc.append(value);
+  return enc;
+}
+
+struct MemEntry {
+  std::string key;
+  LsmValueType type;
+  std::string value;
+};
+
+/**
+ * @brief 基于有序数组的迭代器（memtable 拷贝）
+ */
+class VectorIterator : public LsmIterator {
+ public:
+  explicit VectorIterator(std::vector<MemEntry> entries) : m_entries(std::move(entries)), m_pos(0) {}
+  bool Valid() const override { return m_pos < m_entries.size(); }
+  void Next() override { m_pos++; }
+  const std::string& Key() const override { return m_entries[m_pos].key; }
+  LsmValueType Type() const override { return m_entries[m_pos].type; }
+  const std::string& Value() const override { return m_entries[m_pos].value; }
+
+ private:
+  std::vector<MemEntry> m_entries;
+  size_t m_pos;
+};
+
+/**
+ * @brief 多路归并迭代器
+ *
+ * children 按新旧排列（下标越小越新），同一个 key 只输出最新的那条，旧版本被跳过。
+ * 子迭代器数量很少（memtable + L0 + 每层一个），线性挑选最小值即可。
+ */
+class MergingIterator : public LsmIterator {
+ public:
+  explicit MergingIterator(std::vector<std::unique_ptr<LsmIterator>> children)
+      : m_children(std::move(children)), m_current(-1) {
+    findSmallest();
+  }
+
+  bool Valid() const override { return m_current >= 0; }
+  const std::string& Key() const override { return m_children[m_current]->Key(); }
+  LsmValueType Type() const override { return m_children[m_current]->Type(); }
+  const std::string& Value() const override { return m_children[m_current]->Value(); }
+
+  void Next() override {
+    const std::string key = Key();
+    for (auto& child : m_children) {
+      while (child->Valid() && child->Key() == key) {
+        child->Next();
+      }
+    }
+    findSmallest();
+  }
+
+ private:
+  void findSmallest() {
+    m_current = -1;
+    for (size_t i = 0; i < m_children.size(); i++) {
+      if (!m_children[i]->Valid()) continue;
+      if (m_current < 0 || m_children[i]->Key() < m_children[m_current]->Key()) {
+        m_current = static_cast<int>(i);
+      }
+    }
+  }
+
+  std::vector<std::unique_ptr<LsmIterator>> m_children;
+  int m_current;
+};
+
+std::vector<MemEntry> copyMemTable(SkipList<std::string, std::string>* mem) {
+  std::vector<MemEntry> entries;
+  if (mem == nullptr) {
+    return entries;
+  }
+  mem->for_each_element([&entries](const std::string& key, const std::string& enc) {
+    entries.push_back(MemEntry{key, static_cast<LsmValueType>(static_cast<uint8_t>(enc[0])), enc.substr(1)});
+  });
+  return entries;
+}
+
+// 拷贝 memtable 中不小于 start 的部分
+std::vector<MemEntry> copyMemTableFrom(SkipList<std::string, std::string>* mem, const std::string& start) {
+  std::vector<MemEntry> entries;
+  if (mem == nullptr) {
+    return entries;
+  }
+  auto it = mem->new_iterator();
+  for (it.seek(start); it.valid(); it.next()) {
+    const std::string& enc = it.value();
+    entries.push_back(MemEntry{it.key(), static_cast<LsmValueType>(static_cast<uint8_t>(enc[0])), enc.substr(1)});
+  }
+  return entries;
+}
+
+}  // namespace
+
+// ==================== FileMeta ====================
+
+LsmStorageEngine::FileMeta::~FileMeta() {
+  table.reset();
+  if (obsolete.load()) {
+    ::unlink(path.c_str());
+    if (cache != nullptr) {
+      cache->EraseFile(number);
+    }
+  }
+}
+
+// ==================== 构造/析构 ====================
+
+LsmStorageEngine::LsmStorageEngine(LsmOptions options)
+    : m_options(std::move(options)),
+      m_dbId(0),
+      m_blockCache(m_options.blockCacheBytes),
+      m_memBytes(0),
+      m_nextFileNumber(1),
+      m_bgBusy(false),
+      m_shutdown(false) {
+  if (::mkdir(m_options.dir.c_str(), 0755) != 0 && errno != EEXIST) {
+    throw std::runtime_error("[LSM] mkdir " + m_options.dir + ": " + std::strerror(errno));
+  }
+
+  // 目录身份：第一次打开时随机生成并落盘
+  const std::string identityPath = m_options.dir + "/IDENTITY";
+  std::ifstream identityIn(identityPath);
+  if (!(identityIn >> m_dbId) || m_dbId == 0) {
+    std::random_device rd;
+    m_dbId = (static_cast<uint64_t>(rd()) << 32) | rd();
+    if (m_dbId == 0) m_dbId = 1;
+    std::string text = std::to_string(m_dbId) + "\n";
+    writeFileSync(identityPath, text.data(), text.size());
+  }
+
+  // 文件号必须比目录中已有的都大，旧文件可能被随后安装的快照引用
+  for (const auto& name : listDir(m_options.dir)) {
+    uint64_t number = 0;
+    if (parseTableFileName(name, &number) && number >= m_nextFileNumber) {
+      m_nextFileNumber = number + 1;
+    }
+  }
+
+  m_mem = std::make_shared<MemTable>(kMemTableMaxLevel);
+  m_current = std::make_shared<Version>();
+  m_bgThread = std::thread(&LsmStorageEngine::backgroundLoop, this);
+}
+
+LsmStorageEngine::~LsmStorageEngine() {
+  {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_shutdown = true;
+  }
+  m_bgCv.notify_all();
+  if (m_bgThread.joinable()) {
+    m_bgThread.join();
+  }
+}
+
+std::string LsmStorageEngine::tablePath(uint64_t number) const {
+  return m_options.dir + "/" + std::to_string(number) + ".sst";
+}
+
+uint64_t LsmStorageEngine::newFileNumber() { return m_nextFileNumber++; }
+
+LsmStorageEngine::FileMetaPtr LsmStorageEngine::openTable(uint64_t number) {
+  auto meta = std::make_shared<FileMeta>();
+  meta->number = number;
+  meta->path = tablePath(number);
+  meta->table = SSTableReader::Open(meta->path, number, &m_blockCache);
+  meta->size = meta->table->FileSize();
+  meta->smallest = meta->table->SmallestKey();
+  meta->largest = meta->table->LargestKey();
+  meta->cache = &m_blockCache;
+  return meta;
+}
+
+// ==================== 读写接口 ====================
+
+bool LsmStorageEngine::Get(const std::string& key, std::string* value) { return getInternal(key, value); }
+
+bool LsmStorageEngine::getInternal(const std::string& key, std::string* value) {
+  VersionPtr v;
+  {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    for (auto* mem : {m_mem.get(), m_imm.get()}) {
+      const std::string* enc = mem != nullptr ? mem->find(key) : nullptr;
+      if (enc != nullptr) {
+        if (static_cast<LsmValueType>(static_cast<uint8_t>((*enc)[0])) == LsmValueType::kDeletion) {
+          return false;
+        }
+        value->assign(*enc, 1, std::string::npos);
+        return true;
+      }
+    }
+    v = m_current;
+  }
+
+  // SSTable 不可变，持有版本后无锁查找
+  for (const auto& f : v->levels[0]) {
+    if (key < f->smallest || key > f->largest) continue;
+    auto r = f->table->Get(key, value);
+    if (r != SSTableReader::LookupResult::kNotFound) {
+      return r == SSTableReader::LookupResult::kFound;
+    }
+  }
+  for (int level = 1; level < kNumLevels; level++) {
+    const auto& files = v->levels[level];
+    auto it = std::lower_bound(files.begin(), files.end(), key,
+                               [](const FileMetaPtr& f, const std::string& k) { return f->largest < k; });
+    if (it == files.end() || key < (*it)->smallest) continue;
+    auto r = (*it)->table->Get(key, value);
+    if (r != SSTableReader::LookupResult::kNotFound) {
+      return r == SSTableReader::LookupResult::kFound;
+    }
+  }
+  return false;
+}
+
+void LsmStorageEngine::memInsert(const std::string& key, LsmValueType type, const std::string& value) {
+  std::string enc = encodeMemValue(type, value);
+  m_memBytes += key.size() + enc.size() + kMemEntryOverhead;
+  std::string old;
+  if (!m_mem->upsert(key, std::move(enc), &old)) {
+    // 覆盖了 memtable 里同一个 key 的旧条目，先去掉它的计数
+    if (static_cast<LsmValueType>(static_cast<uint8_t>(old[0])) == LsmValueType::kDeletion) {
+      m_memCount.deletions--;
+    } else {
+      m_memCount.values--;
+    }
+  }
+  if (type == LsmValueType::kDeletion) {
+    m_memCount.deletions++;
+  } else {
+    m_memCount.values++;
+  }
+}
+
+void LsmStorageEngine::makeRoomForWrite(std::unique_lock<std::mutex>& lock) {
+  while (true) {
+    if (!m_bgError.empty()) {
+      throw std::runtime_error("[LSM] background error: " + m_bgError);
+    }
+    if (static_cast<int>(m_current->levels[0].size()) >= m_options.l0StopWritesTrigger) {
+      // L0 堆积过多，读放大失控，等压缩追上来
+      m_bgCv.wait(lock);
+    } else if (m_memBytes < m_options.memtableBytes) {
+      return;
+    } else if (m_imm) {
+      // 上一个 immutable memtable 还没刷完
+      m_bgCv.wait(lock);
+    } else {
+      m_imm = m_mem;
+      m_mem = std::make_shared<MemTable>(kMemTableMaxLevel);
+      m_memBytes = 0;
+      m_immCount = m_memCount;
+      m_memCount = KeyCount();
+      m_bgCv.notify_all();
+    }
+  }
+}
+
+void LsmStorageEngine::Put(const std::string& key, const std::string& value) {
+  std::lock_guard<std::mutex> writeLock(m_writeMtx);
+  std::unique_lock<std::mutex> lock(m_mtx);
+  makeRoomForWrite(lock);
+  memInsert(key, LsmValueType::kValue, value);
+}
+
+void LsmStorageEngine::Append(const std::string& key, const std::string& value) {
+  std::lock_guard<std::mutex> writeLock(m_writeMtx);
+  std::string existing;
+  getInternal(key, &existing);
+  existing.append(value);
+
+  std::unique_lock<std::mutex> lock(m_mtx);
+  makeRoomForWrite(lock);
+  memInsert(key, LsmValueType::kValue, existing);
+}
+
+void LsmStorageEngine::Delete(const std::string& key) {
+  std::lock_guard<std::mutex> writeLock(m_writeMtx);
+  std::unique_lock<std::mutex> lock(m_mtx);
+  makeRoomForWrite(lock);
+  memInsert(key, LsmValueType::kDeletion, "");
+}
+
+// ==================== 后台刷盘与压缩 ====================
+
+uint64_t LsmStorageEngine::maxBytesForLevel(int level) const {
+  uint64_t result = m_options.l1MaxBytes;
+  for (int i = 1; i < level; i++) {
+    result *= m_options.levelMultiplier;
+  }
+  return result;
+}
+
+uint64_t LsmStorageEngine::totalBytes(const std::vector<FileMetaPtr>& files) {
+  uint64_t sum = 0;
+  for (const auto& f : files) sum += f->size;
+  return sum;
+}
+
+bool LsmStorageEngine::needsCompaction(const Version& v) const {
+  if (static_cast<int>(v.levels[0].size()) >= m_options.l0CompactionTrigger) {
+    return true;
+  }
+  for (int level = 1; level < kNumLevels - 1; level++) {
+    if (totalBytes(v.levels[level]) > maxBytesForLevel(level)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool LsmStorageEngine::pickCompaction(const Version& v, Compaction* c) {
+  double bestScore = static_cast<double>(v.levels[0].size()) / m_options.l0CompactionTrigger;
+  int bestLevel = 0;
+  for (int level = 1; level < kNumLevels - 1; level++) {
+    double score = static_cast<double>(totalBytes(v.levels[level])) / maxBytesForLevel(level);
+    if (score > bestScore) {
+      bestScore = score;
+      bestLevel = level;
+    }
+  }
+  if (bestScore < 1.0) {
+    return false;
+  }
+
+  c->level = bestLevel;
+  c->inputs[0].clear();
+  c->inputs[1].clear();
+  if (bestLevel == 0) {
+    // L0 文件之间互相重叠，全部一起下沉
+    c->inputs[0] = v.levels[0];
+  } else {
+    // 轮转选择：从上次压缩结束的位置继续，保证整层都会被轮到
+    const auto& files = v.levels[bestLevel];
+    FileMetaPtr chosen = files.front();
+    for (const auto& f : files) {
+      if (f->largest > m_compactPointer[bestLevel]) {
+        chosen = f;
+        break;
+      }
+    }
+    c->inputs[0].push_back(chosen);
+    m_compactPointer[bestLevel] = chosen->largest;
+  }
+
+  std::string smallest = c->inputs[0].front()->smallest;
+  std::string largest = c->inputs[0].front()->largest;
+  for (const auto& f : c->inputs[0]) {
+    smallest = std::min(smallest, f->smallest);
+    largest = std::max(largest, f->largest);
+  }
+  for (const auto& f : v.levels[bestLevel + 1]) {
+    if (!(f->largest < smallest || f->smallest > largest)) {
+      c->inputs[1].push_back(f);
+    }
+  }
+  return true;
+}
+
+bool LsmStorageEngine::isBaseLevelForKey(const Version& v, int level, const std::string& key) {
+  for (int lvl = level + 1; lvl < kNumLevels; lvl++) {
+    for (const auto& f : v.levels[lvl]) {
+      if (key >= f->smallest && key <= f->largest) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+LsmStorageEngine::FileMetaPtr LsmStorageEngine::writeLevel0(const std::shared_ptr<MemTable>& mem) {
+  uint64_t number;
+  {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    number = newFileNumber();
+    m_pendingOutputs.insert(number);
+  }
+  SSTableBuilder builder(tablePath(number), m_options.blockSize, m_options.bloomBitsPerKey);
+  mem->for_each_element([&builder](const std::string& key, const std::string& enc) {
+    builder.Add(key, static_cast<LsmValueType>(static_cast<uint8_t>(enc[0])), enc.substr(1));
+  });
+  if (builder.NumEntries() == 0) {
+    return nullptr;
+  }
+  builder.Finish();
+  return openTable(number);
+}
+
+std::vector<LsmStorageEngine::FileMetaPtr> LsmStorageEngine::doCompaction(const Compaction& c,
+                                                                          const VersionPtr& base) {
+  std::vector<std::unique_ptr<LsmIterator>> children;
+  for (int which = 0; which < 2; which++) {
+    for (const auto& f : c.inputs[which]) {
+      children.push_back(f->table->NewIterator(false));
+    }
+  }
+  MergingIterator merged(std::move(children));
+
+  const int outputLevel = c.level + 1;
+  std::vector<FileMetaPtr> outputs;
+  std::unique_ptr<SSTableBuilder> builder;
+  uint64_t number = 0;
+  for (; merged.Valid(); merged.Next()) {
+    // 更深的层没有这个 key 时，删除标记已经没有要遮挡的数据，可以丢弃
+    if (merged.Type() == LsmValueType::kDeletion && isBaseLevelForKey(*base, outputLevel, merged.Key())) {
+      continue;
+    }
+    if (!builder) {
+      {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        number = newFileNumber();
+        m_pendingOutputs.insert(number);
+      }
+      builder.reset(new SSTableBuilder(tablePath(number), m_options.blockSize, m_options.bloomBitsPerKey));
+    }
+    builder->Add(merged.Key(), merged.Type(), merged.Value());
+    if (builder->FileSize() >= m_options.targetFileBytes) {
+      builder->Finish();
+      builder.reset();
+      outputs.push_back(openTable(number));
+    }
+  }
+  if (builder) {
+    builder->Finish();
+    builder.reset();
+    outputs.push_back(openTable(number));
+  }
+  return outputs;
+}
+
+void LsmStorageEngine::installVersion(std::shared_ptr<Version> v) {
+  std::set<uint64_t> live;
+  for (const auto& files : v->levels) {
+    for (const auto& f : files) live.insert(f->number);
+  }
+  for (const auto& files : m_current->levels) {
+    for (const auto& f : files) {
+      if (live.count(f->number) == 0) {
+        f->obsolete = true;
+      }
+    }
+  }
+  m_current = std::move(v);
+  m_tableCount = KeyCount();
+  for (const auto& files : m_current->levels) {
+    for (const auto& f : files) {
+      const auto deletions = static_cast<int64_t>(f->table->NumDeletions());
+      m_tableCount.values += static_cast<int64_t>(f->table->NumEntries()) - deletions;
+      m_tableCount.deletions += deletions;
+    }
+  }
+}
+
+void LsmStorageEngine::backgroundLoop() {
+  std::unique_lock<std::mutex> lock(m_mtx);
+  while (true) {
+    m_bgCv.wait(lock, [this] {
+      return m_shutdown || (m_bgError.empty() && (m_imm != nullptr || needsCompaction(*m_current)));
+    });
+    if (m_shutdown) {
+      break;
+    }
+    m_bgBusy = true;
+    try {
+      if (m_imm) {
+        auto imm = m_imm;
+        lock.unlock();
+        FileMetaPtr meta = writeLevel0(imm);
+        lock.lock();
+        auto v = std::make_shared<Version>(*m_current);
+        if (meta) {
+          v->levels[0].insert(v->levels[0].begin(), meta);
+        }
+        installVersion(v);
+        m_imm.reset();
+        m_immCount = KeyCount();
+      } else {
+        VersionPtr base = m_current;
+        Compaction c;
+        if (pickCompaction(*base, &c)) {
+          std::vector<FileMetaPtr> outputs;
+          if (c.inputs[0].size() == 1 && c.inputs[1].empty()) {
+            // 下一层没有重叠文件，直接把文件挪下去，不重写数据
+            outputs = c.inputs[0];
+          } else {
+            lock.unlock();
+            outputs = doCompaction(c, base);
+            lock.lock();
+          }
+          auto v = std::make_shared<Version>(*m_current);
+          for (int which = 0; which < 2; which++) {
+            auto& files = v->levels[c.level + which];
+            for (const auto& in : c.inputs[which]) {
+              files.erase(std::remove(files.begin(), files.end(), in), files.end());
+            }
+          }
+          auto& out = v->levels[c.level + 1];
+          out.insert(out.end(), outputs.begin(), outputs.end());
+          std::sort(out.begin(), out.end(),
+                    [](const FileMetaPtr& a, const FileMetaPtr& b) { return a->smallest < b->smallest; });
+          installVersion(v);
+          LOG_INFO("[LSM] compacted {}+{} files L{} -> {} files L{}", c.inputs[0].size(), c.inputs[1].size(),
+                   c.level, outputs.size(), c.level + 1);
+        }
+      }
+    } catch (const std::exception& e) {
+      if (!lock.owns_lock()) {
+        lock.lock();
+      }
+      m_bgError = e.what();
+      LOG_ERROR("[LSM] background work failed: {}", m_bgError);
+    }
+    m_pendingOutputs.clear();
+    m_bgBusy = false;
+    m_bgCv.notify_all();
+  }
+}
+
+void LsmStorageEngine::waitBackgroundIdle(std::unique_lock<std::mutex>& lock) {
+  m_bgCv.wait(lock, [this] { return !m_bgBusy; });
+}
+
+void LsmStorageEngine::WaitForBackgroundIdle() {
+  std::unique_lock<std::mutex> lock(m_mtx);
+  m_bgCv.wait(lock, [this] {
+    return m_shutdown || !m_bgError.empty() || (!m_bgBusy && !m_imm && !needsCompaction(*m_current));
+  });
+}
+
+int LsmStorageEngine::NumFilesAtLevel(int level) const {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  return static_cast<int>(m_current->levels[level].size());
+}
+
+void LsmStorageEngine::removeGarbageFiles() {
+  std::set<uint64_t> live(m_pendingOutputs.begin(), m_pendingOutputs.end());
+  for (const VersionPtr& v : {m_current, m_pinned}) {
+    if (!v) continue;
+    for (const auto& files : v->levels) {
+      for (const auto& f : files) live.insert(f->number);
+    }
+  }
+  for (const auto& name : listDir(m_options.dir)) {
+    uint64_t number = 0;
+    if (parseTableFileName(name, &number) && live.count(number) == 0) {
+      ::unlink(tablePath(number).c_str());
+      m_blockCache.EraseFile(number);
+    }
+  }
+}
+
+// ==================== 快照 ====================
+
+std::string LsmStorageEngine::Serialize() {
+  std::ostringstream os;
+  SerializeTo(os);
+  return os.str();
+}
+
+void LsmStorageEngine::SerializeTo(std::ostream& os) {
+  struct PinnedFile {
+    int level;
+    uint64_t number;
+    std::ifstream in;
+  };
+  std::map<std::string, MemEntry> memEntries;
+  std::vector<PinnedFile> files;
+  {
+    // memtable 和版本在同一次加锁内取得，是同一时刻的数据；写入只在 m_mtx 内改动它们，不需要 m_writeMtx
+    std::lock_guard<std::mutex> lock(m_mtx);
+    for (auto* mem : {m_imm.get(), m_mem.get()}) {  // 先旧后新，新值覆盖旧值
+      for (auto& e : copyMemTable(mem)) {
+        memEntries[e.key] = std::move(e);
+      }
+    }
+    m_pinned = m_current;  // 快照引用的文件在下一次快照前保留
+    removeGarbageFiles();
+    // 在锁内打开文件：之后即使被压缩删除，已打开的文件仍然可读
+    for (int level = 0; level < kNumLevels; level++) {
+      for (const auto& f : m_pinned->levels[level]) {
+        PinnedFile pinned{level, f->number, std::ifstream(f->path, std::ios::binary)};
+        if (!pinned.in) {
+          throw std::runtime_error("[LSM] cannot read " + f->path);
+        }
+        files.push_back(std::move(pinned));
+      }
+    }
+  }
+
+  // 文件内容随快照一起发送，follower 安装 leader 的快照时需要；按块拷贝到输出流，不整份读进内存
+  std::string header;
+  coding::PutFixed64(&header, kSnapshotMagic);
+  coding::PutFixed64(&header, m_dbId);
+  coding::PutVarint32(&header, static_cast<uint32_t>(files.size()));
+  os.write(header.data(), static_cast<std::streamsize>(header.size()));
+  std::vector<char> chunk(kSnapshotChunkBytes);
+  for (auto& f : files) {
+    f.in.seekg(0, std::ios::end);
+    const uint64_t size = static_cast<uint64_t>(f.in.tellg());
+    f.in.seekg(0, std::ios::beg);
+    header.clear();
+    coding::PutVarint32(&header, static_cast<uint32_t>(f.level));
+    coding::PutVarint64(&header, f.number);
+    coding::PutVarint64(&header, size);
+    os.write(header.data(), static_cast<std::streamsize>(header.size()));
+    uint64_t remaining = size;
+    while (remaining > 0) {
+      const auto n = static_cast<std::streamsize>(std::min<uint64_t>(remaining, chunk.size()));
+      if (!f.in.read(chunk.data(), n)) {
+        throw std::runtime_error("[LSM] short read of table " + std::to_string(f.number));
+      }
+      os.write(chunk.data(), n);
+      remaining -= static_cast<uint64_t>(n);
+    }
+  }
+  std::string mem;
+  coding::PutVarint64(&mem, memEntries.size());
+  for (const auto& item : memEntries) {
+    coding::PutLengthPrefixed(&mem, item.second.key);
+    mem.push_back(static_cast<char>(item.second.type));
+    coding::PutLengthPrefixed(&mem, item.second.value);
+  }
+  os.write(mem.data(), static_cast<std::streamsize>(mem.size()));
+}
+
+void LsmStorageEngine::Deserialize(const std::string& data) {
+  if (data.empty()) {
+    Clear();
+    return;
+  }
+  std::lock_guard<std::mutex> writeLock(m_writeMtx);
+
+  struct SnapshotFile {
+    uint32_t level;
+    uint64_t number;
+    uint64_t size;
+    const char* bytes;
+  };
+  const char* p = data.data();
+  const char* limit = p + data.size();
+  uint64_t magic = 0, dbId = 0;
+  uint32_t fileCount = 0;
+  if (!coding::GetFixed64(&p, limit, &magic) || magic != kSnapshotMagic || !coding::GetFixed64(&p, limit, &dbId) ||
+      !coding::GetVarint32(&p, limit, &fileCount)) {
+    throw std::runtime_error("[LSM] bad snapshot header");
+  }
+  std::vector<SnapshotFile> files;
+  for (uint32_t i = 0; i < fileCount; i++) {
+    SnapshotFile f;
+    if (!coding::GetVarint32(&p, limit, &f.level) || f.level >= kNumLevels || !coding::GetVarint64(&p, limit, &f.number) ||
+        !coding::GetVarint64(&p, limit, &f.size) || static_cast<uint64_t>(limit - p) < f.size) {
+      throw std::runtime_error("[LSM] bad snapshot file entry");
+    }
+    f.bytes = p;
+    p += f.size;
+    files.push_back(f);
+  }
+  uint64_t memCount = 0;
+  if (!coding::GetVarint64(&p, limit, &memCount)) {
+    throw std::runtime_error("[LSM] bad snapshot memtable");
+  }
+  std::vector<MemEntry> memEntries;
+  for (uint64_t i = 0; i < memCount; i++) {
+    MemEntry e;
+    if (!coding::GetLengthPrefixed(&p, limit, &e.key) || p >= limit) {
+      throw std::runtime_error("[LSM] bad snapshot memtable entry");
+    }
+    e.type = static_cast<LsmValueType>(static_cast<uint8_t>(*p++));
+    if (!coding::GetLengthPrefixed(&p, limit, &e.value)) {
+      throw std::runtime_error("[LSM] bad snapshot memtable entry");
+    }
+    memEntries.push_back(std::move(e));
+  }
+
+  std::unique_lock<std::mutex> lock(m_mtx);
+  waitBackgroundIdle(lock);
+
+  std::unordered_map<uint64_t, FileMetaPtr> known;
+  for (const VersionPtr& v : {m_current, m_pinned}) {
+    if (!v) continue;
+    for (const auto& levelFiles : v->levels) {
+      for (const auto& f : levelFiles) known[f->number] = f;
+    }
+  }
+
+  auto v = std::make_shared<Version>();
+  for (const auto& f : files) {
+    FileMetaPtr meta;
+    if (dbId == m_dbId) {
+      // 本节点自己的快照：文件还在就直接引用
+      auto it = known.find(f.number);
+      if (it != known.end()) {
+        meta = it->second;
+        meta->obsolete = false;
+      } else {
+        struct stat st;
+        if (::stat(tablePath(f.number).c_str(), &st) == 0 && static_cast<uint64_t>(st.st_size) == f.size) {
+          meta = openTable(f.number);
+        }
+      }
+    }
+    if (!meta) {
+      uint64_t number = newFileNumber();
+      writeFileSync(tablePath(number), f.bytes, f.size);
+      meta = openTable(number);
+    }
+    v->levels[f.level].push_back(meta);
+  }
+  for (int level = 1; level < kNumLevels; level++) {
+    std::sort(v->levels[level].begin(), v->levels[level].end(),
+              [](const FileMetaPtr& a, const FileMetaPtr& b) { return a->smallest < b->smallest; });
+  }
+
+  m_mem = std::make_shared<MemTable>(kMemTableMaxLevel);
+  m_imm.reset();
+  m_memBytes = 0;
+  m_memCount = KeyCount();
+  m_immCount = KeyCount();
+  for (const auto& e : memEntries) {
+    memInsert(e.key, e.type, e.value);
+  }
+  installVersion(v);
+  m_pinned = m_current;
+  removeGarbageFiles();
+  m_bgCv.notify_all();
+}
+
+// ==================== 范围读 ====================
+
+void LsmStorageEngine::Scan(const std::string& start,
+                            const std::function<bool(const std::string&, const std::string&)>& visitor) {
+  // 在 m_mtx 下同时拿到 memtable 拷贝和当前版本，合并出来的就是同一时刻的数据；
+  // 持有版本的 shared_ptr 期间，被压缩替换掉的文件不会被删除
+  std::vector<MemEntry> memEntries, immEntries;
+  VersionPtr v;
+  {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    memEntries = copyMemTableFrom(m_mem.get(), start);
+    immEntries = copyMemTableFrom(m_imm.get(), start);
+    v = m_current;
+  }
+  std::vector<std::unique_ptr<LsmIterator>> children;
+  children.emplace_back(new VectorIterator(std::move(memEntries)));
+  children.emplace_back(new VectorIterator(std::move(immEntries)));
+  for (const auto& files : v->levels) {
+    for (const auto& f : files) {
+      if (f->largest < start) {
+        continue;
+      }
+      children.push_back(f->table->NewIterator(true, start));
+    }
+  }
+  for (MergingIterator it(std::move(children)); it.Valid(); it.Next()) {
+    if (it.Type() == LsmValueType::kValue && !visitor(it.Key(), it.Value())) {
+      break;
+    }
+  }
+}
+
+// ==================== 管理接口 ====================
+
+size_t LsmStorageEngine::Size() const {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  const int64_t values = m_memCount.values + m_immCount.values + m_tableCount.values;
+  const int64_t deletions = m_memCount.deletions + m_immCount.deletions + m_tableCount.deletions;
+  return values > deletions ? static_cast<size_t>(values - deletions) : 0;
+}
+
+void LsmStorageEngine::Clear() {
+  std::lock_guard<std::mutex> writeLock(m_writeMtx);
+  std::unique_lock<std::mutex> lock(m_mtx);
+  waitBackgroundIdle(lock);
+  m_mem = std::make_shared<MemTable>(kMemTableMaxLevel);
+  m_imm.reset();
+  m_memBytes = 0;
+  m_memCount = KeyCount();
+  m_immCount = KeyCount();
+  installVersion(std::make_shared<Version>());
+}
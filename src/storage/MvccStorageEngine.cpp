@@ -0,0 +1,599 @@
+#include "MvccStorageEngine.h"
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_set>
+
+#include "skipList.h"
+
+namespace {
+
+// 把 ReadView 包装成 IReadView，视图存活期间 GC 不回收它能看到的版本
+class MvccReadView : public IReadView {
+ public:
+  explicit MvccReadView(MvccStorageEngine::ReadView view) : m_view(std::move(view)) {}
+
+  int64_t Index() const override { return m_view.Index(); }
+  bool Get(const std::string &key, std::string *value) const override { return m_view.Get(key, value); }
+  int64_t Version(const std::string &key) const override { return m_view.Version(key); }
+  void Scan(const std::string &start,
+            const std::function<bool(const std::string &, const std::string &)> &visitor) const override {
+    std::string flat;
+    m_view.Scan(start, [&](const std::string &key, const ChunkedValue &value) {
+      flat.clear();
+      value.AppendTo(&flat);
+      return visitor(key, flat);
+    });
+  }
+  void SerializeTo(std::ostream &os) const override { m_view.SerializeTo(os); }
+  bool CollectVersions(std::vector<int64_t> *out) const override {
+    m_view.CollectVersions(out);
+    return true;
+  }
+
+ private:
+  MvccStorageEngine::ReadView m_view;
+};
+
+}  // namespace
+
+struct MvccStorageEngine::Version {
+  int64_t index;     // 对读者可见的索引
+  int64_t modIndex;  // 对外的版本号：写入这个值的日志索引。安装快照时沿用快照里的值，各副本一致
+  bool deleted;
+  ChunkedValue value;
+  std::atomic<Version *> older{nullptr};  // 更旧的版本
+
+  Version(int64_t idx, bool del, ChunkedValue v) : index(idx), modIndex(idx), deleted(del), value(std::move(v)) {}
+};
+
+struct MvccStorageEngine::Node {
+  std::string key;
+  std::atomic<Version *> versions{nullptr};  // 最新版本在前
+  int level;
+  bool dirty = false;  // 是否在 m_dirty 中，只有写者访问
+  std::unique_ptr<std::atomic<Node *>[]> next;
+
+  Node(const std::string &k, int lv) : key(k), level(lv), next(new std::atomic<Node *>[lv]()) {}
+};
+
+// ==================== 构造/析构 ====================
+
+MvccStorageEngine::MvccStorageEngine()
+    : m_head(newNode("", kMaxLevel)),
+      m_level(1),
+      m_rng(0x6d766363),
+      m_applied(0),
+      m_liveCount(0),
+      m_versionCount(0),
+      m_lastWrite(0),
+      m_applying(0),
+      m_writesSinceGc(0),
+      m_parallel(false),
+      m_parallelWrites(0),
+      m_nextTicket(1),
+      m_horizon(0) {}
+
+MvccStorageEngine::~MvccStorageEngine() {
+  for (auto &item : m_retired) {
+    freeNode(item.second);
+  }
+  Node *node = m_head->next[0].load(std::memory_order_relaxed);
+  while (node != nullptr) {
+    Node *next = node->next[0].load(std::memory_order_relaxed);
+    freeNode(node);
+    node = next;
+  }
+  freeNode(m_head);
+}
+
+MvccStorageEngine::Node *MvccStorageEngine::newNode(const std::string &key, int level) { return new Node(key, level); }
+
+void MvccStorageEngine::freeNode(Node *node) {
+  Version *v = node->versions.load(std::memory_order_relaxed);
+  while (v != nullptr) {
+    Version *older = v->older.load(std::memory_order_relaxed);
+    delete v;
+    m_versionCount.fetch_sub(1, std::memory_order_relaxed);
+    v = older;
+  }
+  delete node;
+}
+
+int MvccStorageEngine::randomLevel() {
+  int level = 1;
+  while (level < kMaxLevel && (m_rng() & 3) == 0) {
+    level++;
+  }
+  return level;
+}
+
+// ==================== 跳表查找（读写共用，读者只依赖 acquire 读） ====================
+
+MvccStorageEngine::Node *MvccStorageEngine::findGreaterOrEqual(const std::string &key, Node **prev) const {
+  Node *x = m_head;
+  for (int i = m_level.load(std::memory_order_acquire) - 1; i >= 0; i--) {
+    Node *next = x->next[i].load(std::memory_order_acquire);
+    while (next != nullptr && next->key < key) {
+      x = next;
+      next = x->next[i].load(std::memory_order_acquire);
+    }
+    if (prev != nullptr) {
+      prev[i] = x;
+    }
+  }
+  return x->next[0].load(std::memory_order_acquire);
+}
+
+MvccStorageEngine::Node *MvccStorageEngine::seek(const std::string &key) const {
+  Node *node = findGreaterOrEqual(key, nullptr);
+  return (node != nullptr && node->key == key) ? node : nullptr;
+}
+
+// ==================== 写 ====================
+
+bool MvccStorageEngine::writableAt(int64_t index) const {
+  // 同一条日志里可以有多次写入，但不能写到读者已经可能看到的索引上
+  return index > AppliedIndex() && index >= m_lastWrite;
+}
+
+void MvccStorageEngine::checkWriteIndex(int64_t index) const {
+  if (!writableAt(index)) {
+    throw std::invalid_argument("[MVCC] write index " + std::to_string(index) + " is not after applied index " +
+                                std::to_string(AppliedIndex()));
+  }
+}
+
+void MvccStorageEngine::addVersion(const std::string &key, Version *version) {
+  if (m_parallel) {
+    // 这个 key 只有当前线程在写，已有节点的版本链不会被别的线程修改；
+    // 别的线程同时新建节点时，这里的查找和读者一样只依赖 acquire 读
+    Node *node = seek(key);
+    if (node != nullptr) {
+      pushVersion(node, version);
+    } else if (version->deleted) {
+      delete version;
+    } else {
+      std::lock_guard<std::mutex> lock(m_writeMtx);
+      Node *prev[kMaxLevel];
+      findGreaterOrEqual(key, prev);
+      insertNode(key, version, prev);
+    }
+    m_parallelWrites.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  Node *prev[kMaxLevel];
+  Node *node = findGreaterOrEqual(key, prev);
+  m_lastWrite = version->index;
+  if (node != nullptr && node->key == key) {
+    pushVersion(node, version);
+  } else if (version->deleted) {
+    // key 不存在，删除标记没有意义
+    delete version;
+    return;
+  } else {
+    insertNode(key, version, prev);
+  }
+  maybeCollect();
+}
+
+void MvccStorageEngine::pushVersion(Node *node, Version *version) {
+  Version *old = node->versions.load(std::memory_order_relaxed);
+  const bool wasLive = old != nullptr && !old->deleted;
+  version->older.store(old, std::memory_order_relaxed);
+  node->versions.store(version, std::memory_order_release);
+  m_versionCount.fetch_add(1, std::memory_order_relaxed);
+  if (wasLive && version->deleted) {
+    m_liveCount.fetch_sub(1, std::memory_order_relaxed);
+  } else if (!wasLive && !version->deleted) {
+    m_liveCount.fetch_add(1, std::memory_order_relaxed);
+  }
+  markDirty(node);
+}
+
+void MvccStorageEngine::markDirty(Node *node) {
+  // dirty 标记属于节点，只有写这个 key 的线程访问；共享的 m_dirty 在并发区间内加锁
+  if (node->dirty) {
+    return;
+  }
+  node->dirty = true;
+  if (m_parallel) {
+    std::lock_guard<std::mutex> lock(m_writeMtx);
+    m_dirty.push_back(node);
+  } else {
+    m_dirty.push_back(node);
+  }
+}
+
+void MvccStorageEngine::insertNode(const std::string &key, Version *version, Node **prev) {
+  const int level = randomLevel();
+  const int curLevel = m_level.load(std::memory_order_relaxed);
+  for (int i = curLevel; i < level; i++) {
+    prev[i] = m_head;
+  }
+  Node *node = newNode(key, level);
+  node->versions.store(version, std::memory_order_relaxed);
+  // 先填好自己的 next，再自底向上发布，读者任何时刻看到的都是完整的链表
+  for (int i = 0; i < level; i++) {
+    node->next[i].store(prev[i]->next[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    prev[i]->next[i].store(node, std::memory_order_release);
+  }
+  if (level > curLevel) {
+    m_level.store(level, std::memory_order_release);
+  }
+  m_versionCount.fetch_add(1, std::memory_order_relaxed);
+  m_liveCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void MvccStorageEngine::BeginParallelWrites(int64_t index) {
+  checkWriteIndex(index);
+  m_lastWrite = index;
+  m_parallelWrites.store(0, std::memory_order_relaxed);
+  m_parallel = true;
+}
+
+void MvccStorageEngine::EndParallelWrites() {
+  m_parallel = false;
+  // 区间内没有触发的 GC 按写入次数补上
+  m_writesSinceGc += m_parallelWrites.load(std::memory_order_relaxed);
+  if (m_writesSinceGc >= kGcEveryWrites) {
+    CollectGarbage();
+  }
+}
+
+void MvccStorageEngine::Put(const std::string &key, const std::string &value, int64_t index) {
+  checkWriteIndex(index);
+  addVersion(key, new Version(index, false, ChunkedValue(value)));
+}
+
+void MvccStorageEngine::Append(const std::string &key, const std::string &value, int64_t index) {
+  checkWriteIndex(index);
+  // 新版本与旧版本共享已有的块，只写入追加的部分
+  const Node *node = seek(key);
+  const Version *base = node != nullptr ? node->versions.load(std::memory_order_relaxed) : nullptr;
+  auto *version = new Version(index, false, (base != nullptr && !base->deleted) ? base->value : ChunkedValue());
+  version->value.Append(value);
+  addVersion(key, version);
+}
+
+void MvccStorageEngine::Delete(const std::string &key, int64_t index) {
+  checkWriteIndex(index);
+  addVersion(key, new Version(index, true, ChunkedValue()));
+}
+
+bool MvccStorageEngine::Install(const std::string &data, int64_t index, const std::vector<int64_t> *versions) {
+  if (!writableAt(index)) {
+    return false;
+  }
+  SkipListDump<std::string, ChunkedValue> dumper;
+  if (!data.empty()) {
+    std::stringstream iss(data);
+    boost::archive::text_iarchive ia(iss);
+    ia >> dumper;
+  }
+  std::unordered_set<std::string> keep(dumper.keyDumpVt_.begin(), dumper.keyDumpVt_.end());
+  std::vector<std::string> stale;
+  for (Node *node = m_head->next[0].load(std::memory_order_relaxed); node != nullptr;
+       node = node->next[0].load(std::memory_order_relaxed)) {
+    const Version *latest = node->versions.load(std::memory_order_relaxed);
+    if (latest != nullptr && !latest->deleted && keep.count(node->key) == 0) {
+      stale.push_back(node->key);
+    }
+  }
+  for (const auto &key : stale) {
+    addVersion(key, new Version(index, true, ChunkedValue()));
+  }
+  const bool withVersions = versions != nullptr && versions->size() == dumper.keyDumpVt_.size();
+  for (size_t i = 0; i < dumper.keyDumpVt_.size(); i++) {
+    auto *version = new Version(index, false, std::move(dumper.valDumpVt_[i]));
+    if (withVersions) {
+      version->modIndex = (*versions)[i];
+    }
+    addVersion(dumper.keyDumpVt_[i], version);
+  }
+  SetAppliedIndex(index);
+  return true;
+}
+
+void MvccStorageEngine::SetAppliedIndex(int64_t index) {
+  if (index > m_applied.load(std::memory_order_relaxed)) {
+    m_applied.store(index, std::memory_order_release);
+  }
+}
+
+// ==================== GC ====================
+
+void MvccStorageEngine::maybeCollect() {
+  if (++m_writesSinceGc >= kGcEveryWrites) {
+    CollectGarbage();
+  }
+}
+
+void MvccStorageEngine::unlink(Node *node) {
+  Node *prev[kMaxLevel];
+  findGreaterOrEqual(node->key, prev);
+  for (int i = 0; i < node->level; i++) {
+    if (prev[i]->next[i].load(std::memory_order_relaxed) == node) {
+      // 被摘除节点自己的 next 不动，正停在它上面的读者还能继续往后走
+      prev[i]->next[i].store(node->next[i].load(std::memory_order_relaxed), std::memory_order_release);
+    }
+  }
+}
+
+void MvccStorageEngine::CollectGarbage() {
+  m_writesSinceGc = 0;
+  int64_t horizon;
+  uint64_t minTicket;
+  {
+    std::lock_guard<std::mutex> lock(m_readerMtx);
+    horizon = AppliedIndex();
+    for (const auto &reader : m_readers) {
+      horizon = std::min(horizon, reader.second);
+    }
+    m_horizon = std::max(m_horizon, horizon);
+    minTicket = m_readers.empty() ? m_nextTicket : m_readers.begin()->first;
+  }
+
+  // 摘除之前登记的读者都已经结束，节点可以释放了
+  auto firstLive = std::partition(m_retired.begin(), m_retired.end(),
+                                  [minTicket](const std::pair<uint64_t, Node *> &item) { return item.first <= minTicket; });
+  for (auto it = m_retired.begin(); it != firstLive; ++it) {
+    freeNode(it->second);
+  }
+  m_retired.erase(m_retired.begin(), firstLive);
+
+  // 每个 key 只保留边界内的最新版本；索引不大于 horizon 的读者都停在这个版本或更新的版本上，
+  // 不会再访问更旧的版本，可以直接释放
+  std::vector<Node *> unlinked;
+  std::vector<Node *> stillDirty;
+  for (Node *node : m_dirty) {
+    Version *head = node->versions.load(std::memory_order_relaxed);
+    Version *kept = head;
+    while (kept != nullptr && kept->index > horizon) {
+      kept = kept->older.load(std::memory_order_relaxed);
+    }
+    if (kept != nullptr) {
+      Version *dead = kept->older.exchange(nullptr, std::memory_order_acq_rel);
+      while (dead != nullptr) {
+        Version *older = dead->older.load(std::memory_order_relaxed);
+        delete dead;
+        m_versionCount.fetch_sub(1, std::memory_order_relaxed);
+        dead = older;
+      }
+    }
+    if (kept == head && head->deleted) {
+      unlink(node);
+      unlinked.push_back(node);
+    } else if (head->older.load(std::memory_order_relaxed) == nullptr && !head->deleted) {
+      node->dirty = false;
+    } else {
+      stillDirty.push_back(node);
+    }
+  }
+  m_dirty.swap(stillDirty);
+
+  if (!unlinked.empty()) {
+    uint64_t stamp;
+    {
+      std::lock_guard<std::mutex> lock(m_readerMtx);
+      stamp = m_nextTicket;
+    }
+    for (Node *node : unlinked) {
+      m_retired.emplace_back(stamp, node);
+    }
+  }
+}
+
+// ==================== 读者登记 ====================
+
+uint64_t MvccStorageEngine::registerReader(int64_t *index) {
+  // 在锁内读取已应用索引，保证与 GC 计算边界的顺序一致
+  std::lock_guard<std::mutex> lock(m_readerMtx);
+  *index = AppliedIndex();
+  const uint64_t ticket = m_nextTicket++;
+  m_readers.emplace(ticket, *index);
+  return ticket;
+}
+
+bool MvccStorageEngine::registerReaderAt(int64_t index, uint64_t *ticket) {
+  std::lock_guard<std::mutex> lock(m_readerMtx);
+  if (index < m_horizon || index > AppliedIndex()) {
+    return false;
+  }
+  *ticket = m_nextTicket++;
+  m_readers.emplace(*ticket, index);
+  return true;
+}
+
+void MvccStorageEngine::unregisterReader(uint64_t ticket) {
+  std::lock_guard<std::mutex> lock(m_readerMtx);
+  m_readers.erase(ticket);
+}
+
+size_t MvccStorageEngine::ActiveReaders() const {
+  std::lock_guard<std::mutex> lock(m_readerMtx);
+  return m_readers.size();
+}
+
+MvccStorageEngine::ReadView MvccStorageEngine::OpenReadView() {
+  int64_t index = 0;
+  const uint64_t ticket = registerReader(&index);
+  return ReadView(this, index, ticket);
+}
+
+bool MvccStorageEngine::OpenReadView(int64_t index, ReadView *view) {
+  uint64_t ticket = 0;
+  if (!registerReaderAt(index, &ticket)) {
+    return false;
+  }
+  *view = ReadView(this, index, ticket);
+  return true;
+}
+
+// ==================== 读 ====================
+
+bool MvccStorageEngine::getAt(const std::string &key, int64_t index, std::string *value) const {
+  const Node *node = seek(key);
+  if (node == nullptr) {
+    return false;
+  }
+  const Version *v = node->versions.load(std::memory_order_acquire);
+  while (v != nullptr && v->index > index) {
+    v = v->older.load(std::memory_order_acquire);
+  }
+  if (v == nullptr || v->deleted) {
+    return false;
+  }
+  value->clear();
+  v->value.AppendTo(value);
+  return true;
+}
+
+int64_t MvccStorageEngine::versionAt(const std::string &key, int64_t index) const {
+  const Node *node = seek(key);
+  if (node == nullptr) {
+    return 0;
+  }
+  const Version *v = node->versions.load(std::memory_order_acquire);
+  while (v != nullptr && v->index > index) {
+    v = v->older.load(std::memory_order_acquire);
+  }
+  return (v == nullptr || v->deleted) ? 0 : v->modIndex;
+}
+
+void MvccStorageEngine::versionsAt(int64_t index, std::vector<int64_t> *out) const {
+  for (const Node *node = m_head->next[0].load(std::memory_order_acquire); node != nullptr;
+       node = node->next[0].load(std::memory_order_acquire)) {
+    const Version *v = node->versions.load(std::memory_order_acquire);
+    while (v != nullptr && v->index > index) {
+      v = v->older.load(std::memory_order_acquire);
+    }
+    if (v != nullptr && !v->deleted) {
+      out->push_back(v->modIndex);
+    }
+  }
+}
+
+void MvccStorageEngine::forEachAt(int64_t index,
+                                  const std::function<void(const std::string &, const ChunkedValue &)> &visitor) const {
+  scanAt(index, std::string(), [&visitor](const std::string &key, const ChunkedValue &value) {
+    visitor(key, value);
+    return true;
+  });
+}
+
+void MvccStorageEngine::scanAt(int64_t index, const std::string &start,
+                               const std::function<bool(const std::string &, const ChunkedValue &)> &visitor) const {
+  for (const Node *node = findGreaterOrEqual(start, nullptr); node != nullptr;
+       node = node->next[0].load(std::memory_order_acquire)) {
+    const Version *v = node->versions.load(std::memory_order_acquire);
+    while (v != nullptr && v->index > index) {
+      v = v->older.load(std::memory_order_acquire);
+    }
+    if (v != nullptr && !v->deleted && !visitor(node->key, v->value)) {
+      return;
+    }
+  }
+}
+
+void MvccStorageEngine::serializeAt(int64_t index, std::ostream &os) const {
+  SkipListDump<std::string, ChunkedValue> dumper;
+  forEachAt(index, [&dumper](const std::string &key, const ChunkedValue &value) {
+    dumper.keyDumpVt_.push_back(key);
+    dumper.valDumpVt_.push_back(value);  // 只复制块指针
+  });
+  boost::archive::text_oarchive oa(os);
+  oa << dumper;
+}
+
+// ==================== IStorageEngine ====================
+
+bool MvccStorageEngine::Get(const std::string &key, std::string *value) { return OpenReadView().Get(key, value); }
+
+void MvccStorageEngine::Scan(const std::string &start,
+                             const std::function<bool(const std::string &, const std::string &)> &visitor) {
+  std::string flat;
+  OpenReadView().Scan(start, [&](const std::string &key, const ChunkedValue &value) {
+    flat.clear();
+    value.AppendTo(&flat);
+    return visitor(key, flat);
+  });
+}
+
+bool MvccStorageEngine::GetVersion(const std::string &key, int64_t *version) {
+  *version = OpenReadView().Version(key);
+  return true;
+}
+
+bool MvccStorageEngine::BeginApply(int64_t index) {
+  if (!writableAt(index)) {
+    return false;
+  }
+  m_applying = index;
+  return true;
+}
+
+void MvccStorageEngine::FinishApply(int64_t index) {
+  m_applying = 0;
+  SetAppliedIndex(index);
+}
+
+std::shared_ptr<IReadView> MvccStorageEngine::OpenView() { return std::make_shared<MvccReadView>(OpenReadView()); }
+
+std::shared_ptr<IReadView> MvccStorageEngine::OpenView(int64_t index) {
+  ReadView view;
+  if (!OpenReadView(index, &view)) {
+    return nullptr;
+  }
+  return std::make_shared<MvccReadView>(std::move(view));
+}
+
+bool MvccStorageEngine::CollectVersions(std::vector<int64_t> *out) {
+  OpenReadView().CollectVersions(out);
+  return true;
+}
+
+void MvccStorageEngine::Put(const std::string &key, const std::string &value) {
+  if (m_applying > 0) {
+    Put(key, value, m_applying);
+    return;
+  }
+  const int64_t index = AppliedIndex() + 1;
+  Put(key, value, index);
+  SetAppliedIndex(index);
+}
+
+void MvccStorageEngine::Append(const std::string &key, const std::string &value) {
+  if (m_applying > 0) {
+    Append(key, value, m_applying);
+    return;
+  }
+  const int64_t index = AppliedIndex() + 1;
+  Append(key, value, index);
+  SetAppliedIndex(index);
+}
+
+void MvccStorageEngine::Delete(const std::string &key) {
+  if (m_applying > 0) {
+    Delete(key, m_applying);
+    return;
+  }
+  const int64_t index = AppliedIndex() + 1;
+  Delete(key, index);
+  SetAppliedIndex(index);
+}
+
+std::string MvccStorageEngine::Serialize() {
+  std::ostringstream os;
+  SerializeTo(os);
+  return os.str();
+}
+
+void MvccStorageEngine::SerializeTo(std::ostream &os) { OpenReadView().SerializeTo(os); }
+
+void MvccStorageEngine::Deserialize(const std::string &data) { Install(data, AppliedIndex() + 1); }
+
+size_t MvccStorageEngine::Size() const { return m_liveCount.load(std::memory_order_relaxed); }
+
+void MvccStorageEngine::Clear() { Install("", AppliedIndex() + 1); }
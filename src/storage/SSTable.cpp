@@ -0,0 +1,351 @@
+#include "SSTable.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include "Coding.h"
+
+namespace {
+
+constexpr uint64_t kTableMagic = 0x4c534d5353544231ULL;  // "LSMSSTB1"
+constexpr size_t kFooterSize = 40;
+constexpr size_t kWriteBufferSize = 64 * 1024;
+
+std::runtime_error ioError(const std::string& what, const std::string& path) {
+  return std::runtime_error("[SSTable] " + what + " " + path + ": " + std::strerror(errno));
+}
+
+}  // namespace
+
+bool ParseLsmEntry(const char** p, const char* limit, std::string* key, LsmValueType* type, std::string* value) {
+  const char* q = *p;
+  if (!coding::GetLengthPrefixed(&q, limit, key) || q >= limit) {
+    return false;
+  }
+  *type = static_cast<LsmValueType>(static_cast<uint8_t>(*q++));
+  if (!coding::GetLengthPrefixed(&q, limit, value)) {
+    return false;
+  }
+  *p = q;
+  return true;
+}
+
+// ==================== SSTableBuilder ====================
+
+SSTableBuilder::SSTableBuilder(const std::string& path, size_t blockSize, int bloomBitsPerKey)
+    : m_path(path),
+      m_fd(-1),
+      m_blockSize(blockSize),
+      m_offset(0),
+      m_blockStart(0),
+      m_filter(bloomBitsPerKey),
+      m_numEntries(0),
+      m_finished(false) {
+  m_fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (m_fd < 0) {
+    throw ioError("open", path);
+  }
+}
+
+SSTableBuilder::~SSTableBuilder() {
+  if (m_fd >= 0) {
+    ::close(m_fd);
+  }
+  if (!m_finished) {
+    // 没有 Finish 的文件是半成品，直接丢弃
+    ::unlink(m_path.c_str());
+  }
+}
+
+void SSTableBuilder::Add(const std::string& key, LsmValueType type, const std::string& value) {
+  if (m_numEntries == 0) {
+    m_smallestKey = key;
+  }
+  coding::PutLengthPrefixed(&m_block, key);
+  m_block.push_back(static_cast<char>(type));
+  coding::PutLengthPrefixed(&m_block, value);
+  m_filter.AddKey(key);
+  m_lastKey = key;
+  m_numEntries++;
+  if (type == LsmValueType::kDeletion) {
+    m_numDeletions++;
+  }
+
+  if (m_block.size() >= m_blockSize) {
+    flushBlock();
+  }
+}
+
+void SSTableBuilder::flushBlock() {
+  if (m_block.empty()) {
+    return;
+  }
+  m_index.push_back(IndexEntry{m_lastKey, m_blockStart, m_block.size()});
+  m_buffer.append(m_block);
+  m_blockStart += m_block.size();
+  m_block.clear();
+  writeOut(false);
+}
+
+void SSTableBuilder::writeOut(bool force) {
+  if (!force && m_buffer.size() < kWriteBufferSize) {
+    return;
+  }
+  const char* p = m_buffer.data();
+  size_t left = m_buffer.size();
+  while (left > 0) {
+    ssize_t n = ::write(m_fd, p, left);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      throw ioError("write", m_path);
+    }
+    p += n;
+    left -= static_cast<size_t>(n);
+  }
+  m_offset += m_buffer.size();
+  m_buffer.clear();
+}
+
+void SSTableBuilder::Finish() {
+  flushBlock();
+
+  const uint64_t filterOffset = m_blockStart;
+  std::string filter = m_filter.Finish();
+  m_buffer.append(filter);
+
+  std::string index;
+  coding::PutLengthPrefixed(&index, m_smallestKey);
+  coding::PutLengthPrefixed(&index, m_lastKey);
+  coding::PutVarint64(&index, m_numEntries);
+  coding::PutVarint32(&index, static_cast<uint32_t>(m_index.size()));
+  for (const auto& e : m_index) {
+    coding::PutLengthPrefixed(&index, e.lastKey);
+    coding::PutVarint64(&index, e.offset);
+    coding::PutVarint64(&index, e.size);
+  }
+  coding::PutVarint64(&index, m_numDeletions);
+  const uint64_t indexOffset = filterOffset + filter.size();
+  m_buffer.append(index);
+
+  coding::PutFixed64(&m_buffer, filterOffset);
+  coding::PutFixed64(&m_buffer, filter.size());
+  coding::PutFixed64(&m_buffer, indexOffset);
+  coding::PutFixed64(&m_buffer, index.size());
+  coding::PutFixed64(&m_buffer, kTableMagic);
+  writeOut(true);
+
+  if (::fsync(m_fd) != 0) {
+    throw ioError("fsync", m_path);
+  }
+  ::close(m_fd);
+  m_fd = -1;
+  m_finished = true;
+}
+
+// ==================== SSTableReader ====================
+
+std::shared_ptr<SSTableReader> SSTableReader::Open(const std::string& path, uint64_t fileNumber, BlockCache* cache) {
+  std::shared_ptr<SSTableReader> table(new SSTableReader());
+  table->m_fd = ::open(path.c_str(), O_RDONLY);
+  if (table->m_fd < 0) {
+    throw ioError("open", path);
+  }
+  struct stat st;
+  if (::fstat(table->m_fd, &st) != 0) {
+    throw ioError("fstat", path);
+  }
+  table->m_fileNumber = fileNumber;
+  table->m_fileSize = static_cast<uint64_t>(st.st_size);
+  table->m_cache = cache;
+  if (table->m_fileSize < kFooterSize) {
+    throw std::runtime_error("[SSTable] file too short: " + path);
+  }
+
+  std::string footer = table->readAt(table->m_fileSize - kFooterSize, kFooterSize);
+  const uint64_t filterOffset = coding::DecodeFixed64(footer.data());
+  const uint64_t filterSize = coding::DecodeFixed64(footer.data() + 8);
+  const uint64_t indexOffset = coding::DecodeFixed64(footer.data() + 16);
+  const uint64_t indexSize = coding::DecodeFixed64(footer.data() + 24);
+  if (coding::DecodeFixed64(footer.data() + 32) != kTableMagic ||
+      indexOffset + indexSize > table->m_fileSize - kFooterSize || filterOffset + filterSize > indexOffset) {
+    throw std::runtime_error("[SSTable] bad footer: " + path);
+  }
+
+  table->m_filter = table->readAt(filterOffset, filterSize);
+  std::string index = table->readAt(indexOffset, indexSize);
+  const char* p = index.data();
+  const char* limit = p + index.size();
+  uint32_t blockCount = 0;
+  bool ok = coding::GetLengthPrefixed(&p, limit, &table->m_smallestKey) &&
+            coding::GetLengthPrefixed(&p, limit, &table->m_largestKey) &&
+            coding::GetVarint64(&p, limit, &table->m_numEntries) && coding::GetVarint32(&p, limit, &blockCount);
+  for (uint32_t i = 0; ok && i < blockCount; i++) {
+    IndexEntry e;
+    ok = coding::GetLengthPrefixed(&p, limit, &e.lastKey) && coding::GetVarint64(&p, limit, &e.offset) &&
+         coding::GetVarint64(&p, limit, &e.size);
+    table->m_index.push_back(std::move(e));
+  }
+  if (ok && p < limit) {
+    ok = coding::GetVarint64(&p, limit, &table->m_numDeletions);
+  }
+  if (!ok) {
+    throw std::runtime_error("[SSTable] bad index block: " + path);
+  }
+  return table;
+}
+
+SSTableReader::~SSTableReader() {
+  if (m_fd >= 0) {
+    ::close(m_fd);
+  }
+}
+
+std::string SSTableReader::readAt(uint64_t offset, uint64_t size) const {
+  std::string buf(size, '\0');
+  size_t done = 0;
+  while (done < size) {
+    ssize_t n = ::pread(m_fd, &buf[done], size - done, static_cast<off_t>(offset + done));
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) {
+      throw std::runtime_error("[SSTable] short read in file #" + std::to_string(m_fileNumber));
+    }
+    done += static_cast<size_t>(n);
+  }
+  return buf;
+}
+
+BlockCache::Block SSTableReader::ReadBlock(size_t idx, bool fillCache) {
+  const IndexEntry& e = m_index[idx];
+  if (m_cache != nullptr) {
+    auto block = m_cache->Lookup(m_fileNumber, e.offset);
+    if (block) {
+      return block;
+    }
+  }
+  auto block = std::make_shared<const std::string>(readAt(e.offset, e.size));
+  if (m_cache != nullptr && fillCache) {
+    m_cache->Insert(m_fileNumber, e.offset, block);
+  }
+  return block;
+}
+
+SSTableReader::LookupResult SSTableReader::Get(const std::string& key, std::string* value) {
+  if (key < m_smallestKey || key > m_largestKey || !BloomFilter::KeyMayMatch(key, m_filter)) {
+    return LookupResult::kNotFound;
+  }
+  // 第一个 lastKey >= key 的块
+  size_t lo = 0, hi = m_index.size();
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    if (m_index[mid].lastKey < key) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  if (lo == m_index.size()) {
+    return LookupResult::kNotFound;
+  }
+
+  auto block = ReadBlock(lo, true);
+  const char* p = block->data();
+  const char* limit = p + block->size();
+  std::string k, v;
+  LsmValueType type;
+  while (p < limit && ParseLsmEntry(&p, limit, &k, &type, &v)) {
+    if (k == key) {
+      if (type == LsmValueType::kDeletion) {
+        return LookupResult::kDeleted;
+      }
+      *value = std::move(v);
+      return LookupResult::kFound;
+    }
+    if (k > key) {
+      break;
+    }
+  }
+  return LookupResult::kNotFound;
+}
+
+namespace {
+
+class SSTableIterator : public LsmIterator {
+ public:
+  SSTableIterator(std::shared_ptr<SSTableReader> table, bool fillCache, size_t firstBlock = 0)
+      : m_table(std::move(table)),
+        m_fillCache(fillCache),
+        m_blockIdx(firstBlock),
+        m_p(nullptr),
+        m_limit(nullptr),
+        m_valid(false) {
+    loadBlock();
+    Next();
+  }
+
+  bool Valid() const override { return m_valid; }
+  const std::string& Key() const override { return m_key; }
+  LsmValueType Type() const override { return m_type; }
+  const std::string& Value() const override { return m_value; }
+
+  void Next() override {
+    while (true) {
+      if (m_block && m_p < m_limit) {
+        m_valid = ParseLsmEntry(&m_p, m_limit, &m_key, &m_type, &m_value);
+        if (!m_valid) {
+          throw std::runtime_error("[SSTable] corrupt block in file #" + std::to_string(m_table->FileNumber()));
+        }
+        return;
+      }
+      if (m_blockIdx >= m_table->NumBlocks()) {
+        m_valid = false;
+        return;
+      }
+      loadBlock();
+    }
+  }
+
+ private:
+  void loadBlock() {
+    if (m_blockIdx >= m_table->NumBlocks()) {
+      m_block.reset();
+      return;
+    }
+    m_block = m_table->ReadBlock(m_blockIdx++, m_fillCache);
+    m_p = m_block->data();
+    m_limit = m_p + m_block->size();
+  }
+
+  std::shared_ptr<SSTableReader> m_table;
+  bool m_fillCache;
+  size_t m_blockIdx;
+  BlockCache::Block m_block;
+  const char* m_p;
+  const char* m_limit;
+  bool m_valid;
+  std::string m_key;
+  LsmValueType m_type = LsmValueType::kValue;
+  std::string m_value;
+};
+
+}  // namespace
+
+std::unique_ptr<LsmIterator> SSTableReader::NewIterator(bool fillCache) {
+  return std::unique_ptr<LsmIterator>(new SSTableIterator(shared_from_this(), fillCache));
+}
+
+std::unique_ptr<LsmIterator> SSTableReader::NewIterator(bool fillCache, const std::string& start) {
+  // 第一个 lastKey >= start 的块之前的块都不含目标，块内再逐条跳过更小的 key
+  auto block = std::lower_bound(m_index.begin(), m_index.end(), start,
+                                [](const IndexEntry& e, const std::string& k) { return e.lastKey < k; });
+  std::unique_ptr<LsmIterator> it(
+      new SSTableIterator(shared_from_this(), fillCache, static_cast<size_t>(block - m_index.begin())));
+  while (it->Valid() && it->Key() < start) {
+    it->Next();
+  }
+  return it;
+}
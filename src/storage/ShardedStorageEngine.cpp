@@ -0,0 +1,154 @@
+#include "ShardedStorageEngine.h"
+
+#include <queue>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#include "skipList.h"
+
+namespace {
+
+// Scan 每次从一个分片取出的 key 数
+constexpr size_t kScanBatch = 64;
+
+}  // namespace
+
+ShardedStorageEngine::ShardedStorageEngine(std::vector<std::unique_ptr<IStorageEngine>> shards)
+    : m_shards(std::move(shards)) {
+  if (m_shards.empty()) {
+    throw std::invalid_argument("sharded storage engine needs at least one shard");
+  }
+  for (const auto &shard : m_shards) {
+    if (shard == nullptr) {
+      throw std::invalid_argument("sharded storage engine got a null shard");
+    }
+  }
+}
+
+size_t ShardedStorageEngine::shardIndex(const std::string &key) const {
+  return std::hash<std::string>{}(key) % m_shards.size();
+}
+
+bool ShardedStorageEngine::Get(const std::string &key, std::string *value) {
+  return m_shards[shardIndex(key)]->Get(key, value);
+}
+
+void ShardedStorageEngine::Put(const std::string &key, const std::string &value) {
+  m_shards[shardIndex(key)]->Put(key, value);
+}
+
+void ShardedStorageEngine::Append(const std::string &key, const std::string &value) {
+  m_shards[shardIndex(key)]->Append(key, value);
+}
+
+void ShardedStorageEngine::Delete(const std::string &key) { m_shards[shardIndex(key)]->Delete(key); }
+
+bool ShardedStorageEngine::GetVersion(const std::string &key, int64_t *version) {
+  return m_shards[shardIndex(key)]->GetVersion(key, version);
+}
+
+void ShardedStorageEngine::Scan(const std::string &start,
+                                const std::function<bool(const std::string &, const std::string &)> &visitor) {
+  // 每个分片一个游标，缓冲该分片接下来的一批 key；取完后从这批最后一个 key 之后重新定位
+  struct Cursor {
+    std::vector<std::pair<std::string, std::string>> batch;
+    size_t pos = 0;
+    bool exhausted = false;  // 这批之后分片里没有更多 key
+  };
+  std::vector<Cursor> cursors(m_shards.size());
+  auto fill = [this, &cursors](size_t i, const std::string &from, bool skipFrom) {
+    Cursor &c = cursors[i];
+    c.batch.clear();
+    c.pos = 0;
+    m_shards[i]->Scan(from, [&c, &from, skipFrom](const std::string &key, const std::string &value) {
+      if (skipFrom && key == from) {
+        return true;
+      }
+      c.batch.emplace_back(key, value);
+      return c.batch.size() < kScanBatch;
+    });
+    c.exhausted = c.batch.size() < kScanBatch;
+  };
+
+  // 分片之间 key 不重复，小顶堆里按各游标当前的 key 排序
+  auto later = [&cursors](size_t a, size_t b) {
+    return cursors[a].batch[cursors[a].pos].first > cursors[b].batch[cursors[b].pos].first;
+  };
+  std::priority_queue<size_t, std::vector<size_t>, decltype(later)> heap(later);
+  for (size_t i = 0; i < m_shards.size(); ++i) {
+    fill(i, start, false);
+    if (!cursors[i].batch.empty()) {
+      heap.push(i);
+    }
+  }
+  while (!heap.empty()) {
+    size_t i = heap.top();
+    heap.pop();
+    Cursor &c = cursors[i];
+    const auto &entry = c.batch[c.pos];
+    if (!visitor(entry.first, entry.second)) {
+      return;
+    }
+    if (++c.pos == c.batch.size()) {
+      if (c.exhausted) {
+        continue;
+      }
+      std::string last = std::move(c.batch.back().first);
+      fill(i, last, true);
+      if (c.batch.empty()) {
+        continue;
+      }
+    }
+    heap.push(i);
+  }
+}
+
+std::string ShardedStorageEngine::Serialize() {
+  SkipListDump<std::string, std::string> dumper;
+  Scan("", [&dumper](const std::string &key, const std::string &value) {
+    dumper.keyDumpVt_.push_back(key);
+    dumper.valDumpVt_.push_back(value);
+    return true;
+  });
+  std::stringstream ss;
+  boost::archive::text_oarchive oa(ss);
+  oa << dumper;
+  return ss.str();
+}
+
+void ShardedStorageEngine::Deserialize(const std::string &data) {
+  // 按分片拆开后交给各分片自己恢复，恢复语义（是否先清空等）与内层引擎一致
+  std::vector<SkipListDump<std::string, std::string>> parts(m_shards.size());
+  if (!data.empty()) {
+    SkipListDump<std::string, std::string> dumper;
+    std::stringstream iss(data);
+    boost::archive::text_iarchive ia(iss);
+    ia >> dumper;
+    for (size_t i = 0; i < dumper.keyDumpVt_.size(); ++i) {
+      auto &part = parts[shardIndex(dumper.keyDumpVt_[i])];
+      part.keyDumpVt_.push_back(std::move(dumper.keyDumpVt_[i]));
+      part.valDumpVt_.push_back(std::move(dumper.valDumpVt_[i]));
+    }
+  }
+  for (size_t i = 0; i < m_shards.size(); ++i) {
+    std::stringstream ss;
+    boost::archive::text_oarchive oa(ss);
+    oa << parts[i];
+    m_shards[i]->Deserialize(ss.str());
+  }
+}
+
+size_t ShardedStorageEngine::Size() const {
+  size_t size = 0;
+  for (const auto &shard : m_shards) {
+    size += shard->Size();
+  }
+  return size;
+}
+
+void ShardedStorageEngine::Clear() {
+  for (auto &shard : m_shards) {
+    shard->Clear();
+  }
+}
@@ -0,0 +1,58 @@
+#include "StorageEngineFactory.h"
+
+#include <stdexcept>
+#include "ArtStorageEngine.h"
+#include "BTreeStorageEngine.h"
+#include "HashStorageEngine.h"
+#include "LsmStorageEngine.h"
+#include "MvccStorageEngine.h"
+#include "ShardedStorageEngine.h"
+#include "SkipListStorageEngine.h"
+#include "ValueLogStorageEngine.h"
+
+std::unique_ptr<IStorageEngine> CreateStorageEngine(const std::string &type, int nodeId) {
+  if (type == "skiplist") {
+    return std::make_unique<SkipListStorageEngine>(6);
+  }
+  if (type == "art") {
+    return std::make_unique<ArtStorageEngine>();
+  }
+  if (type == "hash") {
+    return std::make_unique<HashStorageEngine>();
+  }
+  if (type == "btree") {
+    return std::make_unique<BTreeStorageEngine>("btreeData" + std::to_string(nodeId) + ".db");
+  }
+  if (type == "lsm") {
+    LsmOptions options;
+    options.dir = "lsmData" + std::to_string(nodeId);
+    return std::make_unique<LsmStorageEngine>(options);
+  }
+  if (type == "mvcc") {
+    return std::make_unique<MvccStorageEngine>();
+  }
+  if (type == "vlog" || type.compare(0, 5, "vlog:") == 0) {
+    // "vlog" 默认用跳表做索引，"vlog:<engine>" 指定索引引擎
+    const std::string indexType = type == "vlog" ? "skiplist" : type.substr(5);
+    if (indexType == "vlog" || indexType.compare(0, 5, "vlog:") == 0) {
+      throw std::invalid_argument("value log cannot index another value log: " + type);
+    }
+    ValueLogOptions options;
+    options.dir = "vlogData" + std::to_string(nodeId);
+    return std::make_unique<ValueLogStorageEngine>(CreateStorageEngine(indexType, nodeId), options);
+  }
+  if (type == "sharded" || type.compare(0, 8, "sharded:") == 0) {
+    // "sharded" 默认每个分片一个跳表，"sharded:<engine>" 指定分片引擎；
+    // 分片之间不能共用落盘目录，MVCC 的读视图也不能跨分片，只支持内存引擎
+    const std::string shardType = type == "sharded" ? "skiplist" : type.substr(8);
+    if (shardType != "skiplist" && shardType != "art" && shardType != "hash") {
+      throw std::invalid_argument("unsupported shard engine: " + type);
+    }
+    std::vector<std::unique_ptr<IStorageEngine>> shards;
+    for (size_t i = 0; i < ShardedStorageEngine::kDefaultShards; ++i) {
+      shards.push_back(CreateStorageEngine(shardType, nodeId));
+    }
+    return std::make_unique<ShardedStorageEngine>(std::move(shards));
+  }
+  throw std::invalid_argument("unknown storage engine: " + type);
+}
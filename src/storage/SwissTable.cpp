@@ -0,0 +1,238 @@
+#include "SwissTable.h"
+
+#include <cstring>
+#include <limits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+constexpr int8_t kEmpty = -128;  // 0b10000000
+constexpr int8_t kDeleted = -2;  // 0b11111110
+constexpr size_t kInitialCapacity = 64;
+constexpr size_t kNotFound = std::numeric_limits<size_t>::max();
+
+inline size_t hashKey(const std::string &key) { return std::hash<std::string>()(key); }
+inline size_t h1(size_t hash) { return hash >> 7; }
+inline int8_t h2(size_t hash) { return static_cast<int8_t>(hash & 0x7f); }
+
+// 一组 16 个控制字的匹配结果，第 i 位表示第 i 个槽位
+struct Group {
+  explicit Group(const int8_t *ctrl) : ctrl(ctrl) {}
+
+  uint32_t Match(int8_t h) const {
+#if defined(__SSE2__)
+    __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl));
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(c, _mm_set1_epi8(h))));
+#else
+    uint32_t mask = 0;
+    for (size_t i = 0; i < SwissTable::kGroupSize; i++) {
+      if (ctrl[i] == h) mask |= 1u << i;
+    }
+    return mask;
+#endif
+  }
+
+  uint32_t MatchEmpty() const { return Match(kEmpty); }
+
+  // 空位或墓碑：两者最高位都是 1
+  uint32_t MatchAvailable() const {
+#if defined(__SSE2__)
+    __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl));
+    return static_cast<uint32_t>(_mm_movemask_epi8(c));
+#else
+    uint32_t mask = 0;
+    for (size_t i = 0; i < SwissTable::kGroupSize; i++) {
+      if (ctrl[i] < 0) mask |= 1u << i;
+    }
+    return mask;
+#endif
+  }
+
+  const int8_t *ctrl;
+};
+
+}  // namespace
+
+struct SwissTable::Table {
+  struct Slot {
+    std::string key;
+    std::string value;
+  };
+
+  explicit Table(size_t cap)
+      : capacity(cap), groupMask(cap / kGroupSize - 1), ctrl(new int8_t[cap]), slots(new Slot[cap]) {
+    std::memset(ctrl.get(), kEmpty, cap);
+  }
+
+  // 组间按三角数步长探测，组数为 2 的幂时能遍历所有组
+  size_t Find(const std::string &key, size_t hash) const {
+    const int8_t tag = h2(hash);
+    size_t g = h1(hash) & groupMask;
+    for (size_t step = 1; step <= groupMask + 1; step++) {
+      const size_t base = g * kGroupSize;
+      Group group(ctrl.get() + base);
+      for (uint32_t m = group.Match(tag); m != 0; m &= m - 1) {
+        size_t i = base + __builtin_ctz(m);
+        if (slots[i].key == key) return i;
+      }
+      // 组内还有空位说明插入时不会越过这一组，key 不存在
+      if (group.MatchEmpty() != 0) return kNotFound;
+      g = (g + step) & groupMask;
+    }
+    return kNotFound;
+  }
+
+  // 调用方保证 key 不存在且表未满
+  size_t InsertNew(std::string key, size_t hash) {
+    size_t g = h1(hash) & groupMask;
+    size_t idx = kNotFound;
+    for (size_t step = 1; idx == kNotFound; step++) {
+      uint32_t m = Group(ctrl.get() + g * kGroupSize).MatchAvailable();
+      if (m != 0) idx = g * kGroupSize + __builtin_ctz(m);
+      g = (g + step) & groupMask;
+    }
+    if (ctrl[idx] == kDeleted) tombstones--;
+    ctrl[idx] = h2(hash);
+    slots[idx].key = std::move(key);
+    size++;
+    return idx;
+  }
+
+  void EraseAt(size_t idx) {
+    std::string().swap(slots[idx].key);
+    std::string().swap(slots[idx].value);
+    // 同组内有空位时，探测不会越过该组，可以直接置空而不留墓碑
+    size_t base = idx / kGroupSize * kGroupSize;
+    if (Group(ctrl.get() + base).MatchEmpty() != 0) {
+      ctrl[idx] = kEmpty;
+    } else {
+      ctrl[idx] = kDeleted;
+      tombstones++;
+    }
+    size--;
+  }
+
+  bool Full(size_t i) const { return ctrl[i] >= 0; }
+
+  size_t capacity;
+  size_t groupMask;
+  std::unique_ptr<int8_t[]> ctrl;
+  std::unique_ptr<Slot[]> slots;
+  size_t size = 0;
+  size_t tombstones = 0;
+};
+
+SwissTable::SwissTable(double maxLoadFactor)
+    : m_maxLoadFactor(maxLoadFactor), m_active(new Table(kInitialCapacity)), m_migratePos(0) {}
+
+SwissTable::~SwissTable() = default;
+
+std::string *SwissTable::Find(const std::string &key) {
+  const size_t hash = hashKey(key);
+  size_t idx = m_active->Find(key, hash);
+  if (idx != kNotFound) {
+    return &m_active->slots[idx].value;
+  }
+  if (m_old) {
+    idx = m_old->Find(key, hash);
+    if (idx != kNotFound) {
+      return &m_old->slots[idx].value;
+    }
+  }
+  return nullptr;
+}
+
+std::string *SwissTable::Upsert(const std::string &key) {
+  const size_t hash = hashKey(key);
+  if (m_old) {
+    migrateStep(kMigrateBatch);
+  }
+  size_t idx = m_active->Find(key, hash);
+  if (idx != kNotFound) {
+    return &m_active->slots[idx].value;
+  }
+
+  maybeGrow();
+  std::string value;
+  if (m_old) {
+    size_t oldIdx = m_old->Find(key, hash);
+    if (oldIdx != kNotFound) {
+      // 旧表中的 key 顺带搬到新表，保证一个 key 只在一张表里
+      value = std::move(m_old->slots[oldIdx].value);
+      m_old->EraseAt(oldIdx);
+    }
+  }
+  idx = m_active->InsertNew(key, hash);
+  m_active->slots[idx].value = std::move(value);
+  return &m_active->slots[idx].value;
+}
+
+bool SwissTable::Erase(const std::string &key) {
+  const size_t hash = hashKey(key);
+  for (Table *t : {m_active.get(), m_old.get()}) {
+    if (t == nullptr) continue;
+    size_t idx = t->Find(key, hash);
+    if (idx != kNotFound) {
+      t->EraseAt(idx);
+      return true;
+    }
+  }
+  return false;
+}
+
+void SwissTable::maybeGrow() {
+  const Table &t = *m_active;
+  if (static_cast<double>(t.size + t.tombstones + 1) <= t.capacity * m_maxLoadFactor) {
+    return;
+  }
+  if (m_old) {
+    // 上一轮还没搬完就又满了，先一次性搬完
+    migrateStep(std::numeric_limits<size_t>::max());
+  }
+  // 新表容量保证搬迁完成后负载不超过上限的一半；墓碑很多时可能与原容量相同，相当于原地清理
+  const size_t live = m_active->size;
+  size_t newCapacity = kInitialCapacity;
+  while (static_cast<double>(live) > newCapacity * m_maxLoadFactor / 2) {
+    newCapacity *= 2;
+  }
+  m_old = std::move(m_active);
+  m_active.reset(new Table(newCapacity));
+  m_migratePos = 0;
+}
+
+void SwissTable::migrateStep(size_t slots) {
+  Table &old = *m_old;
+  for (size_t n = 0; n < slots && m_migratePos < old.capacity; n++, m_migratePos++) {
+    if (!old.Full(m_migratePos)) continue;
+    auto &slot = old.slots[m_migratePos];
+    const size_t hash = hashKey(slot.key);
+    size_t idx = m_active->InsertNew(std::move(slot.key), hash);
+    m_active->slots[idx].value = std::move(slot.value);
+    old.EraseAt(m_migratePos);
+  }
+  if (m_migratePos >= old.capacity) {
+    m_old.reset();
+  }
+}
+
+void SwissTable::ForEach(const std::function<void(const std::string &, const std::string &)> &visitor) const {
+  for (const Table *t : {m_active.get(), m_old.get()}) {
+    if (t == nullptr) continue;
+    for (size_t i = 0; i < t->capacity; i++) {
+      if (t->Full(i)) visitor(t->slots[i].key, t->slots[i].value);
+    }
+  }
+}
+
+void SwissTable::Clear() {
+  m_active.reset(new Table(kInitialCapacity));
+  m_old.reset();
+  m_migratePos = 0;
+}
+
+size_t SwissTable::Size() const { return m_active->size + (m_old ? m_old->size : 0); }
+
+size_t SwissTable::Capacity() const { return m_active->capacity; }
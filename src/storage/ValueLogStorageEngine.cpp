@@ -0,0 +1,576 @@
+#include "ValueLogStorageEngine.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+
+#include "Coding.h"
+#include "logger.h"
+
+namespace {
+
+constexpr uint64_t kSnapshotMagic = 0x564c4f47534e4150ULL;  // "VLOGSNAP"
+constexpr char kInlineTag = 0;
+constexpr char kExtentTag = 1;
+constexpr size_t kRecordHeader = 8;  // fixed32 keyLen + fixed32 valueLen
+constexpr size_t kCopyChunk = 1 << 20;
+
+bool parseSegmentFileName(const std::string &name, uint64_t *number) {
+  const std::string suffix = ".vlog";
+  if (name.size() <= suffix.size() || name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0) {
+    return false;
+  }
+  uint64_t n = 0;
+  for (size_t i = 0; i < name.size() - suffix.size(); i++) {
+    if (name[i] < '0' || name[i] > '9') return false;
+    n = n * 10 + static_cast<uint64_t>(name[i] - '0');
+  }
+  *number = n;
+  return true;
+}
+
+void preadFully(int fd, char *buf, size_t len, uint64_t offset) {
+  while (len > 0) {
+    ssize_t n = ::pread(fd, buf, len, static_cast<off_t>(offset));
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) {
+      throw std::runtime_error(std::string("[VLog] pread: ") + (n == 0 ? "unexpected EOF" : std::strerror(errno)));
+    }
+    buf += n;
+    len -= static_cast<size_t>(n);
+    offset += static_cast<uint64_t>(n);
+  }
+}
+
+void pwriteFully(int fd, const char *buf, size_t len, uint64_t offset) {
+  while (len > 0) {
+    ssize_t n = ::pwrite(fd, buf, len, static_cast<off_t>(offset));
+    if (n < 0 && errno == EINTR) continue;
+    if (n < 0) {
+      throw std::runtime_error(std::string("[VLog] pwrite: ") + std::strerror(errno));
+    }
+    buf += n;
+    len -= static_cast<size_t>(n);
+    offset += static_cast<uint64_t>(n);
+  }
+}
+
+}  // namespace
+
+ValueLogStorageEngine::Segment::~Segment() {
+  if (fd >= 0) {
+    ::close(fd);
+  }
+}
+
+// ==================== 构造/析构 ====================
+
+ValueLogStorageEngine::ValueLogStorageEngine(std::unique_ptr<IStorageEngine> index, ValueLogOptions options)
+    : m_index(std::move(index)), m_options(std::move(options)), m_dbId(0), m_nextSegment(1), m_shutdown(false) {
+  if (::mkdir(m_options.dir.c_str(), 0755) != 0 && errno != EEXIST) {
+    throw std::runtime_error("[VLog] mkdir " + m_options.dir + ": " + std::strerror(errno));
+  }
+  std::ifstream identityIn(m_options.dir + "/IDENTITY");
+  if (!(identityIn >> m_dbId) || m_dbId == 0) {
+    newIdentity();
+  }
+
+  // 已有的段文件先打开，安装本节点自己的快照时可以直接复用；
+  // 没被快照引用的段有效字节为 0，会被 GC 清理掉
+  if (DIR *d = ::opendir(m_options.dir.c_str())) {
+    while (struct dirent *ent = ::readdir(d)) {
+      uint64_t number = 0;
+      if (parseSegmentFileName(ent->d_name, &number)) {
+        m_segments[number] = openSegment(number, false);
+        m_nextSegment = std::max(m_nextSegment, number + 1);
+      }
+    }
+    ::closedir(d);
+  }
+  m_gcThread = std::thread(&ValueLogStorageEngine::gcLoop, this);
+}
+
+ValueLogStorageEngine::~ValueLogStorageEngine() {
+  {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_shutdown = true;
+  }
+  m_gcCv.notify_all();
+  if (m_gcThread.joinable()) {
+    m_gcThread.join();
+  }
+}
+
+void ValueLogStorageEngine::newIdentity() {
+  std::random_device rd;
+  do {
+    m_dbId = (static_cast<uint64_t>(rd()) << 32) | rd();
+  } while (m_dbId == 0);
+  std::ofstream out(m_options.dir + "/IDENTITY", std::ios::trunc);
+  out << m_dbId << "\n";
+}
+
+std::string ValueLogStorageEngine::segmentPath(uint64_t number) const {
+  return m_options.dir + "/" + std::to_string(number) + ".vlog";
+}
+
+ValueLogStorageEngine::SegmentPtr ValueLogStorageEngine::openSegment(uint64_t number, bool truncate) {
+  const std::string path = segmentPath(number);
+  if (truncate) {
+    // 先删再建：旧文件可能还被正在读的请求持有 fd，不能原地截断
+    ::unlink(path.c_str());
+  }
+  auto seg = std::make_shared<Segment>();
+  seg->number = number;
+  seg->fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+  if (seg->fd < 0) {
+    throw std::runtime_error("[VLog] open " + path + ": " + std::strerror(errno));
+  }
+  struct stat st;
+  ::fstat(seg->fd, &st);
+  seg->size = static_cast<uint64_t>(st.st_size);
+  return seg;
+}
+
+// ==================== 索引值编码 ====================
+
+std::string ValueLogStorageEngine::encodeInline(const std::string &value) {
+  std::string enc;
+  enc.reserve(value.size() + 1);
+  enc.push_back(kInlineTag);
+  enc.append(value);
+  return enc;
+}
+
+std::string ValueLogStorageEngine::encodeExtents(const std::vector<Extent> &extents) {
+  std::string enc(1, kExtentTag);
+  for (const auto &e : extents) {
+    coding::PutVarint64(&enc, e.segment);
+    coding::PutVarint64(&enc, e.offset);
+    coding::PutVarint32(&enc, e.len);
+  }
+  return enc;
+}
+
+bool ValueLogStorageEngine::decode(const std::string &encoded, std::string *inlineValue,
+                                   std::vector<Extent> *extents) {
+  extents->clear();
+  if (encoded.empty()) {
+    return false;
+  }
+  if (encoded[0] == kInlineTag) {
+    inlineValue->assign(encoded, 1, std::string::npos);
+    return true;
+  }
+  const char *p = encoded.data() + 1;
+  const char *limit = encoded.data() + encoded.size();
+  while (p < limit) {
+    Extent e{};
+    if (!coding::GetVarint64(&p, limit, &e.segment) || !coding::GetVarint64(&p, limit, &e.offset) ||
+        !coding::GetVarint32(&p, limit, &e.len)) {
+      throw std::runtime_error("[VLog] corrupted value pointer");
+    }
+    extents->push_back(e);
+  }
+  return true;
+}
+
+// ==================== value log 读写 ====================
+
+ValueLogStorageEngine::Extent ValueLogStorageEngine::writeValue(const std::string &key, const char *data,
+                                                                size_t len) {
+  if (!m_head || m_head->size >= m_options.segmentBytes) {
+    m_head = openSegment(m_nextSegment++, true);
+    m_segments[m_head->number] = m_head;
+  }
+  // 记录里带上 key，GC 扫描段文件时据此回查索引判断片段是否仍然有效
+  std::string header;
+  coding::PutFixed32(&header, static_cast<uint32_t>(key.size()));
+  coding::PutFixed32(&header, static_cast<uint32_t>(len));
+  header.append(key);
+  struct iovec iov[2] = {{const_cast<char *>(header.data()), header.size()}, {const_cast<char *>(data), len}};
+  const size_t total = header.size() + len;
+  ssize_t n = ::pwritev(m_head->fd, iov, 2, static_cast<off_t>(m_head->size));
+  if (n < 0 || static_cast<size_t>(n) != total) {
+    // 短写时补齐剩余部分
+    std::string record = header;
+    record.append(data, len);
+    pwriteFully(m_head->fd, record.data(), record.size(), m_head->size);
+  }
+  Extent e{m_head->number, m_head->size + header.size(), static_cast<uint32_t>(len)};
+  m_head->size += total;
+  m_head->liveBytes += len;
+  return e;
+}
+
+void ValueLogStorageEngine::releaseExtents(const std::vector<Extent> &extents) {
+  for (const auto &e : extents) {
+    auto it = m_segments.find(e.segment);
+    if (it != m_segments.end()) {
+      it->second->liveBytes -= std::min<uint64_t>(it->second->liveBytes, e.len);
+    }
+  }
+}
+
+std::vector<ValueLogStorageEngine::SegmentPtr> ValueLogStorageEngine::pinSegments(
+    const std::vector<Extent> &extents) const {
+  std::vector<SegmentPtr> segs;
+  segs.reserve(extents.size());
+  for (const auto &e : extents) {
+    auto it = m_segments.find(e.segment);
+    if (it == m_segments.end()) {
+      throw std::runtime_error("[VLog] missing segment " + std::to_string(e.segment));
+    }
+    segs.push_back(it->second);
+  }
+  return segs;
+}
+
+void ValueLogStorageEngine::readExtents(const std::vector<Extent> &extents, const std::vector<SegmentPtr> &segs,
+                                        std::string *out) {
+  // 段已被引用住，GC 删除文件后 fd 仍然有效，锁外把各片段直接读进结果缓冲区
+  size_t total = 0;
+  for (const auto &e : extents) total += e.len;
+  out->resize(total);
+  size_t pos = 0;
+  for (size_t i = 0; i < extents.size(); i++) {
+    preadFully(segs[i]->fd, &(*out)[pos], extents[i].len, extents[i].offset);
+    pos += extents[i].len;
+  }
+}
+
+// ==================== IStorageEngine ====================
+
+bool ValueLogStorageEngine::Get(const std::string &key, std::string *value) {
+  std::string encoded;
+  std::vector<Extent> extents;
+  std::vector<SegmentPtr> segs;
+  {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    if (!m_index->Get(key, &encoded)) {
+      return false;
+    }
+    decode(encoded, value, &extents);
+    segs = pinSegments(extents);
+  }
+  if (!extents.empty()) {
+    readExtents(extents, segs, value);
+  }
+  return true;
+}
+
+void ValueLogStorageEngine::Scan(const std::string &start,
+                                 const std::function<bool(const std::string &, const std::string &)> &visitor) {
+  // 整个遍历持有 m_mtx：写入和 GC 搬迁都要等遍历结束，看到的索引与段文件始终一致。
+  // 与其他引擎的 Scan 一样，代价是遍历期间写入被阻塞
+  std::lock_guard<std::mutex> lock(m_mtx);
+  std::string value;
+  std::vector<Extent> extents;
+  m_index->Scan(start, [&](const std::string &key, const std::string &encoded) {
+    extents.clear();
+    decode(encoded, &value, &extents);
+    if (!extents.empty()) {
+      readExtents(extents, pinSegments(extents), &value);
+    }
+    return visitor(key, value);
+  });
+}
+
+void ValueLogStorageEngine::Put(const std::string &key, const std::string &value) {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  std::string old, oldInline;
+  std::vector<Extent> oldExtents;
+  if (m_index->Get(key, &old)) {
+    decode(old, &oldInline, &oldExtents);
+  }
+  if (value.size() >= m_options.valueThreshold) {
+    m_index->Put(key, encodeExtents({writeValue(key, value.data(), value.size())}));
+  } else {
+    m_index->Put(key, encodeInline(value));
+  }
+  releaseExtents(oldExtents);
+}
+
+void ValueLogStorageEngine::Append(const std::string &key, const std::string &value) {
+  std::unique_lock<std::mutex> lock(m_mtx);
+  std::string old, oldInline;
+  std::vector<Extent> extents;
+  if (!m_index->Get(key, &old) || !decode(old, &oldInline, &extents)) {
+    lock.unlock();
+    Put(key, value);
+    return;
+  }
+
+  if (extents.empty()) {
+    // 内联值：拼接后仍然小就继续内联，否则整体写进 value log
+    oldInline.append(value);
+    if (oldInline.size() >= m_options.valueThreshold) {
+      m_index->Put(key, encodeExtents({writeValue(key, oldInline.data(), oldInline.size())}));
+    } else {
+      m_index->Put(key, encodeInline(oldInline));
+    }
+    return;
+  }
+
+  if (extents.size() >= m_options.maxExtents) {
+    // 片段太多，读放大失控：合并成一段
+    std::string merged;
+    std::vector<SegmentPtr> segs = pinSegments(extents);
+    lock.unlock();
+    readExtents(extents, segs, &merged);
+    lock.lock();
+    merged.append(value);
+    std::vector<Extent> current;
+    std::string curInline;
+    if (!m_index->Get(key, &old) || !decode(old, &curInline, &current) || current.size() != extents.size()) {
+      // 锁释放期间被并发修改（只有 GC 会搬迁片段，长度不变），按最新指针重试
+      lock.unlock();
+      Append(key, value);
+      return;
+    }
+    m_index->Put(key, encodeExtents({writeValue(key, merged.data(), merged.size())}));
+    releaseExtents(current);
+    return;
+  }
+
+  // 只写新增的字节，指针列表加一项
+  extents.push_back(writeValue(key, value.data(), value.size()));
+  m_index->Put(key, encodeExtents(extents));
+}
+
+void ValueLogStorageEngine::Delete(const std::string &key) {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  std::string old, oldInline;
+  std::vector<Extent> oldExtents;
+  if (!m_index->Get(key, &old)) {
+    return;
+  }
+  decode(old, &oldInline, &oldExtents);
+  m_index->Delete(key);
+  releaseExtents(oldExtents);
+}
+
+size_t ValueLogStorageEngine::Size() const { return m_index->Size(); }
+
+void ValueLogStorageEngine::Clear() {
+  std::lock_guard<std::mutex> gcLock(m_gcMtx);
+  std::lock_guard<std::mutex> lock(m_mtx);
+  m_index->Clear();
+  for (const auto &item : m_segments) {
+    ::unlink(segmentPath(item.first).c_str());
+  }
+  m_segments.clear();
+  m_head.reset();
+}
+
+size_t ValueLogStorageEngine::SegmentCount() const {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  return m_segments.size();
+}
+
+// ==================== 快照 ====================
+
+void ValueLogStorageEngine::SerializeTo(std::ostream &os) {
+  struct SegmentRef {
+    SegmentPtr seg;
+    uint64_t size;
+    uint64_t liveBytes;
+  };
+  std::string indexData;
+  std::vector<SegmentRef> refs;
+  {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    indexData = m_index->Serialize();
+    for (const auto &item : m_segments) {
+      // 没有有效数据的段不会被索引引用，不必带上
+      if (item.second->liveBytes > 0) {
+        refs.push_back({item.second, item.second->size, item.second->liveBytes});
+      }
+    }
+  }
+
+  std::string buf;
+  coding::PutFixed64(&buf, kSnapshotMagic);
+  coding::PutFixed64(&buf, m_dbId);
+  coding::PutFixed64(&buf, indexData.size());
+  os.write(buf.data(), static_cast<std::streamsize>(buf.size()));
+  os.write(indexData.data(), static_cast<std::streamsize>(indexData.size()));
+  buf.clear();
+  coding::PutFixed64(&buf, refs.size());
+  os.write(buf.data(), static_cast<std::streamsize>(buf.size()));
+
+  // 段文件只追加，锁外按快照时的长度读出前缀即可
+  std::string chunk;
+  for (const auto &ref : refs) {
+    buf.clear();
+    coding::PutFixed64(&buf, ref.seg->number);
+    coding::PutFixed64(&buf, ref.size);
+    coding::PutFixed64(&buf, ref.liveBytes);
+    os.write(buf.data(), static_cast<std::streamsize>(buf.size()));
+    for (uint64_t off = 0; off < ref.size; off += kCopyChunk) {
+      const size_t n = static_cast<size_t>(std::min<uint64_t>(kCopyChunk, ref.size - off));
+      chunk.resize(n);
+      preadFully(ref.seg->fd, &chunk[0], n, off);
+      os.write(chunk.data(), static_cast<std::streamsize>(n));
+    }
+  }
+}
+
+std::string ValueLogStorageEngine::Serialize() {
+  std::ostringstream os;
+  SerializeTo(os);
+  return os.str();
+}
+
+void ValueLogStorageEngine::Deserialize(const std::string &data) {
+  if (data.empty()) {
+    Clear();
+    return;
+  }
+  const char *p = data.data();
+  const char *limit = p + data.size();
+  uint64_t magic = 0, dbId = 0, indexSize = 0, segCount = 0;
+  if (!coding::GetFixed64(&p, limit, &magic) || magic != kSnapshotMagic || !coding::GetFixed64(&p, limit, &dbId) ||
+      !coding::GetFixed64(&p, limit, &indexSize) || static_cast<uint64_t>(limit - p) < indexSize) {
+    throw std::runtime_error("[VLog] bad snapshot header");
+  }
+  std::string indexData(p, indexSize);
+  p += indexSize;
+  if (!coding::GetFixed64(&p, limit, &segCount)) {
+    throw std::runtime_error("[VLog] bad snapshot header");
+  }
+
+  std::lock_guard<std::mutex> gcLock(m_gcMtx);
+  std::lock_guard<std::mutex> lock(m_mtx);
+  const bool sameDb = dbId == m_dbId;
+  std::map<uint64_t, SegmentPtr> installed;
+  for (uint64_t i = 0; i < segCount; i++) {
+    uint64_t number = 0, size = 0, liveBytes = 0;
+    if (!coding::GetFixed64(&p, limit, &number) || !coding::GetFixed64(&p, limit, &size) ||
+        !coding::GetFixed64(&p, limit, &liveBytes) || static_cast<uint64_t>(limit - p) < size) {
+      throw std::runtime_error("[VLog] bad snapshot segment");
+    }
+    SegmentPtr seg;
+    auto it = m_segments.find(number);
+    if (sameDb && it != m_segments.end() && it->second->size >= size) {
+      // 本节点自己的段，只追加不改写，快照时的前缀仍然一致
+      seg = it->second;
+    } else {
+      seg = openSegment(number, true);
+      pwriteFully(seg->fd, p, size, 0);
+      seg->size = size;
+    }
+    seg->liveBytes = liveBytes;
+    installed[number] = seg;
+    m_nextSegment = std::max(m_nextSegment, number + 1);
+    p += size;
+  }
+  for (const auto &item : m_segments) {
+    if (installed.count(item.first) == 0) {
+      ::unlink(segmentPath(item.first).c_str());
+    }
+  }
+  m_segments = std::move(installed);
+  m_head.reset();  // 新写入从新段开始，不接在复用段的尾部
+  if (!sameDb) {
+    // 本地段号现在装的是别的节点的数据，换一个身份，旧快照不能再走复用路径
+    newIdentity();
+  }
+  m_index->Deserialize(indexData);
+}
+
+// ==================== GC ====================
+
+void ValueLogStorageEngine::gcLoop() {
+  std::unique_lock<std::mutex> lock(m_mtx);
+  while (!m_shutdown) {
+    m_gcCv.wait_for(lock, std::chrono::milliseconds(m_options.gcIntervalMs), [this] { return m_shutdown; });
+    if (m_shutdown) {
+      break;
+    }
+    lock.unlock();
+    try {
+      RunGcOnce();
+    } catch (const std::exception &e) {
+      LOG_ERROR("[VLog] gc failed: {}", e.what());
+    }
+    lock.lock();
+  }
+}
+
+int ValueLogStorageEngine::RunGcOnce() {
+  std::lock_guard<std::mutex> gcLock(m_gcMtx);
+  std::vector<SegmentPtr> candidates;
+  {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    for (const auto &item : m_segments) {
+      const SegmentPtr &seg = item.second;
+      if (seg == m_head || seg->size == 0) continue;
+      if (static_cast<double>(seg->size - seg->liveBytes) >= m_options.gcDeadRatio * seg->size) {
+        candidates.push_back(seg);
+      }
+    }
+  }
+  int collected = 0;
+  for (const auto &seg : candidates) {
+    if (collectSegment(seg)) {
+      collected++;
+    }
+  }
+  return collected;
+}
+
+bool ValueLogStorageEngine::collectSegment(const SegmentPtr &seg) {
+  uint64_t moved = 0;
+  uint64_t off = 0;
+  std::string header(kRecordHeader, '\0');
+  std::string key, value;
+  while (off + kRecordHeader <= seg->size) {
+    preadFully(seg->fd, &header[0], kRecordHeader, off);
+    const uint32_t klen = coding::DecodeFixed32(header.data());
+    const uint32_t vlen = coding::DecodeFixed32(header.data() + 4);
+    key.resize(klen);
+    preadFully(seg->fd, &key[0], klen, off + kRecordHeader);
+    const uint64_t valueOffset = off + kRecordHeader + klen;
+    off = valueOffset + vlen;
+
+    // 回查索引：只有指针仍指向这里的片段才需要搬走
+    std::lock_guard<std::mutex> lock(m_mtx);
+    std::string encoded, inlineValue;
+    std::vector<Extent> extents;
+    if (!m_index->Get(key, &encoded) || !decode(encoded, &inlineValue, &extents)) {
+      continue;
+    }
+    for (auto &e : extents) {
+      if (e.segment == seg->number && e.offset == valueOffset) {
+        value.resize(vlen);
+        preadFully(seg->fd, &value[0], vlen, valueOffset);
+        e = writeValue(key, value.data(), vlen);
+        m_index->Put(key, encodeExtents(extents));
+        seg->liveBytes -= std::min<uint64_t>(seg->liveBytes, vlen);
+        moved += vlen;
+        break;
+      }
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(m_mtx);
+  auto it = m_segments.find(seg->number);
+  if (it == m_segments.end() || it->second != seg) {
+    return false;
+  }
+  m_segments.erase(it);
+  ::unlink(segmentPath(seg->number).c_str());
+  LOG_INFO("[VLog] collected segment {} ({} bytes, {} live bytes moved)", seg->number, seg->size, moved);
+  return true;
+}
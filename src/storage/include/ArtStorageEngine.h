@@ -0,0 +1,97 @@
+#ifndef ART_STORAGE_ENGINE_H
+#define ART_STORAGE_ENGINE_H
+
+#include <mutex>
+#include <sstream>
+#include "ArtTree.h"
+#include "IStorageEngine.h"
+#include "skipList.h"
+
+/**
+ * @brief 基于自适应基数树的存储引擎
+ *
+ * 点查沿 key 字节逐层下降，深度只取决于 key 长度，不随数据量增长；
+ * 适合点查为主的负载。快照按 key 有序遍历生成，
+ * 格式与 SkipListStorageEngine 相同（SkipListDump），两种引擎的快照可以互相安装。
+ */
+class ArtStorageEngine : public IStorageEngine {
+ public:
+  ArtStorageEngine() = default;
+
+  bool Get(const std::string &key, std::string *value) override {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    const std::string *found = m_tree.Find(key);
+    if (found == nullptr) {
+      return false;
+    }
+    *value = *found;
+    return true;
+  }
+
+  void Put(const std::string &key, const std::string &value) override {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    *m_tree.Upsert(key) = value;
+  }
+
+  void Append(const std::string &key, const std::string &value) override {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_tree.Upsert(key)->append(value);  // 叶子里的值原地追加
+  }
+
+  void Delete(const std::string &key) override {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_tree.Erase(key);
+  }
+
+  void Scan(const std::string &start,
+            const std::function<bool(const std::string &, const std::string &)> &visitor) override {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_tree.ForEachFrom(start, visitor);
+  }
+
+  std::string Serialize() override {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    SkipListDump<std::string, std::string> dumper;
+    dumper.keyDumpVt_.reserve(m_tree.Size());
+    dumper.valDumpVt_.reserve(m_tree.Size());
+    m_tree.ForEach([&dumper](const std::string &key, const std::string &value) {
+      dumper.keyDumpVt_.push_back(key);
+      dumper.valDumpVt_.push_back(value);
+    });
+    std::stringstream ss;
+    boost::archive::text_oarchive oa(ss);
+    oa << dumper;
+    return ss.str();
+  }
+
+  void Deserialize(const std::string &data) override {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_tree.Clear();
+    if (data.empty()) {
+      return;
+    }
+    SkipListDump<std::string, std::string> dumper;
+    std::stringstream iss(data);
+    boost::archive::text_iarchive ia(iss);
+    ia >> dumper;
+    for (size_t i = 0; i < dumper.keyDumpVt_.size(); ++i) {
+      *m_tree.Upsert(dumper.keyDumpVt_[i]) = dumper.valDumpVt_[i];
+    }
+  }
+
+  size_t Size() const override {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    return m_tree.Size();
+  }
+
+  void Clear() override {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_tree.Clear();
+  }
+
+ private:
+  ArtTree m_tree;
+  mutable std::mutex m_mtx;
+};
+
+#endif  // ART_STORAGE_ENGINE_H
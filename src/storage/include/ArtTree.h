@@ -0,0 +1,62 @@
+#ifndef ART_TREE_H
+#define ART_TREE_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+struct ArtNode;  // 节点布局见 ArtTree.cpp
+
+/**
+ * @brief 自适应基数树（Adaptive Radix Tree, Leis et al. ICDE'13）
+ *
+ * - 内部节点按子节点数量在 Node4/16/48/256 之间自动升降级，稀疏处省内存、稠密处省跳转；
+ * - Node16 用 SSE2 一次比较 16 个 key 字节；
+ * - 路径压缩：单链路径折叠进节点的 prefix，只存前 kMaxStoredPrefix 个字节，
+ *   更长的部分在需要时从子树最小叶子的完整 key 里取（混合式压缩）；
+ * - key 可以是另一个 key 的前缀（"a" 与 "ab"），恰好在某节点结束的 key 挂在该节点的 terminal 上。
+ *
+ * 非线程安全，由外层（ArtStorageEngine）加锁。
+ */
+class ArtTree {
+ public:
+  ArtTree() = default;
+  ~ArtTree();
+
+  ArtTree(const ArtTree &) = delete;
+  ArtTree &operator=(const ArtTree &) = delete;
+
+  /**
+   * @brief 查找 key，返回值的指针，不存在返回 nullptr
+   */
+  std::string *Find(const std::string &key) const;
+
+  /**
+   * @brief 插入或定位 key，返回其值的指针（新 key 的值为空串）
+   * 调用方可以直接修改返回的值，例如 Append 原地追加
+   */
+  std::string *Upsert(const std::string &key);
+
+  bool Erase(const std::string &key);
+
+  /**
+   * @brief 按 key 字节序升序遍历
+   */
+  void ForEach(const std::function<void(const std::string &, const std::string &)> &visitor) const;
+
+  /**
+   * @brief 从第一个不小于 start 的 key 开始升序遍历，visitor 返回 false 时停止
+   * 整棵子树都小于 start 时跳过，不逐个比较
+   */
+  void ForEachFrom(const std::string &start,
+                   const std::function<bool(const std::string &, const std::string &)> &visitor) const;
+
+  void Clear();
+  size_t Size() const { return m_size; }
+
+ private:
+  ArtNode *m_root = nullptr;
+  size_t m_size = 0;
+};
+
+#endif  // ART_TREE_H
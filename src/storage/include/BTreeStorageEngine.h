@@ -0,0 +1,123 @@
+#ifndef BTREE_STORAGE_ENGINE_H
+#define BTREE_STORAGE_ENGINE_H
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include "IStorageEngine.h"
+
+/**
+ * @brief 基于 mmap 的写时复制 B+ 树存储引擎（LMDB / bbolt 风格）
+ *
+ * 文件布局：第 0、1 页是交替写的 meta 页，其余是 4KB 的树节点页和大 value 的溢出页。
+ *
+ * 写入：只有一个写者（m_mtx）。提交点之后第一次修改某页时复制出新页（COW），
+ *       同一提交周期内再次修改该页直接原地写。被复制掉的旧页在下一次提交之后才能复用，
+ *       因此上一次提交的树在磁盘上始终完整。
+ * 提交：每次生成快照时提交：msync 数据页，再写 txnId 更大的那一个 meta 页。
+ *       提交点就是快照点，不需要额外的 WAL，中间的修改由 Raft 日志重放。
+ * 快照：提交后的只读事务，按 key 顺序流式输出（SerializeTo）。提交之后释放 m_mtx，沿提交的根遍历：
+ *       这棵树的页在下一次提交之前不会被复用，写者只改新分配的页；快照期间不再提交（m_snapshotMtx），
+ *       文件增长需要重新映射时旧映射推迟到快照结束再解除。
+ * 重启：打开文件时读出最近一次提交的根节点并保留它引用的页；
+ *       随后安装的快照如果正是这次提交产生的（dbId + txnId 相同），直接采用磁盘上的树，
+ *       不需要逐条 Deserialize。
+ */
+class BTreeStorageEngine : public IStorageEngine {
+ public:
+  explicit BTreeStorageEngine(const std::string &path);
+  ~BTreeStorageEngine() override;
+
+  BTreeStorageEngine(const BTreeStorageEngine &) = delete;
+  BTreeStorageEngine &operator=(const BTreeStorageEngine &) = delete;
+
+  bool Get(const std::string &key, std::string *value) override;
+  void Put(const std::string &key, const std::string &value) override;
+  void Append(const std::string &key, const std::string &value) override;
+  void Delete(const std::string &key) override;
+  void Scan(const std::string &start,
+            const std::function<bool(const std::string &, const std::string &)> &visitor) override;
+  std::string Serialize() override;
+  void SerializeTo(std::ostream &os) override;
+  void Deserialize(const std::string &data) override;
+  size_t Size() const override;
+  void Clear() override;
+
+  // ==================== 运维/测试接口 ====================
+
+  uint64_t CommittedTxnId() const;
+  uint32_t PageCount() const;
+  size_t FreePageCount() const;
+
+  static constexpr uint32_t kPageSize = 4096;
+  static constexpr size_t kMaxKeySize = 1000;
+
+ private:
+  struct ValueSlot;
+  struct Node;
+  struct Split;
+
+  // ---------- 页管理 ----------
+  char *page(uint32_t pgno) const { return pageAt(m_map, pgno); }
+  static char *pageAt(char *base, uint32_t pgno) { return base + static_cast<size_t>(pgno) * kPageSize; }
+  void growFile(uint32_t pageCount);
+  uint32_t allocPage();
+  uint32_t allocRun(uint32_t pages);
+  void freePage(uint32_t pgno);
+  void freeValue(const ValueSlot &v);
+  void freeTree(uint32_t pgno);
+  void markReachable(uint32_t pgno, std::vector<bool> *reachable) const;
+
+  // ---------- 节点编解码 ----------
+  Node readNode(uint32_t pgno) const;
+  static Node decodeNode(const char *pg);
+  uint32_t writeNode(const Node &n, uint32_t oldPgno);
+  uint32_t store(Node &n, uint32_t pgno, Split *split);
+  std::string readValue(const char *entryValue, bool overflow, uint32_t len) const;
+
+  // ---------- 树操作 ----------
+  bool findValue(const std::string &key, std::string *value) const;
+  void putLocked(const std::string &key, const std::string &value);
+  uint32_t insertRec(uint32_t pgno, const std::string &key, const ValueSlot &v, Split *split, bool *added);
+  bool eraseRec(uint32_t pgno, const std::string &key, uint32_t *newPgno);
+  // 遍历 base 映射下以 pgno 为根的已提交的树，不访问任何成员，可以在 m_mtx 之外调用
+  template <typename F>
+  static void forEachRec(char *base, uint32_t pgno, F &&visitor);
+  bool scanRec(uint32_t pgno, const std::string &start, bool bounded,
+               const std::function<bool(const std::string &, const std::string &)> &visitor) const;
+
+  // ---------- 提交 ----------
+  void commit();
+  bool loadMeta();
+
+  std::string m_path;
+  int m_fd;
+  char *m_map;
+  size_t m_mapSize;
+  uint32_t m_pageCount;  // 文件中的页数
+
+  uint64_t m_dbId;
+  uint64_t m_txnId;            // 最近一次提交
+  uint32_t m_committedRoot;    // 最近一次提交的根
+  uint64_t m_committedCount;
+
+  uint32_t m_root;  // 当前树（0 表示空树，0/1 号页是 meta，不会是节点）
+  uint64_t m_count;
+
+  std::unordered_set<uint32_t> m_dirty;  // 本提交周期新分配的页，可以原地修改
+  std::vector<uint32_t> m_free;          // 可以立即复用的页
+  std::vector<uint32_t> m_pendingFree;   // 被复制掉的已提交页，下一次提交后才能复用
+
+  bool m_snapshotReading;                                 // 有快照正在 m_mtx 之外读已提交的树
+  std::vector<std::pair<char *, size_t>> m_retiredMaps;  // 快照期间被替换的旧映射，快照结束后解除
+
+  std::mutex m_snapshotMtx;  // 串行化快照：一次快照从提交到遍历结束之间不能再提交
+  mutable std::mutex m_mtx;
+};
+
+#endif  // BTREE_STORAGE_ENGINE_H
@@ -0,0 +1,106 @@
+#ifndef STORAGE_BLOCK_CACHE_H
+#define STORAGE_BLOCK_CACHE_H
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+/**
+ * @brief SSTable 数据块的 LRU 缓存
+ *
+ * key 为 (文件号, 块偏移)，value 为解析前的块内容。块以 shared_ptr 返回，
+ * 被淘汰时正在读的调用方仍然持有引用，不需要额外的 pin 机制。
+ * 容量按字节计算，单把锁保护（块读取本身在锁外进行）。
+ */
+class BlockCache {
+ public:
+  using Block = std::shared_ptr<const std::string>;
+
+  explicit BlockCache(size_t capacityBytes) : m_capacity(capacityBytes), m_usage(0), m_hits(0), m_misses(0) {}
+
+  Block Lookup(uint64_t fileNumber, uint64_t offset) {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    auto it = m_index.find(CacheKey{fileNumber, offset});
+    if (it == m_index.end()) {
+      m_misses++;
+      return nullptr;
+    }
+    m_hits++;
+    m_lru.splice(m_lru.begin(), m_lru, it->second);
+    return it->second->block;
+  }
+
+  void Insert(uint64_t fileNumber, uint64_t offset, Block block) {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    CacheKey key{fileNumber, offset};
+    auto it = m_index.find(key);
+    if (it != m_index.end()) {
+      m_usage -= it->second->block->size();
+      m_lru.erase(it->second);
+      m_index.erase(it);
+    }
+    m_lru.push_front(Entry{key, std::move(block)});
+    m_index[key] = m_lru.begin();
+    m_usage += m_lru.front().block->size();
+    while (m_usage > m_capacity && m_lru.size() > 1) {
+      auto& victim = m_lru.back();
+      m_usage -= victim.block->size();
+      m_index.erase(victim.key);
+      m_lru.pop_back();
+    }
+  }
+
+  /**
+   * @brief 文件被删除后丢弃它的全部缓存块
+   */
+  void EraseFile(uint64_t fileNumber) {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    for (auto it = m_lru.begin(); it != m_lru.end();) {
+      if (it->key.fileNumber == fileNumber) {
+        m_usage -= it->block->size();
+        m_index.erase(it->key);
+        it = m_lru.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  size_t Usage() const {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    return m_usage;
+  }
+
+  double HitRatio() const {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    uint64_t total = m_hits + m_misses;
+    return total > 0 ? static_cast<double>(m_hits) / total : 0.0;
+  }
+
+ private:
+  struct CacheKey {
+    uint64_t fileNumber;
+    uint64_t offset;
+    bool operator==(const CacheKey& o) const { return fileNumber == o.fileNumber && offset == o.offset; }
+  };
+  struct CacheKeyHash {
+    size_t operator()(const CacheKey& k) const { return std::hash<uint64_t>()(k.fileNumber * 0x9e3779b97f4a7c15ULL ^ k.offset); }
+  };
+  struct Entry {
+    CacheKey key;
+    Block block;
+  };
+
+  mutable std::mutex m_mtx;
+  size_t m_capacity;
+  size_t m_usage;
+  uint64_t m_hits;
+  uint64_t m_misses;
+  std::list<Entry> m_lru;
+  std::unordered_map<CacheKey, std::list<Entry>::iterator, CacheKeyHash> m_index;
+};
+
+#endif  // STORAGE_BLOCK_CACHE_H
@@ -0,0 +1,76 @@
+#ifndef STORAGE_BLOOM_FILTER_H
+#define STORAGE_BLOOM_FILTER_H
+
+#include <string>
+#include <vector>
+
+#include "Coding.h"
+
+/**
+ * @brief 布隆过滤器（每个 SSTable 一个）
+ *
+ * 采用 LevelDB 的双重哈希方案：只计算一次哈希，其余 k-1 个探测位由 delta 旋转得到。
+ * 序列化格式：位数组 + 1 字节 k。点查询在读数据块之前先过一遍过滤器，
+ * 不存在的 key 绝大多数情况下不需要任何磁盘 IO。
+ */
+class BloomFilter {
+ public:
+  explicit BloomFilter(int bitsPerKey = 10) : m_bitsPerKey(bitsPerKey) {
+    // k = ln2 * bits/key 时误判率最低
+    m_k = static_cast<int>(bitsPerKey * 0.69);
+    if (m_k < 1) m_k = 1;
+    if (m_k > 30) m_k = 30;
+  }
+
+  void AddKey(const std::string& key) { m_hashes.push_back(coding::Hash32(key.data(), key.size())); }
+
+  /**
+   * @brief 根据已加入的 key 生成过滤器数据
+   */
+  std::string Finish() const {
+    size_t bits = m_hashes.size() * m_bitsPerKey;
+    if (bits < 64) bits = 64;
+    size_t bytes = (bits + 7) / 8;
+    bits = bytes * 8;
+
+    std::string result(bytes, '\0');
+    for (uint32_t h : m_hashes) {
+      const uint32_t delta = (h >> 17) | (h << 15);
+      for (int j = 0; j < m_k; j++) {
+        const uint32_t bitpos = h % bits;
+        result[bitpos / 8] |= static_cast<char>(1 << (bitpos % 8));
+        h += delta;
+      }
+    }
+    result.push_back(static_cast<char>(m_k));
+    return result;
+  }
+
+  /**
+   * @brief 判断 key 是否可能存在
+   * @return false 表示一定不存在；true 表示可能存在
+   */
+  static bool KeyMayMatch(const std::string& key, const std::string& filter) {
+    if (filter.size() < 2) return true;
+    const size_t bytes = filter.size() - 1;
+    const size_t bits = bytes * 8;
+    const int k = static_cast<unsigned char>(filter[bytes]);
+    if (k > 30) return true;  // 未知编码，保守处理
+
+    uint32_t h = coding::Hash32(key.data(), key.size());
+    const uint32_t delta = (h >> 17) | (h << 15);
+    for (int j = 0; j < k; j++) {
+      const uint32_t bitpos = h % bits;
+      if ((filter[bitpos / 8] & (1 << (bitpos % 8))) == 0) return false;
+      h += delta;
+    }
+    return true;
+  }
+
+ private:
+  int m_bitsPerKey;
+  int m_k;
+  std::vector<uint32_t> m_hashes;
+};
+
+#endif  // STORAGE_BLOOM_FILTER_H
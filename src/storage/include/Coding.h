@@ -0,0 +1,139 @@
+#ifndef STORAGE_CODING_H
+#define STORAGE_CODING_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+/**
+ * @brief 磁盘格式编解码工具（小端定长整数 + varint + 长度前缀字符串）
+ *
+ * LSM 的 SSTable、快照清单等磁盘格式共用这一套编码，
+ * 所有 Get* 函数在输入不足时返回 false，并且只在成功时推进 *p。
+ */
+namespace coding {
+
+inline void PutFixed32(std::string* dst, uint32_t v) {
+  char buf[4];
+  for (int i = 0; i < 4; i++) buf[i] = static_cast<char>((v >> (8 * i)) & 0xff);
+  dst->append(buf, 4);
+}
+
+inline void PutFixed64(std::string* dst, uint64_t v) {
+  char buf[8];
+  for (int i = 0; i < 8; i++) buf[i] = static_cast<char>((v >> (8 * i)) & 0xff);
+  dst->append(buf, 8);
+}
+
+inline uint32_t DecodeFixed32(const char* p) {
+  uint32_t v = 0;
+  for (int i = 0; i < 4; i++) v |= static_cast<uint32_t>(static_cast<unsigned char>(p[i])) << (8 * i);
+  return v;
+}
+
+inline uint64_t DecodeFixed64(const char* p) {
+  uint64_t v = 0;
+  for (int i = 0; i < 8; i++) v |= static_cast<uint64_t>(static_cast<unsigned char>(p[i])) << (8 * i);
+  return v;
+}
+
+inline void PutVarint32(std::string* dst, uint32_t v) {
+  while (v >= 0x80) {
+    dst->push_back(static_cast<char>(v | 0x80));
+    v >>= 7;
+  }
+  dst->push_back(static_cast<char>(v));
+}
+
+inline void PutVarint64(std::string* dst, uint64_t v) {
+  while (v >= 0x80) {
+    dst->push_back(static_cast<char>(v | 0x80));
+    v >>= 7;
+  }
+  dst->push_back(static_cast<char>(v));
+}
+
+inline bool GetFixed32(const char** p, const char* limit, uint32_t* v) {
+  if (limit - *p < 4) return false;
+  *v = DecodeFixed32(*p);
+  *p += 4;
+  return true;
+}
+
+inline bool GetFixed64(const char** p, const char* limit, uint64_t* v) {
+  if (limit - *p < 8) return false;
+  *v = DecodeFixed64(*p);
+  *p += 8;
+  return true;
+}
+
+inline bool GetVarint64(const char** p, const char* limit, uint64_t* v) {
+  uint64_t result = 0;
+  const char* q = *p;
+  for (int shift = 0; shift <= 63 && q < limit; shift += 7) {
+    uint64_t byte = static_cast<unsigned char>(*q++);
+    result |= (byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0) {
+      *v = result;
+      *p = q;
+      return true;
+    }
+  }
+  return false;
+}
+
+inline bool GetVarint32(const char** p, const char* limit, uint32_t* v) {
+  uint64_t v64 = 0;
+  const char* q = *p;
+  if (!GetVarint64(&q, limit, &v64) || v64 > 0xffffffffu) return false;
+  *v = static_cast<uint32_t>(v64);
+  *p = q;
+  return true;
+}
+
+inline void PutLengthPrefixed(std::string* dst, const std::string& s) {
+  PutVarint32(dst, static_cast<uint32_t>(s.size()));
+  dst->append(s);
+}
+
+inline bool GetLengthPrefixed(const char** p, const char* limit, std::string* s) {
+  uint32_t len = 0;
+  const char* q = *p;
+  if (!GetVarint32(&q, limit, &len) || static_cast<uint64_t>(limit - q) < len) return false;
+  s->assign(q, len);
+  *p = q + len;
+  return true;
+}
+
+// 32位哈希（murmur 风格），供布隆过滤器和缓存分片使用
+inline uint32_t Hash32(const char* data, size_t n, uint32_t seed = 0xbc9f1d34) {
+  const uint32_t m = 0xc6a4a793;
+  const uint32_t r = 24;
+  const char* limit = data + n;
+  uint32_t h = seed ^ static_cast<uint32_t>(n * m);
+  while (limit - data >= 4) {
+    uint32_t w = DecodeFixed32(data);
+    data += 4;
+    h += w;
+    h *= m;
+    h ^= (h >> 16);
+  }
+  switch (limit - data) {
+    case 3:
+      h += static_cast<uint32_t>(static_cast<unsigned char>(data[2])) << 16;
+      // fallthrough
+    case 2:
+      h += static_cast<uint32_t>(static_cast<unsigned char>(data[1])) << 8;
+      // fallthrough
+    case 1:
+      h += static_cast<uint32_t>(static_cast<unsigned char>(data[0]));
+      h *= m;
+      h ^= (h >> r);
+      break;
+  }
+  return h;
+}
+
+}  // namespace coding
+
+#endif  // STORAGE_CODING_H
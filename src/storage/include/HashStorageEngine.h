@@ -0,0 +1,120 @@
+#ifndef HASH_STORAGE_ENGINE_H
+#define HASH_STORAGE_ENGINE_H
+
+#include <algorithm>
+#include <mutex>
+#include <sstream>
+#include <utility>
+#include <vector>
+#include "IStorageEngine.h"
+#include "SwissTable.h"
+#include "skipList.h"
+
+/**
+ * @brief 基于开放寻址哈希表的存储引擎
+ *
+ * 面向不需要有序访问的 keyspace：点查/写入平均 O(1)，Append 原地追加。
+ * 哈希表的遍历顺序依赖插入历史，不同副本之间不一致，
+ * 因此快照按 key 排序后输出，保证同样的数据产生同样的快照；
+ * 格式与 SkipListStorageEngine 相同（SkipListDump）。
+ */
+class HashStorageEngine : public IStorageEngine {
+ public:
+  explicit HashStorageEngine(double maxLoadFactor = 0.875) : m_table(maxLoadFactor) {}
+
+  bool Get(const std::string &key, std::string *value) override {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    const std::string *found = m_table.Find(key);
+    if (found == nullptr) {
+      return false;
+    }
+    *value = *found;
+    return true;
+  }
+
+  void Put(const std::string &key, const std::string &value) override {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    *m_table.Upsert(key) = value;
+  }
+
+  void Append(const std::string &key, const std::string &value) override {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_table.Upsert(key)->append(value);
+  }
+
+  void Delete(const std::string &key) override {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_table.Erase(key);
+  }
+
+  // 哈希表无序，只能把不小于 start 的 key 全部取出来排序，代价 O(n log n)；范围读多的 keyspace 应选有序引擎
+  void Scan(const std::string &start,
+            const std::function<bool(const std::string &, const std::string &)> &visitor) override {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    std::vector<std::pair<const std::string *, const std::string *>> entries;
+    m_table.ForEach([&entries, &start](const std::string &key, const std::string &value) {
+      if (key >= start) {
+        entries.emplace_back(&key, &value);
+      }
+    });
+    std::sort(entries.begin(), entries.end(), [](const auto &a, const auto &b) { return *a.first < *b.first; });
+    for (const auto &e : entries) {
+      if (!visitor(*e.first, *e.second)) {
+        break;
+      }
+    }
+  }
+
+  std::string Serialize() override {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    std::vector<std::pair<const std::string *, const std::string *>> entries;
+    entries.reserve(m_table.Size());
+    m_table.ForEach([&entries](const std::string &key, const std::string &value) {
+      entries.emplace_back(&key, &value);
+    });
+    std::sort(entries.begin(), entries.end(), [](const auto &a, const auto &b) { return *a.first < *b.first; });
+
+    SkipListDump<std::string, std::string> dumper;
+    dumper.keyDumpVt_.reserve(entries.size());
+    dumper.valDumpVt_.reserve(entries.size());
+    for (const auto &e : entries) {
+      dumper.keyDumpVt_.push_back(*e.first);
+      dumper.valDumpVt_.push_back(*e.second);
+    }
+    std::stringstream ss;
+    boost::archive::text_oarchive oa(ss);
+    oa << dumper;
+    return ss.str();
+  }
+
+  void Deserialize(const std::string &data) override {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_table.Clear();
+    if (data.empty()) {
+      return;
+    }
+    SkipListDump<std::string, std::string> dumper;
+    std::stringstream iss(data);
+    boost::archive::text_iarchive ia(iss);
+    ia >> dumper;
+    for (size_t i = 0; i < dumper.keyDumpVt_.size(); ++i) {
+      *m_table.Upsert(dumper.keyDumpVt_[i]) = std::move(dumper.valDumpVt_[i]);
+    }
+  }
+
+  size_t Size() const override {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    return m_table.Size();
+  }
+
+  void Clear() override {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_table.Clear();
+  }
+
+ private:
+  SwissTable m_table;
+  mutable std::mutex m_mtx;
+};
+
+#endif  // HASH_STORAGE_ENGINE_H
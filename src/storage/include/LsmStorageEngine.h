@@ -0,0 +1,175 @@
+#ifndef LSM_STORAGE_ENGINE_H
+#define LSM_STORAGE_ENGINE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BlockCache.h"
+#include "IStorageEngine.h"
+#include "SSTable.h"
+#include "skipList.h"
+
+/**
+ * @brief LSM 引擎参数
+ */
+struct LsmOptions {
+  std::string dir = "lsm";                  // SSTable 所在目录（每个节点独立）
+  size_t memtableBytes = 4 << 20;           // memtable 写满后转为 immutable 并刷盘
+  size_t blockSize = 4 << 10;               // 数据块大小
+  int bloomBitsPerKey = 10;                 // 布隆过滤器每个 key 的位数（约 1% 误判率）
+  size_t blockCacheBytes = 64 << 20;        // 块缓存容量
+  int l0CompactionTrigger = 4;              // L0 文件数达到该值时触发 L0->L1 压缩
+  int l0StopWritesTrigger = 12;             // L0 文件数达到该值时写入阻塞等待压缩
+  uint64_t l1MaxBytes = 10 << 20;           // L1 容量，之后每层乘以 levelMultiplier
+  int levelMultiplier = 10;
+  uint64_t targetFileBytes = 2 << 20;       // 压缩输出的单个文件大小
+};
+
+/**
+ * @brief LSM-Tree 存储引擎
+ *
+ * 写路径：写入基于 SkipList 的 memtable；memtable 超过阈值后冻结为 immutable memtable，
+ *         由后台线程刷成 L0 的 SSTable（带块索引和布隆过滤器）。
+ * 读路径：memtable -> immutable memtable -> L0（新到旧）-> L1..Ln（每层二分定位一个文件）。
+ * 压缩：  后台线程做分层压缩，L0 按文件数、L1+ 按层容量打分，分数 >= 1 的层向下一层合并。
+ *
+ * 不需要 WAL：Raft 日志本身就是 WAL，重启后从快照点重放即可。
+ * 因此快照只记录"哪些 SSTable + 未刷盘的 memtable"：
+ * - 本节点重启安装自己的快照时（dbId 相同且文件仍在），直接引用磁盘上的不可变文件，不重写数据；
+ * - 安装来自 leader 的快照时，文件内容随快照一起到达，写成本地的新文件。
+ * 被最近一次快照引用的文件在下一次快照之前不会被删除。
+ */
+class LsmStorageEngine : public IStorageEngine {
+ public:
+  explicit LsmStorageEngine(LsmOptions options = LsmOptions());
+  ~LsmStorageEngine() override;
+
+  LsmStorageEngine(const LsmStorageEngine&) = delete;
+  LsmStorageEngine& operator=(const LsmStorageEngine&) = delete;
+
+  bool Get(const std::string& key, std::string* value) override;
+  void Put(const std::string& key, const std::string& value) override;
+  void Append(const std::string& key, const std::string& value) override;
+  void Delete(const std::string& key) override;
+
+  /**
+   * @brief 合并 memtable 与各层文件的有序视图，删除标记不输出
+   */
+  void Scan(const std::string& start,
+            const std::function<bool(const std::string&, const std::string&)>& visitor) override;
+  std::string Serialize() override;
+
+  /**
+   * @brief 固定当前版本后释放锁，逐个文件按块写出，不阻塞写入，也不把全部文件读进内存
+   */
+  void SerializeTo(std::ostream& os) override;
+  void Deserialize(const std::string& data) override;
+
+  /**
+   * @brief 有效 key 数量的估算值，O(1)，仅用于统计
+   * 值条目数减去删除标记数：memtable 内是精确的；不同文件和 memtable 里同一个 key 的多个版本各算一次，
+   * 一个删除标记按抵消一个旧值计算，压缩把旧版本合并掉之后趋于准确
+   */
+  size_t Size() const override;
+  void Clear() override;
+
+  // ==================== 运维/测试接口 ====================
+
+  int NumFilesAtLevel(int level) const;
+
+  /**
+   * @brief 等待后台刷盘与压缩全部完成
+   */
+  void WaitForBackgroundIdle();
+
+  double BlockCacheHitRatio() const { return m_blockCache.HitRatio(); }
+
+  static constexpr int kNumLevels = 7;
+
+ private:
+  using MemTable = SkipList<std::string, std::string>;  // value = 1字节类型 + 值
+
+  struct FileMeta {
+    uint64_t number = 0;
+    uint64_t size = 0;
+    std::string smallest;
+    std::string largest;
+    std::string path;
+    std::shared_ptr<SSTableReader> table;
+    BlockCache* cache = nullptr;
+    std::atomic<bool> obsolete{false};  // 不再被任何版本引用，最后一个引用释放时删除文件
+
+    ~FileMeta();
+  };
+  using FileMetaPtr = std::shared_ptr<FileMeta>;
+
+  // 不可变的文件集合，读操作拿到 shared_ptr 后无锁访问
+  struct Version {
+    std::vector<FileMetaPtr> levels[kNumLevels];  // L0 新文件在前；L1+ 按 smallest 有序且互不重叠
+  };
+  using VersionPtr = std::shared_ptr<const Version>;
+
+  struct Compaction {
+    int level = 0;
+    std::vector<FileMetaPtr> inputs[2];  // inputs[0] 在 level，inputs[1] 在 level+1
+  };
+
+  std::string tablePath(uint64_t number) const;
+  uint64_t newFileNumber();  // 需持有 m_mtx
+  FileMetaPtr openTable(uint64_t number);
+
+  void memInsert(const std::string& key, LsmValueType type, const std::string& value);
+  void makeRoomForWrite(std::unique_lock<std::mutex>& lock);
+  bool getInternal(const std::string& key, std::string* value);
+
+  void backgroundLoop();
+  bool needsCompaction(const Version& v) const;
+  bool pickCompaction(const Version& v, Compaction* c);
+  FileMetaPtr writeLevel0(const std::shared_ptr<MemTable>& mem);
+  std::vector<FileMetaPtr> doCompaction(const Compaction& c, const VersionPtr& base);
+  void installVersion(std::shared_ptr<Version> v);  // 需持有 m_mtx，同时重算 m_tableCount
+  void waitBackgroundIdle(std::unique_lock<std::mutex>& lock);
+  void removeGarbageFiles();  // 需持有 m_mtx
+
+  uint64_t maxBytesForLevel(int level) const;
+  static uint64_t totalBytes(const std::vector<FileMetaPtr>& files);
+  static bool isBaseLevelForKey(const Version& v, int level, const std::string& key);
+
+  LsmOptions m_options;
+  uint64_t m_dbId;  // 目录身份，用于判断快照中的文件是否就是本地文件
+  BlockCache m_blockCache;
+
+  mutable std::mutex m_writeMtx;  // 串行化写操作（Append 的读-改-写需要）
+  mutable std::mutex m_mtx;       // 保护下面的状态
+  std::condition_variable m_bgCv;
+  std::shared_ptr<MemTable> m_mem;
+  std::shared_ptr<MemTable> m_imm;
+  size_t m_memBytes;
+  // Size() 的估算：各部分的值条目数和删除标记数，memtable 随写入更新，文件部分在安装版本时重算
+  struct KeyCount {
+    int64_t values = 0;
+    int64_t deletions = 0;
+  };
+  KeyCount m_memCount;
+  KeyCount m_immCount;
+  KeyCount m_tableCount;
+  VersionPtr m_current;
+  VersionPtr m_pinned;                 // 最近一次快照引用的版本
+  std::set<uint64_t> m_pendingOutputs;  // 后台正在写的文件号
+  std::string m_compactPointer[kNumLevels];
+  uint64_t m_nextFileNumber;
+  bool m_bgBusy;
+  bool m_shutdown;
+  std::string m_bgError;
+  std::thread m_bgThread;
+};
+
+#endif  // LSM_STORAGE_ENGINE_H
@@ -0,0 +1,257 @@
+#ifndef MVCC_STORAGE_ENGINE_H
+#define MVCC_STORAGE_ENGINE_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ChunkedValue.h"
+#include "IStorageEngine.h"
+
+/**
+ * @brief 多版本（MVCC）内存存储引擎
+ *
+ * 每次写入都带上 Raft 日志索引，生成该 key 的一个新版本，旧版本保留到没有读者需要为止：
+ * - 写：只有一个写者（apply 线程），写入索引必须递增；写完一条日志后调用
+ *   SetAppliedIndex() 让这条日志对读者可见。一条日志内的大批写入可以按 key 分给多个线程并发写，
+ *   见 BeginParallelWrites()。
+ * - 读：ReadView 固定在某个已应用的索引上，Get/遍历只看索引不大于它的版本。
+ *   读路径不加锁（跳表和版本链都用原子指针发布），不阻塞 apply，apply 也不阻塞读。
+ * - GC：由写者周期性执行，以当前最老的读者索引为界，只保留界内每个 key 的最新版本；
+ *   界内最新版本是删除标记的 key 从跳表摘除，等摘除前注册的读者都结束后再释放内存。
+ *
+ * value 用 ChunkedValue 保存，新版本与旧版本共享未修改的块，Append 不复制整个旧值。
+ * 快照格式与 SkipListStorageEngine 相同。
+ */
+class MvccStorageEngine : public IStorageEngine {
+ public:
+  class ReadView;
+
+  MvccStorageEngine();
+  ~MvccStorageEngine() override;
+
+  MvccStorageEngine(const MvccStorageEngine &) = delete;
+  MvccStorageEngine &operator=(const MvccStorageEngine &) = delete;
+
+  // ==================== 版本化写入（仅 apply 线程调用） ====================
+
+  void Put(const std::string &key, const std::string &value, int64_t index);
+  void Append(const std::string &key, const std::string &value, int64_t index);
+  void Delete(const std::string &key, int64_t index);
+
+  /**
+   * @brief 以一组版本化写入的方式安装快照：快照里没有的 key 写删除标记，其余 key 写新版本
+   * 已经打开的 ReadView 仍然看到安装前的数据
+   * @param versions 与快照中 key 顺序一致的版本号（ReadView::CollectVersions 的输出），
+   *                 为空时所有 key 的版本号记为 index
+   * @return index 不在已应用索引之后时返回 false，不安装：旧快照的数据不能以更新的版本号出现
+   */
+  bool Install(const std::string &data, int64_t index, const std::vector<int64_t> *versions = nullptr) override;
+
+  /**
+   * @brief 进入并发写入区间：到 EndParallelWrites() 为止，索引为 index 的写入可以在多个线程上同时调用，
+   * 但同一个 key 只能由一个线程写（调用方按 key 分区）。已有 key 的新版本直接挂到各自的版本链上，
+   * 只有新建跳表节点时互斥；区间内不做 GC
+   */
+  void BeginParallelWrites(int64_t index) override;
+  void EndParallelWrites() override;
+
+  /**
+   * @brief 索引不大于 index 的写入对新打开的读者可见
+   */
+  void SetAppliedIndex(int64_t index);
+  int64_t AppliedIndex() const { return m_applied.load(std::memory_order_acquire); }
+
+  /**
+   * @brief 按最老的读者回收旧版本和已删除的 key，写入时也会按间隔自动触发
+   */
+  void CollectGarbage();
+
+  // ==================== 读 ====================
+
+  /**
+   * @brief 在最新的已应用索引上打开读视图
+   */
+  ReadView OpenReadView();
+
+  /**
+   * @brief 在指定索引上打开读视图
+   * @return 索引比已回收的版本还旧或者还没应用时返回 false
+   */
+  bool OpenReadView(int64_t index, ReadView *view);
+
+  // ==================== IStorageEngine ====================
+  // 读最新的已应用版本。BeginApply 与 FinishApply 之间的写入使用该日志的索引，FinishApply 时对读者可见；
+  // 区间外的写入各自占用下一个索引并立即可见
+
+  bool BeginApply(int64_t index) override;
+  void FinishApply(int64_t index) override;
+  std::shared_ptr<IReadView> OpenView() override;
+  std::shared_ptr<IReadView> OpenView(int64_t index) override;
+  bool CollectVersions(std::vector<int64_t> *out) override;
+
+  bool Get(const std::string &key, std::string *value) override;
+  void Put(const std::string &key, const std::string &value) override;
+  void Append(const std::string &key, const std::string &value) override;
+  void Delete(const std::string &key) override;
+  void Scan(const std::string &start,
+            const std::function<bool(const std::string &, const std::string &)> &visitor) override;
+  bool GetVersion(const std::string &key, int64_t *version) override;
+  std::string Serialize() override;
+  void SerializeTo(std::ostream &os) override;
+  void Deserialize(const std::string &data) override;
+  size_t Size() const override;
+  void Clear() override;
+
+  // ==================== 运维/测试接口 ====================
+
+  size_t VersionCount() const { return m_versionCount.load(std::memory_order_relaxed); }
+  size_t ActiveReaders() const;
+
+ private:
+  struct Version;
+  struct Node;
+
+  static constexpr int kMaxLevel = 16;
+  static constexpr size_t kGcEveryWrites = 1024;
+
+  // ---------- 跳表 ----------
+  Node *newNode(const std::string &key, int level);
+  void freeNode(Node *node);
+  int randomLevel();
+  Node *findGreaterOrEqual(const std::string &key, Node **prev) const;
+  Node *seek(const std::string &key) const;
+
+  // ---------- 写 ----------
+  void addVersion(const std::string &key, Version *version);
+  void pushVersion(Node *node, Version *version);  // 挂到已有节点的版本链上
+  void insertNode(const std::string &key, Version *version, Node **prev);
+  void markDirty(Node *node);
+  void unlink(Node *node);
+  // index 是否在读者可能看到的索引之后（可以写入）
+  bool writableAt(int64_t index) const;
+  // 带显式索引的写入在索引不合法时抛出 std::invalid_argument（调用方的编程错误）
+  void checkWriteIndex(int64_t index) const;
+  void maybeCollect();
+
+  // ---------- 读者登记 ----------
+  uint64_t registerReader(int64_t *index);
+  bool registerReaderAt(int64_t index, uint64_t *ticket);
+  void unregisterReader(uint64_t ticket);
+
+  bool getAt(const std::string &key, int64_t index, std::string *value) const;
+  int64_t versionAt(const std::string &key, int64_t index) const;
+  void versionsAt(int64_t index, std::vector<int64_t> *out) const;
+  void forEachAt(int64_t index, const std::function<void(const std::string &, const ChunkedValue &)> &visitor) const;
+  void scanAt(int64_t index, const std::string &start,
+              const std::function<bool(const std::string &, const ChunkedValue &)> &visitor) const;
+  void serializeAt(int64_t index, std::ostream &os) const;
+
+  Node *m_head;
+  std::atomic<int> m_level;  // 只有写者修改
+  std::mt19937 m_rng;        // 只有写者使用
+  std::atomic<int64_t> m_applied;
+  std::atomic<size_t> m_liveCount;
+  std::atomic<size_t> m_versionCount;
+
+  // 写者私有
+  int64_t m_lastWrite;               // 最近一次写入的索引
+  int64_t m_applying;                // BeginApply 的索引，不在区间内时为 0
+  std::vector<Node *> m_dirty;       // 有旧版本或者最新版本是删除标记的节点
+  std::vector<std::pair<uint64_t, Node *>> m_retired;  // (摘除时的读者票号, 节点)
+  size_t m_writesSinceGc;
+  // 并发写入区间：m_parallel 只在区间外修改；区间内新建节点、m_dirty 和 m_rng 由 m_writeMtx 保护
+  bool m_parallel;
+  std::mutex m_writeMtx;
+  std::atomic<size_t> m_parallelWrites;
+
+  // 读者登记：票号 -> 读索引。票号单调递增，用于判断读者是否可能还停在已摘除的节点上
+  mutable std::mutex m_readerMtx;
+  std::map<uint64_t, int64_t> m_readers;
+  uint64_t m_nextTicket;
+  int64_t m_horizon;  // 最近一次 GC 的边界，更早的索引已经不能再打开读视图
+};
+
+/**
+ * @brief 固定在某个索引上的只读视图，析构时注销；存活期间 GC 不会回收它能看到的版本
+ */
+class MvccStorageEngine::ReadView {
+ public:
+  ReadView() = default;
+  ~ReadView() { Release(); }
+  ReadView(ReadView &&other) noexcept { *this = std::move(other); }
+  ReadView &operator=(ReadView &&other) noexcept {
+    if (this != &other) {
+      Release();
+      m_engine = other.m_engine;
+      m_index = other.m_index;
+      m_ticket = other.m_ticket;
+      other.m_engine = nullptr;
+    }
+    return *this;
+  }
+  ReadView(const ReadView &) = delete;
+  ReadView &operator=(const ReadView &) = delete;
+
+  bool Valid() const { return m_engine != nullptr; }
+  int64_t Index() const { return m_index; }
+
+  bool Get(const std::string &key, std::string *value) const { return m_engine->getAt(key, m_index, value); }
+
+  /**
+   * @brief key 在视图中可见的最新版本的写入索引，不存在（或已删除）时为 0
+   */
+  int64_t Version(const std::string &key) const { return m_engine->versionAt(key, m_index); }
+
+  /**
+   * @brief 按 key 升序遍历视图中存在的所有键值
+   */
+  void ForEach(const std::function<void(const std::string &, const ChunkedValue &)> &visitor) const {
+    m_engine->forEachAt(m_index, visitor);
+  }
+
+  /**
+   * @brief 从第一个不小于 start 的 key 开始升序遍历，visitor 返回 false 时停止
+   * 读视图固定了索引，分多次调用（翻页）看到的仍是同一份数据
+   */
+  void Scan(const std::string &start,
+            const std::function<bool(const std::string &, const ChunkedValue &)> &visitor) const {
+    m_engine->scanAt(m_index, start, visitor);
+  }
+
+  /**
+   * @brief 输出视图的快照，格式与 MvccStorageEngine::Serialize() 相同
+   */
+  void SerializeTo(std::ostream &os) const { m_engine->serializeAt(m_index, os); }
+
+  /**
+   * @brief 按 SerializeTo 中 key 的顺序输出每个 key 的版本号，随快照一起保存后传给 Install
+   */
+  void CollectVersions(std::vector<int64_t> *out) const { m_engine->versionsAt(m_index, out); }
+
+  void Release() {
+    if (m_engine != nullptr) {
+      m_engine->unregisterReader(m_ticket);
+      m_engine = nullptr;
+    }
+  }
+
+ private:
+  friend class MvccStorageEngine;
+  ReadView(MvccStorageEngine *engine, int64_t index, uint64_t ticket)
+      : m_engine(engine), m_index(index), m_ticket(ticket) {}
+
+  MvccStorageEngine *m_engine = nullptr;
+  int64_t m_index = 0;
+  uint64_t m_ticket = 0;
+};
+
+#endif  // MVCC_STORAGE_ENGINE_H
@@ -0,0 +1,156 @@
+#ifndef STORAGE_SSTABLE_H
+#define STORAGE_SSTABLE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "BlockCache.h"
+#include "BloomFilter.h"
+
+/**
+ * SSTable 文件格式（所有整数小端）：
+ *
+ *   [data block 0] ... [data block n-1] [filter block] [index block] [footer 40B]
+ *
+ *   data block   : 连续的 entry，entry = varint keyLen | key | u8 type | varint valLen | value
+ *   filter block : BloomFilter::Finish() 的输出
+ *   index block  : smallestKey | largestKey | varint64 numEntries | varint32 blockCount |
+ *                  blockCount * (lastKey | varint64 offset | varint64 size) | varint64 numDeletions
+ *                  （numDeletions 是后加的，旧文件没有，读出来按 0 处理）
+ *   footer       : fixed64 filterOffset | fixed64 filterSize | fixed64 indexOffset | fixed64 indexSize | fixed64 magic
+ *
+ * 文件一旦写完就不再修改，索引和过滤器在打开时常驻内存，数据块按需读取并进入 BlockCache。
+ */
+
+enum class LsmValueType : uint8_t { kDeletion = 0, kValue = 1 };
+
+/**
+ * @brief 有序 entry 迭代器（memtable 与 SSTable 合并时的统一视图）
+ */
+class LsmIterator {
+ public:
+  virtual ~LsmIterator() = default;
+  virtual bool Valid() const = 0;
+  virtual void Next() = 0;
+  virtual const std::string& Key() const = 0;
+  virtual LsmValueType Type() const = 0;
+  virtual const std::string& Value() const = 0;
+};
+
+/**
+ * @brief SSTable 写入器，key 必须严格递增地 Add
+ */
+class SSTableBuilder {
+ public:
+  SSTableBuilder(const std::string& path, size_t blockSize, int bloomBitsPerKey);
+  ~SSTableBuilder();
+
+  SSTableBuilder(const SSTableBuilder&) = delete;
+  SSTableBuilder& operator=(const SSTableBuilder&) = delete;
+
+  void Add(const std::string& key, LsmValueType type, const std::string& value);
+
+  /**
+   * @brief 写入 filter/index/footer 并 fsync，之后文件即可被 SSTableReader 打开
+   */
+  void Finish();
+
+  uint64_t FileSize() const { return m_offset + m_buffer.size(); }
+  uint64_t NumEntries() const { return m_numEntries; }
+  uint64_t NumDeletions() const { return m_numDeletions; }
+  const std::string& SmallestKey() const { return m_smallestKey; }
+  const std::string& LargestKey() const { return m_lastKey; }
+
+ private:
+  struct IndexEntry {
+    std::string lastKey;
+    uint64_t offset;
+    uint64_t size;
+  };
+
+  void flushBlock();
+  void writeOut(bool force);
+
+  std::string m_path;
+  int m_fd;
+  size_t m_blockSize;
+  uint64_t m_offset;     // 已写入文件的字节数
+  std::string m_buffer;  // 待写入文件的字节
+  std::string m_block;   // 正在构建的数据块
+  uint64_t m_blockStart;
+  std::vector<IndexEntry> m_index;
+  BloomFilter m_filter;
+  std::string m_smallestKey;
+  std::string m_lastKey;
+  uint64_t m_numEntries;
+  uint64_t m_numDeletions = 0;
+  bool m_finished;
+};
+
+/**
+ * @brief SSTable 只读访问，线程安全（pread + 不可变的内存索引）
+ */
+class SSTableReader : public std::enable_shared_from_this<SSTableReader> {
+ public:
+  enum class LookupResult { kNotFound, kFound, kDeleted };
+
+  /**
+   * @brief 打开文件并加载索引与过滤器，格式错误时抛出 std::runtime_error
+   */
+  static std::shared_ptr<SSTableReader> Open(const std::string& path, uint64_t fileNumber, BlockCache* cache);
+  ~SSTableReader();
+
+  LookupResult Get(const std::string& key, std::string* value);
+
+  /**
+   * @brief 顺序遍历整个文件
+   * @param fillCache 压缩时传 false，避免冷数据把热点块挤出缓存
+   */
+  std::unique_ptr<LsmIterator> NewIterator(bool fillCache);
+
+  /**
+   * @brief 从第一个不小于 start 的 entry 开始遍历，用块索引跳过前面的块
+   */
+  std::unique_ptr<LsmIterator> NewIterator(bool fillCache, const std::string& start);
+
+  uint64_t FileNumber() const { return m_fileNumber; }
+  uint64_t FileSize() const { return m_fileSize; }
+  uint64_t NumEntries() const { return m_numEntries; }
+  uint64_t NumDeletions() const { return m_numDeletions; }  // 删除标记数，包含在 NumEntries 中
+  const std::string& SmallestKey() const { return m_smallestKey; }
+  const std::string& LargestKey() const { return m_largestKey; }
+  size_t NumBlocks() const { return m_index.size(); }
+
+  // 内部使用：读取第 idx 个数据块
+  BlockCache::Block ReadBlock(size_t idx, bool fillCache);
+
+ private:
+  struct IndexEntry {
+    std::string lastKey;
+    uint64_t offset;
+    uint64_t size;
+  };
+
+  SSTableReader() = default;
+  std::string readAt(uint64_t offset, uint64_t size) const;
+
+  int m_fd = -1;
+  uint64_t m_fileNumber = 0;
+  uint64_t m_fileSize = 0;
+  uint64_t m_numEntries = 0;
+  uint64_t m_numDeletions = 0;
+  BlockCache* m_cache = nullptr;
+  std::string m_filter;
+  std::vector<IndexEntry> m_index;
+  std::string m_smallestKey;
+  std::string m_largestKey;
+};
+
+/**
+ * @brief 解析一条 data block entry，失败返回 false
+ */
+bool ParseLsmEntry(const char** p, const char* limit, std::string* key, LsmValueType* type, std::string* value);
+
+#endif  // STORAGE_SSTABLE_H
@@ -0,0 +1,56 @@
+#ifndef SHARDED_STORAGE_ENGINE_H
+#define SHARDED_STORAGE_ENGINE_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "IStorageEngine.h"
+
+/**
+ * @brief 按 key 哈希分片的存储引擎
+ *
+ * 把 keyspace 分给 N 个互相独立的内层引擎，每个分片有自己的锁：
+ * 点查、写入、删除只锁 key 所在的分片，读和 apply 落在不同分片时互不等待。
+ *
+ * Scan 对各分片做多路归并，结果仍按 key 升序；每个分片一次只取一小批，visitor 提前结束时不会把整个分片读出来。
+ * 每一批在各自分片的锁内读取，分片之间不是同一时刻的视图，调用方需要一致的遍历时应与写入互斥
+ * （状态机的 apply 线程是唯一的写者，它自己的遍历不受影响）。
+ *
+ * 快照是各分片数据归并后的 SkipListDump，与 SkipListStorageEngine / HashStorageEngine 的格式相同，
+ * 与分片数无关：分片数不同的节点之间、分片与不分片的引擎之间都可以互相安装快照。
+ */
+class ShardedStorageEngine : public IStorageEngine {
+ public:
+  static constexpr size_t kDefaultShards = 16;
+
+  /**
+   * @param shards 内层引擎，至少一个，传入时应为空
+   */
+  explicit ShardedStorageEngine(std::vector<std::unique_ptr<IStorageEngine>> shards);
+
+  ShardedStorageEngine(const ShardedStorageEngine &) = delete;
+  ShardedStorageEngine &operator=(const ShardedStorageEngine &) = delete;
+
+  bool Get(const std::string &key, std::string *value) override;
+  void Put(const std::string &key, const std::string &value) override;
+  void Append(const std::string &key, const std::string &value) override;
+  void Delete(const std::string &key) override;
+  bool GetVersion(const std::string &key, int64_t *version) override;
+  void Scan(const std::string &start,
+            const std::function<bool(const std::string &, const std::string &)> &visitor) override;
+  std::string Serialize() override;
+  void Deserialize(const std::string &data) override;
+  size_t Size() const override;
+  void Clear() override;
+
+  size_t ShardCount() const { return m_shards.size(); }
+
+ private:
+  size_t shardIndex(const std::string &key) const;
+
+  std::vector<std::unique_ptr<IStorageEngine>> m_shards;
+};
+
+#endif  // SHARDED_STORAGE_ENGINE_H
@@ -0,0 +1,28 @@
+#ifndef STORAGE_ENGINE_FACTORY_H
+#define STORAGE_ENGINE_FACTORY_H
+
+#include <memory>
+#include <string>
+#include "IStorageEngine.h"
+
+/**
+ * @brief 按名称创建存储引擎
+ *
+ * 可选值：
+ * - "skiplist"：SkipListStorageEngine
+ * - "art"：ArtStorageEngine，点查为主的负载
+ * - "hash"：HashStorageEngine，不需要有序访问的负载
+ * - "btree"：BTreeStorageEngine，数据放在 btreeData<nodeId>.db
+ * - "lsm"：LsmStorageEngine，数据放在 lsmData<nodeId> 目录
+ * - "mvcc"：MvccStorageEngine，读视图不阻塞写入（KvServer默认）
+ * - "vlog" / "vlog:<engine>"：ValueLogStorageEngine，大 value 放在 vlogData<nodeId> 目录，
+ *   索引默认用跳表，也可以指定上面任意一种引擎
+ * - "sharded" / "sharded:<engine>"：ShardedStorageEngine，keyspace 按哈希分到多个各自加锁的引擎，
+ *   分片默认用跳表，也可以是 "art" / "hash"
+ *
+ * @param type 引擎名称，未知名称抛出 std::invalid_argument
+ * @param nodeId 节点编号，需要落盘的引擎用它区分目录
+ */
+std::unique_ptr<IStorageEngine> CreateStorageEngine(const std::string &type, int nodeId);
+
+#endif  // STORAGE_ENGINE_FACTORY_H
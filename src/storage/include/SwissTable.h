@@ -0,0 +1,69 @@
+#ifndef SWISS_TABLE_H
+#define SWISS_TABLE_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+/**
+ * @brief 开放寻址哈希表（Swiss table 布局）
+ *
+ * - 每个槽位对应 1 字节控制字：空 / 墓碑 / 已用（低 7 位存 hash 的 H2）；
+ *   16 个控制字为一组，探测时用 SSE2 一次比较整组，只有 H2 命中的槽位才去比较 key；
+ * - 组间二次探测，负载上限默认 7/8；
+ * - 渐进式扩容：超过负载上限后新建两倍大小的表，旧表保留，
+ *   之后每次写操作顺带搬迁 kMigrateBatch 个槽位，单次插入不会因为整表 rehash 出现长尾；
+ *   搬迁期间一个 key 只会存在于其中一张表，查找依次检查新表和旧表。
+ *
+ * 非线程安全，由外层（HashStorageEngine）加锁。
+ */
+class SwissTable {
+ public:
+  explicit SwissTable(double maxLoadFactor = 0.875);
+  ~SwissTable();
+
+  SwissTable(const SwissTable &) = delete;
+  SwissTable &operator=(const SwissTable &) = delete;
+
+  /**
+   * @brief 查找 key，返回值的指针，不存在返回 nullptr
+   */
+  std::string *Find(const std::string &key);
+
+  /**
+   * @brief 插入或定位 key，返回其值的指针（新 key 的值为空串）
+   */
+  std::string *Upsert(const std::string &key);
+
+  bool Erase(const std::string &key);
+
+  /**
+   * @brief 遍历所有元素，顺序取决于哈希与插入历史，不保证稳定
+   */
+  void ForEach(const std::function<void(const std::string &, const std::string &)> &visitor) const;
+
+  void Clear();
+  size_t Size() const;
+
+  // ==================== 统计接口 ====================
+
+  size_t Capacity() const;
+  bool Migrating() const { return m_old != nullptr; }
+
+  static constexpr size_t kGroupSize = 16;
+  static constexpr size_t kMigrateBatch = 32;
+
+ private:
+  struct Table;
+
+  void maybeGrow();
+  void migrateStep(size_t slots);
+
+  double m_maxLoadFactor;
+  std::unique_ptr<Table> m_active;
+  std::unique_ptr<Table> m_old;  // 扩容中的旧表，搬空后释放
+  size_t m_migratePos;           // 旧表中下一个待搬迁的槽位
+};
+
+#endif  // SWISS_TABLE_H
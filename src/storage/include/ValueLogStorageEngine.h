@@ -0,0 +1,124 @@
+#ifndef VALUE_LOG_STORAGE_ENGINE_H
+#define VALUE_LOG_STORAGE_ENGINE_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "IStorageEngine.h"
+
+/**
+ * @brief 键值分离引擎参数
+ */
+struct ValueLogOptions {
+  std::string dir = "vlog";              // value log 段文件所在目录（每个节点独立）
+  size_t valueThreshold = 1024;          // 不小于该长度的 value 写入 value log，更小的内联在索引中
+  uint64_t segmentBytes = 64 << 20;      // 段文件写满后封存，新开一个段
+  double gcDeadRatio = 0.5;              // 封存段中失效数据占比达到该值时回收
+  int gcIntervalMs = 1000;               // 后台 GC 检查间隔
+  size_t maxExtents = 64;                // 一个 value 最多由多少段追加片段组成，超过后合并重写
+};
+
+/**
+ * @brief WiscKey 风格的键值分离存储引擎
+ *
+ * 作为装饰器包在任意 IStorageEngine（索引）外面：
+ * - 大 value 顺序追加到 value log 段文件，索引里只存 (段号, 偏移, 长度) 指针；
+ *   小 value 直接内联在索引中，避免一次额外的读。
+ * - Append 只把新增的字节写进 value log，并在索引的指针列表末尾加一项，
+ *   代价与追加长度成正比；指针过多时合并重写成一段。
+ * - Get 按指针列表把各片段读出拼接。
+ * - 后台 GC：按段统计有效字节，失效比例高的封存段中仍被索引引用的片段搬到当前段，
+ *   然后删除整个段文件。
+ *
+ * 快照 = 索引快照（只含指针，与 value 大小无关）+ 被引用段文件的原始字节，
+ * 段文件内容按原样流式写出，不经过逐条序列化。
+ * 本节点安装自己的快照时（目录身份相同且段文件仍在）直接复用本地段文件。
+ */
+class ValueLogStorageEngine : public IStorageEngine {
+ public:
+  ValueLogStorageEngine(std::unique_ptr<IStorageEngine> index, ValueLogOptions options = ValueLogOptions());
+  ~ValueLogStorageEngine() override;
+
+  ValueLogStorageEngine(const ValueLogStorageEngine &) = delete;
+  ValueLogStorageEngine &operator=(const ValueLogStorageEngine &) = delete;
+
+  bool Get(const std::string &key, std::string *value) override;
+  void Put(const std::string &key, const std::string &value) override;
+  void Append(const std::string &key, const std::string &value) override;
+  void Delete(const std::string &key) override;
+  void Scan(const std::string &start,
+            const std::function<bool(const std::string &, const std::string &)> &visitor) override;
+  std::string Serialize() override;
+  void SerializeTo(std::ostream &os) override;
+  void Deserialize(const std::string &data) override;
+  size_t Size() const override;
+  void Clear() override;
+
+  // ==================== 运维/测试接口 ====================
+
+  /**
+   * @brief 立即做一轮 GC，返回回收的段数
+   */
+  int RunGcOnce();
+
+  size_t SegmentCount() const;
+
+ private:
+  // value log 中的一个片段
+  struct Extent {
+    uint64_t segment;
+    uint64_t offset;  // value 字节在段文件中的起始位置
+    uint32_t len;
+  };
+
+  // 段文件：fd 随 shared_ptr 释放关闭，GC 删除文件后正在读的请求仍可以读完
+  struct Segment {
+    uint64_t number = 0;
+    int fd = -1;
+    uint64_t size = 0;       // 已写入字节数
+    uint64_t liveBytes = 0;  // 仍被索引引用的 value 字节数
+    ~Segment();
+  };
+  using SegmentPtr = std::shared_ptr<Segment>;
+
+  // 索引中存放的 value 编码：1 字节标记 + 内联值 / 指针列表
+  static std::string encodeInline(const std::string &value);
+  static std::string encodeExtents(const std::vector<Extent> &extents);
+  static bool decode(const std::string &encoded, std::string *inlineValue, std::vector<Extent> *extents);
+
+  std::string segmentPath(uint64_t number) const;
+  SegmentPtr openSegment(uint64_t number, bool truncate);
+  Extent writeValue(const std::string &key, const char *data, size_t len);  // 需持有 m_mtx
+  void releaseExtents(const std::vector<Extent> &extents);                  // 需持有 m_mtx
+  // 与索引查找在同一个 m_mtx 临界区内调用：GC 可能在两次加锁之间搬走片段并删除段文件
+  std::vector<SegmentPtr> pinSegments(const std::vector<Extent> &extents) const;  // 需持有 m_mtx
+  static void readExtents(const std::vector<Extent> &extents, const std::vector<SegmentPtr> &segs,
+                          std::string *out);
+  void newIdentity();
+
+  void gcLoop();
+  bool collectSegment(const SegmentPtr &seg);
+
+  std::unique_ptr<IStorageEngine> m_index;
+  ValueLogOptions m_options;
+  uint64_t m_dbId;
+
+  mutable std::mutex m_mtx;
+  std::map<uint64_t, SegmentPtr> m_segments;
+  SegmentPtr m_head;  // 当前写入的段
+  uint64_t m_nextSegment;
+
+  std::mutex m_gcMtx;  // 串行化 GC（后台线程与 RunGcOnce）
+  std::condition_variable m_gcCv;
+  bool m_shutdown;
+  std::thread m_gcThread;
+};
+
+#endif  // VALUE_LOG_STORAGE_ENGINE_H
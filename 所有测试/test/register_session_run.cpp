@@ -0,0 +1,87 @@
+// register_session_run.cpp - 会话注册日志被截断、同一索引换成另一个客户端的注册日志时，等待者不能误认
+//
+// 场景：客户端 A 的注册日志在旧 leader 上拿到索引 5，还没提交 leader 就换了，新 leader 在索引 5 提交的是客户端 B 的注册。
+// A 的等待者必须以失败回调（A 重试后拿到自己的会话），只有 B 拿到会话 5，两个客户端不会共用同一个去重会话。
+// 注册日志的 ClientId 是客户端生成的随机数（同 KvServer::RegisterSession），apply 时忽略，不会变成会话。
+//
+// 编译（在仓库根目录）：
+//   g++ -std=c++17 -I src/common/include -I src/raftCore/include -I src/skipList/include -I src/storage/include \
+//       所有测试/test/register_session_run.cpp src/raftCore/CompletionSlab.cpp src/raftCore/KvStateMachine.cpp \
+//       src/raftCore/ReadCache.cpp src/raftCore/ApplyPool.cpp src/raftCore/SessionTable.cpp \
+//       src/raftCore/ShardedSessionTable.cpp src/raftCore/TtlIndex.cpp src/raftCore/TimingWheel.cpp \
+//       src/raftCore/TxnExecutor.cpp src/raftCore/WatchHub.cpp src/storage/*.cpp \
+//       -lboost_serialization -lfmt -lpthread -o bin/register_session_run
+// 运行：
+//   ./bin/register_session_run
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include "CompletionSlab.h"
+#include "KvStateMachine.h"
+#include "SessionTable.h"
+#include "StorageEngineFactory.h"
+
+namespace {
+
+Op registration(uint64_t nonce) {
+  Op op;
+  op.Operation = "RegisterSession";
+  op.ClientId = std::to_string(nonce);
+  op.RequestId = 0;
+  op.TimestampMs = 1000;
+  return op;
+}
+
+uint64_t tagOf(const Op &op) { return CompletionSlab::Tag(op.ClientId, op.RequestId); }
+
+}  // namespace
+
+int main() {
+  const int index = 5;
+  auto deadline = CompletionSlab::Clock::now() + std::chrono::seconds(10);
+  Op fromA = registration(0x1234567890abcdefULL);
+  Op fromB = registration(0xfedcba0987654321ULL);
+  assert(tagOf(fromA) != tagOf(fromB));
+
+  // 旧 leader 上 A 在索引 5 等待，新 leader 上 B 在索引 5 等待
+  CompletionSlab oldLeader;
+  CompletionSlab newLeader;
+  int resultA = -1;
+  int resultB = -1;
+  oldLeader.Register(index, tagOf(fromA), deadline, [&](bool applied, int) { resultA = applied; });
+  newLeader.Register(index, tagOf(fromB), deadline, [&](bool applied, int) { resultB = applied; });
+
+  KvStateMachine sm(CreateStorageEngine("skiplist", 0));
+  for (int i = 1; i < index; i++) {
+    Op noop;
+    noop.Operation = "Get";
+    noop.RequestId = 0;
+    noop.TimestampMs = 1000;
+    assert(sm.ApplyOp(noop, i, nullptr));
+  }
+  // 两个节点都在索引 5 应用 B 的注册日志
+  assert(sm.ApplyOp(fromB, index, nullptr));
+  oldLeader.Complete(index, tagOf(fromB));
+  newLeader.Complete(index, tagOf(fromB));
+
+  assert(resultA == 0);
+  assert(resultB == 1);
+  // 只注册了以索引为 id 的会话，随机数本身没有成为会话
+  assert(sm.SessionCount() == 1);
+
+  Op put;
+  put.Operation = "Put";
+  put.Key = "k";
+  put.Value = "v";
+  put.ClientId = SessionTable::ClientIdOf(index);
+  put.RequestId = 1;
+  put.TimestampMs = 1000;
+  assert(sm.ApplyOp(put, index + 1, nullptr));
+  assert(sm.IsDuplicateRequest(SessionTable::ClientIdOf(index), 1));
+  assert(!sm.IsDuplicateRequest(fromB.ClientId, 0));
+
+  std::printf("register_session_run ok\n");
+  return 0;
+}
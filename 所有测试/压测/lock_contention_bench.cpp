@@ -0,0 +1,170 @@
+// lock_contention_bench.cpp - 读写并发时的锁竞争测试（不经过 Raft）
+//
+// 一个写线程不停地写（模拟 apply），同时 1/2/4/8 个读线程做点查，统计读吞吐随读线程数的变化。
+// 对比单锁的 SkipListStorageEngine 和按 key 分片的 ShardedStorageEngine（16 个跳表分片），
+// 分别直接压引擎、以及经过 KvStateMachine（Get + 判重 与 Apply 并发）。
+// 单锁时读线程越多排队越严重；分片后读和写落在不同分片上互不等待，读吞吐应随线程数上升。
+//
+// 编译（在仓库根目录）：
+//   g++ -O2 -std=c++17 -I src/common/include -I src/skipList/include -I src/storage/include -I src/raftCore/include \
+//       所有测试/压测/lock_contention_bench.cpp src/storage/ShardedStorageEngine.cpp \
+//       src/raftCore/KvStateMachine.cpp src/raftCore/ApplyPool.cpp src/raftCore/ReadCache.cpp \
+//       src/raftCore/SessionTable.cpp src/raftCore/ShardedSessionTable.cpp src/raftCore/TtlIndex.cpp \
+//       src/raftCore/TimingWheel.cpp src/raftCore/TxnExecutor.cpp \
+//       -lboost_serialization -lfmt -lpthread -o bin/lock_contention_bench
+// 运行：
+//   ./bin/lock_contention_bench [每组持续毫秒数]   # 默认 1000
+//
+// 注意：SkipList 每次操作都会向 std::cout 打印调试信息，测试期间 stdout 指向空设备，结果写到原来的标准输出。
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "KvStateMachine.h"
+#include "ShardedStorageEngine.h"
+#include "SkipListStorageEngine.h"
+
+namespace {
+
+constexpr size_t kKeyCount = 100000;
+constexpr size_t kShards = ShardedStorageEngine::kDefaultShards;
+
+FILE *g_out = nullptr;  // 原来的标准输出
+
+std::string keyOf(size_t i) { return "user:" + std::to_string(i); }
+
+std::unique_ptr<IStorageEngine> makeEngine(bool sharded) {
+  if (!sharded) {
+    return std::make_unique<SkipListStorageEngine>(18);
+  }
+  std::vector<std::unique_ptr<IStorageEngine>> shards;
+  for (size_t i = 0; i < kShards; i++) {
+    shards.push_back(std::make_unique<SkipListStorageEngine>(18));
+  }
+  return std::make_unique<ShardedStorageEngine>(std::move(shards));
+}
+
+struct Target {
+  std::function<void(size_t i, std::string *out)> read;
+  std::function<void(size_t seq)> write;
+};
+
+struct Result {
+  double readOps;
+  double writeOps;
+};
+
+// 一个写线程持续写入，readers 个读线程随机点查，持续 durationMs
+Result run(const Target &target, int readers, int durationMs) {
+  std::atomic<bool> stop{false};
+  std::atomic<uint64_t> reads{0};
+  uint64_t writes = 0;
+
+  std::thread writer([&] {
+    size_t seq = 1;
+    while (!stop.load(std::memory_order_relaxed)) {
+      target.write(seq++);
+    }
+    writes = seq - 1;
+  });
+  std::vector<std::thread> threads;
+  for (int t = 0; t < readers; t++) {
+    threads.emplace_back([&, t] {
+      std::mt19937_64 rng(t + 1);
+      std::string out;
+      uint64_t n = 0;
+      while (!stop.load(std::memory_order_relaxed)) {
+        target.read(rng() % kKeyCount, &out);
+        ++n;
+      }
+      reads.fetch_add(n);
+    });
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  std::this_thread::sleep_for(std::chrono::milliseconds(durationMs));
+  stop = true;
+  writer.join();
+  for (auto &t : threads) {
+    t.join();
+  }
+  double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  return Result{reads.load() / sec, writes / sec};
+}
+
+void printRow(const std::string &name, int readers, const Result &r) {
+  std::fprintf(g_out, "%-28s %8d %14.0f %14.0f\n", name.c_str(), readers, r.readOps, r.writeOps);
+  std::fflush(g_out);
+}
+
+void benchEngine(bool sharded, int durationMs) {
+  std::unique_ptr<IStorageEngine> engine = makeEngine(sharded);
+  const std::string value(64, 'v');
+  for (size_t i = 0; i < kKeyCount; i++) {
+    engine->Put(keyOf(i), value);
+  }
+  Target target;
+  target.read = [&](size_t i, std::string *out) { engine->Get(keyOf(i), out); };
+  target.write = [&](size_t seq) { engine->Put(keyOf(seq * 7919 % kKeyCount), value); };
+  for (int readers : {1, 2, 4, 8}) {
+    printRow(sharded ? "engine sharded x16" : "engine skiplist", readers, run(target, readers, durationMs));
+  }
+}
+
+void benchStateMachine(bool sharded, int durationMs) {
+  KvStateMachine sm(makeEngine(sharded));
+  const std::string value(64, 'v');
+  int index = 0;
+  auto apply = [&](size_t key, int requestId) {
+    Op op;
+    op.Operation = "Put";
+    op.Key = keyOf(key);
+    op.Value = value;
+    op.ClientId = requestId > static_cast<int>(kKeyCount) ? "writer" : std::to_string(requestId % 64);
+    op.RequestId = requestId;
+    sm.Apply(KvStateMachine::SerializeOp(op), ++index);
+  };
+  for (size_t i = 0; i < kKeyCount; i++) {
+    apply(i, static_cast<int>(i + 1));
+  }
+  Target target;
+  target.read = [&](size_t i, std::string *out) {
+    sm.IsDuplicateRequest(std::to_string(i % 64), static_cast<int>(i));
+    sm.Get(keyOf(i), out);
+  };
+  // 写线程用自己的 clientId，请求号递增，每条日志都真正写入
+  target.write = [&](size_t seq) { apply(seq * 7919 % kKeyCount, static_cast<int>(kKeyCount + seq)); };
+  for (int readers : {1, 2, 4, 8}) {
+    printRow(sharded ? "statemachine sharded x16" : "statemachine skiplist", readers,
+             run(target, readers, durationMs));
+  }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const int durationMs = argc > 1 ? std::atoi(argv[1]) : 1000;
+
+  // SkipList 的调试输出丢弃掉；多个线程同时打印，只能整体重定向 stdout
+  g_out = fdopen(dup(STDOUT_FILENO), "w");
+  if (g_out == nullptr || std::freopen("/dev/null", "w", stdout) == nullptr) {
+    std::perror("redirect stdout");
+    return 1;
+  }
+
+  std::fprintf(g_out, "keys=%zu value=64B, 1 writer + N readers, %d ms per row, hw threads=%u\n", kKeyCount,
+               durationMs, std::thread::hardware_concurrency());
+  std::fprintf(g_out, "%-28s %8s %14s %14s\n", "target", "readers", "read ops/s", "write ops/s");
+  benchEngine(false, durationMs);
+  benchEngine(true, durationMs);
+  benchStateMachine(false, durationMs);
+  benchStateMachine(true, durationMs);
+  return 0;
+}
@@ -0,0 +1,110 @@
+// storage_engine_bench.cpp - 存储引擎单机基准测试（不经过 Raft）
+//
+// 对比 SkipListStorageEngine / ArtStorageEngine / HashStorageEngine 的 Put / Get / Append 吞吐。
+// key 数按哈希表的目标负载（size / capacity）推算，观察负载升高后探测变长对哈希引擎的影响。
+//
+// 编译（在仓库根目录）：
+//   g++ -O2 -std=c++17 -I src/common/include -I src/skipList/include -I src/storage/include \
+//       所有测试/压测/storage_engine_bench.cpp src/storage/SwissTable.cpp src/storage/ArtTree.cpp \
+//       -lboost_serialization -o bin/storage_engine_bench
+// 运行：
+//   ./bin/storage_engine_bench [logCapacity]   # 默认 18，即哈希表容量 262144
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "ArtStorageEngine.h"
+#include "HashStorageEngine.h"
+#include "SkipListStorageEngine.h"
+
+namespace {
+
+struct BenchResult {
+  double putOps;
+  double getOps;
+  double appendOps;
+};
+
+double opsPerSec(size_t ops, std::chrono::steady_clock::time_point start) {
+  double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  return ops / sec;
+}
+
+BenchResult runBench(IStorageEngine *engine, const std::vector<std::string> &keys,
+                     const std::vector<size_t> &readOrder) {
+  BenchResult r{};
+  const std::string value(64, 'v');
+
+  auto start = std::chrono::steady_clock::now();
+  for (const auto &k : keys) {
+    engine->Put(k, value);
+  }
+  r.putOps = opsPerSec(keys.size(), start);
+
+  std::string out;
+  size_t hits = 0;
+  start = std::chrono::steady_clock::now();
+  for (size_t i : readOrder) {
+    hits += engine->Get(keys[i], &out) ? 1 : 0;
+  }
+  r.getOps = opsPerSec(readOrder.size(), start);
+  if (hits != readOrder.size()) {
+    std::cerr << "unexpected miss: " << hits << "/" << readOrder.size() << std::endl;
+  }
+
+  start = std::chrono::steady_clock::now();
+  for (size_t i : readOrder) {
+    engine->Append(keys[i], "x");
+  }
+  r.appendOps = opsPerSec(readOrder.size(), start);
+  return r;
+}
+
+void printRow(const std::string &name, const BenchResult &r) {
+  std::printf("%-22s %12.0f %12.0f %12.0f\n", name.c_str(), r.putOps, r.getOps, r.appendOps);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  // 哈希表容量固定为 2^logCapacity 时，按目标负载推算 key 数，让每一行都落在想要的负载上
+  const int logCapacity = argc > 1 ? std::atoi(argv[1]) : 18;
+  const size_t capacity = size_t(1) << logCapacity;
+
+  std::printf("hash capacity=%zu value=64B, each row runs all engines on the same keys\n", capacity);
+  std::printf("%-22s %12s %12s %12s\n", "engine", "put ops/s", "get ops/s", "append ops/s");
+
+  for (double targetLoad : {0.45, 0.6, 0.75, 0.86}) {
+    const size_t keyCount = static_cast<size_t>(capacity * targetLoad);
+    std::mt19937_64 rng(42);
+    std::vector<std::string> keys;
+    keys.reserve(keyCount);
+    for (size_t i = 0; i < keyCount; i++) {
+      keys.push_back("user:" + std::to_string(rng() % 100000000) + ":" + std::to_string(i));
+    }
+    std::vector<size_t> readOrder(keyCount);
+    for (size_t i = 0; i < keyCount; i++) readOrder[i] = rng() % keyCount;
+
+    SwissTable probe;  // 只用来确认实际负载
+    for (const auto &k : keys) probe.Upsert(k);
+    std::printf("-- keys=%zu, hash load %.2f\n", keyCount, static_cast<double>(probe.Size()) / probe.Capacity());
+
+    {
+      SkipListStorageEngine engine(18);
+      printRow("skiplist", runBench(&engine, keys, readOrder));
+    }
+    {
+      ArtStorageEngine engine;
+      printRow("art", runBench(&engine, keys, readOrder));
+    }
+    {
+      HashStorageEngine engine;
+      printRow("hash", runBench(&engine, keys, readOrder));
+    }
+  }
+  return 0;
+}